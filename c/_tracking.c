@@ -2,11 +2,56 @@
  * Data flow tracking via PyRefTracer + Frame Eval Hook.
  *
  * Architecture:
- *   - C stores EVERYTHING, no filtering
- *   - Hash table: obj_id → creation_info (with full traceback)
+ *   - C stores EVERYTHING unless a filter config is passed; start(sample_every=,
+ *     sample_interval_ns=, max_calls_per_code=) samples CALLs for always-on
+ *     use (sampling.h) — decided before any event is reserved
+ *   - start(include_paths=, exclude_paths=, include_types=) compiles
+ *     FilterConfig into a C-side matcher (filter.h), cached per code
+ *     object: filtered frames are never recorded
+ *   - Hash table: obj_id → creation info; tracebacks are ids into a shared
+ *     call-stack trie (stacks.h), full depth, memoized per frame
  *   - DESTROY event includes BOTH creation_ctx AND destruction_ctx
  *   - All errors captured with full exception info
- *   - Python does all filtering
+ *   - Strings INTERNED per session (StringTable), resolved once per code
+ *     object (co_extra cache) — no allocation per event
+ *   - Per-thread event buffers, merged by global sequence number in stop()
+ *     — no shared mutable state on the CALL/RETURN path (Py_MOD_GIL_NOT_USED)
+ *   - drain() streams completed events out while tracking, so traces need
+ *     not fit in RAM; stop() returns only what was not drained yet
+ *   - start(trace_path=...) writes events to a binary trace file instead
+ *     (tracefile.h): flush()/stop() write, no Python object per event
+ *   - start(aggregate=True) records no events at all: completed calls
+ *     bump per-thread (caller, callee) edge counters (edges.h), stop()
+ *     returns only the merged edges — memory O(distinct edges)
+ *   - start(profile=True) records no events either: each completed call
+ *     feeds its function's inclusive/exclusive latency histograms
+ *     (profile.h), timed with a cheap clock (clock.h) — memory
+ *     O(distinct functions)
+ *   - start(alloc_sites=True) records no events either: CREATE/DESTROY
+ *     only bump counters of their (creation stack, type) site (sites.h);
+ *     snapshot() reads the live-by-site table without stopping
+ *   - Every record carries the asyncio task running on its thread
+ *     (context_task_id(): one load from the thread state); start(tasks=True)
+ *     records no events and charges exclusive call time and object
+ *     creations/destructions to that task instead (tasks.h)
+ *   - start(backend="monitoring") observes frames through sys.monitoring
+ *     (PEP 669) callbacks instead of replacing the eval function; filtered
+ *     code returns DISABLE and runs at full speed after its first call.
+ *     Both backends make the same decisions and feed the same buffers
+ *   - start(shm_name=...) exports every published record to per-thread
+ *     shared-memory rings (shmring.h) read by a collector process
+ *     (shm_create()/shm_poll()); the traced process keeps no events and
+ *     stop() has nothing to serialize
+ *   - stats() reports the tracker itself while it runs: recorded and
+ *     dropped events, memory of every table, barrier contention and a
+ *     sampled estimate of time inside the hooks (stats.h)
+ *   - fork() pauses the session; the child starts a fresh one (its own
+ *     "<trace_path>.<pid>" file in trace file mode), nothing is inherited
+ *   - analyze_columns() filters a columnar result and builds its call
+ *     graph and object flow on row indices (analysis.h), GIL released,
+ *     optionally split over worker threads
+ *   - Filtering is optional and runs in C: only with a FilterConfig passed
+ *     to start() (or analyze_columns()); Python filters run after stop()
  *
  * Requires: Python 3.14+ (PyRefTracer API)
  */
@@ -17,59 +62,79 @@
 #include <frameobject.h>
 #include <string.h>
 #include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "internal/pycore_frame.h"
 #include "internal/pycore_interpframe_structs.h"
 #include "internal/pycore_stackref.h"
 #include "internal/pycore_ceval.h"
+#include "internal/pycore_genobject.h"
+#include "internal/pycore_tstate.h"
 
 #include "tracking/types.h"
-#include "tracking/memory.h"
 #include "tracking/errors.h"
 #include "tracking/hashtable.h"
+#include "tracking/store.h"
+#include "tracking/frame.h"
+#include "tracking/interning.h"
+#include "tracking/stacks.h"
+#include "tracking/codecache.h"
 #include "tracking/events.h"
 #include "tracking/output.h"
+#include "tracking/tracefile.h"
+#include "tracking/columns.h"
+#include "tracking/sampling.h"
+#include "tracking/filter.h"
+#include "tracking/edges.h"
+#include "tracking/clock.h"
+#include "tracking/profile.h"
+#include "tracking/sites.h"
+#include "tracking/tasks.h"
+#include "tracking/monitor.h"
+#include "tracking/shmring.h"
+#include "tracking/stats.h"
+#include "tracking/analysis.h"
 
 /* New module: thread-safe barrier for safe termination */
 #include "tracking/barrier.h"
 
-/* Execution context: thread_id, coro_id, timestamp_ns */
+/* Execution context: thread_id, coro_id, task_id, timestamp_ns */
 #include "tracking/context.h"
 
 /* ============================================================================
  * Python Runtime Context Implementation
  *
  * context_coro_id() and context_task_id() are declared in context.h
- * but require Python.h access, so implemented here.
+ * but require Python.h access, so implemented here. Both are one or two
+ * loads from the thread state: no Python call, no frame walk, safe in
+ * every hook.
  * ============================================================================ */
 
 uint64_t context_coro_id(void) {
-    PyThreadState *tstate = PyThreadState_Get();
-    if (tstate == nullptr) {
-        return 0;
-    }
-
-    _PyInterpreterFrame *frame = tstate->current_frame;
-    if (frame == nullptr) {
-        return 0;
-    }
-
-    _PyStackRef exec_ref = frame->f_executable;
-    if (PyStackRef_IsNull(exec_ref)) {
+    PyThreadState *tstate = PyThreadState_GetUnchecked();
+    _PyInterpreterFrame *frame = tstate ? tstate->current_frame : nullptr;
+    if (frame == nullptr || frame->owner != FRAME_OWNED_BY_GENERATOR) {
         return 0;
     }
 
-    PyObject *executable = PyStackRef_AsPyObjectBorrow(exec_ref);
-    if (PyCoro_CheckExact(executable) || PyAsyncGen_CheckExact(executable)) {
-        return (uint64_t)executable;
+    /* A generator's frame is embedded in it: the owner is at a fixed offset */
+    PyObject *gen = (PyObject *)_PyGen_GetGeneratorFromFrame(frame);
+    if (PyCoro_CheckExact(gen) || PyAsyncGen_CheckExact(gen)) {
+        return (uint64_t)(uintptr_t)gen;
     }
-
     return 0;
 }
 
 uint64_t context_task_id(void) {
-    /* Phase 5 stub: asyncio task tracking not implemented.
-     * Full implementation requires asyncio.current_task() C API. */
-    return 0;
+    /* _asyncio swaps the running task of this thread on every task step
+     * (enter_task/leave_task): the field is the per-thread cache, updated
+     * exactly when the task switches. Pure-Python tasks are not seen. */
+    PyThreadState *tstate = PyThreadState_GetUnchecked();
+    if (tstate == nullptr) {
+        return 0;
+    }
+    return (uint64_t)(uintptr_t)((_PyThreadStateImpl *)tstate)->asyncio_running_task;
 }
 
 /* ============================================================================
@@ -87,154 +152,727 @@ static inline PyObject* invoke_original_eval(
     return _PyEval_EvalFrameDefault(tstate, frame, throwflag);
 }
 
+/* Shared between threads (CREATE on one, DESTROY on another): mutex.
+ * Critical sections never call into Python. */
 static creation_map obj_creation_map;
-static __thread FrameInfo call_stack[MAX_STACK_DEPTH];
-static __thread int stack_depth = 0;
+static pthread_mutex_t creation_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * Lifecycle state. start()/stop() claim TRANSITION via CAS, so concurrent
+ * calls from several threads cannot interleave. Hooks record only in ACTIVE.
+ */
+typedef enum {
+    TRACKING_IDLE,
+    TRACKING_TRANSITION,
+    TRACKING_ACTIVE,
+} TrackingState;
+
+static _Atomic(int) tracking_state = TRACKING_IDLE;
+
+static inline bool tracking_active(void) {
+    return atomic_load_explicit(&tracking_state, memory_order_acquire) == TRACKING_ACTIVE;
+}
+
+/* Tracking session id: bumped by start(), 0 = never started.
+ * Interned pointers (events, call stacks, code cache) belong to one session. */
+static _Atomic(uint64_t) session_id = 0;
+static __thread uint64_t tl_stack_session = 0;
+
+/* Sampling: written only in TRANSITION, read-only while ACTIVE */
+static SamplingConfig sampling;
+static bool sampling_on = false;
+static __thread SamplerState tl_sampler;
+
+/* C-side filter: written only in TRANSITION, read-only while ACTIVE */
+static EventFilter event_filter;
+static bool filter_paths = false;       /* event_filter_has_paths() */
+static bool record_frames = true;       /* CALL or RETURN recorded */
+static bool record_objects = true;      /* CREATE or DESTROY recorded */
+static bool capture_args = true;        /* CALL records carry arguments */
+
+/* Backend: written only in TRANSITION. true = sys.monitoring callbacks
+ * (PEP 669) instead of the frame eval hook */
+static bool monitoring_on = false;
+
+/* Aggregate mode: written only in TRANSITION, read-only while ACTIVE */
+static bool aggregate_on = false;
+static bool aggregate_time = false;     /* Inclusive time per edge */
+
+/* Profile mode: written only in TRANSITION, read-only while ACTIVE */
+static bool profile_on = false;
+static ProfileClock profile_clock;
+
+/* Ticks spent in profiled callees of this thread's innermost profiled
+ * frame (a counter on that frame's C stack), nullptr outside one. Tasks
+ * mode counts ns of its timed callees the same way */
+static __thread uint64_t *tl_child_ticks = nullptr;
+
+/* Alloc-sites mode: sites_on written only in TRANSITION; site_table is
+ * shared between threads (CREATE on one, DESTROY on another) under
+ * creation_mutex, like obj_creation_map */
+static bool sites_on = false;
+static SiteTable *site_table = nullptr;
+
+/* Tasks mode: written only in TRANSITION, read-only while ACTIVE */
+static bool tasks_on = false;
+
+static inline uint64_t current_session(void) {
+    return atomic_load_explicit(&session_id, memory_order_acquire);
+}
 
-static Event *events = nullptr;
-static size_t events_count = 0;
-static size_t events_capacity = 0;
-static int tracking_active = 0;
+/**
+ * Drop frames (and sampler state) this thread kept from a previous session.
+ * Their interned strings died with that session's StringTable.
+ */
+static inline void sync_thread_stack(void) {
+    uint64_t session = current_session();
+    if (tl_stack_session != session) {
+        frame_stack_clear();
+        monitor_stack_clear();
+        tl_sampler = (SamplerState){0};
+        tl_stack_session = session;
+    }
+}
 
 /* ============================================================================
- * Event registry
+ * Per-thread event buffers
+ *
+ * Each thread appends to its own EventStore: no lock and no shared realloc
+ * on the hot path. A buffer is registered once per thread per session and
+ * owned by the registry, so events of exited threads survive until stop().
+ * Global order is rebuilt in drain()/stop() by merging on Event.seq.
+ *
+ * Streaming:
+ *   Records become visible to drain() when the thread leaves its outermost
+ *   barrier section (all its records are then complete). While a section
+ *   is open, open_seq holds a lower bound of the seqs it may still append;
+ *   drain() takes only seq < min(next_seq, every open_seq), so nothing it
+ *   returns can be followed by an older event later.
+ *   This needs the open_seq store to be visible before the seq taken after
+ *   it: with a relaxed fetch_add (reordered on ARM), drain() could read the
+ *   advanced next_seq next to a stale UINT64_MAX open_seq. The store and
+ *   the fetch_add are seq_cst, so they stay in program order.
  * ============================================================================ */
 
-static int ensure_events_capacity(size_t needed) {
-    if (events_count + needed <= events_capacity) {
-        return 1;
+typedef struct ThreadBuffer {
+    EventStore store;
+    _Atomic(uint64_t) open_seq;     /* UINT64_MAX when no section is open */
+    EdgeTable *edges;               /* Aggregate mode, created on first edge */
+    ProfileTable *profile;          /* Profile mode, created on first call */
+    TaskTable *tasks;               /* Tasks mode, created on first charge */
+    ShmProducer *shm;               /* Shared-memory mode, created on first export */
+    ThreadStats stats;              /* Written by the owning thread, read by stats() */
+    uint32_t index;                 /* Registration order in this session (Event.thread) */
+    struct ThreadBuffer *next;
+} ThreadBuffer;
+
+/* Registry: push under buffers_mutex, walked only when hooks are off */
+static ThreadBuffer *buffers = nullptr;
+static size_t buffers_count = 0;
+static pthread_mutex_t buffers_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Global order: one fetch_add per recorded event */
+static _Atomic(uint64_t) next_seq = 0;
+
+/* stats(): drops that have no ThreadBuffer to count on. Reset by start() */
+static _Atomic(uint64_t) dropped_no_buffer = 0;  /* Buffer allocation failed */
+static _Atomic(uint64_t) dropped_stopping = 0;   /* Hook fired while not ACTIVE */
+
+/* drain()/flush() callers: stores allow a single consumer */
+static pthread_mutex_t drain_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Trace file mode: set by start(), consumers write here instead of dicts.
+ * Written only in TRANSITION; trace_path owned (bytes, for OSError) */
+static bool trace_enabled = false;
+static TraceWriter trace_writer;
+static PyObject *trace_path = nullptr;
+
+/* Shared-memory mode: written only in TRANSITION. Published records go
+ * straight to the collector's rings (shmring.h) and are released */
+static bool shm_on = false;
+static ShmSegment shm_segment;
+
+/* tl_buffer is valid only while tl_buffer_session == session_id */
+static __thread ThreadBuffer *tl_buffer = nullptr;
+static __thread uint64_t tl_buffer_session = 0;
+
+/* Section state: records reserved since the outermost section_enter() */
+static __thread int tl_section_depth = 0;
+static __thread bool tl_open = false;
+
+/* Set while this thread drains: its own allocations are not recorded */
+static __thread bool tl_suppress = false;
+
+/* Hook time sampling (stats.h): outermost sections seen, start of the
+ * timed one (0 = this section is not timed) */
+static __thread uint32_t tl_section_tick = 0;
+static __thread uint64_t tl_section_start = 0;
+
+/**
+ * Get (or register) this thread's buffer for the current session.
+ * @return Buffer, or nullptr on OOM (caller drops event).
+ */
+static ThreadBuffer* thread_buffer(void) {
+    uint64_t session = current_session();
+    if (tl_buffer_session == session) {
+        return tl_buffer;
+    }
+
+    ThreadBuffer *buf = malloc(sizeof(ThreadBuffer));
+    if (!buf) {
+        return nullptr;
     }
+    event_store_init(&buf->store);
+    atomic_init(&buf->open_seq, UINT64_MAX);
+    buf->edges = nullptr;
+    buf->profile = nullptr;
+    buf->tasks = nullptr;
+    buf->shm = nullptr;
+    buf->stats = (ThreadStats){0};
+
+    pthread_mutex_lock(&buffers_mutex);
+    buf->index = (uint32_t)buffers_count;
+    buf->next = buffers;
+    buffers = buf;
+    buffers_count++;
+    pthread_mutex_unlock(&buffers_mutex);
+
+    tl_buffer = buf;
+    tl_buffer_session = session;
+    return buf;
+}
 
-    size_t new_capacity = events_capacity == 0
-        ? INITIAL_EVENTS_CAPACITY
-        : events_capacity * 2;
+/** A hook fired while starting, stopping or paused (fork): nothing recorded. */
+static void count_stopping(void) {
+    atomic_fetch_add_explicit(&dropped_stopping, 1, memory_order_relaxed);
+}
 
-    while (new_capacity < events_count + needed) {
-        new_capacity *= 2;
+/**
+ * Reserve a record of type in this thread's buffer and stamp its sequence
+ * number and running task. Counted in the buffer's stats (recorded or
+ * dropped).
+ * @return Zeroed record, or nullptr on OOM.
+ */
+static Event* reserve_event(EventType type, int max_args) {
+    ThreadBuffer *buf = thread_buffer();
+    if (!buf) {
+        atomic_fetch_add_explicit(&dropped_no_buffer, 1, memory_order_relaxed);
+        return nullptr;
+    }
+    if (!tl_open) {
+        /* Bound published BEFORE taking a seq (see Streaming above) */
+        atomic_store(&buf->open_seq, atomic_load(&next_seq));
+        tl_open = true;
+    }
+    Event *ev = event_store_reserve(&buf->store, max_args);
+    if (!ev) {
+        stats_add(&buf->stats.dropped_oom, 1);
+        return nullptr;
     }
+    ev->seq = atomic_fetch_add_explicit(&next_seq, 1, memory_order_seq_cst);
+    ev->thread = buf->index;
+    ev->task = context_task_id();
+    stats_add(&buf->stats.events[type], 1);
+    return ev;
+}
 
-    Event *new_events = realloc(events, new_capacity * sizeof(Event));
-    if (!new_events) {
-        return 0;
+/** Give back unused arg slots of a CALL record reserved on this thread. */
+static inline void commit_event(Event *ev) {
+    event_store_commit(&tl_buffer->store, ev);
+}
+
+/**
+ * Enter a barrier-protected recording section (nestable).
+ * @return false if stopping or this thread is draining (record nothing).
+ */
+[[nodiscard]]
+static inline bool section_enter(void) {
+    if (tl_suppress || !barrier_try_enter()) {
+        return false;
+    }
+    if (tl_section_depth++ == 0
+        && (++tl_section_tick & (STATS_HOOK_SAMPLE_EVERY - 1)) == 0) {
+        tl_section_start = context_timestamp_ns();
+    }
+    return true;
+}
+
+/**
+ * Shared-memory mode: move this thread's published records to its ring.
+ * Never waits: records that do not fit are dropped and counted there.
+ */
+static void shm_export(ThreadBuffer *buf) {
+    if (!buf->shm) {
+        buf->shm = shm_producer_new(&shm_segment);
     }
+    uint64_t thread_id = context_thread_id();
+    uint64_t now_ns = context_timestamp_ns();
+    Event *ev;
+    while ((ev = event_store_take(&buf->store))) {
+        RawEvent raw;
+        raw_event_from(&raw, ev, thread_id, now_ns);
+        if (buf->shm) {
+            (void)shm_producer_write(buf->shm, &raw);
+        } else {
+            /* OOM: no producer, counted with events of ring-less threads */
+            atomic_fetch_add_explicit(&shm_segment.header->unclaimed, 1, memory_order_relaxed);
+        }
+    }
+}
 
-    events = new_events;
-    events_capacity = new_capacity;
-    return 1;
+/** Timed section ends: charge its duration to this thread's stats. */
+static void time_section(void) {
+    ThreadBuffer *buf = thread_buffer();
+    if (buf) {
+        stats_add(&buf->stats.hook_ns, context_timestamp_ns() - tl_section_start);
+        stats_add(&buf->stats.hook_samples, 1);
+    }
+    tl_section_start = 0;
 }
 
-static void free_events(void) {
-    if (events) {
-        for (size_t i = 0; i < events_count; i++) {
-            Event *evt = &events[i];
-            free_frame_info(&evt->location);
-            free_frame_info(&evt->caller);
-            for (int j = 0; j < evt->arg_count; j++) {
-                free(evt->args[j].name_owned);
-                evt->args[j].name_owned = nullptr;
-            }
-            if (evt->creation_info) {
-                free(evt->creation_info);
-                evt->creation_info = nullptr;
-            }
+/** Leave section; the outermost leave publishes this thread's records. */
+static inline void section_leave(void) {
+    if (--tl_section_depth == 0 && tl_open) {
+        /* tl_open implies tl_buffer belongs to the current session:
+         * stop() cannot finish while this section is open */
+        event_store_publish(&tl_buffer->store);
+        atomic_store_explicit(&tl_buffer->stats.event_bytes, tl_buffer->store.bytes,
+                              memory_order_relaxed);
+        if (shm_on) {
+            shm_export(tl_buffer);
         }
-        free(events);
+        atomic_store(&tl_buffer->open_seq, UINT64_MAX);
+        tl_open = false;
+    }
+    if (tl_section_depth == 0 && tl_section_start != 0) {
+        time_section();
     }
-    events = nullptr;
-    events_count = 0;
-    events_capacity = 0;
+    barrier_leave();
+}
+
+/* ============================================================================
+ * Event registry
+ * ============================================================================ */
+
+/**
+ * Free all thread buffers.
+ * Records own nothing individually (errors live in the store's aux arena),
+ * so this is O(chunks), not O(events).
+ * Precondition: hooks disabled and barrier drained (no writers).
+ */
+static void free_events(void) {
+    ThreadBuffer *buf = buffers;
+    while (buf) {
+        ThreadBuffer *next = buf->next;
+        event_store_destroy(&buf->store);
+        edge_table_free(buf->edges);
+        profile_table_free(buf->profile);
+        task_table_free(buf->tasks);
+        shm_producer_free(buf->shm);
+        free(buf);
+        buf = next;
+    }
+    buffers = nullptr;
+    buffers_count = 0;
+    atomic_store_explicit(&next_seq, 0, memory_order_relaxed);
+    atomic_store_explicit(&dropped_no_buffer, 0, memory_order_relaxed);
+    atomic_store_explicit(&dropped_stopping, 0, memory_order_relaxed);
+}
+
+/**
+ * Release everything recorded in the current session.
+ * Bulk only: event chunks, aux/string arenas and trie chunks are unmapped
+ * block by block, the creation map is one bucket array — O(blocks).
+ */
+static void free_session(void) {
+    free_events();
+    pthread_mutex_lock(&creation_mutex);
+    vt_cleanup(&obj_creation_map);
+    site_table_free(site_table);
+    site_table = nullptr;
+    pthread_mutex_unlock(&creation_mutex);
+    stack_trie_destroy();
+    string_table_destroy();
 }
 
 /* ============================================================================
  * Frame Eval Hook
  * ============================================================================ */
 
+/**
+ * Sampling decision for a call whose code metadata is cached (sampling.h).
+ * @return true if the call is recorded.
+ */
+static inline bool sample_call(CodeMeta *meta) {
+    uint64_t now_ns = sampling.interval_ns > 0 ? context_timestamp_ns() : 0;
+    return sampler_thread_allows(&sampling, &tl_sampler, now_ns)
+        && sampler_code_allows(&sampling, &meta->fires);
+}
+
+/**
+ * Path filter result of a code object, evaluated once per session.
+ * Racing threads compute the same value: relaxed stores suffice.
+ */
+static inline bool code_traced(CodeMeta *meta) {
+    uint8_t match = atomic_load_explicit(&meta->match, memory_order_relaxed);
+    if (match == CODE_MATCH_UNKNOWN) {
+        match = (uint8_t)(event_filter_path(&event_filter, meta->location.file)
+                          ? CODE_MATCH_TRACED : CODE_MATCH_SKIPPED);
+        atomic_store_explicit(&meta->match, match, memory_order_relaxed);
+    }
+    return match == CODE_MATCH_TRACED;
+}
+
+/**
+ * Record CALL of code (unless CALL is filtered by type) and resolve its
+ * location. frame nullptr = arguments unknown (none recorded). Called
+ * inside a section.
+ * @return false on OOM (nothing recorded).
+ */
+static bool record_call(
+    PyCodeObject *code,
+    _PyInterpreterFrame *frame,
+    uint64_t session,
+    FrameInfo *location)
+{
+    if (!event_filter_type(&event_filter, EVENT_CALL)) {
+        *location = code_cache_lookup(code, session, nullptr)->location;
+        return true;
+    }
+
+    /* Trailing args sized for this code object (cached count on a hit) */
+    const CodeMeta *meta = code_cache_peek(code, session);
+    int arg_slots = !capture_args || !frame ? 0
+                  : meta ? meta->arg_count : call_arg_capacity(code);
+    Event *ev = reserve_event(EVENT_CALL, arg_slots);
+    if (!ev) {
+        return false;
+    }
+    if (meta == nullptr) {
+        meta = code_cache_lookup(code, session, ev);
+    }
+    fill_call_event(ev, meta, frame, frame_stack_top(), arg_slots);
+    commit_event(ev);
+    *location = ev->location;
+    return true;
+}
+
+/**
+ * Evaluate a frame skipped by the filter or sampling: neither CALL nor
+ * RETURN recorded. The frame still goes on the shadow stack, so callers
+ * and creation sites of recorded events stay exact. Called inside a
+ * section, leaves it.
+ */
+static PyObject* eval_skipped(
+    PyThreadState *tstate,
+    _PyInterpreterFrame *frame,
+    int throwflag,
+    const FrameInfo *location)
+{
+    size_t depth_before = frame_stack_depth();
+    frame_stack_push(location);
+    section_leave();
+
+    PyObject *result = invoke_original_eval(tstate, frame, throwflag);
+
+    if (frame_stack_depth() > depth_before) {
+        frame_stack_pop();
+    }
+    return result;
+}
+
+/**
+ * Count a completed call on its (caller, callee) edge in this thread's
+ * table. Called inside a section of call_session (checked by the caller).
+ */
+static void count_edge(const FrameInfo *caller, const FrameInfo *callee, uint64_t elapsed_ns) {
+    ThreadBuffer *buf = thread_buffer();
+    if (buf && !buf->edges) {
+        buf->edges = edge_table_new();
+    }
+    if (buf && buf->edges) {
+        /* OOM: call not counted, as a dropped event */
+        (void)edge_table_add(buf->edges, caller, callee, elapsed_ns);
+    }
+}
+
+/**
+ * Feed a completed call's inclusive/own ticks into its function's
+ * histograms in this thread's table. Called inside a section of
+ * call_session (checked by the caller).
+ */
+static void add_profiled_call(const FrameInfo *callee, uint64_t elapsed, uint64_t child_ticks) {
+    ThreadBuffer *buf = thread_buffer();
+    if (buf && !buf->profile) {
+        buf->profile = profile_table_new();
+    }
+    if (buf && buf->profile) {
+        uint64_t own = elapsed > child_ticks ? elapsed - child_ticks : 0;
+        /* OOM: call not recorded, as a dropped event */
+        (void)profile_table_add(buf->profile, callee,
+                                profile_clock_ticks_to_ns(&profile_clock, elapsed),
+                                profile_clock_ticks_to_ns(&profile_clock, own));
+    }
+}
+
+/**
+ * This thread's task table, created on first charge. Called inside a
+ * section of the current session.
+ * @return Table, or nullptr on OOM (charge dropped, as a dropped event).
+ */
+static TaskTable* thread_tasks(void) {
+    ThreadBuffer *buf = thread_buffer();
+    if (buf && !buf->tasks) {
+        buf->tasks = task_table_new();
+    }
+    return buf ? buf->tasks : nullptr;
+}
+
+/**
+ * Charge a completed call's exclusive time to task in this thread's
+ * table. Called inside a section of call_session (checked by the caller).
+ */
+static void add_task_call(uint64_t task, uint64_t elapsed_ns, uint64_t child_ns) {
+    TaskTable *tasks = thread_tasks();
+    if (tasks) {
+        uint64_t own_ns = elapsed_ns > child_ns ? elapsed_ns - child_ns : 0;
+        /* OOM: call not counted, as a dropped event */
+        (void)task_table_add_call(tasks, task, own_ns);
+    }
+}
+
+/**
+ * Evaluate a frame in aggregate mode: no record, the completed call is
+ * counted on its (caller, callee) edge in this thread's table. Called
+ * inside a section, leaves it.
+ */
+static PyObject* eval_aggregated(
+    PyThreadState *tstate,
+    _PyInterpreterFrame *frame,
+    int throwflag,
+    PyCodeObject *code,
+    uint64_t call_session)
+{
+    /* Caller copied BEFORE original_eval: a new session clears the stack meanwhile */
+    const FrameInfo *top = frame_stack_top();
+    FrameInfo caller = top ? *top : FRAME_NO_CALLER;
+    FrameInfo callee = code_cache_lookup(code, call_session, nullptr)->location;
+
+    size_t depth_before = frame_stack_depth();
+    frame_stack_push(&callee);
+    section_leave();
+
+    uint64_t start_ns = aggregate_time ? context_timestamp_ns() : 0;
+    PyObject *result = invoke_original_eval(tstate, frame, throwflag);
+    uint64_t elapsed_ns = aggregate_time ? context_timestamp_ns() - start_ns : 0;
+
+    if (frame_stack_depth() > depth_before) {
+        frame_stack_pop();
+    }
+
+    /* Counted at RETURN, as AnalyzerService.build_call_graph() */
+    if (!section_enter()) {
+        return result;
+    }
+    if (!tracking_active() || current_session() != call_session) {
+        section_leave();
+        return result;
+    }
+    count_edge(&caller, &callee, elapsed_ns);
+    section_leave();
+    return result;
+}
+
+/**
+ * Evaluate a frame in profile mode: no record, the completed call's
+ * inclusive and exclusive time go into its function's histograms in this
+ * thread's table. Exclusive time excludes profiled callees only, which
+ * report their inclusive time to tl_child_ticks. Called inside a section,
+ * leaves it.
+ */
+static PyObject* eval_profiled(
+    PyThreadState *tstate,
+    _PyInterpreterFrame *frame,
+    int throwflag,
+    PyCodeObject *code,
+    uint64_t call_session)
+{
+    /* Location copied BEFORE original_eval: stop() frees the metadata meanwhile */
+    FrameInfo callee = code_cache_lookup(code, call_session, nullptr)->location;
+    section_leave();
+
+    uint64_t child_ticks = 0;
+    uint64_t *parent_ticks = tl_child_ticks;
+    tl_child_ticks = &child_ticks;
+
+    uint64_t start = profile_clock_now(&profile_clock);
+    PyObject *result = invoke_original_eval(tstate, frame, throwflag);
+    uint64_t end = profile_clock_now(&profile_clock);
+
+    uint64_t elapsed = end > start ? end - start : 0;
+    tl_child_ticks = parent_ticks;
+    if (parent_ticks) {
+        *parent_ticks += elapsed;
+    }
+
+    if (!section_enter()) {
+        return result;
+    }
+    if (!tracking_active() || current_session() != call_session) {
+        section_leave();
+        return result;
+    }
+    add_profiled_call(&callee, elapsed, child_ticks);
+    section_leave();
+    return result;
+}
+
+/**
+ * Evaluate a frame in tasks mode: no record, the completed call's
+ * exclusive time is charged to the asyncio task running when it started
+ * (a coroutine frame runs within one task step). Callees report their
+ * inclusive time to tl_child_ticks, as in eval_profiled. Called inside a
+ * section, leaves it.
+ */
+static PyObject* eval_tasked(
+    PyThreadState *tstate,
+    _PyInterpreterFrame *frame,
+    int throwflag,
+    uint64_t call_session)
+{
+    uint64_t task = context_task_id();
+    section_leave();
+
+    uint64_t child_ns = 0;
+    uint64_t *parent_ns = tl_child_ticks;
+    tl_child_ticks = &child_ns;
+
+    uint64_t start_ns = context_timestamp_ns();
+    PyObject *result = invoke_original_eval(tstate, frame, throwflag);
+    uint64_t elapsed_ns = context_timestamp_ns() - start_ns;
+
+    tl_child_ticks = parent_ns;
+    if (parent_ns) {
+        *parent_ns += elapsed_ns;
+    }
+
+    if (!section_enter()) {
+        return result;
+    }
+    if (!tracking_active() || current_session() != call_session) {
+        section_leave();
+        return result;
+    }
+    add_task_call(task, elapsed_ns, child_ns);
+    section_leave();
+    return result;
+}
+
 static PyObject* tracking_frame_evaluator(
     PyThreadState *tstate,
     _PyInterpreterFrame *frame,
     int throwflag)
 {
-    if (!tracking_active) {
+    if (!tracking_active()) {
+        count_stopping();
         goto call_original;
     }
 
     /* CRITICAL: Enter barrier-protected section.
      * This prevents use-after-free when py_stop() called during eval. */
-    if (!barrier_try_enter()) {
+    if (!section_enter()) {
         goto call_original;  /* Stopping, skip tracking */
     }
 
     /* Get code object */
     _PyStackRef exec_ref = frame->f_executable;
     if (PyStackRef_IsNull(exec_ref)) {
-        barrier_leave();
+        section_leave();
         goto call_original;
     }
     PyObject *executable = PyStackRef_AsPyObjectBorrow(exec_ref);
     if (!PyCode_Check(executable)) {
-        barrier_leave();
+        section_leave();
         goto call_original;
     }
     PyCodeObject *code = (PyCodeObject *)executable;
+    sync_thread_stack();
+    uint64_t call_session = current_session();
+
+    /* C-side filter: decided once per code object, before any record */
+    if (!record_frames || filter_paths) {
+        CodeMeta *meta = code_cache_lookup(code, call_session, nullptr);
+        if (!record_frames || !code_traced(meta)) {
+            return eval_skipped(tstate, frame, throwflag, &meta->location);
+        }
+    }
 
-    /* Ensure space for CALL + RETURN */
-    if (!ensure_events_capacity(2)) {
-        barrier_leave();
-        goto call_original;
+    /* Sampling: decided before any record is reserved. A cache miss is
+     * always recorded (it fills the metadata a skipped call pushes). */
+    if (sampling_on) {
+        CodeMeta *cached = code_cache_peek(code, call_session);
+        if (cached != nullptr && !sample_call(cached)) {
+            return eval_skipped(tstate, frame, throwflag, &cached->location);
+        }
     }
 
-    /* Record CALL event */
-    Event *call_event = &events[events_count++];
-    memset(call_event, 0, sizeof(Event));
-    const FrameInfo *caller = stack_depth > 0 ? &call_stack[stack_depth - 1] : nullptr;
-    fill_call_event(call_event, code, frame, caller);
+    if (aggregate_on) {
+        return eval_aggregated(tstate, frame, throwflag, code, call_session);
+    }
+    if (profile_on) {
+        return eval_profiled(tstate, frame, throwflag, code, call_session);
+    }
+    if (tasks_on) {
+        return eval_tasked(tstate, frame, throwflag, call_session);
+    }
 
-    /* Push to call stack */
-    if (stack_depth < MAX_STACK_DEPTH) {
-        call_stack[stack_depth] = call_event->location;
-        stack_depth++;
+    /* Record CALL event. Location saved locally BEFORE original_eval:
+     * records never move, but stop() during original_eval frees them. */
+    FrameInfo saved_location;
+    if (!record_call(code, frame, call_session, &saved_location)) {
+        section_leave();
+        goto call_original;
     }
 
-    /* Save location locally BEFORE original_eval.
-     * After original_eval events may be realloc'd or freed. */
-    FrameInfo saved_location = call_event->location;
+    /* Push to call stack (no depth limit) */
+    size_t depth_before = frame_stack_depth();
+    frame_stack_push(&saved_location);
 
     /* Leave barrier before calling original eval (allows nested calls).
      * Re-enter after to record RETURN event. */
-    barrier_leave();
+    section_leave();
 
     /* Call original evaluator (may be long-running, allows py_stop()) */
     PyObject *result = invoke_original_eval(tstate, frame, throwflag);
 
-    /* Pop from call stack */
-    if (stack_depth > 0) {
-        stack_depth--;
+    /* Pop own frame, unless a new session cleared the stack meanwhile */
+    if (frame_stack_depth() > depth_before) {
+        frame_stack_pop();
     }
 
     /* Re-enter barrier for RETURN event */
-    if (!barrier_try_enter()) {
+    if (!section_enter()) {
         /* Stopping during eval, skip RETURN event */
         return result;
     }
 
-    /* Safety: stop() may have been called during original_eval. */
-    if (!tracking_active || !events) {
-        barrier_leave();
+    /* Safety: stop() (and maybe a new start()) during original_eval.
+     * saved_location is interned in call_session's StringTable. */
+    if (!tracking_active() || current_session() != call_session) {
+        section_leave();
         return result;
     }
 
-    /* Re-check capacity (nested calls may have consumed it) */
-    if (!ensure_events_capacity(1)) {
-        barrier_leave();
+    /* Record RETURN event (unless filtered by type) */
+    Event *ret_event = event_filter_type(&event_filter, EVENT_RETURN)
+                              ? reserve_event(EVENT_RETURN, 0) : nullptr;
+    if (!ret_event) {
+        section_leave();
         return result;
     }
-
-    /* Record RETURN event */
-    Event *ret_event = &events[events_count++];
-    memset(ret_event, 0, sizeof(Event));
     fill_return_event(ret_event, &saved_location, result);
 
-    barrier_leave();
+    section_leave();
     return result;
 
 call_original:
@@ -242,257 +880,2291 @@ call_original:
 }
 
 /* ============================================================================
- * PyRefTracer handlers (separated for single responsibility)
+ * sys.monitoring backend (PEP 669)
+ *
+ * start(backend="monitoring") registers C callbacks (vectorcall
+ * PyCFunctions) for the start of a frame (PY_START, PY_RESUME, PY_THROW)
+ * and its end (PY_RETURN, PY_YIELD, PY_UNWIND) instead of replacing the
+ * eval function: every frame keeps CPython's own (specializing) evaluator.
+ * Same decisions as tracking_frame_evaluator; the per-call state it keeps
+ * on the C stack around the evaluation goes on the monitor stack
+ * (monitor.h). Each callback is one short section.
+ *
+ * Filtered code returns DISABLE from its start and return callbacks: its
+ * locations stop firing for the rest of the session and run at full speed
+ * (start() calls restart_events() to re-arm them). Such frames are not on
+ * the shadow stack, so callers and creation stacks name the nearest
+ * traced frame instead of the filtered one.
  * ============================================================================ */
 
+static PyObject *monitoring_disable = nullptr;  /* sys.monitoring.DISABLE (owned) */
+static int monitoring_tool = -1;                /* Tool id held, -1 = none */
+
 /**
- * Handle object creation: store in hash table and record event.
+ * Identity of the frame a callback fires for: the interpreter frame
+ * (never dereferenced later), or the code object if the current frame is
+ * not one of code. Start and end of one frame compute the same key.
  */
-static void handle_ref_create(uintptr_t obj_id, const char *type_name) {
-    /* Store creation info in hash table */
-    CreationInfo empty_info = {0};
-    creation_map_itr itr = vt_insert(&obj_creation_map, obj_id, empty_info);
-
-    if (!vt_is_end(itr)) {
-        CreationInfo *info = &itr.data->val;
-        info->type_name_ref = type_name;
-
-        if (stack_depth > 0) {
-            info->location = call_stack[stack_depth - 1];
+static const void* monitor_frame_key(PyCodeObject *code, _PyInterpreterFrame **frame) {
+    PyThreadState *tstate = PyThreadState_GetUnchecked();
+    _PyInterpreterFrame *current = tstate ? tstate->current_frame : nullptr;
+    bool own = current != nullptr && !PyStackRef_IsNull(current->f_executable)
+            && PyStackRef_AsPyObjectBorrow(current->f_executable) == (PyObject *)code;
+    *frame = own ? current : nullptr;
+    return own ? (const void *)current : (const void *)code;
+}
 
-            /* Capture full traceback */
-            int depth = stack_depth < MAX_TRACEBACK_DEPTH ? stack_depth : MAX_TRACEBACK_DEPTH;
-            info->traceback_depth = depth;
-            for (int i = 0; i < depth; i++) {
-                info->traceback[i] = call_stack[stack_depth - 1 - i];
-            }
-        }
+/** Open a monitor entry (and its shadow frame, except in profile/tasks mode). */
+static MonitorEntry* monitor_open(const void *key, MonitorKind kind,
+                                  const FrameInfo *location, uint64_t session) {
+    size_t depth_before = frame_stack_depth();
+    if (kind != MONITOR_PROFILED && kind != MONITOR_TASKED) {
+        frame_stack_push(location);     /* As eval_profiled: no shadow frame */
     }
+    MonitorEntry *entry = monitor_stack_push();
+    entry->code = key;
+    entry->kind = kind;
+    entry->location = *location;
+    entry->session = session;
+    entry->depth_before = depth_before;
+    return entry;
+}
 
-    /* Record CREATE event */
-    if (!ensure_events_capacity(1)) {
+/**
+ * Decide and open the frame: skipped, aggregated, profiled, tasked or
+ * recorded. Called inside a section, past the path filter.
+ */
+static void monitor_open_traced(PyCodeObject *code, uint64_t session) {
+    _PyInterpreterFrame *frame = nullptr;
+    const void *key = monitor_frame_key(code, &frame);
+
+    CodeMeta *cached = sampling_on ? code_cache_peek(code, session) : nullptr;
+    if (!record_frames || (cached != nullptr && !sample_call(cached))) {
+        const CodeMeta *meta = cached ? cached : code_cache_lookup(code, session, nullptr);
+        (void)monitor_open(key, MONITOR_SKIPPED, &meta->location, session);
         return;
     }
-
-    Event *ev = &events[events_count++];
-    memset(ev, 0, sizeof(Event));
-    fill_create_event(ev, obj_id, type_name, call_stack, stack_depth);
+    if (aggregate_on || profile_on) {
+        const FrameInfo *top = frame_stack_top();
+        FrameInfo caller = top ? *top : FRAME_NO_CALLER;
+        FrameInfo callee = code_cache_lookup(code, session, nullptr)->location;
+        MonitorKind kind = aggregate_on ? MONITOR_AGGREGATED : MONITOR_PROFILED;
+        MonitorEntry *entry = monitor_open(key, kind, &callee, session);
+        entry->caller = caller;
+        entry->start = profile_on ? profile_clock_now(&profile_clock)
+                     : aggregate_time ? context_timestamp_ns() : 0;
+        return;
+    }
+    if (tasks_on) {
+        FrameInfo callee = code_cache_lookup(code, session, nullptr)->location;
+        MonitorEntry *entry = monitor_open(key, MONITOR_TASKED, &callee, session);
+        entry->task = context_task_id();
+        entry->start = context_timestamp_ns();
+        return;
+    }
+    FrameInfo location;
+    if (record_call(code, frame, session, &location)) {
+        (void)monitor_open(key, MONITOR_RECORDED, &location, session);
+    }
 }
 
 /**
- * Handle object destruction: lookup creation, record event, cleanup.
+ * Start of a frame (PY_START, PY_RESUME, PY_THROW).
+ * @return new ref: DISABLE for code excluded by the path filter, else None.
  */
-static void handle_ref_destroy(uintptr_t obj_id, const char *type_name) {
-    /* Lookup creation info */
-    creation_map_itr itr = vt_get(&obj_creation_map, obj_id);
-    CreationInfo *creation_info = vt_is_end(itr) ? nullptr : &itr.data->val;
-
-    /* Copy creation info to heap BEFORE erasing hash table entry */
-    CreationInfo *creation_copy = nullptr;
-    if (creation_info) {
-        creation_copy = malloc(sizeof(CreationInfo));
-        if (creation_copy) {
-            *creation_copy = *creation_info;
-        }
+static PyObject* monitor_frame_start(PyCodeObject *code) {
+    if (!tracking_active()) {
+        count_stopping();
+        Py_RETURN_NONE;
     }
-
-    /* Record DESTROY event */
-    if (ensure_events_capacity(1)) {
-        Event *ev = &events[events_count++];
-        memset(ev, 0, sizeof(Event));
-        fill_destroy_event(ev, obj_id, type_name, call_stack, stack_depth, creation_copy);
-    } else if (creation_copy) {
-        free(creation_copy);
+    if (!section_enter()) {
+        Py_RETURN_NONE;
     }
+    sync_thread_stack();
+    uint64_t session = current_session();
 
-    /* Remove from hash table */
-    if (!vt_is_end(itr)) {
-        vt_erase_itr(&obj_creation_map, itr);
+    /* Path filter: decided once per code object, then the location is off */
+    if (filter_paths && !code_traced(code_cache_lookup(code, session, nullptr))) {
+        section_leave();
+        return Py_NewRef(monitoring_disable);
     }
+    monitor_open_traced(code, session);
+    section_leave();
+    Py_RETURN_NONE;
 }
 
-/* ============================================================================
- * PyRefTracer callback
- * ============================================================================ */
+/**
+ * Add a closed entry's inclusive time to the child time of the nearest
+ * open entry of the same kind (profile: ticks, tasks: ns).
+ */
+static void monitor_charge_parent(MonitorKind kind, uint64_t elapsed) {
+    for (size_t n = 0; n < monitor_stack_depth(); n++) {
+        MonitorEntry *parent = monitor_stack_peek(n);
+        if (parent->kind == kind) {
+            parent->child_ticks += elapsed;
+            return;
+        }
+    }
+}
 
-static int ref_tracer_callback(PyObject *obj, PyRefTracerEvent event, void *data) {
-    (void)data;
+/** Close a matched entry: RETURN event, edge count, histograms or task charge. */
+static void monitor_close(const MonitorEntry *entry, PyObject *result) {
+    if (entry->kind == MONITOR_RECORDED && event_filter_type(&event_filter, EVENT_RETURN)) {
+        Event *ret_event = reserve_event(EVENT_RETURN, 0);
+        if (ret_event) {
+            fill_return_event(ret_event, &entry->location, result);
+        }
+    } else if (entry->kind == MONITOR_AGGREGATED) {
+        uint64_t elapsed_ns = aggregate_time ? context_timestamp_ns() - entry->start : 0;
+        count_edge(&entry->caller, &entry->location, elapsed_ns);
+    } else if (entry->kind == MONITOR_PROFILED) {
+        uint64_t end = profile_clock_now(&profile_clock);
+        uint64_t elapsed = end > entry->start ? end - entry->start : 0;
+        /* Inclusive time counts as child time of the nearest profiled caller */
+        monitor_charge_parent(MONITOR_PROFILED, elapsed);
+        add_profiled_call(&entry->location, elapsed, entry->child_ticks);
+    } else if (entry->kind == MONITOR_TASKED) {
+        uint64_t elapsed_ns = context_timestamp_ns() - entry->start;
+        monitor_charge_parent(MONITOR_TASKED, elapsed_ns);
+        add_task_call(entry->task, elapsed_ns, entry->child_ticks);
+    }
+}
 
-    if (!tracking_active) {
-        return 0;
+/**
+ * End of a frame (PY_RETURN, PY_YIELD: result = value; PY_UNWIND: nullptr).
+ * An end without a matching start (frame began before start(), or was
+ * filtered) is ignored.
+ * @return new ref: DISABLE for filtered code if can_disable, else None.
+ */
+static PyObject* monitor_frame_end(PyCodeObject *code, PyObject *result, bool can_disable) {
+    if (!tracking_active() || !section_enter()) {
+        Py_RETURN_NONE;
+    }
+    sync_thread_stack();
+    _PyInterpreterFrame *frame = nullptr;
+    const void *key = monitor_frame_key(code, &frame);
+
+    MonitorEntry *top = monitor_stack_peek(0);
+    if (top == nullptr || top->code != key) {
+        bool disable = can_disable && filter_paths
+                    && !code_traced(code_cache_lookup(code, current_session(), nullptr));
+        section_leave();
+        return disable ? Py_NewRef(monitoring_disable) : Py_NewRef(Py_None);
     }
 
-    /* Enter barrier-protected section */
-    if (!barrier_try_enter()) {
-        return 0;  /* Stopping, skip tracking */
+    MonitorEntry entry = *top;
+    monitor_stack_pop();
+    if (frame_stack_depth() > entry.depth_before) {
+        frame_stack_pop();
     }
+    monitor_close(&entry, result);
+    section_leave();
+    Py_RETURN_NONE;
+}
 
-    uintptr_t obj_id = (uintptr_t)obj;
-    const char *type_name = Py_TYPE(obj)->tp_name;
+/* Callback signatures: (code, instruction_offset[, value]) */
+
+static PyObject* monitor_on_start(PyObject *self, PyObject *const *args, Py_ssize_t nargs) {
+    (void)self;
+    if (nargs < 1 || !PyCode_Check(args[0])) {
+        Py_RETURN_NONE;
+    }
+    return monitor_frame_start((PyCodeObject *)args[0]);
+}
+
+static PyObject* monitor_on_return(PyObject *self, PyObject *const *args, Py_ssize_t nargs) {
+    (void)self;
+    if (nargs < 3 || !PyCode_Check(args[0])) {
+        Py_RETURN_NONE;
+    }
+    return monitor_frame_end((PyCodeObject *)args[0], args[2], true);
+}
+
+static PyObject* monitor_on_unwind(PyObject *self, PyObject *const *args, Py_ssize_t nargs) {
+    (void)self;
+    if (nargs < 1 || !PyCode_Check(args[0])) {
+        Py_RETURN_NONE;
+    }
+    /* PY_UNWIND cannot be disabled: returning DISABLE would raise */
+    return monitor_frame_end((PyCodeObject *)args[0], nullptr, false);
+}
+
+static PyMethodDef monitor_start_def = {
+    "_monitor_start", (PyCFunction)(void(*)(void))monitor_on_start, METH_FASTCALL, nullptr};
+static PyMethodDef monitor_return_def = {
+    "_monitor_return", (PyCFunction)(void(*)(void))monitor_on_return, METH_FASTCALL, nullptr};
+static PyMethodDef monitor_unwind_def = {
+    "_monitor_unwind", (PyCFunction)(void(*)(void))monitor_on_unwind, METH_FASTCALL, nullptr};
+
+static const struct {
+    const char *event;      /* sys.monitoring.events attribute */
+    PyMethodDef *def;
+} MONITOR_CALLBACKS[] = {
+    {"PY_START", &monitor_start_def},
+    {"PY_RESUME", &monitor_start_def},
+    {"PY_THROW", &monitor_start_def},
+    {"PY_RETURN", &monitor_return_def},
+    {"PY_YIELD", &monitor_return_def},
+    {"PY_UNWIND", &monitor_unwind_def},
+};
+
+/**
+ * Register every MONITOR_CALLBACKS entry for tool and enable their events.
+ * @return false with an exception set.
+ */
+static bool monitoring_register(PyObject *monitoring, int tool) {
+    PyObject *events = PyObject_GetAttrString(monitoring, "events");
+    if (!events) {
+        return false;
+    }
+    long mask = 0;
+    bool ok = true;
+    for (size_t i = 0; ok && i < sizeof(MONITOR_CALLBACKS) / sizeof(MONITOR_CALLBACKS[0]); i++) {
+        PyObject *bit = PyObject_GetAttrString(events, MONITOR_CALLBACKS[i].event);
+        PyObject *callback = bit ? PyCFunction_New(MONITOR_CALLBACKS[i].def, nullptr) : nullptr;
+        PyObject *previous = callback
+            ? PyObject_CallMethod(monitoring, "register_callback", "iOO", tool, bit, callback)
+            : nullptr;
+        ok = previous != nullptr;
+        mask |= ok ? PyLong_AsLong(bit) : 0;
+        Py_XDECREF(previous);
+        Py_XDECREF(callback);
+        Py_XDECREF(bit);
+    }
+    Py_DECREF(events);
+    PyObject *set = ok ? PyObject_CallMethod(monitoring, "set_events", "il", tool, mask) : nullptr;
+    Py_XDECREF(set);
+    return set != nullptr;
+}
+
+/**
+ * Take sys.monitoring.PROFILER_ID and install the callbacks.
+ * Precondition: TRANSITION (callbacks firing meanwhile return at once).
+ * @return false with an exception set (ValueError if the id is in use).
+ */
+static bool monitoring_install(void) {
+    PyObject *monitoring = PySys_GetObject("monitoring");  /* Borrowed */
+    if (!monitoring) {
+        PyErr_SetString(PyExc_RuntimeError, "sys.monitoring is not available");
+        return false;
+    }
+    PyObject *tool_obj = PyObject_GetAttrString(monitoring, "PROFILER_ID");
+    int tool = tool_obj ? PyLong_AsInt(tool_obj) : -1;
+    Py_XDECREF(tool_obj);
+    PyObject *disable = PyErr_Occurred() ? nullptr : PyObject_GetAttrString(monitoring, "DISABLE");
+    PyObject *held = disable
+        ? PyObject_CallMethod(monitoring, "use_tool_id", "is", tool, "archcheck")
+        : nullptr;
+    if (!held) {
+        Py_XDECREF(disable);
+        return false;
+    }
+    Py_DECREF(held);
+
+    /* Re-arm locations a previous session disabled */
+    PyObject *restarted = PyObject_CallMethod(monitoring, "restart_events", nullptr);
+    Py_XDECREF(restarted);
+    if (!restarted || !monitoring_register(monitoring, tool)) {
+        PyObject *exc = PyErr_GetRaisedException();
+        PyObject *freed = PyObject_CallMethod(monitoring, "free_tool_id", "i", tool);
+        Py_XDECREF(freed);
+        PyErr_SetRaisedException(exc);
+        Py_DECREF(disable);
+        return false;
+    }
+    monitoring_disable = disable;
+    monitoring_tool = tool;
+    return true;
+}
+
+/**
+ * Release the tool id (free_tool_id() also unregisters its callbacks and
+ * events). A failure is reported as unraisable: stop() still returns.
+ */
+static void monitoring_remove(void) {
+    PyObject *monitoring = PySys_GetObject("monitoring");  /* Borrowed */
+    PyObject *freed = monitoring
+        ? PyObject_CallMethod(monitoring, "free_tool_id", "i", monitoring_tool)
+        : nullptr;
+    if (!freed && PyErr_Occurred()) {
+        PyErr_WriteUnraisable(nullptr);
+    }
+    Py_XDECREF(freed);
+    Py_CLEAR(monitoring_disable);
+    monitoring_tool = -1;
+}
+
+/* ============================================================================
+ * PyRefTracer handlers (separated for single responsibility)
+ * ============================================================================ */
+
+/**
+ * Handle object creation: store in hash table and record event.
+ */
+static void handle_ref_create(uintptr_t obj_id, const char *type_name) {
+    /* Creation stack from this thread's frames (trie hit: lock-free) */
+    CreationInfo info = {.stack = stack_trie_current(), .type_name_ref = type_name};
+    const FrameInfo *current = frame_stack_top();
+
+    /* Store creation info in hash table (shared across threads) */
+    pthread_mutex_lock(&creation_mutex);
+    (void)vt_insert(&obj_creation_map, obj_id, info);
+    pthread_mutex_unlock(&creation_mutex);
+
+    /* Record CREATE event (unless filtered by type: info above still
+     * feeds DESTROY creation context) */
+    Event *ev = event_filter_type(&event_filter, EVENT_CREATE)
+                       ? reserve_event(EVENT_CREATE, 0) : nullptr;
+    if (!ev) {
+        return;
+    }
+    fill_create_event(ev, obj_id, type_name, current);
+}
+
+/**
+ * Handle object destruction: lookup creation, record event, cleanup.
+ */
+static void handle_ref_destroy(uintptr_t obj_id, const char *type_name) {
+    /* Take creation info out of hash table (copied by value BEFORE erasing).
+     * Erased even if DESTROY is filtered by type: ids are reused. */
+    CreationInfo creation;
+    bool found = false;
+
+    pthread_mutex_lock(&creation_mutex);
+    creation_map_itr itr = vt_get(&obj_creation_map, obj_id);
+    if (!vt_is_end(itr)) {
+        creation = itr.data->val;
+        found = true;
+        vt_erase_itr(&obj_creation_map, itr);
+    }
+    pthread_mutex_unlock(&creation_mutex);
+
+    /* Record DESTROY event */
+    Event *ev = event_filter_type(&event_filter, EVENT_DESTROY)
+                       ? reserve_event(EVENT_DESTROY, 0) : nullptr;
+    if (ev) {
+        fill_destroy_event(ev, obj_id, type_name, frame_stack_top(), found ? &creation : nullptr);
+    }
+}
+
+/**
+ * Alloc-sites mode: count the object on its (creation stack, type) site.
+ * No record; OOM leaves the object untracked.
+ */
+static void handle_site_create(uintptr_t obj_id, const char *type_name) {
+    StackId stack = stack_trie_current();
+    uint64_t now_ns = context_timestamp_ns();
+
+    pthread_mutex_lock(&creation_mutex);
+    (void)site_table_create(site_table, obj_id, stack, type_name, now_ns);
+    pthread_mutex_unlock(&creation_mutex);
+}
+
+/** Alloc-sites mode: count the destruction on the object's site. */
+static void handle_site_destroy(uintptr_t obj_id) {
+    uint64_t now_ns = context_timestamp_ns();
+
+    pthread_mutex_lock(&creation_mutex);
+    (void)site_table_destroy(site_table, obj_id, now_ns);
+    pthread_mutex_unlock(&creation_mutex);
+}
+
+/**
+ * Tasks mode: charge the creation or destruction to this thread's running
+ * task. No record; OOM leaves the object uncounted.
+ */
+static void handle_task_object(bool created) {
+    TaskTable *tasks = thread_tasks();
+    if (tasks) {
+        (void)task_table_add_object(tasks, context_task_id(), created);
+    }
+}
+
+/* ============================================================================
+ * PyRefTracer callback
+ * ============================================================================ */
+
+static int ref_tracer_callback(PyObject *obj, PyRefTracerEvent event, void *data) {
+    (void)data;
+
+    if (!tracking_active()) {
+        count_stopping();
+        return 0;
+    }
+    if (!record_objects) {
+        return 0;
+    }
+
+    /* Enter barrier-protected section */
+    if (!section_enter()) {
+        return 0;  /* Stopping, skip tracking */
+    }
+
+    uintptr_t obj_id = (uintptr_t)obj;
+    const char *type_name = Py_TYPE(obj)->tp_name;
+    sync_thread_stack();
 
     switch (event) {
         case PyRefTracer_CREATE:
-            handle_ref_create(obj_id, type_name);
+            if (tasks_on) {
+                handle_task_object(true);
+            } else if (sites_on) {
+                handle_site_create(obj_id, type_name);
+            } else {
+                handle_ref_create(obj_id, type_name);
+            }
             break;
         case PyRefTracer_DESTROY:
-            handle_ref_destroy(obj_id, type_name);
+            if (tasks_on) {
+                handle_task_object(false);
+            } else if (sites_on) {
+                handle_site_destroy(obj_id);
+            } else {
+                handle_ref_destroy(obj_id, type_name);
+            }
+            break;
+    }
+
+    section_leave();
+    return 0;
+}
+
+/* ============================================================================
+ * Python API
+ * ============================================================================ */
+
+/**
+ * Open trace file for this session (trace file mode).
+ * @return false with OSError set.
+ */
+static bool open_trace(PyObject *path) {
+    if (!trace_writer_open(&trace_writer, PyBytes_AS_STRING(path))) {
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+        return false;
+    }
+    trace_path = Py_NewRef(path);
+    trace_enabled = true;
+    return true;
+}
+
+/**
+ * Finish trace file (string section + footer) and leave trace file mode.
+ * @return false with errno set if the file is incomplete.
+ */
+static bool close_trace(void) {
+    bool ok = trace_writer_close(&trace_writer);
+    trace_enabled = false;
+    return ok;
+}
+
+/**
+ * Attach to the collector's segment for this session (shared-memory mode).
+ * @return false with OSError set.
+ */
+static bool open_shm(const char *name) {
+    if (!shm_segment_attach(&shm_segment, name)) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, name);
+        return false;
+    }
+    shm_on = true;
+    return true;
+}
+
+/** Tell the collector no more records come, detach, leave shared-memory mode. */
+static void close_shm(void) {
+    shm_segment_finish(&shm_segment);
+    shm_segment_unmap(&shm_segment);
+    shm_on = false;
+}
+
+/** UTF-8 views of a Python sequence of str, valid while fast is alive. */
+typedef struct {
+    PyObject *fast;
+    const char **utf8;
+    size_t count;
+} Utf8List;
+
+static void utf8_list_release(Utf8List *list) {
+    PyMem_Free(list->utf8);
+    Py_CLEAR(list->fast);
+    *list = (Utf8List){0};
+}
+
+/**
+ * Borrow UTF-8 of every str in obj (nullptr/None = empty list).
+ * @return false with TypeError/MemoryError set (nothing to release).
+ */
+static bool utf8_list(PyObject *obj, const char *name, Utf8List *out) {
+    *out = (Utf8List){0};
+    if (obj == nullptr || obj == Py_None) {
+        return true;
+    }
+    if (PyUnicode_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "%s must be a sequence of str, not str", name);
+        return false;
+    }
+    out->fast = PySequence_Fast(obj, name);
+    if (!out->fast) {
+        return false;
+    }
+
+    Py_ssize_t n = PySequence_Fast_GET_SIZE(out->fast);
+    out->utf8 = PyMem_Malloc((size_t)(n > 0 ? n : 1) * sizeof(const char *));
+    if (!out->utf8) {
+        utf8_list_release(out);
+        PyErr_NoMemory();
+        return false;
+    }
+    PyObject **items = PySequence_Fast_ITEMS(out->fast);
+    for (Py_ssize_t i = 0; i < n; i++) {
+        if (!PyUnicode_Check(items[i])) {
+            PyErr_Format(PyExc_TypeError, "%s items must be str, not %.200s",
+                         name, Py_TYPE(items[i])->tp_name);
+            utf8_list_release(out);
+            return false;
+        }
+        out->utf8[i] = PyUnicode_AsUTF8(items[i]);
+        if (!out->utf8[i]) {
+            utf8_list_release(out);
+            return false;
+        }
+    }
+    out->count = (size_t)n;
+    return true;
+}
+
+/**
+ * EVENT_TYPE_BIT mask of event type names (nullptr/None = all types).
+ * @return false with TypeError/ValueError set.
+ */
+static bool parse_type_mask(PyObject *obj, unsigned *mask) {
+    *mask = EVENT_TYPES_ALL;
+    Utf8List names;
+    if (!utf8_list(obj, "include_types", &names)) {
+        return false;
+    }
+    if (!names.fast) {
+        return true;
+    }
+
+    *mask = 0;
+    for (size_t i = 0; i < names.count; i++) {
+        unsigned bit = 0;
+        for (EventType t = EVENT_CALL; t <= EVENT_DESTROY; t++) {
+            if (strcmp(names.utf8[i], event_type_name(t)) == 0) {
+                bit = EVENT_TYPE_BIT(t);
+            }
+        }
+        if (bit == 0) {
+            PyErr_Format(PyExc_ValueError, "include_types: unknown event type '%s'", names.utf8[i]);
+            utf8_list_release(&names);
+            return false;
+        }
+        *mask |= bit;
+    }
+    utf8_list_release(&names);
+    return true;
+}
+
+/**
+ * Compile start() filter arguments (FilterConfig) into a C-side filter.
+ * @return false with exception set (nothing to destroy).
+ */
+static bool compile_filter(PyObject *include, PyObject *exclude, PyObject *types,
+                           EventFilter *out) {
+    unsigned mask;
+    Utf8List inc, exc;
+    if (!parse_type_mask(types, &mask) || !utf8_list(include, "include_paths", &inc)) {
+        return false;
+    }
+    if (!utf8_list(exclude, "exclude_paths", &exc)) {
+        utf8_list_release(&inc);
+        return false;
+    }
+
+    bool ok = event_filter_init(out, inc.utf8, inc.count, exc.utf8, exc.count, mask);
+    utf8_list_release(&inc);
+    utf8_list_release(&exc);
+    if (!ok) {
+        PyErr_NoMemory();
+    }
+    return ok;
+}
+
+/**
+ * Install compiled filter for the next session.
+ * Precondition: TRANSITION (hooks off).
+ */
+static void install_filter(EventFilter *compiled) {
+    event_filter_destroy(&event_filter);
+    event_filter = *compiled;
+    filter_paths = event_filter_has_paths(&event_filter);
+    record_frames = event_filter_type(&event_filter, EVENT_CALL)
+                 || event_filter_type(&event_filter, EVENT_RETURN);
+    record_objects = event_filter_type(&event_filter, EVENT_CREATE)
+                  || event_filter_type(&event_filter, EVENT_DESTROY);
+}
+
+/**
+ * Install the frame hook of the chosen backend.
+ * @return false with an exception set (monitoring only).
+ */
+static bool install_frame_hook(PyInterpreterState *interp) {
+    if (monitoring_on) {
+        return monitoring_install();
+    }
+    original_eval = _PyInterpreterState_GetEvalFrameFunc(interp);
+    _PyInterpreterState_SetEvalFrameFunc(interp, tracking_frame_evaluator);
+    return true;
+}
+
+/** Remove the frame hook installed by install_frame_hook(). */
+static void remove_frame_hook(PyInterpreterState *interp) {
+    if (monitoring_on) {
+        monitoring_remove();
+        return;
+    }
+    _PyInterpreterState_SetEvalFrameFunc(interp, original_eval);
+    original_eval = nullptr;
+}
+
+/** Undo a start() that failed after opening the session: back to IDLE. */
+static void abort_start(void) {
+    if (trace_enabled) {
+        (void)close_trace();
+        Py_CLEAR(trace_path);
+    }
+    if (shm_on) {
+        close_shm();
+    }
+    atomic_store_explicit(&tracking_state, TRACKING_IDLE, memory_order_release);
+}
+
+static PyObject* py_start(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
+
+    static char *kwlist[] = {"trace_path", "sample_every", "sample_interval_ns",
+                             "max_calls_per_code", "include_paths", "exclude_paths",
+                             "include_types", "aggregate", "aggregate_time", "profile",
+                             "profile_clock", "alloc_sites", "capture_args", "backend",
+                             "shm_name", "tasks", nullptr};
+    PyObject *path_arg = nullptr;
+    Py_ssize_t every = 1, interval_ns = 0, max_per_code = 0;
+    PyObject *include = nullptr, *exclude = nullptr, *types = nullptr;
+    int aggregate = 0, timed = 0, profile = 0, alloc_sites = 0, with_args = 1, tasks = 0;
+    const char *clock_name = nullptr, *backend = nullptr, *shm_name = nullptr;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$OnnnOOOpppzppzzp", kwlist,
+                                     &path_arg, &every, &interval_ns, &max_per_code,
+                                     &include, &exclude, &types, &aggregate, &timed,
+                                     &profile, &clock_name, &alloc_sites, &with_args,
+                                     &backend, &shm_name, &tasks)) {
+        return nullptr;
+    }
+    ProfileClockKind clock_kind = PROFILE_CLOCK_MONOTONIC;
+    PyObject *path = nullptr;   /* bytes (owned), nullptr = no trace file */
+    if (path_arg && path_arg != Py_None && !PyUnicode_FSConverter(path_arg, &path)) {
+        return nullptr;
+    }
+    const char *invalid = every < 1 ? "sample_every must be >= 1"
+                        : interval_ns < 0 ? "sample_interval_ns must be >= 0"
+                        : max_per_code < 0 ? "max_calls_per_code must be >= 0"
+                        : aggregate && path ? "aggregate cannot be combined with trace_path"
+                        : timed && !aggregate ? "aggregate_time requires aggregate=True"
+                        : profile && path ? "profile cannot be combined with trace_path"
+                        : profile && aggregate ? "profile cannot be combined with aggregate"
+                        : clock_name && !profile ? "profile_clock requires profile=True"
+                        : clock_name && !profile_clock_parse(clock_name, &clock_kind)
+                            ? "profile_clock must be 'monotonic', 'coarse' or 'tsc'"
+                        : alloc_sites && path ? "alloc_sites cannot be combined with trace_path"
+                        : alloc_sites && (aggregate || profile)
+                            ? "alloc_sites cannot be combined with aggregate or profile"
+                        : tasks && (path || shm_name)
+                            ? "tasks cannot be combined with trace_path or shm_name"
+                        : tasks && (aggregate || profile || alloc_sites)
+                            ? "tasks cannot be combined with aggregate, profile or alloc_sites"
+                        : backend && strcmp(backend, "eval_frame") != 0
+                                  && strcmp(backend, "monitoring") != 0
+                            ? "backend must be 'eval_frame' or 'monitoring'"
+                        : shm_name && path ? "shm_name cannot be combined with trace_path"
+                        : shm_name && (aggregate || profile || alloc_sites)
+                            ? "shm_name cannot be combined with aggregate, profile or alloc_sites"
+                        : nullptr;
+    /* TSC calibration (~10 ms, once per process) before any state changes */
+    ProfileClock chosen_clock = {.kind = PROFILE_CLOCK_MONOTONIC, .ns_per_tick = 1.0};
+    if (!invalid && profile && !profile_clock_init(&chosen_clock, clock_kind)) {
+        invalid = "profile_clock 'tsc' is not available on this machine";
+    }
+    if (invalid) {
+        Py_XDECREF(path);
+        PyErr_SetString(PyExc_ValueError, invalid);
+        return nullptr;
+    }
+    EventFilter compiled;
+    if (!compile_filter(include, exclude, types, &compiled)) {
+        Py_XDECREF(path);
+        return nullptr;
+    }
+    SiteTable *sites = alloc_sites ? site_table_new() : nullptr;
+    if (alloc_sites && !sites) {
+        Py_XDECREF(path);
+        event_filter_destroy(&compiled);
+        return PyErr_NoMemory();
+    }
+
+    int expected = TRACKING_IDLE;
+    if (!atomic_compare_exchange_strong(&tracking_state, &expected, TRACKING_TRANSITION)) {
+        Py_XDECREF(path);
+        event_filter_destroy(&compiled);
+        site_table_free(sites);
+        PyErr_SetString(PyExc_RuntimeError, "Already started");
+        return nullptr;
+    }
+
+    /* Create trace file / attach segment before any hook is installed */
+    bool opened = path ? open_trace(path) : shm_name == nullptr || open_shm(shm_name);
+    Py_XDECREF(path);
+    if (!opened) {
+        event_filter_destroy(&compiled);
+        atomic_store_explicit(&tracking_state, TRACKING_IDLE, memory_order_release);
+        return nullptr;
+    }
+
+    /* Hooks are off: plain stores, published by the ACTIVE release below */
+    sampling = (SamplingConfig){
+        .every = (uint64_t)every,
+        .interval_ns = (uint64_t)interval_ns,
+        .max_per_code = (uint64_t)max_per_code,
+    };
+    sampling_on = sampling_enabled(&sampling);
+    install_filter(&compiled);
+    capture_args = with_args;
+    monitoring_on = backend && strcmp(backend, "monitoring") == 0;
+    aggregate_on = aggregate;
+    aggregate_time = timed;
+    if (aggregate_on) {
+        record_objects = false;     /* Edges only */
+    }
+    profile_on = profile;
+    if (profile_on) {
+        profile_clock = chosen_clock;
+        record_objects = false;     /* Histograms only */
+    }
+    sites_on = alloc_sites;
+    if (sites_on) {
+        record_frames = false;      /* Frames only feed creation stacks */
+        record_objects = true;
+    }
+    tasks_on = tasks;               /* Calls and objects both charged */
+
+    /* Clear previous state, open new session (fresh StringTable) */
+    free_session();
+    vt_init(&obj_creation_map);
+    site_table = sites;
+    string_table_init(0);
+    stack_trie_init();
+    atomic_fetch_add_explicit(&session_id, 1, memory_order_acq_rel);
+    sync_thread_stack();
+
+    /* Initialize stop barrier for safe termination */
+    barrier_init();
+
+    /* Set up frame hook: eval function or sys.monitoring callbacks */
+    PyInterpreterState *interp = PyInterpreterState_Get();
+    if (!install_frame_hook(interp)) {
+        abort_start();
+        return nullptr;
+    }
+
+    /* Set up PyRefTracer */
+    if (PyRefTracer_SetTracer(ref_tracer_callback, nullptr) != 0) {
+        remove_frame_hook(interp);
+        abort_start();
+        PyErr_SetString(PyExc_RuntimeError, "Failed to set tracer");
+        return nullptr;
+    }
+
+    atomic_store_explicit(&tracking_state, TRACKING_ACTIVE, memory_order_release);
+    Py_RETURN_NONE;
+}
+
+/**
+ * Collect every thread buffer's store for merging.
+ * @return malloc'd array of *n store pointers, or nullptr on OOM.
+ */
+static EventStore** collect_stores(size_t *n) {
+    pthread_mutex_lock(&buffers_mutex);
+    EventStore **stores = malloc((buffers_count ? buffers_count : 1) * sizeof(EventStore *));
+    size_t count = 0;
+    if (stores) {
+        for (ThreadBuffer *buf = buffers; buf; buf = buf->next) {
+            stores[count++] = &buf->store;
+        }
+    }
+    pthread_mutex_unlock(&buffers_mutex);
+    *n = count;
+    return stores;
+}
+
+/**
+ * Smallest seq any thread may still append (see Streaming).
+ *
+ * next_seq is read BEFORE walking the registry: a buffer registered after
+ * the walk only gets seqs >= that read.
+ */
+static uint64_t drain_watermark(void) {
+    uint64_t watermark = atomic_load(&next_seq);
+    pthread_mutex_lock(&buffers_mutex);
+    for (ThreadBuffer *buf = buffers; buf; buf = buf->next) {
+        uint64_t open = atomic_load(&buf->open_seq);
+        if (open < watermark) {
+            watermark = open;
+        }
+    }
+    pthread_mutex_unlock(&buffers_mutex);
+    return watermark;
+}
+
+/** Consumer of taken events; returns false to stop consuming. */
+typedef bool (*EventSink)(Event *evt, size_t idx, void *ctx);
+
+/**
+ * Take events with seq < limit_seq in global (seq) order and pass them to sink.
+ *
+ * Taken records release their out-of-line data here; their chunks are
+ * released by the store once fully taken.
+ *
+ * @param max_events  Upper bound of events taken (SIZE_MAX = no bound).
+ * @return Events taken, or -1 with Python exception set.
+ */
+static Py_ssize_t consume_events(uint64_t limit_seq, size_t max_events,
+                                 EventSink sink, void *ctx) {
+    size_t n = 0;
+    EventStore **stores = collect_stores(&n);
+    if (!stores) {
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    EventStoreMerge merge;
+    if (!event_store_merge_init(&merge, stores, n, limit_seq)) {
+        free(stores);
+        PyErr_NoMemory();
+        return -1;
+    }
+
+    size_t idx = 0;
+    Event *evt;
+    while (idx < max_events && (evt = event_store_merge_next(&merge)) != nullptr) {
+        bool more = sink(evt, idx, ctx);
+        idx++;
+        if (!more) {
+            break;
+        }
+    }
+
+    event_store_merge_destroy(&merge);
+    free(stores);
+    return (Py_ssize_t)idx;
+}
+
+typedef struct {
+    PyObject *events_list;
+    OutputErrors *output_errors;
+} ListSink;
+
+/** Sink: serialize to dict, append to list. */
+static bool sink_list(Event *evt, size_t idx, void *ctx) {
+    ListSink *sink = ctx;
+    PyObject *entry = serialize_event(evt, idx, sink->output_errors);
+    if (entry) {
+        PyList_Append(sink->events_list, entry);
+        Py_DECREF(entry);
+    }
+    return true;
+}
+
+/** Sink: append to trace file; stops at the first I/O error. */
+static bool sink_trace(Event *evt, size_t idx, void *ctx) {
+    (void)idx;
+    return trace_writer_event(ctx, evt);
+}
+
+/**
+ * Build {events: [...], output_errors: [...]} from events below limit_seq.
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_result(uint64_t limit_seq, size_t max_events) {
+    OutputErrors output_errors = {0};
+
+    PyObject *result_dict = PyDict_New();
+    if (!result_dict) {
+        return nullptr;
+    }
+
+    PyObject *events_list = PyList_New(0);
+    ListSink sink = {.events_list = events_list, .output_errors = &output_errors};
+    if (!events_list || consume_events(limit_seq, max_events, sink_list, &sink) < 0) {
+        Py_XDECREF(events_list);
+        Py_DECREF(result_dict);
+        return nullptr;
+    }
+
+    PyDict_SetItemString(result_dict, "events", events_list);
+    Py_DECREF(events_list);
+
+    /* Output errors */
+    if (output_errors.count > 0) {
+        PyObject *oe_list = output_errors_to_list(&output_errors);
+        if (oe_list) {
+            PyDict_SetItemString(result_dict, "output_errors", oe_list);
+            Py_DECREF(oe_list);
+        }
+    }
+    return result_dict;
+}
+
+typedef struct {
+    EventColumns *columns;
+    PyObject *errors_list;      /* [{index, errors}] for rows with field errors */
+    OutputErrors *output_errors;
+    bool oom;
+} ColumnSink;
+
+/** Sink: append row; field errors (rare) go out-of-band with their row index. */
+static bool sink_columns(Event *evt, size_t idx, void *ctx) {
+    ColumnSink *sink = ctx;
+    size_t row = sink->columns->count;
+    if (!event_columns_append(sink->columns, evt)) {
+        sink->oom = true;
+        return false;
+    }
+    if (evt->error_count > 0) {
+        PyObject *entry = PyDict_New();
+        if (entry) {
+            dict_set_ulonglong(entry, "index", row);
+            serialize_event_errors(entry, evt, idx, sink->output_errors);
+            PyList_Append(sink->errors_list, entry);
+            Py_DECREF(entry);
+        }
+    }
+    return true;
+}
+
+/**
+ * Build {columns: {name: bytes}, strings: [...], errors: [...], output_errors: [...]}
+ * from all remaining events. Strings must still be alive (before free_session).
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_columns_result(void) {
+    OutputErrors output_errors = {0};
+    EventColumns columns;
+    if (!event_columns_init(&columns)) {
+        return PyErr_NoMemory();
+    }
+
+    PyObject *errors_list = PyList_New(0);
+    ColumnSink sink = {
+        .columns = &columns,
+        .errors_list = errors_list,
+        .output_errors = &output_errors,
+    };
+    if (!errors_list || consume_events(UINT64_MAX, SIZE_MAX, sink_columns, &sink) < 0) {
+        Py_XDECREF(errors_list);
+        event_columns_destroy(&columns);
+        return nullptr;
+    }
+    if (sink.oom) {
+        Py_DECREF(errors_list);
+        event_columns_destroy(&columns);
+        return PyErr_NoMemory();
+    }
+
+    PyObject *columns_dict = columns_to_dict(&columns);
+    PyObject *strings = column_strings_to_list(&columns, &output_errors);
+    event_columns_destroy(&columns);
+    if (!columns_dict || !strings) {
+        Py_XDECREF(columns_dict);
+        Py_XDECREF(strings);
+        Py_DECREF(errors_list);
+        return nullptr;
+    }
+
+    PyObject *result_dict = Py_BuildValue("{s:N,s:N,s:N}", "columns", columns_dict,
+                                          "strings", strings, "errors", errors_list);
+    if (result_dict && output_errors.count > 0) {
+        PyObject *oe_list = output_errors_to_list(&output_errors);
+        if (oe_list) {
+            PyDict_SetItemString(result_dict, "output_errors", oe_list);
+            Py_DECREF(oe_list);
+        }
+    }
+    return result_dict;
+}
+
+typedef struct {
+    PyObject *edges_list;
+    OutputErrors *output_errors;
+    size_t index;
+} EdgeSink;
+
+/** Visitor: append one edge dict. */
+static bool sink_edge(const EdgeKey *key, const EdgeStats *stats, void *ctx) {
+    EdgeSink *sink = ctx;
+    PyObject *entry = edge_to_dict(key, stats, aggregate_time, sink->index++, sink->output_errors);
+    if (!entry) {
+        return false;
+    }
+    int rc = PyList_Append(sink->edges_list, entry);
+    Py_DECREF(entry);
+    return rc == 0;
+}
+
+/**
+ * Merge every thread's edge table, build {edges: [...], output_errors: [...]}.
+ * Precondition: hooks off, strings still alive (before free_session).
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_edges_result(void) {
+    EdgeTable *merged = edge_table_new();
+    if (!merged) {
+        return PyErr_NoMemory();
+    }
+    bool merged_all = true;
+    pthread_mutex_lock(&buffers_mutex);
+    for (ThreadBuffer *buf = buffers; buf && merged_all; buf = buf->next) {
+        merged_all = !buf->edges || edge_table_merge(merged, buf->edges);
+    }
+    pthread_mutex_unlock(&buffers_mutex);
+    if (!merged_all) {
+        edge_table_free(merged);
+        return PyErr_NoMemory();
+    }
+
+    OutputErrors output_errors = {0};
+    PyObject *edges_list = PyList_New(0);
+    EdgeSink sink = {.edges_list = edges_list, .output_errors = &output_errors};
+    if (!edges_list || !edge_table_each(merged, sink_edge, &sink)) {
+        Py_XDECREF(edges_list);
+        edge_table_free(merged);
+        return nullptr;
+    }
+    edge_table_free(merged);
+
+    PyObject *result_dict = Py_BuildValue("{s:N}", "edges", edges_list);
+    if (result_dict && output_errors.count > 0) {
+        PyObject *oe_list = output_errors_to_list(&output_errors);
+        if (oe_list) {
+            PyDict_SetItemString(result_dict, "output_errors", oe_list);
+            Py_DECREF(oe_list);
+        }
+    }
+    return result_dict;
+}
+
+typedef struct {
+    PyObject *functions_list;
+    OutputErrors *output_errors;
+    size_t index;
+} ProfileSink;
+
+/** Visitor: append one function dict. */
+static bool sink_profile(const FrameInfo *func, const ProfileStats *stats, void *ctx) {
+    ProfileSink *sink = ctx;
+    PyObject *entry = profile_to_dict(func, stats, sink->index++, sink->output_errors);
+    if (!entry) {
+        return false;
+    }
+    int rc = PyList_Append(sink->functions_list, entry);
+    Py_DECREF(entry);
+    return rc == 0;
+}
+
+/**
+ * Merge every thread's profile table, build
+ * {clock: name, functions: [...], output_errors: [...]}.
+ * Precondition: hooks off, strings still alive (before free_session).
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_profile_result(void) {
+    ProfileTable *merged = profile_table_new();
+    if (!merged) {
+        return PyErr_NoMemory();
+    }
+    bool merged_all = true;
+    pthread_mutex_lock(&buffers_mutex);
+    for (ThreadBuffer *buf = buffers; buf && merged_all; buf = buf->next) {
+        merged_all = !buf->profile || profile_table_merge(merged, buf->profile);
+    }
+    pthread_mutex_unlock(&buffers_mutex);
+    if (!merged_all) {
+        profile_table_free(merged);
+        return PyErr_NoMemory();
+    }
+
+    OutputErrors output_errors = {0};
+    PyObject *functions_list = PyList_New(0);
+    ProfileSink sink = {.functions_list = functions_list, .output_errors = &output_errors};
+    if (!functions_list || !profile_table_each(merged, sink_profile, &sink)) {
+        Py_XDECREF(functions_list);
+        profile_table_free(merged);
+        return nullptr;
+    }
+    profile_table_free(merged);
+
+    PyObject *result_dict = Py_BuildValue("{s:s,s:N}",
+                                          "clock", profile_clock_name(profile_clock.kind),
+                                          "functions", functions_list);
+    if (result_dict && output_errors.count > 0) {
+        PyObject *oe_list = output_errors_to_list(&output_errors);
+        if (oe_list) {
+            PyDict_SetItemString(result_dict, "output_errors", oe_list);
+            Py_DECREF(oe_list);
+        }
+    }
+    return result_dict;
+}
+
+/**
+ * Copy the site table out (under creation_mutex), build
+ * {sites: [...], live_objects: N, output_errors: [...]}.
+ * Safe while tracking: no Python call under the mutex.
+ * Precondition: inside a section or hooks off (strings, trie alive).
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_sites_result(void) {
+    size_t count = 0;
+    pthread_mutex_lock(&creation_mutex);
+    SiteEntry *entries = site_table_entries(site_table, &count);
+    size_t live_objects = site_table_live(site_table);
+    pthread_mutex_unlock(&creation_mutex);
+    if (!entries) {
+        return PyErr_NoMemory();
+    }
+
+    OutputErrors output_errors = {0};
+    PyObject *sites_list = PyList_New((Py_ssize_t)count);
+    for (size_t i = 0; sites_list && i < count; i++) {
+        PyObject *entry = site_to_dict(&entries[i], i, &output_errors);
+        if (!entry) {
+            Py_CLEAR(sites_list);
             break;
+        }
+        PyList_SET_ITEM(sites_list, (Py_ssize_t)i, entry);
+    }
+    free(entries);
+    if (!sites_list) {
+        return nullptr;
+    }
+
+    PyObject *result_dict = Py_BuildValue("{s:N,s:K}", "sites", sites_list,
+                                          "live_objects", (unsigned long long)live_objects);
+    if (result_dict && output_errors.count > 0) {
+        PyObject *oe_list = output_errors_to_list(&output_errors);
+        if (oe_list) {
+            PyDict_SetItemString(result_dict, "output_errors", oe_list);
+            Py_DECREF(oe_list);
+        }
+    }
+    return result_dict;
+}
+
+/** Visitor: append one task dict (ctx: the list). */
+static bool sink_task(uint64_t task, const TaskStats *stats, void *ctx) {
+    PyObject *entry = Py_BuildValue("{s:K,s:K,s:K,s:K,s:K}",
+                                    "task", (unsigned long long)task,
+                                    "calls", (unsigned long long)stats->calls,
+                                    "own_ns", (unsigned long long)stats->own_ns,
+                                    "allocated", (unsigned long long)stats->allocated,
+                                    "freed", (unsigned long long)stats->freed);
+    if (!entry) {
+        return false;
+    }
+    int rc = PyList_Append((PyObject *)ctx, entry);
+    Py_DECREF(entry);
+    return rc == 0;
+}
+
+/**
+ * Merge every thread's task table, build
+ * {tasks: [{task, calls, own_ns, allocated, freed}, ...]}.
+ * Precondition: hooks off.
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* build_tasks_result(void) {
+    TaskTable *merged = task_table_new();
+    if (!merged) {
+        return PyErr_NoMemory();
+    }
+    bool merged_all = true;
+    pthread_mutex_lock(&buffers_mutex);
+    for (ThreadBuffer *buf = buffers; buf && merged_all; buf = buf->next) {
+        merged_all = !buf->tasks || task_table_merge(merged, buf->tasks);
+    }
+    pthread_mutex_unlock(&buffers_mutex);
+    if (!merged_all) {
+        task_table_free(merged);
+        return PyErr_NoMemory();
+    }
+
+    PyObject *tasks_list = PyList_New(0);
+    if (!tasks_list || !task_table_each(merged, sink_task, tasks_list)) {
+        Py_XDECREF(tasks_list);
+        task_table_free(merged);
+        return nullptr;
+    }
+    task_table_free(merged);
+    return Py_BuildValue("{s:N}", "tasks", tasks_list);
+}
+
+/**
+ * Write events below limit_seq to the trace file.
+ * @return Events written, or -1 with Python exception set.
+ */
+static Py_ssize_t write_trace(uint64_t limit_seq, size_t max_events) {
+    Py_ssize_t written = consume_events(limit_seq, max_events, sink_trace, &trace_writer);
+    if (written >= 0 && trace_writer.error != 0) {
+        errno = trace_writer.error;
+        PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, trace_path);
+        return -1;
+    }
+    return written;
+}
+
+/**
+ * Write everything left, close trace file.
+ * @return {events: [], trace_events: N}, or nullptr with OSError set.
+ */
+static PyObject* finish_trace(void) {
+    Py_ssize_t written = write_trace(UINT64_MAX, SIZE_MAX);
+    uint64_t total = trace_writer.event_count;  /* flush()ed ones included */
+
+    /* Close even after an error: releases writer, file stays incomplete */
+    bool closed = close_trace();
+    PyObject *path = trace_path;
+    trace_path = nullptr;
+
+    if (written < 0 || !closed) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetFromErrnoWithFilenameObject(PyExc_OSError, path);
+        }
+        Py_DECREF(path);
+        return nullptr;
+    }
+    Py_DECREF(path);
+
+    PyObject *events_list = PyList_New(0);
+    if (!events_list) {
+        return nullptr;
+    }
+    return Py_BuildValue("{s:N,s:K}", "events", events_list,
+                         "trace_events", (unsigned long long)total);
+}
+
+static PyObject* py_stop(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
+
+    static char *kwlist[] = {"columnar", "prefer_columnar", nullptr};
+    int columnar = 0;
+    int prefer_columnar = 0;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|$pp", kwlist, &columnar,
+                                     &prefer_columnar)) {
+        return nullptr;
+    }
+    if (columnar && trace_enabled) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with trace_path");
+        return nullptr;
+    }
+    if (columnar && aggregate_on) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with aggregate");
+        return nullptr;
+    }
+    if (columnar && profile_on) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with profile");
+        return nullptr;
+    }
+    if (columnar && sites_on) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with alloc_sites");
+        return nullptr;
+    }
+    if (columnar && tasks_on) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with tasks");
+        return nullptr;
+    }
+    if (columnar && shm_on) {
+        PyErr_SetString(PyExc_ValueError, "columnar result not available with shm_name");
+        return nullptr;
+    }
+
+    int expected = TRACKING_ACTIVE;
+    if (!atomic_compare_exchange_strong(&tracking_state, &expected, TRACKING_TRANSITION)) {
+        PyErr_SetString(PyExc_RuntimeError, "Not started");
+        return nullptr;
+    }
+
+    /* CRITICAL: Wait for all in-flight frame evaluations via barrier.
+     * This prevents use-after-free when stop() called during callback.
+     * Without the GIL: a concurrent drain() may need it to finish. */
+    StopResult stop_result;
+    Py_BEGIN_ALLOW_THREADS
+    stop_result = barrier_stop();
+    Py_END_ALLOW_THREADS
+    if (stop_result == STOP_FROM_CALLBACK) {
+        /* Cannot stop from within a tracked function call */
+        atomic_store_explicit(&tracking_state, TRACKING_ACTIVE, memory_order_release);
+        PyErr_SetString(PyExc_RuntimeError, "Cannot stop() from tracked callback");
+        return nullptr;
+    }
+
+    /* Restore original frame evaluator (or release sys.monitoring) */
+    remove_frame_hook(PyInterpreterState_Get());
+
+    /* Clear PyRefTracer */
+    PyRefTracer_SetTracer(nullptr, nullptr);
+
+    /* Destroy barrier NOW — all hooks disabled, no more callbacks possible */
+    barrier_destroy();
+
+    /* Every section left: all records exported, the collector may finish */
+    if (shm_on) {
+        close_shm();
+    }
+
+    /* Everything not drained yet (every section left: all published) */
+    PyObject *result_dict = trace_enabled ? finish_trace()
+                          : aggregate_on  ? build_edges_result()
+                          : profile_on    ? build_profile_result()
+                          : sites_on      ? build_sites_result()
+                          : tasks_on      ? build_tasks_result()
+                          : columnar || (prefer_columnar && !shm_on)
+                                          ? build_columns_result()
+                                          : build_result(UINT64_MAX, SIZE_MAX);
+
+    free_session();
+    /* barrier already destroyed after hooks disabled */
+    atomic_store_explicit(&tracking_state, TRACKING_IDLE, memory_order_release);
+    return result_dict;
+}
+
+/**
+ * Become the (single) consumer of the thread buffers.
+ * Holds a section: stop() waits for us, buffers stay valid.
+ * @return false with RuntimeError set if not tracking.
+ */
+static bool consumer_enter(void) {
+    if (!tracking_active() || !section_enter()) {
+        PyErr_SetString(PyExc_RuntimeError, "Not started");
+        return false;
+    }
+
+    /* One consumer per store: serialize consumers (GIL released while waiting) */
+    if (pthread_mutex_trylock(&drain_mutex) != 0) {
+        Py_BEGIN_ALLOW_THREADS
+        pthread_mutex_lock(&drain_mutex);
+        Py_END_ALLOW_THREADS
+    }
+    tl_suppress = true;
+    return true;
+}
+
+static void consumer_leave(void) {
+    tl_suppress = false;
+    pthread_mutex_unlock(&drain_mutex);
+    section_leave();
+}
+
+static PyObject* py_drain(PyObject *self, PyObject *args) {
+    (void)self;
+
+    Py_ssize_t max_events;
+    if (!PyArg_ParseTuple(args, "n", &max_events)) {
+        return nullptr;
+    }
+    if (max_events <= 0) {
+        PyErr_SetString(PyExc_ValueError, "max_events must be positive");
+        return nullptr;
+    }
+
+    if (!consumer_enter()) {
+        return nullptr;
+    }
+    PyObject *result_dict = nullptr;
+    if (trace_enabled) {
+        PyErr_SetString(PyExc_RuntimeError, "Events are written to trace file, use flush()");
+    } else if (aggregate_on) {
+        PyErr_SetString(PyExc_RuntimeError, "No events in aggregate mode, edges come with stop()");
+    } else if (profile_on) {
+        PyErr_SetString(PyExc_RuntimeError, "No events in profile mode, histograms come with stop()");
+    } else if (sites_on) {
+        PyErr_SetString(PyExc_RuntimeError, "No events in alloc_sites mode, use snapshot()");
+    } else if (tasks_on) {
+        PyErr_SetString(PyExc_RuntimeError, "No events in tasks mode, task totals come with stop()");
+    } else if (shm_on) {
+        PyErr_SetString(PyExc_RuntimeError, "No events with shm_name, the collector reads them");
+    } else {
+        result_dict = build_result(drain_watermark(), (size_t)max_events);
+    }
+    consumer_leave();
+    return result_dict;
+}
+
+static PyObject* py_flush(PyObject *self, PyObject *args) {
+    (void)self;
+
+    Py_ssize_t max_events;
+    if (!PyArg_ParseTuple(args, "n", &max_events)) {
+        return nullptr;
+    }
+    if (max_events <= 0) {
+        PyErr_SetString(PyExc_ValueError, "max_events must be positive");
+        return nullptr;
     }
 
-    barrier_leave();
-    return 0;
+    if (!consumer_enter()) {
+        return nullptr;
+    }
+    Py_ssize_t written = -1;
+    if (!trace_enabled) {
+        PyErr_SetString(PyExc_RuntimeError, "No trace file, start(trace_path=...)");
+    } else {
+        written = write_trace(drain_watermark(), (size_t)max_events);
+    }
+    consumer_leave();
+    return written < 0 ? nullptr : PyLong_FromSsize_t(written);
 }
 
-/* ============================================================================
- * Python API
- * ============================================================================ */
+static PyObject* py_count(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
+    /* Every recorded event took exactly one sequence number */
+    return PyLong_FromUnsignedLongLong(atomic_load_explicit(&next_seq, memory_order_relaxed));
+}
 
-static PyObject* py_start(PyObject *self, PyObject *args) {
+static PyObject* py_snapshot(PyObject *self, PyObject *args) {
     (void)self;
     (void)args;
 
-    if (tracking_active) {
-        PyErr_SetString(PyExc_RuntimeError, "Already started");
+    /* Section: stop() waits for us, trie and strings stay valid */
+    if (!tracking_active() || !section_enter()) {
+        PyErr_SetString(PyExc_RuntimeError, "Not started");
         return nullptr;
     }
+    PyObject *result_dict = nullptr;
+    if (!sites_on) {
+        PyErr_SetString(PyExc_RuntimeError, "snapshot() requires start(alloc_sites=True)");
+    } else {
+        tl_suppress = true;     /* Our own result objects are not counted */
+        result_dict = build_sites_result();
+        tl_suppress = false;
+    }
+    section_leave();
+    return result_dict;
+}
 
-    /* Clear previous state */
-    free_events();
-    vt_cleanup(&obj_creation_map);
-    vt_init(&obj_creation_map);
-    stack_depth = 0;
+/** Per-thread counters of the session, summed by stats(). */
+typedef struct {
+    uint64_t events[STATS_EVENT_TYPES];
+    uint64_t dropped_oom;
+    uint64_t event_bytes;
+    uint64_t hook_samples;
+    uint64_t hook_ns;
+    size_t threads;
+} StatsTotals;
+
+static void sum_thread_stats(StatsTotals *totals) {
+    *totals = (StatsTotals){
+        .dropped_oom = atomic_load_explicit(&dropped_no_buffer, memory_order_relaxed),
+    };
+    pthread_mutex_lock(&buffers_mutex);
+    for (ThreadBuffer *buf = buffers; buf; buf = buf->next) {
+        for (int t = 0; t < STATS_EVENT_TYPES; t++) {
+            totals->events[t] += stats_get(&buf->stats.events[t]);
+        }
+        totals->dropped_oom += stats_get(&buf->stats.dropped_oom);
+        totals->event_bytes += stats_get(&buf->stats.event_bytes);
+        totals->hook_samples += stats_get(&buf->stats.hook_samples);
+        totals->hook_ns += stats_get(&buf->stats.hook_ns);
+    }
+    totals->threads = buffers_count;
+    pthread_mutex_unlock(&buffers_mutex);
+}
 
-    /* Initialize stop barrier for safe termination */
-    barrier_init();
+/**
+ * Build the stats() dict. Precondition: inside a section (session tables
+ * and buffers stay valid), tl_suppress set (our objects are not counted).
+ * @return New dict, or nullptr with exception set.
+ */
+static PyObject* build_stats(void) {
+    StatsTotals totals;
+    sum_thread_stats(&totals);
+
+    pthread_mutex_lock(&creation_mutex);
+    size_t map_size = vt_size(&obj_creation_map);
+    size_t map_buckets = vt_bucket_count(&obj_creation_map);
+    size_t sites = site_table ? site_table_size(site_table) : 0;
+    pthread_mutex_unlock(&creation_mutex);
+    size_t map_bytes = map_buckets * (sizeof(creation_map_bucket) + sizeof(uint16_t));
+
+    BarrierStats barrier;
+    barrier_stats(&barrier);
+    uint64_t shm_dropped = shm_on ? shm_segment_dropped(&shm_segment) : 0;
+
+    return Py_BuildValue(
+        "{s:{s:K,s:K,s:K,s:K},s:{s:K,s:K,s:K},s:{s:K,s:n,s:n,s:n},s:{s:n,s:n},"
+        "s:n,s:n,s:n,s:n,s:{s:K,s:K,s:K},s:{s:K,s:K,s:I}}",
+        "events",
+            event_type_name(EVENT_CALL), (unsigned long long)totals.events[EVENT_CALL],
+            event_type_name(EVENT_RETURN), (unsigned long long)totals.events[EVENT_RETURN],
+            event_type_name(EVENT_CREATE), (unsigned long long)totals.events[EVENT_CREATE],
+            event_type_name(EVENT_DESTROY), (unsigned long long)totals.events[EVENT_DESTROY],
+        "dropped",
+            "oom", (unsigned long long)totals.dropped_oom,
+            "stopping", (unsigned long long)atomic_load_explicit(&dropped_stopping,
+                                                                 memory_order_relaxed),
+            "shm", (unsigned long long)shm_dropped,
+        "memory",
+            "events", (unsigned long long)totals.event_bytes,
+            "creation_map", (Py_ssize_t)map_bytes,
+            "strings", (Py_ssize_t)string_table_bytes(),
+            "stacks", (Py_ssize_t)stack_trie_bytes(),
+        "creation_map",
+            "size", (Py_ssize_t)map_size,
+            "buckets", (Py_ssize_t)map_buckets,
+        "strings", (Py_ssize_t)string_table_count(),
+        "stacks", (Py_ssize_t)stack_trie_count(),
+        "sites", (Py_ssize_t)sites,
+        "threads", (Py_ssize_t)totals.threads,
+        "barrier",
+            "refused", (unsigned long long)barrier.refused,
+            "stops", (unsigned long long)barrier.stops,
+            "stop_wait_ns", (unsigned long long)barrier.stop_wait_ns,
+        "hook",
+            "samples", (unsigned long long)totals.hook_samples,
+            "sampled_ns", (unsigned long long)totals.hook_ns,
+            "sample_every", (unsigned int)STATS_HOOK_SAMPLE_EVERY);
+}
 
-    /* Set up frame eval hook */
-    PyInterpreterState *interp = PyInterpreterState_Get();
-    original_eval = _PyInterpreterState_GetEvalFrameFunc(interp);
-    _PyInterpreterState_SetEvalFrameFunc(interp, tracking_frame_evaluator);
+static PyObject* py_stats(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
 
-    /* Set up PyRefTracer */
-    if (PyRefTracer_SetTracer(ref_tracer_callback, nullptr) != 0) {
-        _PyInterpreterState_SetEvalFrameFunc(interp, original_eval);
-        original_eval = nullptr;
-        PyErr_SetString(PyExc_RuntimeError, "Failed to set tracer");
+    /* Section: stop() waits for us, buffers and session tables stay valid */
+    if (!tracking_active() || !section_enter()) {
+        PyErr_SetString(PyExc_RuntimeError, "Not started");
         return nullptr;
     }
-
-    tracking_active = 1;
-    Py_RETURN_NONE;
+    tl_suppress = true;     /* Our own result objects are not counted */
+    PyObject *result_dict = build_stats();
+    tl_suppress = false;
+    section_leave();
+    return result_dict;
 }
 
-static PyObject* py_stop(PyObject *self, PyObject *args) {
+static PyObject* py_is_active(PyObject *self, PyObject *args) {
     (void)self;
     (void)args;
+    return PyBool_FromLong(tracking_active());
+}
 
-    if (!tracking_active) {
-        PyErr_SetString(PyExc_RuntimeError, "Not started");
+static PyObject* py_get_origin(PyObject *self, PyObject *args) {
+    (void)self;
+
+    PyObject *obj;
+    if (!PyArg_ParseTuple(args, "O", &obj)) {
         return nullptr;
     }
 
-    tracking_active = 0;
+    /* Section: stop() waits for us, trie and strings stay valid */
+    if (!tracking_active() || !section_enter()) {
+        PyErr_SetString(PyExc_RuntimeError, "Tracking not active");
+        return nullptr;
+    }
 
-    /* CRITICAL: Wait for all in-flight frame evaluations via barrier.
-     * This prevents use-after-free when stop() called during callback. */
-    StopResult stop_result = barrier_stop();
-    if (stop_result == STOP_FROM_CALLBACK) {
-        /* Cannot stop from within a tracked function call */
-        tracking_active = 1;  /* Restore state */
-        PyErr_SetString(PyExc_RuntimeError, "Cannot stop() from tracked callback");
+    /* Copy under lock; serialize after (no Python allocation under the mutex) */
+    uintptr_t obj_id = (uintptr_t)obj;
+    CreationInfo info;
+    bool found = false;
+
+    pthread_mutex_lock(&creation_mutex);
+    creation_map_itr itr = vt_get(&obj_creation_map, obj_id);
+    if (!vt_is_end(itr)) {
+        info = itr.data->val;
+        found = true;
+    }
+    pthread_mutex_unlock(&creation_mutex);
+
+    PyObject *origin = Py_None;
+    if (found) {
+        OutputErrors oe = {0};
+        tl_suppress = true;     /* Our own result objects are not counted */
+        origin = creation_info_to_dict(&info, &oe, "origin");
+        tl_suppress = false;
+    } else {
+        Py_INCREF(origin);
+    }
+    section_leave();
+    return origin;
+}
+
+/* ============================================================================
+ * Native column analysis (analysis.h)
+ *
+ * analyze_columns() runs filter + call graph + object flow over the
+ * buffers of an EventColumns (stop(columnar=True)) and copies the kept
+ * rows into new columns. Independent of tracking state; the pass runs
+ * with the GIL released.
+ * ============================================================================ */
+
+static_assert(sizeof(ColumnEdge) == 6 * sizeof(uint32_t) + sizeof(uint64_t),
+              "ColumnEdge must match struct format '@IIIIiiQ'");
+static_assert(sizeof(ColumnLifecycle) == 4 * sizeof(size_t),
+              "ColumnLifecycle must match struct format '@NNNN'");
+
+/** What a column is indexed by: event row, flattened arg, or creation stack entry. */
+typedef enum { COLUMN_SPAN_ROW, COLUMN_SPAN_ARG, COLUMN_SPAN_STACK } ColumnSpan;
+
+/** Columns of an EventColumns (keys of COLUMN_FORMATS): item size, span. */
+static const struct {
+    const char *name;
+    size_t itemsize;
+    ColumnSpan span;
+} COLUMN_BUFFERS[] = {
+    {"kind", sizeof(uint8_t), COLUMN_SPAN_ROW},
+    {"obj_id", sizeof(uint64_t), COLUMN_SPAN_ROW},
+    {"type_name", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"file", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"func", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"line", sizeof(int32_t), COLUMN_SPAN_ROW},
+    {"caller_file", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"caller_func", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"caller_line", sizeof(int32_t), COLUMN_SPAN_ROW},
+    {"thread", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"task", sizeof(uint64_t), COLUMN_SPAN_ROW},
+    {"creation", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"creation_type", sizeof(uint32_t), COLUMN_SPAN_ROW},
+    {"arg_count", sizeof(uint16_t), COLUMN_SPAN_ROW},
+    {"arg_id", sizeof(uint64_t), COLUMN_SPAN_ARG},
+    {"arg_name", sizeof(uint32_t), COLUMN_SPAN_ARG},
+    {"arg_type", sizeof(uint32_t), COLUMN_SPAN_ARG},
+    {"stack_parent", sizeof(uint32_t), COLUMN_SPAN_STACK},
+    {"stack_file", sizeof(uint32_t), COLUMN_SPAN_STACK},
+    {"stack_func", sizeof(uint32_t), COLUMN_SPAN_STACK},
+    {"stack_line", sizeof(int32_t), COLUMN_SPAN_STACK},
+};
+
+constexpr size_t COLUMN_BUFFER_COUNT = sizeof(COLUMN_BUFFERS) / sizeof(COLUMN_BUFFERS[0]);
+
+/** Indices into COLUMN_BUFFERS. */
+enum {
+    COL_KIND, COL_OBJ_ID, COL_TYPE_NAME, COL_FILE, COL_FUNC, COL_LINE, COL_CALLER_FILE,
+    COL_CALLER_FUNC, COL_CALLER_LINE, COL_THREAD, COL_TASK, COL_CREATION,
+    COL_CREATION_TYPE, COL_ARG_COUNT, COL_ARG_ID, COL_ARG_NAME, COL_ARG_TYPE, COL_STACK_PARENT,
+};
+
+/**
+ * Borrow columns[name] as a contiguous, aligned array of itemsize-byte items.
+ * @return false with Python exception set (view not held).
+ */
+static bool get_column_buffer(PyObject *columns, const char *name, size_t itemsize,
+                              Py_buffer *view) {
+    PyObject *obj = PyMapping_GetItemString(columns, name);
+    if (!obj) {
+        return false;
+    }
+    int rc = PyObject_GetBuffer(obj, view, PyBUF_C_CONTIGUOUS);
+    Py_DECREF(obj);
+    if (rc < 0) {
+        return false;
+    }
+    if ((size_t)view->len % itemsize != 0 || (uintptr_t)view->buf % itemsize != 0) {
+        PyErr_Format(PyExc_ValueError, "column '%s': not an aligned array of %zu-byte items",
+                     name, itemsize);
+        PyBuffer_Release(view);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Check the borrowed columns form one EventColumns: row columns of equal
+ * length, arg columns covering sum(arg_count), stack columns of equal
+ * length, every file idx inside file_pass. Fills the view the native pass
+ * reads.
+ * @return false with ValueError set.
+ */
+static bool check_column_buffers(const Py_buffer *views, const Py_buffer *file_pass,
+                                 ColumnsView *cols) {
+    size_t rows = (size_t)views[COL_KIND].len;
+    const uint16_t *arg_count = views[COL_ARG_COUNT].buf;
+    uint64_t arg_total = 0;
+    if ((size_t)views[COL_ARG_COUNT].len / sizeof(uint16_t) == rows) {
+        for (size_t row = 0; row < rows; row++) {
+            arg_total += arg_count[row];
+        }
+    }
+    uint64_t stacks = (size_t)views[COL_STACK_PARENT].len / sizeof(uint32_t);
+    for (size_t i = 1; i < COLUMN_BUFFER_COUNT; i++) {
+        ColumnSpan span = COLUMN_BUFFERS[i].span;
+        uint64_t expected = span == COLUMN_SPAN_ROW ? rows
+                          : span == COLUMN_SPAN_ARG ? arg_total : stacks;
+        if ((size_t)views[i].len / COLUMN_BUFFERS[i].itemsize != expected) {
+            PyErr_Format(PyExc_ValueError, "column '%s': expected %llu entries",
+                         COLUMN_BUFFERS[i].name, (unsigned long long)expected);
+            return false;
+        }
+    }
+
+    *cols = (ColumnsView){
+        .count = rows,
+        .kind = views[COL_KIND].buf,
+        .obj_id = views[COL_OBJ_ID].buf,
+        .file = views[COL_FILE].buf,
+        .func = views[COL_FUNC].buf,
+        .line = views[COL_LINE].buf,
+        .caller_file = views[COL_CALLER_FILE].buf,
+        .caller_func = views[COL_CALLER_FUNC].buf,
+        .caller_line = views[COL_CALLER_LINE].buf,
+        .thread = views[COL_THREAD].buf,
+        .arg_count = arg_count,
+        .arg_id = views[COL_ARG_ID].buf,
+    };
+
+    if (file_pass) {
+        for (size_t row = 0; row < rows; row++) {
+            if (cols->file[row] >= (size_t)file_pass->len) {
+                PyErr_Format(PyExc_ValueError, "file_pass: no entry for file idx %u",
+                             cols->file[row]);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/** bytes of src items at idx[0..n) (itemsize bytes each). */
+static PyObject* gather_items(const void *src, size_t itemsize, const size_t *idx, size_t n) {
+    PyObject *bytes = PyBytes_FromStringAndSize(nullptr, (Py_ssize_t)(n * itemsize));
+    if (!bytes) {
         return nullptr;
     }
+    char *dst = PyBytes_AS_STRING(bytes);
+    for (size_t i = 0; i < n; i++) {
+        memcpy(dst + i * itemsize, (const char *)src + idx[i] * itemsize, itemsize);
+    }
+    return bytes;
+}
 
-    /* Restore original frame evaluator */
-    PyInterpreterState *interp = PyInterpreterState_Get();
-    _PyInterpreterState_SetEvalFrameFunc(interp, original_eval);
-    original_eval = nullptr;
+/**
+ * {name: bytes} of every column restricted to the kept rows (and their
+ * args). Stack columns are copied whole: kept DESTROY rows still refer to
+ * their entries.
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* select_column_buffers(const Py_buffer *views, const ColumnsView *cols,
+                                       const ColumnAnalysis *res) {
+    size_t kept_args = 0;
+    for (size_t i = 0; i < res->row_count; i++) {
+        kept_args += cols->arg_count[res->rows[i]];
+    }
+    size_t *arg_rows = malloc((kept_args ? kept_args : 1) * sizeof(size_t));
+    if (!arg_rows) {
+        return PyErr_NoMemory();
+    }
+    size_t start = 0;
+    size_t next_row = 0;
+    size_t j = 0;
+    for (size_t i = 0; i < res->row_count; i++) {
+        for (; next_row < res->rows[i]; next_row++) {
+            start += cols->arg_count[next_row];
+        }
+        for (uint16_t a = 0; a < cols->arg_count[next_row]; a++) {
+            arg_rows[j++] = start + a;
+        }
+    }
 
-    /* Clear PyRefTracer */
-    PyRefTracer_SetTracer(nullptr, nullptr);
+    PyObject *dict = PyDict_New();
+    bool ok = dict != nullptr;
+    for (size_t i = 0; ok && i < COLUMN_BUFFER_COUNT; i++) {
+        ColumnSpan span = COLUMN_BUFFERS[i].span;
+        PyObject *column = span == COLUMN_SPAN_STACK
+            ? PyBytes_FromStringAndSize(views[i].buf, views[i].len)
+            : gather_items(views[i].buf, COLUMN_BUFFERS[i].itemsize,
+                           span == COLUMN_SPAN_ARG ? arg_rows : res->rows,
+                           span == COLUMN_SPAN_ARG ? kept_args : res->row_count);
+        ok = column && PyDict_SetItemString(dict, COLUMN_BUFFERS[i].name, column) == 0;
+        Py_XDECREF(column);
+    }
+    free(arg_rows);
+    if (!ok) {
+        Py_XDECREF(dict);
+        return nullptr;
+    }
+    return dict;
+}
 
-    /* Destroy barrier NOW — all hooks disabled, no more callbacks possible */
-    barrier_destroy();
+/**
+ * {rows, edges, unmatched, lifecycles, passes, orphans: bytes, duplicate_row,
+ *  selected: {name: bytes} | None}. Row arrays are size_t ('N'), edges
+ * '@IIIIiiQ', lifecycles '@NNNN'; selected is None when every row was kept.
+ * @return New dict, or nullptr with Python exception set.
+ */
+static PyObject* column_analysis_to_dict(const Py_buffer *views, const ColumnsView *cols,
+                                         const ColumnAnalysis *res) {
+    PyObject *dict = PyDict_New();
+    if (!dict) {
+        return nullptr;
+    }
+    PyObject *duplicate = res->duplicate_row == ANALYSIS_NO_ROW
+                        ? Py_NewRef(Py_None)
+                        : PyLong_FromSize_t(res->duplicate_row);
+    PyObject *selected = res->row_count == cols->count
+                       ? Py_NewRef(Py_None)
+                       : select_column_buffers(views, cols, res);
+    bool ok = duplicate && selected
+           && PyDict_SetItemString(dict, "duplicate_row", duplicate) == 0
+           && PyDict_SetItemString(dict, "selected", selected) == 0
+           && DICT_SET_COLUMN(dict, res, rows, res->row_count)
+           && DICT_SET_COLUMN(dict, res, edges, res->edge_count)
+           && DICT_SET_COLUMN(dict, res, unmatched, res->unmatched_count)
+           && DICT_SET_COLUMN(dict, res, lifecycles, res->lifecycle_count)
+           && DICT_SET_COLUMN(dict, res, passes, res->pass_count)
+           && DICT_SET_COLUMN(dict, res, orphans, res->orphan_count);
+    Py_XDECREF(duplicate);
+    Py_XDECREF(selected);
+    if (!ok) {
+        Py_DECREF(dict);
+        return nullptr;
+    }
+    return dict;
+}
 
-    /* Track output errors */
-    OutputErrors output_errors = {0};
+static PyObject* py_analyze_columns(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
 
-    /* Build result */
-    PyObject *result_dict = PyDict_New();
-    if (!result_dict) {
-        free_events();
-        vt_cleanup(&obj_creation_map);
+    static char *kwlist[] = {"", "kinds", "file_pass", "workers", nullptr};
+    PyObject *columns;
+    int kinds = 0x0f;
+    PyObject *file_pass_obj = Py_None;
+    Py_ssize_t workers = 1;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|$iOn", kwlist,
+                                     &columns, &kinds, &file_pass_obj, &workers)) {
+        return nullptr;
+    }
+    if (kinds < 0 || kinds > 0x0f) {
+        PyErr_Format(PyExc_ValueError, "kinds must be a mask of 4 event types, got %d", kinds);
+        return nullptr;
+    }
+    if (workers < 1 || workers > (Py_ssize_t)ANALYSIS_MAX_WORKERS) {
+        PyErr_Format(PyExc_ValueError, "workers must be in [1, %u], got %zd",
+                     ANALYSIS_MAX_WORKERS, workers);
         return nullptr;
     }
 
-    PyObject *events_list = PyList_New(0);
-    if (!events_list) {
-        Py_DECREF(result_dict);
-        free_events();
-        vt_cleanup(&obj_creation_map);
+    Py_buffer views[COLUMN_BUFFER_COUNT];
+    size_t held = 0;
+    while (held < COLUMN_BUFFER_COUNT
+           && get_column_buffer(columns, COLUMN_BUFFERS[held].name,
+                                COLUMN_BUFFERS[held].itemsize, &views[held])) {
+        held++;
+    }
+    Py_buffer file_pass;
+    bool has_file_pass = false;
+    if (held == COLUMN_BUFFER_COUNT && file_pass_obj != Py_None) {
+        has_file_pass = PyObject_GetBuffer(file_pass_obj, &file_pass, PyBUF_C_CONTIGUOUS) == 0;
+    }
+
+    PyObject *result = nullptr;
+    ColumnsView cols;
+    if (held == COLUMN_BUFFER_COUNT && (file_pass_obj == Py_None || has_file_pass)
+        && check_column_buffers(views, has_file_pass ? &file_pass : nullptr, &cols)) {
+        ColumnFilter filter = {
+            .kinds = (uint8_t)kinds,
+            .file_pass = has_file_pass ? file_pass.buf : nullptr,
+            .file_pass_count = has_file_pass ? (size_t)file_pass.len : 0,
+        };
+        ColumnAnalysis res;
+        bool ok;
+        Py_BEGIN_ALLOW_THREADS
+        ok = analyze_columns(&cols, &filter, (unsigned)workers, &res);
+        Py_END_ALLOW_THREADS
+        if (ok) {
+            result = column_analysis_to_dict(views, &cols, &res);
+            column_analysis_destroy(&res);
+        } else {
+            PyErr_NoMemory();
+        }
+    }
+
+    if (has_file_pass) {
+        PyBuffer_Release(&file_pass);
+    }
+    for (size_t i = 0; i < held; i++) {
+        PyBuffer_Release(&views[i]);
+    }
+    return result;
+}
+
+/* ============================================================================
+ * Shared-memory collector (runs in the collector process)
+ *
+ * shm_create() makes the segment a traced process attaches to with
+ * start(shm_name=...), shm_poll() turns ring records into event dicts.
+ * Independent of tracking state: a process can collect and be traced.
+ * ============================================================================ */
+
+#define SHM_CAPSULE_NAME "archcheck._tracking.ShmCollector"
+
+/** Raw events taken from the rings per shm_consumer_poll() call. */
+constexpr size_t SHM_POLL_BATCH = 4096;
+
+typedef struct {
+    ShmSegment segment;
+    ShmConsumer *consumer;      /* nullptr after shm_close() */
+    char *name;                 /* Owned, unlinked by close */
+    pthread_mutex_t mutex;      /* One poll/close at a time */
+} ShmCollector;
+
+/** Unmap and unlink. Idempotent. Caller holds mutex (or sole owner). */
+static void shm_collector_close(ShmCollector *collector) {
+    if (!collector->consumer) {
+        return;
+    }
+    shm_consumer_free(collector->consumer);
+    collector->consumer = nullptr;
+    shm_segment_unmap(&collector->segment);
+    (void)shm_segment_unlink(collector->name);
+}
+
+static void shm_capsule_destructor(PyObject *capsule) {
+    ShmCollector *collector = PyCapsule_GetPointer(capsule, SHM_CAPSULE_NAME);
+    if (!collector) {
+        PyErr_WriteUnraisable(capsule);
+        return;
+    }
+    shm_collector_close(collector);
+    pthread_mutex_destroy(&collector->mutex);
+    free(collector->name);
+    free(collector);
+}
+
+static PyObject* py_shm_create(PyObject *self, PyObject *args, PyObject *kwargs) {
+    (void)self;
+
+    static char *kwlist[] = {"", "rings", "ring_bytes", nullptr};
+    const char *name;
+    Py_ssize_t rings = 64, ring_bytes = 1 << 20;
+    if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s|$nn", kwlist,
+                                     &name, &rings, &ring_bytes)) {
+        return nullptr;
+    }
+    if (rings < 1 || (size_t)rings > SHM_MAX_RINGS) {
+        PyErr_Format(PyExc_ValueError, "rings must be in [1, %u]", (unsigned)SHM_MAX_RINGS);
+        return nullptr;
+    }
+    uint64_t bytes = (uint64_t)ring_bytes;
+    if (ring_bytes < 1 || bytes < SHM_MIN_RING_BYTES || bytes > SHM_MAX_RING_BYTES
+        || (bytes & (bytes - 1)) != 0) {
+        PyErr_SetString(PyExc_ValueError, "ring_bytes must be a power of 2 in [4 KiB, 1 GiB]");
         return nullptr;
     }
 
-    for (size_t i = 0; i < events_count; i++) {
-        PyObject *entry = serialize_event(&events[i], i, &output_errors);
-        if (entry) {
-            PyList_Append(events_list, entry);
+    ShmCollector *collector = calloc(1, sizeof(ShmCollector));
+    char *owned_name = strdup(name);
+    if (!collector || !owned_name) {
+        free(collector);
+        free(owned_name);
+        return PyErr_NoMemory();
+    }
+    collector->name = owned_name;
+    pthread_mutex_init(&collector->mutex, nullptr);
+
+    if (!shm_segment_create(&collector->segment, name, (uint32_t)rings, bytes)) {
+        PyErr_SetFromErrnoWithFilename(PyExc_OSError, name);
+        pthread_mutex_destroy(&collector->mutex);
+        free(owned_name);
+        free(collector);
+        return nullptr;
+    }
+    collector->consumer = shm_consumer_new(&collector->segment);
+    if (!collector->consumer) {
+        shm_segment_unmap(&collector->segment);
+        (void)shm_segment_unlink(name);
+        pthread_mutex_destroy(&collector->mutex);
+        free(owned_name);
+        free(collector);
+        return PyErr_NoMemory();
+    }
+
+    /* Consumer set: the destructor unmaps and unlinks */
+    PyObject *capsule = PyCapsule_New(collector, SHM_CAPSULE_NAME, shm_capsule_destructor);
+    if (!capsule) {
+        shm_collector_close(collector);
+        pthread_mutex_destroy(&collector->mutex);
+        free(owned_name);
+        free(collector);
+    }
+    return capsule;
+}
+
+/** Collector of a capsule from shm_create(), or nullptr with TypeError set. */
+static ShmCollector* shm_collector_arg(PyObject *capsule) {
+    return PyCapsule_GetPointer(capsule, SHM_CAPSULE_NAME);
+}
+
+/**
+ * Take up to max_events events as dicts.
+ * @return {events: [...], output_errors: [...], dropped: N, done: bool}.
+ */
+static PyObject* shm_poll_locked(ShmCollector *collector, size_t max_events) {
+    /* Finished BEFORE reading: done only if nothing is left after this poll */
+    bool finished = shm_segment_finished(&collector->segment);
+    size_t batch_cap = max_events < SHM_POLL_BATCH ? max_events : SHM_POLL_BATCH;
+    RawEvent *batch = malloc(batch_cap * sizeof(RawEvent));
+    PyObject *events_list = PyList_New(0);
+    if (!batch || !events_list) {
+        free(batch);
+        Py_XDECREF(events_list);
+        return PyErr_NoMemory();
+    }
+
+    OutputErrors output_errors = {0};
+    size_t total = 0;
+    bool drained = false;
+    while (total < max_events) {
+        size_t want = max_events - total < batch_cap ? max_events - total : batch_cap;
+        size_t n = shm_consumer_poll(collector->consumer, batch, want);
+        for (size_t i = 0; i < n; i++) {
+            PyObject *entry = raw_event_to_dict(&batch[i], total + i, &output_errors);
+            if (!entry || PyList_Append(events_list, entry) < 0) {
+                Py_XDECREF(entry);
+                Py_DECREF(events_list);
+                free(batch);
+                return nullptr;
+            }
             Py_DECREF(entry);
         }
+        total += n;
+        if (n < want) {
+            drained = true;
+            break;
+        }
     }
+    free(batch);
 
-    PyDict_SetItemString(result_dict, "events", events_list);
-    Py_DECREF(events_list);
-
-    /* Output errors */
-    if (output_errors.count > 0) {
+    PyObject *result_dict = Py_BuildValue(
+        "{s:N,s:K,s:O}", "events", events_list,
+        "dropped", (unsigned long long)shm_segment_dropped(&collector->segment),
+        "done", finished && drained ? Py_True : Py_False);
+    if (result_dict && output_errors.count > 0) {
         PyObject *oe_list = output_errors_to_list(&output_errors);
         if (oe_list) {
             PyDict_SetItemString(result_dict, "output_errors", oe_list);
             Py_DECREF(oe_list);
         }
     }
-
-    free_events();
-    vt_cleanup(&obj_creation_map);
-    /* barrier already destroyed after hooks disabled (line 375) */
     return result_dict;
 }
 
-static PyObject* py_count(PyObject *self, PyObject *args) {
+static PyObject* py_shm_poll(PyObject *self, PyObject *args) {
     (void)self;
-    (void)args;
-    return PyLong_FromSize_t(events_count);
+
+    PyObject *capsule;
+    Py_ssize_t max_events;
+    if (!PyArg_ParseTuple(args, "On", &capsule, &max_events)) {
+        return nullptr;
+    }
+    if (max_events <= 0) {
+        PyErr_SetString(PyExc_ValueError, "max_events must be positive");
+        return nullptr;
+    }
+    ShmCollector *collector = shm_collector_arg(capsule);
+    if (!collector) {
+        return nullptr;
+    }
+
+    pthread_mutex_lock(&collector->mutex);
+    PyObject *result_dict = nullptr;
+    if (!collector->consumer) {
+        PyErr_SetString(PyExc_ValueError, "collector is closed");
+    } else {
+        result_dict = shm_poll_locked(collector, (size_t)max_events);
+    }
+    pthread_mutex_unlock(&collector->mutex);
+    return result_dict;
 }
 
-static PyObject* py_is_active(PyObject *self, PyObject *args) {
+static PyObject* py_shm_close(PyObject *self, PyObject *capsule) {
     (void)self;
-    (void)args;
-    return PyBool_FromLong(tracking_active);
+
+    ShmCollector *collector = shm_collector_arg(capsule);
+    if (!collector) {
+        return nullptr;
+    }
+    pthread_mutex_lock(&collector->mutex);
+    shm_collector_close(collector);
+    pthread_mutex_unlock(&collector->mutex);
+    Py_RETURN_NONE;
 }
 
-static PyObject* py_get_origin(PyObject *self, PyObject *args) {
+/* ============================================================================
+ * Fork handling
+ *
+ * os.register_at_fork() hooks (module_exec) keep a session from being
+ * copied into a forked child, where the parent's events and creation map
+ * would be stopped (and counted) a second time:
+ *   before           pause: barrier_stop() drains every section, so no
+ *                    other thread holds a tracker lock or a half-written
+ *                    record at fork(); creation_mutex is held across it
+ *                    (get_origin() takes it outside any section)
+ *   after_in_parent  resume the same session
+ *   after_in_child   drop the inherited session, open a fresh one in the
+ *                    same mode:
+ *                      trace_path  "<trace_path>.<pid>" (the parent keeps
+ *                                  its file and its buffered records)
+ *                      shm_name    none: child untraced (one producer
+ *                                  per segment)
+ *                      otherwise   in memory, returned by the child's stop()
+ *
+ * Frames running at fork() record no RETURN in the child (session check).
+ * Not paused: fork() from inside a tracked section (ref tracer callback).
+ * ============================================================================ */
+
+/* before() paused the session. Fork hooks run on the forking thread only */
+static bool fork_paused = false;
+
+static PyObject* fork_before(PyObject *self, PyObject *unused) {
     (void)self;
+    (void)unused;
+    int expected = TRACKING_ACTIVE;
+    if (barrier_in_callback()
+        || !atomic_compare_exchange_strong(&tracking_state, &expected, TRACKING_TRANSITION)) {
+        Py_RETURN_NONE;
+    }
 
-    PyObject *obj;
-    if (!PyArg_ParseTuple(args, "O", &obj)) {
-        return nullptr;
+    /* Without the GIL: a thread in a section may need it to leave */
+    Py_BEGIN_ALLOW_THREADS
+    (void)barrier_stop();
+    pthread_mutex_lock(&creation_mutex);
+    Py_END_ALLOW_THREADS
+    fork_paused = true;
+    Py_RETURN_NONE;
+}
+
+static PyObject* fork_after_parent(PyObject *self, PyObject *unused) {
+    (void)self;
+    (void)unused;
+    if (!fork_paused) {
+        Py_RETURN_NONE;
     }
+    fork_paused = false;
+    pthread_mutex_unlock(&creation_mutex);
+    barrier_resume();
+    atomic_store_explicit(&tracking_state, TRACKING_ACTIVE, memory_order_release);
+    Py_RETURN_NONE;
+}
 
-    if (!tracking_active) {
-        PyErr_SetString(PyExc_RuntimeError, "Tracking not active");
-        return nullptr;
+/**
+ * Child: leave the paused session's mode, open this process's output.
+ * @return false if the child stays untraced (exception set on failure).
+ */
+static bool fork_child_output(void) {
+    if (shm_on) {
+        /* Unmap only: finishing would tell the collector the PARENT stopped */
+        shm_segment_unmap(&shm_segment);
+        shm_on = false;
+        return false;
+    }
+    if (!trace_enabled) {
+        return true;
     }
 
-    uintptr_t obj_id = (uintptr_t)obj;
-    creation_map_itr itr = vt_get(&obj_creation_map, obj_id);
+    /* Parent's buffered records are the parent's to write */
+    trace_writer_abandon(&trace_writer);
+    trace_enabled = false;
+    PyObject *path = PyBytes_FromFormat("%s.%ld", PyBytes_AS_STRING(trace_path), (long)getpid());
+    Py_CLEAR(trace_path);
+    bool opened = path != nullptr && open_trace(path);
+    Py_XDECREF(path);
+    return opened;
+}
+
+static PyObject* fork_after_child(PyObject *self, PyObject *unused) {
+    (void)self;
+    (void)unused;
+    if (!fork_paused) {
+        Py_RETURN_NONE;
+    }
+    fork_paused = false;
+    pthread_mutex_unlock(&creation_mutex);
+
+    bool traced = fork_child_output();
+    SiteTable *sites = traced && sites_on ? site_table_new() : nullptr;
+    if (traced && sites_on && !sites) {
+        PyErr_NoMemory();
+        traced = false;
+    }
 
-    if (vt_is_end(itr)) {
+    /* Same teardown/setup as stop() + start(): only this thread survived */
+    if (!traced) {
+        PyObject *exc = PyErr_GetRaisedException();
+        if (trace_enabled) {
+            (void)close_trace();
+        }
+        Py_CLEAR(trace_path);
+        free_session();
+        remove_frame_hook(PyInterpreterState_Get());
+        PyRefTracer_SetTracer(nullptr, nullptr);
+        barrier_destroy();
+        atomic_store_explicit(&tracking_state, TRACKING_IDLE, memory_order_release);
+        /* Raised from a fork hook: reported as unraisable, fork() returns */
+        PyErr_SetRaisedException(exc);
+        if (exc) {
+            return nullptr;
+        }
         Py_RETURN_NONE;
     }
 
-    OutputErrors oe = {0};
-    return creation_info_to_dict(&itr.data->val, &oe, "origin");
+    free_session();
+    vt_init(&obj_creation_map);
+    site_table = sites;
+    string_table_init(0);
+    stack_trie_init();
+    atomic_fetch_add_explicit(&session_id, 1, memory_order_acq_rel);
+    sync_thread_stack();
+    barrier_resume();
+    atomic_store_explicit(&tracking_state, TRACKING_ACTIVE, memory_order_release);
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef fork_before_def = {
+    "_fork_before", fork_before, METH_NOARGS, nullptr};
+static PyMethodDef fork_parent_def = {
+    "_fork_after_parent", fork_after_parent, METH_NOARGS, nullptr};
+static PyMethodDef fork_child_def = {
+    "_fork_after_child", fork_after_child, METH_NOARGS, nullptr};
+
+/**
+ * os.register_at_fork(before=, after_in_parent=, after_in_child=).
+ * Hooks cannot be unregistered: they stay for the process, no-ops while idle.
+ * @return false with an exception set.
+ */
+static bool register_fork_hooks(void) {
+    PyObject *os = PyImport_ImportModule("os");
+    PyObject *kwargs = os ? Py_BuildValue("{s:N,s:N,s:N}",
+                                          "before", PyCFunction_New(&fork_before_def, nullptr),
+                                          "after_in_parent",
+                                          PyCFunction_New(&fork_parent_def, nullptr),
+                                          "after_in_child",
+                                          PyCFunction_New(&fork_child_def, nullptr))
+                          : nullptr;
+    PyObject *reg = kwargs ? PyObject_GetAttrString(os, "register_at_fork") : nullptr;
+    PyObject *no_args = reg ? PyTuple_New(0) : nullptr;
+    PyObject *done = no_args ? PyObject_Call(reg, no_args, kwargs) : nullptr;
+    Py_XDECREF(done);
+    Py_XDECREF(no_args);
+    Py_XDECREF(reg);
+    Py_XDECREF(kwargs);
+    Py_XDECREF(os);
+    return done != nullptr;
 }
 
 /* ============================================================================
@@ -500,16 +3172,60 @@ static PyObject* py_get_origin(PyObject *self, PyObject *args) {
  * ============================================================================ */
 
 static PyMethodDef methods[] = {
-    {"start", py_start, METH_NOARGS,
-     "Start tracking. Captures all events, no filtering."},
-    {"stop", py_stop, METH_NOARGS,
-     "Stop tracking and return {events: [...], output_errors: [...]}"},
+    {"start", (PyCFunction)(void(*)(void))py_start, METH_VARARGS | METH_KEYWORDS,
+     "Start tracking. Captures all events unless filtered in C (include_*, exclude_*).\n"
+     "trace_path: write events to this binary trace file instead of stop()\n"
+     "sample_every, sample_interval_ns, max_calls_per_code: sample CALLs\n"
+     "include_paths, exclude_paths, include_types: FilterConfig applied in C\n"
+     "aggregate: count (caller, callee) edges instead of recording events\n"
+     "aggregate_time: also sum inclusive time per edge\n"
+     "profile: per-function latency histograms instead of recording events\n"
+     "profile_clock: 'monotonic' (default), 'coarse' or 'tsc'\n"
+     "alloc_sites: count objects per (creation stack, type) site instead of recording events\n"
+     "capture_args: False = CALL events carry no arguments (default True)\n"
+     "backend: 'eval_frame' (default, PEP 523 hook) or 'monitoring' (sys.monitoring callbacks)\n"
+     "shm_name: export events to the segment of shm_create(shm_name) instead of stop()\n"
+     "tasks: charge call time and objects to the running asyncio task instead of recording events"},
+    {"stop", (PyCFunction)(void(*)(void))py_stop, METH_VARARGS | METH_KEYWORDS,
+     "Stop tracking and return {events: [...], output_errors: [...]}\n"
+     "columnar: return {columns: {name: bytes}, strings: [...], errors: [...]} instead\n"
+     "prefer_columnar: columnar result when recording events, mode result otherwise\n"
+     "aggregate mode: return {edges: [{caller, callee, count, total_ns}, ...]}\n"
+     "profile mode: return {clock, functions: [{function, inclusive, exclusive}, ...]}\n"
+     "alloc_sites mode: return snapshot() of the final site table\n"
+     "tasks mode: return {tasks: [{task, calls, own_ns, allocated, freed}, ...]}\n"
+     "shm_name mode: events went to the collector, return {events: []}"},
+    {"drain", py_drain, METH_VARARGS,
+     "Take up to max_events completed events: {events: [...], output_errors: [...]}"},
+    {"flush", py_flush, METH_VARARGS,
+     "Write up to max_events completed events to the trace file, return count"},
     {"count", py_count, METH_NOARGS,
      "Current event count"},
+    {"snapshot", py_snapshot, METH_NOARGS,
+     "alloc_sites mode, while tracking: {sites: [{site, allocated, freed, live, lifetime}, ...],\n"
+     "live_objects: N}"},
+    {"stats", py_stats, METH_NOARGS,
+     "Tracker counters while tracking: {events: {type: N}, dropped: {oom, stopping, shm},\n"
+     "memory: {events, creation_map, strings, stacks}, creation_map: {size, buckets},\n"
+     "strings, stacks, sites, threads, barrier: {refused, stops, stop_wait_ns},\n"
+     "hook: {samples, sampled_ns, sample_every}}"},
     {"is_active", py_is_active, METH_NOARGS,
      "Is tracking active"},
     {"get_origin", py_get_origin, METH_VARARGS,
      "Get creation info for object (while tracking is active)"},
+    {"shm_create", (PyCFunction)(void(*)(void))py_shm_create, METH_VARARGS | METH_KEYWORDS,
+     "Create shared-memory segment name for start(shm_name=name), return collector handle\n"
+     "rings: traced threads with a ring (default 64); ring_bytes: bytes per ring (default 1 MiB)"},
+    {"shm_poll", py_shm_poll, METH_VARARGS,
+     "Take up to max_events events: {events: [...], output_errors: [...], dropped, done}"},
+    {"shm_close", py_shm_close, METH_O,
+     "Unmap and unlink the segment of a collector handle (idempotent)"},
+    {"analyze_columns", (PyCFunction)(void(*)(void))py_analyze_columns,
+     METH_VARARGS | METH_KEYWORDS,
+     "Filter + call graph + object flow over stop(columnar=True) columns, GIL released\n"
+     "kinds: bit mask of kept event types; file_pass: bytes per file idx, 0 = path filtered\n"
+     "workers: threads to split the pass over; returns {rows, edges, unmatched, lifecycles,\n"
+     "passes, orphans: bytes, duplicate_row, selected: kept rows as {name: bytes} | None}"},
     {nullptr, nullptr, 0, nullptr}
 };
 
@@ -520,27 +3236,28 @@ static PyMethodDef methods[] = {
 static int module_exec(PyObject *module) {
     (void)module;
     vt_init(&obj_creation_map);
-    return 0;
+    if (!register_fork_hooks()) {
+        return -1;
+    }
+    return code_cache_init();
 }
 
 /**
  * Module slots for Python 3.14+ free-threading support.
  *
- * Current: Py_MOD_GIL_USED (safe default, GIL re-enabled on module load)
- *
- * PREREQUISITE for Py_MOD_GIL_NOT_USED (full free-threaded support):
- *   1. C atomics: DONE (barrier.c, interning.c)
- *   2. SafeCallback._lock: DONE (PHASE01 Section 1.6)
- *   3. Per-thread builders: PHASE02 Section 2.5 (builder.py)
- *
- * Without per-thread builders, parallel callbacks race on shared OMEGABuilder.
- * See: tests/unit/infrastructure/test_free_threaded_builder.py
- *
- * TODO(PHASE02 step 12): After builder.py → Py_MOD_GIL_NOT_USED
+ * Py_MOD_GIL_NOT_USED: module does not need the GIL.
+ *   - Events: per-thread buffers, global order via atomic seq
+ *   - Creation map: creation_mutex (CREATE/DESTROY may cross threads)
+ *   - Code cache: lock-free hits, mutex on miss (codecache.c)
+ *   - StringTable, barrier: internally synchronized (interning.c, barrier.c)
+ *   - drain()/flush(): drain_mutex (one consumer), published records only
+ *   - Trace file: written only by the consumer or by stop()
+ *   - start()/stop(): serialized by tracking_state CAS
+ *   - fork(): os.register_at_fork hooks pause the session (barrier drained)
  */
 static PyModuleDef_Slot module_slots[] = {
     {Py_mod_exec, module_exec},
-    {Py_mod_gil, Py_MOD_GIL_USED},
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
     {0, nullptr}
 };
 
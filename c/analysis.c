@@ -0,0 +1,563 @@
+/**
+ * Native Column Analysis Implementation
+ *
+ * Architecture:
+ *   row_state[count] — one byte per row: kept / unmatched RETURN / open
+ *                      CALL. Written only by the worker owning the row's
+ *                      thread (disjoint bytes), read by the final scan,
+ *                      which emits rows and unmatched already ascending.
+ *   Worker           — per-thread stacks (slot thread / workers), edge
+ *                      map (ColumnEdgeKey → count), open map (obj_id →
+ *                      lifecycle), lifecycles in create order, (lifecycle,
+ *                      CALL row) pass pairs, orphan rows.
+ *   Merge            — edge maps summed into one array; lifecycles and
+ *                      orphans of all workers sorted by row; passes
+ *                      regrouped per lifecycle (stable: row order kept).
+ *
+ * Memory:
+ *   1 byte per row + per worker O(distinct edges + objects + stack depth).
+ *
+ * C23: nullptr, constexpr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/analysis.h"
+#include "tracking/invariants.h"
+#include "tracking/types.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/* ============================================================================
+ * Hash tables
+ * ============================================================================ */
+
+static inline uint64_t analysis_mix(uint64_t hash, uint64_t word) {
+    hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+/* splitmix64 finalizer: obj_ids are aligned addresses, low bits are zero */
+static inline uint64_t analysis_avalanche(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline uint64_t column_edge_hash(ColumnEdgeKey key) {
+    uint64_t hash = 0;
+    hash = analysis_mix(hash, ((uint64_t)key.caller_file << 32) | key.caller_func);
+    hash = analysis_mix(hash, ((uint64_t)key.file << 32) | key.func);
+    hash = analysis_mix(hash, ((uint64_t)(uint32_t)key.caller_line << 32) | (uint32_t)key.line);
+    return analysis_avalanche(hash);
+}
+
+static inline bool column_edge_equal(ColumnEdgeKey a, ColumnEdgeKey b) {
+    return a.caller_file == b.caller_file && a.caller_func == b.caller_func
+        && a.caller_line == b.caller_line && a.file == b.file && a.func == b.func
+        && a.line == b.line;
+}
+
+/* Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME column_edge_map
+#define KEY_TY ColumnEdgeKey
+#define VAL_TY uint64_t
+#define HASH_FN column_edge_hash
+#define CMPR_FN column_edge_equal
+#include "vendor/verstable.h"
+
+#define NAME open_object_map
+#define KEY_TY uint64_t
+#define VAL_TY size_t
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+/* ============================================================================
+ * Growable arrays
+ * ============================================================================ */
+
+constexpr size_t ANALYSIS_INITIAL_CAP = 64;
+
+typedef struct {
+    size_t *data;
+    size_t len;
+    size_t cap;
+} RowVec;
+
+typedef struct {
+    size_t lifecycle;           /* Worker-local lifecycle index */
+    size_t row;                 /* CALL row */
+} PassPair;
+
+/** Make room for one more element (doubling). @return false on OOM (array kept). */
+static bool grow(void **data, size_t *cap, size_t len, size_t size) {
+    if (len < *cap) {
+        return true;
+    }
+    size_t new_cap = *cap ? *cap * 2 : ANALYSIS_INITIAL_CAP;
+    void *grown = realloc(*data, new_cap * size);
+    if (grown == nullptr) {
+        return false;
+    }
+    *data = grown;
+    *cap = new_cap;
+    return true;
+}
+
+#define PUSH(array, len, cap, value) \
+    (grow((void **)&(array), &(cap), (len), sizeof(*(array))) && ((array)[(len)++] = (value), true))
+
+static inline bool rowvec_push(RowVec *vec, size_t row) {
+    return PUSH(vec->data, vec->len, vec->cap, row);
+}
+
+/* ============================================================================
+ * Worker
+ * ============================================================================ */
+
+/* row_state bits */
+constexpr uint8_t ROW_KEPT = 1;
+constexpr uint8_t ROW_UNMATCHED = 2;
+
+typedef struct {
+    const ColumnsView *cols;
+    const ColumnFilter *filter;
+    uint8_t *row_state;
+    unsigned index;
+    unsigned workers;
+
+    /* Call graph: threads with thread % workers == index */
+    RowVec *stacks;             /* Slot thread / workers */
+    size_t stack_slots;
+    column_edge_map edges;
+
+    /* Object flow: objects with owner(obj_id) == index */
+    open_object_map open;
+    ColumnLifecycle *lifecycles;
+    size_t lifecycle_count;
+    size_t lifecycle_cap;
+    PassPair *pairs;
+    size_t pair_count;
+    size_t pair_cap;
+    size_t *passes;             /* Grouped by lifecycle at the end of worker_run() */
+    RowVec orphans;
+    size_t duplicate_row;
+
+    bool oom;
+} Worker;
+
+static inline bool owns_object(const Worker *w, uint64_t obj_id) {
+    return w->workers == 1 || analysis_avalanche(obj_id) % w->workers == w->index;
+}
+
+static inline bool row_kept(const ColumnsView *cols, const ColumnFilter *filter, size_t row) {
+    uint8_t kind = cols->kind[row];
+    if (((filter->kinds >> kind) & 1u) == 0) {
+        return false;
+    }
+    uint32_t file = cols->file[row];
+    if ((kind == EVENT_CALL || kind == EVENT_RETURN) && file != 0 && filter->file_pass != nullptr) {
+        REQUIRE(file < filter->file_pass_count, "analyze_columns: file idx outside file_pass");
+        return filter->file_pass[file] != 0;
+    }
+    return true;
+}
+
+/** Stack of thread (owned by w). @return nullptr on OOM. */
+static RowVec* worker_stack(Worker *w, uint32_t thread) {
+    size_t slot = thread / w->workers;
+    if (slot >= w->stack_slots) {
+        size_t slots = w->stack_slots ? w->stack_slots : 4;
+        while (slots <= slot) {
+            slots *= 2;
+        }
+        RowVec *grown = realloc(w->stacks, slots * sizeof(RowVec));
+        if (grown == nullptr) {
+            return nullptr;
+        }
+        for (size_t i = w->stack_slots; i < slots; i++) {
+            grown[i] = (RowVec){0};
+        }
+        w->stacks = grown;
+        w->stack_slots = slots;
+    }
+    return &w->stacks[slot];
+}
+
+static bool worker_call(Worker *w, size_t row) {
+    RowVec *stack = worker_stack(w, w->cols->thread[row]);
+    return stack != nullptr && rowvec_push(stack, row);
+}
+
+static bool worker_return(Worker *w, size_t row) {
+    const ColumnsView *c = w->cols;
+    RowVec *stack = worker_stack(w, c->thread[row]);
+    if (stack == nullptr) {
+        return false;
+    }
+    if (stack->len == 0) {
+        /* RETURN without matching CALL (Data Completeness) */
+        w->row_state[row] |= ROW_UNMATCHED;
+        return true;
+    }
+
+    size_t call = stack->data[--stack->len];
+    /* Skip if no caller info (file=None) or self-loop */
+    if (c->caller_func[call] == 0 || c->caller_file[call] == 0) {
+        return true;
+    }
+    ColumnEdgeKey key = {
+        .caller_file = c->caller_file[call],
+        .caller_func = c->caller_func[call],
+        .caller_line = c->caller_line[call],
+        .file = c->file[call],
+        .func = c->func[call],
+        .line = c->line[call],
+    };
+    if (key.caller_file == key.file && key.caller_func == key.func && key.caller_line == key.line) {
+        return true;
+    }
+    column_edge_map_itr itr = vt_get_or_insert(&w->edges, key, 0);
+    if (vt_is_end(itr)) {
+        return false;
+    }
+    itr.data->val++;
+    return true;
+}
+
+static bool worker_create(Worker *w, size_t row) {
+    uint64_t obj_id = w->cols->obj_id[row];
+    if (!vt_is_end(vt_get(&w->open, obj_id))) {
+        /* Duplicate CREATE without DESTROY: object flow stops here (C bug) */
+        w->duplicate_row = row;
+        return true;
+    }
+    ColumnLifecycle lifecycle = {
+        .create_row = row,
+        .destroy_row = ANALYSIS_NO_ROW,
+    };
+    size_t index = w->lifecycle_count;
+    return PUSH(w->lifecycles, w->lifecycle_count, w->lifecycle_cap, lifecycle)
+        && !vt_is_end(vt_insert(&w->open, obj_id, index));
+}
+
+static bool worker_destroy(Worker *w, size_t row) {
+    open_object_map_itr itr = vt_get(&w->open, w->cols->obj_id[row]);
+    if (vt_is_end(itr)) {
+        /* DESTROY without CREATE (Data Completeness) */
+        return rowvec_push(&w->orphans, row);
+    }
+    w->lifecycles[itr.data->val].destroy_row = row;
+    vt_erase_itr(&w->open, itr);
+    return true;
+}
+
+static bool worker_passed(Worker *w, uint64_t obj_id, size_t row) {
+    open_object_map_itr itr = vt_get(&w->open, obj_id);
+    if (vt_is_end(itr)) {
+        return true;
+    }
+    PassPair pair = {.lifecycle = itr.data->val, .row = row};
+    w->lifecycles[pair.lifecycle].pass_count++;
+    return PUSH(w->pairs, w->pair_count, w->pair_cap, pair);
+}
+
+/** The pass: every kept row once, work split by owner. */
+static void worker_run(Worker *w) {
+    const ColumnsView *c = w->cols;
+    size_t arg = 0;
+    bool ok = true;
+
+    for (size_t row = 0; ok && row < c->count; row++) {
+        size_t args = arg;
+        arg += c->arg_count[row];
+        if (!row_kept(c, w->filter, row)) {
+            continue;
+        }
+
+        uint8_t kind = c->kind[row];
+        bool own_thread = c->thread[row] % w->workers == w->index;
+        bool objects = w->duplicate_row == ANALYSIS_NO_ROW;
+        if (own_thread) {
+            w->row_state[row] |= ROW_KEPT;
+        }
+
+        switch (kind) {
+            case EVENT_CALL:
+                ok = !own_thread || worker_call(w, row);
+                for (size_t j = args; ok && objects && j < arg; j++) {
+                    ok = !owns_object(w, c->arg_id[j]) || worker_passed(w, c->arg_id[j], row);
+                }
+                break;
+            case EVENT_RETURN:
+                ok = !own_thread || worker_return(w, row);
+                break;
+            case EVENT_CREATE:
+                ok = !objects || !owns_object(w, c->obj_id[row]) || worker_create(w, row);
+                break;
+            case EVENT_DESTROY:
+                ok = !objects || !owns_object(w, c->obj_id[row]) || worker_destroy(w, row);
+                break;
+            default:
+                UNREACHABLE("analyze_columns: invalid kind");
+        }
+    }
+
+    /* Remaining CALLs on stacks are unmatched (Data Completeness) */
+    for (size_t s = 0; ok && s < w->stack_slots; s++) {
+        for (size_t i = 0; i < w->stacks[s].len; i++) {
+            w->row_state[w->stacks[s].data[i]] |= ROW_UNMATCHED;
+        }
+    }
+
+    /* Group pass rows by lifecycle (counting sort, stable) */
+    if (ok && w->pair_count > 0) {
+        w->passes = malloc(w->pair_count * sizeof(size_t));
+        ok = w->passes != nullptr;
+    }
+    if (ok) {
+        size_t start = 0;
+        for (size_t i = 0; i < w->lifecycle_count; i++) {
+            w->lifecycles[i].pass_start = start;
+            start += w->lifecycles[i].pass_count;
+            w->lifecycles[i].pass_count = 0;
+        }
+        for (size_t i = 0; i < w->pair_count; i++) {
+            ColumnLifecycle *lifecycle = &w->lifecycles[w->pairs[i].lifecycle];
+            w->passes[lifecycle->pass_start + lifecycle->pass_count++] = w->pairs[i].row;
+        }
+    }
+    w->oom = !ok;
+}
+
+static void* worker_thread(void *arg) {
+    worker_run(arg);
+    return nullptr;
+}
+
+static void worker_init(Worker *w, const ColumnsView *cols, const ColumnFilter *filter,
+                        uint8_t *row_state, unsigned index, unsigned workers) {
+    *w = (Worker){
+        .cols = cols,
+        .filter = filter,
+        .row_state = row_state,
+        .index = index,
+        .workers = workers,
+        .duplicate_row = ANALYSIS_NO_ROW,
+    };
+    vt_init(&w->edges);
+    vt_init(&w->open);
+}
+
+static void worker_destroy_state(Worker *w) {
+    for (size_t s = 0; s < w->stack_slots; s++) {
+        free(w->stacks[s].data);
+    }
+    free(w->stacks);
+    vt_cleanup(&w->edges);
+    vt_cleanup(&w->open);
+    free(w->lifecycles);
+    free(w->pairs);
+    free(w->passes);
+    free(w->orphans.data);
+}
+
+/* ============================================================================
+ * Merge
+ * ============================================================================ */
+
+typedef struct {
+    ColumnLifecycle lifecycle;
+    const size_t *passes;       /* Worker's grouped passes */
+} LifecycleRef;
+
+static int row_compare(const void *a, const void *b) {
+    size_t x = *(const size_t *)a;
+    size_t y = *(const size_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int lifecycle_compare(const void *a, const void *b) {
+    size_t x = ((const LifecycleRef *)a)->lifecycle.create_row;
+    size_t y = ((const LifecycleRef *)b)->lifecycle.create_row;
+    return (x > y) - (x < y);
+}
+
+/** Rows and unmatched (two groups) from row_state, ascending. */
+static bool merge_rows(const ColumnsView *cols, const uint8_t *row_state, ColumnAnalysis *out) {
+    size_t kept = 0;
+    size_t unmatched = 0;
+    for (size_t row = 0; row < cols->count; row++) {
+        kept += (row_state[row] & ROW_KEPT) != 0;
+        unmatched += (row_state[row] & ROW_UNMATCHED) != 0;
+    }
+    out->rows = malloc((kept ? kept : 1) * sizeof(size_t));
+    out->unmatched = malloc((unmatched ? unmatched : 1) * sizeof(size_t));
+    if (out->rows == nullptr || out->unmatched == nullptr) {
+        return false;
+    }
+
+    /* Unmatched RETURNs first, then open CALLs: Python column order */
+    for (size_t row = 0; row < cols->count; row++) {
+        if (row_state[row] & ROW_KEPT) {
+            out->rows[out->row_count++] = row;
+        }
+        if ((row_state[row] & ROW_UNMATCHED) && cols->kind[row] == EVENT_RETURN) {
+            out->unmatched[out->unmatched_count++] = row;
+        }
+    }
+    for (size_t row = 0; row < cols->count; row++) {
+        if ((row_state[row] & ROW_UNMATCHED) && cols->kind[row] == EVENT_CALL) {
+            out->unmatched[out->unmatched_count++] = row;
+        }
+    }
+    return true;
+}
+
+static bool merge_edges(Worker *workers, unsigned n, ColumnAnalysis *out) {
+    column_edge_map *dst = &workers[0].edges;
+    for (unsigned w = 1; w < n; w++) {
+        column_edge_map *src = &workers[w].edges;
+        for (column_edge_map_itr itr = vt_first(src); !vt_is_end(itr); itr = vt_next(itr)) {
+            column_edge_map_itr slot = vt_get_or_insert(dst, itr.data->key, 0);
+            if (vt_is_end(slot)) {
+                return false;
+            }
+            slot.data->val += itr.data->val;
+        }
+    }
+
+    size_t count = vt_size(dst);
+    out->edges = malloc((count ? count : 1) * sizeof(ColumnEdge));
+    if (out->edges == nullptr) {
+        return false;
+    }
+    for (column_edge_map_itr itr = vt_first(dst); !vt_is_end(itr); itr = vt_next(itr)) {
+        out->edges[out->edge_count++] = (ColumnEdge){.key = itr.data->key, .count = itr.data->val};
+    }
+    return true;
+}
+
+static bool merge_objects(Worker *workers, unsigned n, ColumnAnalysis *out) {
+    size_t lifecycles = 0;
+    size_t passes = 0;
+    size_t orphans = 0;
+    for (unsigned w = 0; w < n; w++) {
+        lifecycles += workers[w].lifecycle_count;
+        passes += workers[w].pair_count;
+        orphans += workers[w].orphans.len;
+        if (workers[w].duplicate_row < out->duplicate_row) {
+            out->duplicate_row = workers[w].duplicate_row;
+        }
+    }
+
+    LifecycleRef *refs = malloc((lifecycles ? lifecycles : 1) * sizeof(LifecycleRef));
+    out->lifecycles = malloc((lifecycles ? lifecycles : 1) * sizeof(ColumnLifecycle));
+    out->passes = malloc((passes ? passes : 1) * sizeof(size_t));
+    out->orphans = malloc((orphans ? orphans : 1) * sizeof(size_t));
+    if (refs == nullptr || out->lifecycles == nullptr || out->passes == nullptr
+        || out->orphans == nullptr) {
+        free(refs);
+        return false;
+    }
+
+    size_t r = 0;
+    for (unsigned w = 0; w < n; w++) {
+        for (size_t i = 0; i < workers[w].lifecycle_count; i++) {
+            refs[r++] = (LifecycleRef){.lifecycle = workers[w].lifecycles[i],
+                                       .passes = workers[w].passes};
+        }
+        for (size_t i = 0; i < workers[w].orphans.len; i++) {
+            out->orphans[out->orphan_count++] = workers[w].orphans.data[i];
+        }
+    }
+    if (n > 1) {
+        qsort(refs, lifecycles, sizeof(LifecycleRef), lifecycle_compare);
+        qsort(out->orphans, out->orphan_count, sizeof(size_t), row_compare);
+    }
+
+    for (size_t i = 0; i < lifecycles; i++) {
+        ColumnLifecycle lifecycle = refs[i].lifecycle;
+        const size_t *src = refs[i].passes + lifecycle.pass_start;
+        lifecycle.pass_start = out->pass_count;
+        for (size_t j = 0; j < lifecycle.pass_count; j++) {
+            out->passes[out->pass_count++] = src[j];
+        }
+        out->lifecycles[out->lifecycle_count++] = lifecycle;
+    }
+    free(refs);
+    return true;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+bool analyze_columns(const ColumnsView *cols, const ColumnFilter *filter, unsigned workers,
+                     ColumnAnalysis *out) {
+    REQUIRE(cols != nullptr && filter != nullptr && out != nullptr,
+            "analyze_columns: arguments must not be null");
+    REQUIRE(workers >= 1 && workers <= ANALYSIS_MAX_WORKERS,
+            "analyze_columns: workers out of range");
+
+    uint8_t *row_state = calloc(cols->count ? cols->count : 1, 1);
+    Worker *pool = malloc(workers * sizeof(Worker));
+    if (row_state == nullptr || pool == nullptr) {
+        free(row_state);
+        free(pool);
+        return false;
+    }
+    for (unsigned w = 0; w < workers; w++) {
+        worker_init(&pool[w], cols, filter, row_state, w, workers);
+    }
+
+    /* Worker 0 runs here; one that cannot get a thread runs here too */
+    pthread_t threads[ANALYSIS_MAX_WORKERS];
+    bool started[ANALYSIS_MAX_WORKERS] = {false};
+    for (unsigned w = 1; w < workers; w++) {
+        started[w] = pthread_create(&threads[w], nullptr, worker_thread, &pool[w]) == 0;
+    }
+    worker_run(&pool[0]);
+    bool ok = !pool[0].oom;
+    for (unsigned w = 1; w < workers; w++) {
+        if (started[w]) {
+            pthread_join(threads[w], nullptr);
+        } else {
+            worker_run(&pool[w]);
+        }
+        ok = ok && !pool[w].oom;
+    }
+
+    ColumnAnalysis res = {.duplicate_row = ANALYSIS_NO_ROW};
+    ok = ok && merge_rows(cols, row_state, &res) && merge_edges(pool, workers, &res)
+         && merge_objects(pool, workers, &res);
+
+    for (unsigned w = 0; w < workers; w++) {
+        worker_destroy_state(&pool[w]);
+    }
+    free(pool);
+    free(row_state);
+
+    if (!ok) {
+        column_analysis_destroy(&res);
+        return false;
+    }
+    *out = res;
+    return true;
+}
+
+void column_analysis_destroy(ColumnAnalysis *res) {
+    REQUIRE(res != nullptr, "column_analysis_destroy: result must not be null");
+
+    free(res->rows);
+    free(res->edges);
+    free(res->unmatched);
+    free(res->lifecycles);
+    free(res->passes);
+    free(res->orphans);
+    *res = (ColumnAnalysis){.duplicate_row = ANALYSIS_NO_ROW};
+}
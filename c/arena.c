@@ -0,0 +1,140 @@
+/**
+ * Session Arena Implementation
+ *
+ * Architecture:
+ *   head → block → block → ... (newest first)
+ *   Each block: header + data, one anonymous mmap. alloc() bumps head->used;
+ *   a request that does not fit maps a new block (the old tail is wasted,
+ *   at most one request's worth per block). Oversized requests get a block
+ *   of their own, linked BEHIND head so the current block keeps filling.
+ *
+ * Memory:
+ *   Mapped pages are committed on first touch, so a fresh 1 MB block costs
+ *   only the pages actually used.
+ *
+ * C23: constexpr, nullptr
+ * POSIX: mmap/munmap
+ * FAIL-FIRST: abort on contract violation; OOM returns nullptr (valid state)
+ */
+
+#include "tracking/arena.h"
+#include "tracking/invariants.h"
+
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* ============================================================================
+ * Block
+ * ============================================================================ */
+
+struct ArenaBlock {
+    ArenaBlock *next;       /* Older block */
+    size_t size;            /* Mapped bytes, header included */
+    size_t used;            /* Bytes used, header included */
+};
+
+/** Largest supported alignment: blocks are page-aligned. */
+constexpr size_t ARENA_MAX_ALIGN = 4096;
+
+static inline size_t page_size(void) {
+    long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? (size_t)size : 4096;
+}
+
+static inline size_t round_up(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+}
+
+/** Map a block of at least size bytes. @return nullptr on OOM. */
+static ArenaBlock* block_map(Arena *arena, size_t size) {
+    size = round_up(size, page_size());
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return nullptr;
+    }
+    ArenaBlock *block = mem;
+    block->next = nullptr;
+    block->size = size;
+    block->used = sizeof(ArenaBlock);
+    arena->mapped += size;
+    return block;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+void arena_init(Arena *arena, size_t block_size) {
+    REQUIRE(arena != nullptr, "arena_init: arena must not be null");
+
+    arena->head = nullptr;
+    arena->block_size = round_up(block_size == 0 ? ARENA_DEFAULT_BLOCK_SIZE : block_size,
+                                 page_size());
+    arena->bytes = 0;
+    arena->mapped = 0;
+}
+
+void arena_destroy(Arena *arena) {
+    REQUIRE(arena != nullptr, "arena_destroy: arena must not be null");
+
+    ArenaBlock *block = arena->head;
+    while (block != nullptr) {
+        ArenaBlock *next = block->next;
+        munmap(block, block->size);
+        block = next;
+    }
+    arena->head = nullptr;
+    arena->bytes = 0;
+    arena->mapped = 0;
+}
+
+void* arena_alloc(Arena *arena, size_t size, size_t align) {
+    REQUIRE(arena != nullptr, "arena_alloc: arena must not be null");
+    REQUIRE(align != 0 && (align & (align - 1)) == 0 && align <= ARENA_MAX_ALIGN,
+            "arena_alloc: align must be a power of 2 <= 4096");
+
+    ArenaBlock *block = arena->head;
+    if (block != nullptr) {
+        size_t offset = round_up(block->used, align);
+        if (offset <= block->size && size <= block->size - offset) {
+            block->used = offset + size;
+            arena->bytes += size;
+            return (unsigned char *)block + offset;
+        }
+    }
+
+    size_t need = round_up(sizeof(ArenaBlock), align) + size;
+    if (need < size) {
+        return nullptr;  /* Overflow: treat as OOM */
+    }
+
+    if (need > arena->block_size) {
+        /* Dedicated block behind head: the current block keeps filling */
+        ArenaBlock *big = block_map(arena, need);
+        if (big == nullptr) {
+            return nullptr;
+        }
+        big->used = big->size;
+        if (block != nullptr) {
+            big->next = block->next;
+            block->next = big;
+        } else {
+            arena->head = big;
+        }
+        arena->bytes += size;
+        return (unsigned char *)big + round_up(sizeof(ArenaBlock), align);
+    }
+
+    ArenaBlock *fresh = block_map(arena, arena->block_size);
+    if (fresh == nullptr) {
+        return nullptr;
+    }
+    fresh->next = block;
+    arena->head = fresh;
+
+    size_t offset = round_up(fresh->used, align);
+    fresh->used = offset + size;
+    arena->bytes += size;
+    return (unsigned char *)fresh + offset;
+}
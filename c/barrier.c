@@ -1,42 +1,71 @@
 /**
  * Stop Barrier Implementation
  *
- * Reference counting + condition variable barrier.
+ * Per-thread reference counts + condition variable barrier.
  *
  * Architecture:
- *   g_barrier.active_callbacks — atomic counter, in-flight protected sections
- *   g_barrier.stopping         — atomic flag, prevents new entries
- *   g_barrier.mutex/cond       — barrier synchronization for stop()
- *   tl_callback_depth          — thread-local depth for stop-from-callback detection
+ *   BarrierSlot.active     — in-flight sections of ONE thread, own cache line:
+ *                            enter/leave never touch a line shared with
+ *                            another thread (free-threaded CALL path)
+ *   g_slots                — registry of slots, push-only, walked by stop()
+ *   g_barrier.stopping     — atomic flag, prevents new entries
+ *   g_barrier.mutex/cond   — barrier synchronization for stop()
+ *   tl_slot                — this thread's slot (claimed on first enter)
+ *   tl_callback_depth      — thread-local depth for stop-from-callback detection
+ *   g_barrier.refused/...  — contention counters, bumped on slow paths only
+ *
+ * Slot Lifetime:
+ *   Slots live for the process. Thread exit releases the slot (pthread key
+ *   destructor), the next new thread reuses it: registry size is bounded
+ *   by peak concurrent threads, not by threads ever created.
  *
  * State Handling:
  *   UNINITIALIZED/DESTROYED: try_enter() returns false, leave() is no-op
  *   ACTIVE:                  normal operation
  *   STOPPING:                try_enter() returns false, leave() signals
  *
- * Memory Ordering:
- *   - stopping: acquire on read, release on write
- *   - active_callbacks: acq_rel on increment/decrement
- *   - Ensures protected section cannot access freed resources
+ * Memory Ordering (Dekker pattern, both sides seq_cst):
+ *   enter: slot.active++ then load stopping
+ *   stop:  store stopping then load every slot.active
+ *   At least one side sees the other: either enter backs out, or stop
+ *   waits for it. Slots are pushed under g_slots_mutex before their first
+ *   increment, and stop() scans under it, so no slot is missed.
  *
- * C23: constexpr, nullptr, _Atomic, bool
- * POSIX: pthread (TSan-compatible, NOT C11 threads.h)
+ * C23: constexpr, nullptr, alignas, _Atomic, bool
+ * POSIX: pthread (TSan-compatible, NOT C11 threads.h), clock_gettime()
  */
 
+#define _GNU_SOURCE
+
 #include "tracking/barrier.h"
 #include "tracking/invariants.h"
 
 #include <pthread.h>
 #include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
 
 /* ============================================================================
  * Global State
  * ============================================================================ */
 
-typedef struct {
-    /* Reference counting */
-    _Atomic(int64_t) active_callbacks;
+constexpr size_t BARRIER_CACHE_LINE = 64;
+
+typedef struct BarrierSlot {
+    /* Reference count of the owning thread (nesting included) */
+    alignas(BARRIER_CACHE_LINE) _Atomic(int64_t) active;
 
+    /* Claimed by a live thread */
+    _Atomic(bool) owned;
+
+    /* Registry link, immutable after push */
+    struct BarrierSlot *next;
+} BarrierSlot;
+
+static_assert(sizeof(BarrierSlot) % BARRIER_CACHE_LINE == 0,
+              "BarrierSlot must fill whole cache lines (no false sharing)");
+
+typedef struct {
     /* Stop flag */
     _Atomic(bool) stopping;
 
@@ -46,13 +75,109 @@ typedef struct {
 
     /* Lifecycle: true between init() and destroy() */
     bool initialized;
+
+    /* Contention (barrier_stats): written on slow paths only */
+    _Atomic(uint64_t) refused;
+    _Atomic(uint64_t) stops;
+    _Atomic(uint64_t) stop_wait_ns;
 } Barrier;
 
 static Barrier g_barrier = {0};
 
+/* Slot registry: push under g_slots_mutex, never freed */
+static _Atomic(BarrierSlot *) g_slots = nullptr;
+static pthread_mutex_t g_slots_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Releases a thread's slot at thread exit */
+static pthread_key_t g_slot_key;
+static pthread_once_t g_slot_key_once = PTHREAD_ONCE_INIT;
+
+/* This thread's slot: nullptr until first enter */
+static _Thread_local BarrierSlot *tl_slot = nullptr;
+
 /* Thread-local depth: detect stop-from-callback, support nested enter/leave */
 static _Thread_local int tl_callback_depth = 0;
 
+/* ============================================================================
+ * Slot Registry
+ * ============================================================================ */
+
+/** Thread exit: slot free for reuse (the thread left every section). */
+static void release_slot(void *slot) {
+    atomic_store_explicit(&((BarrierSlot *)slot)->owned, false, memory_order_release);
+}
+
+static void create_slot_key(void) {
+    int result = pthread_key_create(&g_slot_key, release_slot);
+    REQUIRE(result == 0, "pthread_key_create failed");
+}
+
+/**
+ * Claim a free slot, or register a new one.
+ * FAIL-FIRST: Aborts on allocation failure (as init()).
+ */
+static BarrierSlot* acquire_slot(void) {
+    pthread_once(&g_slot_key_once, create_slot_key);
+
+    BarrierSlot *slot = atomic_load_explicit(&g_slots, memory_order_acquire);
+    for (; slot != nullptr; slot = slot->next) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&slot->owned, &expected, true)) {
+            break;
+        }
+    }
+
+    if (slot == nullptr) {
+        slot = aligned_alloc(BARRIER_CACHE_LINE, sizeof(BarrierSlot));
+        REQUIRE(slot != nullptr, "barrier slot allocation failed");
+        atomic_init(&slot->active, 0);
+        atomic_init(&slot->owned, true);
+
+        pthread_mutex_lock(&g_slots_mutex);
+        slot->next = atomic_load_explicit(&g_slots, memory_order_relaxed);
+        atomic_store_explicit(&g_slots, slot, memory_order_release);
+        pthread_mutex_unlock(&g_slots_mutex);
+    }
+
+    int result = pthread_setspecific(g_slot_key, slot);
+    REQUIRE(result == 0, "pthread_setspecific failed");
+    tl_slot = slot;
+    return slot;
+}
+
+static uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void count_refused(void) {
+    atomic_fetch_add_explicit(&g_barrier.refused, 1, memory_order_relaxed);
+}
+
+/** Sum of all slots (seq_cst: pairs with enter, see Memory Ordering). */
+static int64_t active_total(void) {
+    int64_t total = 0;
+    BarrierSlot *slot = atomic_load_explicit(&g_slots, memory_order_acquire);
+    for (; slot != nullptr; slot = slot->next) {
+        total += atomic_load(&slot->active);
+    }
+    return total;
+}
+
+/**
+ * Drop one reference of this thread's slot.
+ * Wakes stop() (under its mutex: no lost wakeup) when this slot drains.
+ */
+static void slot_release(BarrierSlot *slot) {
+    int64_t prev = atomic_fetch_sub(&slot->active, 1);
+    if (prev == 1 && atomic_load(&g_barrier.stopping)) {
+        pthread_mutex_lock(&g_barrier.mutex);
+        pthread_cond_broadcast(&g_barrier.cond);
+        pthread_mutex_unlock(&g_barrier.mutex);
+    }
+}
+
 /* ============================================================================
  * Lifecycle
  * ============================================================================ */
@@ -63,8 +188,15 @@ void barrier_init(void) {
         return;
     }
 
-    atomic_store(&g_barrier.active_callbacks, 0);
+    /* Late leaves after destroy() were no-ops: start from zero */
+    BarrierSlot *slot = atomic_load_explicit(&g_slots, memory_order_acquire);
+    for (; slot != nullptr; slot = slot->next) {
+        atomic_store(&slot->active, 0);
+    }
     atomic_store(&g_barrier.stopping, false);
+    atomic_store(&g_barrier.refused, 0);
+    atomic_store(&g_barrier.stops, 0);
+    atomic_store(&g_barrier.stop_wait_ns, 0);
 
     int result = pthread_mutex_init(&g_barrier.mutex, nullptr);
     REQUIRE(result == 0, "pthread_mutex_init failed");
@@ -103,25 +235,23 @@ bool barrier_try_enter(void) {
 
     /* Fast path: already stopping */
     if (atomic_load_explicit(&g_barrier.stopping, memory_order_acquire)) {
+        count_refused();
         return false;
     }
 
-    /* Increment BEFORE entering protected section (acquire-release) */
-    atomic_fetch_add_explicit(&g_barrier.active_callbacks, 1, memory_order_acq_rel);
+    BarrierSlot *slot = tl_slot ? tl_slot : acquire_slot();
+
+    /* Increment BEFORE entering protected section (own cache line) */
+    atomic_fetch_add(&slot->active, 1);
 
     /*
      * Double-check after increment (handle race with stop).
      * Scenario: stop() set flag between our check and increment.
      * Must decrement and return false.
      */
-    if (atomic_load_explicit(&g_barrier.stopping, memory_order_acquire)) {
-        int64_t prev = atomic_fetch_sub_explicit(
-            &g_barrier.active_callbacks, 1, memory_order_acq_rel);
-
-        /* Signal stop waiter if we were the last one */
-        if (prev == 1) {
-            pthread_cond_signal(&g_barrier.cond);
-        }
+    if (atomic_load(&g_barrier.stopping)) {
+        slot_release(slot);
+        count_refused();
         return false;
     }
 
@@ -149,14 +279,8 @@ void barrier_leave(void) {
 
     tl_callback_depth--;
 
-    /* Decrement AFTER leaving protected section (release) */
-    int64_t prev = atomic_fetch_sub_explicit(
-        &g_barrier.active_callbacks, 1, memory_order_acq_rel);
-
-    /* Signal stop waiter if count reaches 0 during stopping */
-    if (prev == 1 && atomic_load_explicit(&g_barrier.stopping, memory_order_acquire)) {
-        pthread_cond_signal(&g_barrier.cond);
-    }
+    /* Decrement AFTER leaving protected section */
+    slot_release(tl_slot);
 }
 
 StopResult barrier_stop(void) {
@@ -186,19 +310,48 @@ StopResult barrier_stop(void) {
     }
 
     /* Signal: no new entries accepted */
-    atomic_store_explicit(&g_barrier.stopping, true, memory_order_release);
-
-    /* Wait: all in-flight protected sections complete */
-    while (atomic_load_explicit(&g_barrier.active_callbacks, memory_order_acquire) > 0) {
+    atomic_store(&g_barrier.stopping, true);
+
+    /* Wait: all in-flight protected sections complete (slow scan).
+     * Scanned under g_slots_mutex: a slot pushed after the scan was
+     * pushed after stopping was set, its enter backs out. */
+    uint64_t wait_start = 0;
+    for (;;) {
+        pthread_mutex_lock(&g_slots_mutex);
+        int64_t active = active_total();
+        pthread_mutex_unlock(&g_slots_mutex);
+        if (active == 0) {
+            break;
+        }
+        if (wait_start == 0) {
+            wait_start = monotonic_ns();
+        }
         pthread_cond_wait(&g_barrier.cond, &g_barrier.mutex);
     }
+    if (wait_start != 0) {
+        atomic_fetch_add_explicit(&g_barrier.stops, 1, memory_order_relaxed);
+        atomic_fetch_add_explicit(&g_barrier.stop_wait_ns, monotonic_ns() - wait_start,
+                                  memory_order_relaxed);
+    }
 
-    /* NOW SAFE: active_callbacks == 0, no new entries possible */
+    /* NOW SAFE: every slot == 0, no new entries possible */
     pthread_mutex_unlock(&g_barrier.mutex);
 
     return STOP_OK;
 }
 
+void barrier_resume(void) {
+    /* Graceful: nothing to resume before init() or after destroy() */
+    if (!g_barrier.initialized) {
+        return;
+    }
+
+    /* Under the mutex: serializes with a concurrent stop() */
+    pthread_mutex_lock(&g_barrier.mutex);
+    atomic_store(&g_barrier.stopping, false);
+    pthread_mutex_unlock(&g_barrier.mutex);
+}
+
 /* ============================================================================
  * Dispatch API
  * ============================================================================ */
@@ -232,9 +385,17 @@ int64_t barrier_active_count(void) {
     if (!g_barrier.initialized) {
         return 0;
     }
-    return atomic_load_explicit(&g_barrier.active_callbacks, memory_order_acquire);
+    return active_total();
 }
 
 bool barrier_in_callback(void) {
     return tl_callback_depth > 0;
 }
+
+void barrier_stats(BarrierStats *out) {
+    *out = (BarrierStats){
+        .refused = atomic_load_explicit(&g_barrier.refused, memory_order_relaxed),
+        .stops = atomic_load_explicit(&g_barrier.stops, memory_order_relaxed),
+        .stop_wait_ns = atomic_load_explicit(&g_barrier.stop_wait_ns, memory_order_relaxed),
+    };
+}
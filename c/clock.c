@@ -0,0 +1,99 @@
+/**
+ * Profiling Clock Implementation
+ *
+ * TSC calibration:
+ *   Spin ~10 ms on CLOCK_MONOTONIC, read RDTSC at both ends:
+ *   ns_per_tick = Δns / Δticks. Done once per process (pthread_once);
+ *   an invariant TSC runs at a constant rate across cores and P-states.
+ *
+ * C23: constexpr, nullptr
+ * POSIX: clock_gettime(), pthread_once()
+ */
+
+#define _GNU_SOURCE
+
+#include "tracking/clock.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#if PROFILE_CLOCK_HAS_TSC
+#include <cpuid.h>
+#endif
+
+/* ============================================================================
+ * TSC
+ * ============================================================================ */
+
+/** Calibration window. Longer = more precise ratio, slower first start(). */
+constexpr uint64_t TSC_CALIBRATION_NS = 10 * 1000 * 1000;
+
+static pthread_once_t g_tsc_once = PTHREAD_ONCE_INIT;
+static double g_tsc_ns_per_tick = 0.0;     /* 0 = TSC unusable */
+
+static inline uint64_t monotonic_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void tsc_calibrate(void) {
+#if PROFILE_CLOCK_HAS_TSC
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || (edx & (1u << 8)) == 0) {
+        return;  /* No invariant TSC: rate may change with frequency */
+    }
+
+    uint64_t ns_start = monotonic_ns();
+    uint64_t tsc_start = (uint64_t)__rdtsc();
+    uint64_t ns_end = ns_start;
+    while (ns_end - ns_start < TSC_CALIBRATION_NS) {
+        ns_end = monotonic_ns();
+    }
+    uint64_t tsc_end = (uint64_t)__rdtsc();
+
+    if (tsc_end > tsc_start) {
+        g_tsc_ns_per_tick = (double)(ns_end - ns_start) / (double)(tsc_end - tsc_start);
+    }
+#endif
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+static const char *const CLOCK_NAMES[] = {
+    [PROFILE_CLOCK_MONOTONIC] = "monotonic",
+    [PROFILE_CLOCK_COARSE] = "coarse",
+    [PROFILE_CLOCK_TSC] = "tsc",
+};
+
+bool profile_clock_parse(const char *name, ProfileClockKind *kind) {
+    for (int i = 0; i < (int)(sizeof(CLOCK_NAMES) / sizeof(CLOCK_NAMES[0])); i++) {
+        if (name != nullptr && strcmp(name, CLOCK_NAMES[i]) == 0) {
+            *kind = (ProfileClockKind)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* profile_clock_name(ProfileClockKind kind) {
+    return CLOCK_NAMES[kind];
+}
+
+bool profile_clock_init(ProfileClock *clock, ProfileClockKind kind) {
+    clock->kind = kind;
+    clock->ns_per_tick = 1.0;
+    if (kind != PROFILE_CLOCK_TSC) {
+        return true;
+    }
+
+    pthread_once(&g_tsc_once, tsc_calibrate);
+    if (g_tsc_ns_per_tick <= 0.0) {
+        clock->kind = PROFILE_CLOCK_MONOTONIC;
+        return false;
+    }
+    clock->ns_per_tick = g_tsc_ns_per_tick;
+    return true;
+}
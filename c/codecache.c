@@ -0,0 +1,177 @@
+/**
+ * Code Object Cache Implementation
+ *
+ * Architecture:
+ *   g_extra_index — co_extra slot reserved via PyUnstable_Eval_RequestCodeExtraIndex
+ *   code->co_extra[g_extra_index] — heap CodeMeta*, freed by code_meta_free()
+ *
+ * Concurrency:
+ *   hit  — atomic acquire load of entry->session, no lock
+ *   miss — resolve strings unlocked (may call into Python), then under
+ *          g_fill_mutex: re-check, allocate/attach, store, release-publish.
+ *          A published entry is never rewritten within its session.
+ *
+ * Invalidation:
+ *   Code object destroyed → interpreter calls code_meta_free (no dangling keys).
+ *   Session changed       → entry->session mismatch → refill (re-intern).
+ *
+ * peek():
+ *   Hit path only, for decisions taken before an event exists (sampling).
+ *
+ * C23: nullptr, _Atomic
+ * POSIX: pthread (TSan-compatible)
+ * FAIL-FIRST: abort on contract violation; OOM falls back to scratch entry
+ */
+
+#include "tracking/codecache.h"
+#include "tracking/errors.h"
+#include "tracking/invariants.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * State
+ * ============================================================================ */
+
+static Py_ssize_t g_extra_index = -1;
+
+/** Serializes misses so concurrent fillers never race on one entry. */
+static pthread_mutex_t g_fill_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/** Fallback when entry allocation fails. Never cached (session = 0). */
+static _Thread_local CodeMeta tl_scratch;
+
+static void code_meta_free(void *ptr) {
+    free(ptr);
+}
+
+/* ============================================================================
+ * Internal
+ * ============================================================================ */
+
+static CodeMeta* code_meta_get(PyCodeObject *code) {
+    void *extra = nullptr;
+    if (PyUnstable_Code_GetExtra((PyObject *)code, g_extra_index, &extra) < 0) {
+        PyErr_Clear();
+        return nullptr;
+    }
+    return extra;
+}
+
+static inline bool code_meta_valid(CodeMeta *meta, uint64_t session) {
+    return meta != nullptr
+        && atomic_load_explicit(&meta->session, memory_order_acquire) == session;
+}
+
+/**
+ * Intern argument names (co_localsplusnames prefix) into names.
+ * @return false if a name failed (error captured into ev, if any).
+ */
+static bool resolve_arg_names(PyCodeObject *code, int arg_count, Event *ev,
+                              const char *names[MAX_ARGS]) {
+    bool complete = true;
+    for (int i = 0; i < arg_count; i++) {
+        char field[ERROR_FIELD_LEN];
+        (void)snprintf(field, sizeof(field), "arg[%d]", i);
+        names[i] = intern_utf8(PyTuple_GET_ITEM(code->co_localsplusnames, i), ev, field);
+        complete = complete && names[i] != nullptr;
+    }
+    return complete;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+int code_cache_init(void) {
+    if (g_extra_index >= 0) {
+        return 0;
+    }
+    g_extra_index = PyUnstable_Eval_RequestCodeExtraIndex(code_meta_free);
+    if (g_extra_index < 0) {
+        if (!PyErr_Occurred()) {
+            PyErr_SetString(PyExc_RuntimeError, "No free co_extra index");
+        }
+        return -1;
+    }
+    return 0;
+}
+
+CodeMeta* code_cache_lookup(PyCodeObject *code, uint64_t session, Event *ev) {
+    REQUIRE(g_extra_index >= 0, "code_cache_lookup: code_cache_init() not called");
+    REQUIRE(session != 0, "code_cache_lookup: session must be positive");
+
+    CodeMeta *meta = code_meta_get(code);
+    if (code_meta_valid(meta, session)) {
+        return meta;  /* Hot path */
+    }
+
+    /* Resolve outside the lock: may call into Python (error capture) */
+    uint16_t errors_before = ev ? ev->error_count : 0;
+    FrameInfo location = {
+        .file = intern_utf8(code->co_filename, ev, "file"),
+        .line = code->co_firstlineno,
+        .func = intern_utf8(code->co_qualname, ev, "func"),
+    };
+    int arg_count = call_arg_capacity(code);
+    const char *arg_names[MAX_ARGS] = {nullptr};
+    bool names_complete = resolve_arg_names(code, arg_count, ev, arg_names);
+    /* Cache only complete entries: errors must be reported on EVERY event.
+     * Without ev, a missing field is the only trace of a dropped error. */
+    bool complete = ev ? ev->error_count == errors_before
+                       : location.file != nullptr && location.func != nullptr && names_complete;
+    uint64_t published = complete ? session : 0;
+
+    pthread_mutex_lock(&g_fill_mutex);
+
+    /* Re-check: another thread may have published it meanwhile */
+    meta = code_meta_get(code);
+    if (code_meta_valid(meta, session)) {
+        pthread_mutex_unlock(&g_fill_mutex);
+        return meta;
+    }
+
+    if (meta == nullptr) {
+        meta = calloc(1, sizeof(CodeMeta));
+        if (meta != nullptr
+            && PyUnstable_Code_SetExtra((PyObject *)code, g_extra_index, meta) < 0) {
+            PyErr_Clear();
+            free(meta);
+            meta = nullptr;
+        }
+    }
+
+    if (meta != nullptr) {
+        meta->location = location;
+        meta->arg_count = arg_count;
+        memcpy(meta->arg_names, arg_names, sizeof(arg_names));
+        atomic_store_explicit(&meta->fires, 1, memory_order_relaxed);
+        atomic_store_explicit(&meta->match, CODE_MATCH_UNKNOWN, memory_order_relaxed);
+        /* Release: readers that see session also see location */
+        atomic_store_explicit(&meta->session, published, memory_order_release);
+    }
+
+    pthread_mutex_unlock(&g_fill_mutex);
+
+    if (meta == nullptr) {
+        /* OOM: hand out uncached thread-local copy */
+        tl_scratch.location = location;
+        tl_scratch.arg_count = arg_count;
+        memcpy(tl_scratch.arg_names, arg_names, sizeof(arg_names));
+        atomic_store_explicit(&tl_scratch.match, CODE_MATCH_UNKNOWN, memory_order_relaxed);
+        atomic_store_explicit(&tl_scratch.session, 0, memory_order_relaxed);
+        return &tl_scratch;
+    }
+    return meta;
+}
+
+CodeMeta* code_cache_peek(PyCodeObject *code, uint64_t session) {
+    REQUIRE(g_extra_index >= 0, "code_cache_peek: code_cache_init() not called");
+    REQUIRE(session != 0, "code_cache_peek: session must be positive");
+
+    CodeMeta *meta = code_meta_get(code);
+    return code_meta_valid(meta, session) ? meta : nullptr;
+}
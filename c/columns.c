@@ -0,0 +1,329 @@
+/**
+ * Columnar Event Buffers Implementation
+ *
+ * Architecture:
+ *   Row columns grow together (doubling, shared cap); arg columns grow
+ *   together on their own cap. Growth reallocs each array; on partial
+ *   failure already-grown arrays are simply larger than cap (harmless).
+ *   ids — verstable pointer → string idx, first sight appends to strings[];
+ *   StackId → stack entry, first sight walks the trie node → root and
+ *   appends every frame not seen yet (a failed walk is rolled back).
+ *
+ * Memory:
+ *   Per event: 1 + 8 + 4*3 + 4 + 4*2 + 4 + 4 + 4*2 + 2 = 51 bytes (+ 16 per
+ *   arg), versus a PyDict with fresh str objects per field. Per distinct
+ *   creation frame: 16 bytes, versus a traceback list per DESTROY.
+ *
+ * C23: nullptr, constexpr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/columns.h"
+#include "tracking/invariants.h"
+#include "tracking/stacks.h"
+
+#include <stdlib.h>
+
+/* Verstable hash table: interned/tp_name pointer → string idx.
+ * Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME column_string_map
+#define KEY_TY uintptr_t
+#define VAL_TY uint32_t
+#include "vendor/verstable.h"
+#define NAME column_stack_map
+#define KEY_TY StackId
+#define VAL_TY uint32_t
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct ColumnIds {
+    column_string_map map;
+    column_stack_map stacks;
+};
+
+constexpr size_t COLUMNS_INITIAL_ROWS = 4096;
+constexpr uint32_t COLUMNS_INITIAL_STRINGS = 256;
+constexpr uint32_t COLUMNS_INITIAL_STACKS = 256;
+
+/* ============================================================================
+ * Internal
+ * ============================================================================ */
+
+/**
+ * realloc array to cap elements; keeps array on failure.
+ * Needs `void *grown` in scope.
+ */
+#define GROW(array, cap) \
+    ((grown = realloc((array), (cap) * sizeof(*(array)))) != nullptr && ((array) = grown, true))
+
+static bool ensure_rows(EventColumns *cols) {
+    if (cols->count < cols->cap) {
+        return true;
+    }
+    void *grown;
+    size_t cap = cols->cap ? cols->cap * 2 : COLUMNS_INITIAL_ROWS;
+    bool ok = GROW(cols->kind, cap)
+           && GROW(cols->obj_id, cap)
+           && GROW(cols->type_name, cap)
+           && GROW(cols->file, cap)
+           && GROW(cols->func, cap)
+           && GROW(cols->line, cap)
+           && GROW(cols->caller_file, cap)
+           && GROW(cols->caller_func, cap)
+           && GROW(cols->caller_line, cap)
+           && GROW(cols->thread, cap)
+           && GROW(cols->task, cap)
+           && GROW(cols->creation, cap)
+           && GROW(cols->creation_type, cap)
+           && GROW(cols->arg_count, cap);
+    if (ok) {
+        cols->cap = cap;
+    }
+    return ok;
+}
+
+static bool ensure_args(EventColumns *cols, size_t extra) {
+    size_t need = cols->arg_total + extra;
+    if (need <= cols->arg_cap) {
+        return true;
+    }
+    void *grown;
+    size_t cap = cols->arg_cap ? cols->arg_cap * 2 : COLUMNS_INITIAL_ROWS;
+    while (cap < need) {
+        cap *= 2;
+    }
+    bool ok = GROW(cols->arg_id, cap)
+           && GROW(cols->arg_name, cap)
+           && GROW(cols->arg_type, cap);
+    if (ok) {
+        cols->arg_cap = cap;
+    }
+    return ok;
+}
+
+/**
+ * Idx of a pointer-stable string, 0 for nullptr.
+ * @return false on OOM.
+ */
+static bool string_idx(EventColumns *cols, const char *s, uint32_t *idx) {
+    if (s == nullptr) {
+        *idx = 0;
+        return true;
+    }
+
+    column_string_map_itr itr = vt_get(&cols->ids->map, (uintptr_t)s);
+    if (!vt_is_end(itr)) {
+        *idx = itr.data->val;
+        return true;
+    }
+
+    if (cols->string_count == cols->string_cap) {
+        void *grown;
+        uint32_t cap = cols->string_cap * 2;
+        if (!GROW(cols->strings, cap)) {
+            return false;
+        }
+        cols->string_cap = cap;
+    }
+    if (vt_is_end(vt_insert(&cols->ids->map, (uintptr_t)s, cols->string_count))) {
+        return false;
+    }
+    cols->strings[cols->string_count] = s;
+    *idx = cols->string_count++;
+    return true;
+}
+
+static bool ensure_stacks(EventColumns *cols) {
+    if (cols->stack_count < cols->stack_cap) {
+        return true;
+    }
+    void *grown;
+    uint32_t cap = cols->stack_cap ? cols->stack_cap * 2 : COLUMNS_INITIAL_STACKS;
+    bool ok = GROW(cols->stack_parent, cap)
+           && GROW(cols->stack_file, cap)
+           && GROW(cols->stack_func, cap)
+           && GROW(cols->stack_line, cap);
+    if (ok) {
+        cols->stack_cap = cap;
+    }
+    return ok;
+}
+
+/** Drop the entries appended from first on by a failed stack_entry() walk. */
+static void stack_rollback(EventColumns *cols, StackId stack, uint32_t first) {
+    for (uint32_t k = first; k < cols->stack_count; k++) {
+        (void)vt_erase(&cols->ids->stacks, stack);
+        stack = stack_trie_node(stack)->parent;
+    }
+    cols->stack_count = first;
+}
+
+/**
+ * Stack entry of a creation stack (COLUMN_STACK_ROOT for STACK_EMPTY).
+ * Frames not seen yet are appended innermost first; each links to the
+ * entry below it once that is known.
+ * @return false on OOM (entries of this walk removed).
+ */
+static bool stack_entry(EventColumns *cols, StackId stack, uint32_t *entry) {
+    uint32_t first = cols->stack_count;
+    uint32_t below = COLUMN_STACK_ROOT;
+    uint32_t child = COLUMN_STACK_NONE;
+    for (StackId id = stack; id != STACK_EMPTY; ) {
+        column_stack_map_itr itr = vt_get(&cols->ids->stacks, id);
+        if (!vt_is_end(itr)) {
+            below = itr.data->val;
+            break;
+        }
+
+        const StackNode *node = stack_trie_node(id);
+        uint32_t file = 0, func = 0;
+        uint32_t k = cols->stack_count;
+        if (!ensure_stacks(cols)
+            || !string_idx(cols, node->frame.file, &file)
+            || !string_idx(cols, node->frame.func, &func)
+            || vt_is_end(vt_insert(&cols->ids->stacks, id, k))) {
+            stack_rollback(cols, stack, first);
+            return false;
+        }
+        cols->stack_parent[k] = COLUMN_STACK_ROOT;
+        cols->stack_file[k] = file;
+        cols->stack_func[k] = func;
+        cols->stack_line[k] = node->frame.line;
+        cols->stack_count++;
+        if (child != COLUMN_STACK_NONE) {
+            cols->stack_parent[child] = k;
+        }
+        child = k;
+        id = node->parent;
+    }
+
+    if (child != COLUMN_STACK_NONE) {
+        cols->stack_parent[child] = below;
+    }
+    *entry = cols->stack_count > first ? first : below;
+    return true;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+bool event_columns_init(EventColumns *cols) {
+    REQUIRE(cols != nullptr, "event_columns_init: columns must not be null");
+
+    *cols = (EventColumns){0};
+    cols->ids = malloc(sizeof(ColumnIds));
+    cols->strings = malloc(COLUMNS_INITIAL_STRINGS * sizeof(*cols->strings));
+    if (cols->ids == nullptr || cols->strings == nullptr || !ensure_stacks(cols)) {
+        free(cols->ids);
+        cols->ids = nullptr;  /* Maps not initialized: nothing to clean up */
+        event_columns_destroy(cols);
+        return false;
+    }
+    vt_init(&cols->ids->map);
+    vt_init(&cols->ids->stacks);
+    cols->strings[0] = nullptr;
+    cols->string_count = 1;
+    cols->string_cap = COLUMNS_INITIAL_STRINGS;
+
+    /* NONE and ROOT: no frame, ROOT below everything */
+    for (uint32_t k = COLUMN_STACK_NONE; k <= COLUMN_STACK_ROOT; k++) {
+        cols->stack_parent[k] = COLUMN_STACK_NONE;
+        cols->stack_file[k] = 0;
+        cols->stack_func[k] = 0;
+        cols->stack_line[k] = 0;
+    }
+    cols->stack_count = COLUMN_STACK_ROOT + 1;
+    return true;
+}
+
+bool event_columns_append(EventColumns *cols, const Event *ev) {
+    REQUIRE(cols != nullptr && cols->ids != nullptr, "event_columns_append: columns not initialized");
+    REQUIRE(ev != nullptr, "event_columns_append: event must not be null");
+
+    uint16_t arg_count = ev->type == EVENT_CALL ? ev->arg_count : 0;
+    if (!ensure_rows(cols) || !ensure_args(cols, arg_count)) {
+        return false;
+    }
+
+    /* Resolve all string idxs first: a failure leaves no partial row */
+    uint32_t type = 0, file = 0, func = 0, caller_file = 0, caller_func = 0;
+    bool has_caller = ev->type == EVENT_CALL && ev->caller.func != nullptr;
+    bool ok = string_idx(cols, ev->type == EVENT_CALL ? nullptr : ev->type_name_ref, &type)
+           && string_idx(cols, ev->location.file, &file)
+           && string_idx(cols, ev->location.func, &func)
+           && (!has_caller || string_idx(cols, ev->caller.file, &caller_file))
+           && (!has_caller || string_idx(cols, ev->caller.func, &caller_func));
+
+    uint32_t creation = COLUMN_STACK_NONE, creation_type = 0;
+    if (ok && ev->type == EVENT_DESTROY && ev->has_creation) {
+        ok = string_idx(cols, ev->creation.type_name_ref, &creation_type)
+          && stack_entry(cols, ev->creation.stack, &creation);
+    }
+
+    size_t base = cols->arg_total;
+    for (uint16_t i = 0; ok && i < arg_count; i++) {
+        ok = string_idx(cols, ev->args[i].name_ref, &cols->arg_name[base + i])
+          && string_idx(cols, ev->args[i].type_ref, &cols->arg_type[base + i]);
+        cols->arg_id[base + i] = ev->args[i].id;
+    }
+    if (!ok) {
+        return false;
+    }
+
+    size_t row = cols->count;
+    cols->kind[row] = (uint8_t)ev->type;
+    cols->obj_id[row] = ev->type == EVENT_CALL ? 0 : ev->obj_id;
+    cols->type_name[row] = type;
+    cols->file[row] = file;
+    cols->func[row] = func;
+    cols->line[row] = ev->location.line;
+    cols->caller_file[row] = caller_file;
+    cols->caller_func[row] = caller_func;
+    cols->caller_line[row] = has_caller ? ev->caller.line : 0;
+    cols->thread[row] = ev->thread;
+    cols->task[row] = ev->task;
+    cols->creation[row] = creation;
+    cols->creation_type[row] = creation_type;
+    cols->arg_count[row] = arg_count;
+
+    cols->arg_total += arg_count;
+    cols->count++;
+    return true;
+}
+
+void event_columns_destroy(EventColumns *cols) {
+    REQUIRE(cols != nullptr, "event_columns_destroy: columns must not be null");
+
+    if (cols->ids != nullptr) {
+        vt_cleanup(&cols->ids->map);
+        vt_cleanup(&cols->ids->stacks);
+        free(cols->ids);
+    }
+    free(cols->kind);
+    free(cols->obj_id);
+    free(cols->type_name);
+    free(cols->file);
+    free(cols->func);
+    free(cols->line);
+    free(cols->caller_file);
+    free(cols->caller_func);
+    free(cols->caller_line);
+    free(cols->thread);
+    free(cols->task);
+    free(cols->creation);
+    free(cols->creation_type);
+    free(cols->arg_count);
+    free(cols->arg_id);
+    free(cols->arg_name);
+    free(cols->arg_type);
+    free(cols->stack_parent);
+    free(cols->stack_file);
+    free(cols->stack_func);
+    free(cols->stack_line);
+    free(cols->strings);
+    *cols = (EventColumns){0};
+}
@@ -0,0 +1,141 @@
+/**
+ * Call Edge Table Implementation
+ *
+ * Architecture:
+ *   verstable EdgeKey → EdgeStats. Hash mixes the four interned pointers
+ *   and both lines (no string hashing: interning makes pointers unique).
+ *   Memory per edge: 48-byte key + 16-byte value + verstable metadata.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/edges.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+
+/* ============================================================================
+ * Key hashing / equality
+ * ============================================================================ */
+
+static inline bool frame_equal(const FrameInfo *a, const FrameInfo *b) {
+    return a->file == b->file && a->func == b->func && a->line == b->line;
+}
+
+static inline uint64_t edge_mix(uint64_t hash, uint64_t word) {
+    hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+static inline uint64_t edge_key_hash(EdgeKey key) {
+    uint64_t hash = 0;
+    hash = edge_mix(hash, (uint64_t)(uintptr_t)key.caller.file);
+    hash = edge_mix(hash, (uint64_t)(uintptr_t)key.caller.func);
+    hash = edge_mix(hash, (uint64_t)(uint32_t)key.caller.line);
+    hash = edge_mix(hash, (uint64_t)(uintptr_t)key.callee.file);
+    hash = edge_mix(hash, (uint64_t)(uintptr_t)key.callee.func);
+    hash = edge_mix(hash, (uint64_t)(uint32_t)key.callee.line);
+    /* Final avalanche: verstable uses both low bits (bucket) and high bits (fragment) */
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline bool edge_key_equal(EdgeKey a, EdgeKey b) {
+    return frame_equal(&a.caller, &b.caller) && frame_equal(&a.callee, &b.callee);
+}
+
+/* Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME edge_map
+#define KEY_TY EdgeKey
+#define VAL_TY EdgeStats
+#define HASH_FN edge_key_hash
+#define CMPR_FN edge_key_equal
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct EdgeTable {
+    edge_map map;
+};
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+EdgeTable* edge_table_new(void) {
+    EdgeTable *table = malloc(sizeof(EdgeTable));
+    if (table == nullptr) {
+        return nullptr;
+    }
+    vt_init(&table->map);
+    return table;
+}
+
+void edge_table_free(EdgeTable *table) {
+    if (table == nullptr) {
+        return;
+    }
+    vt_cleanup(&table->map);
+    free(table);
+}
+
+/** Add stats to key's edge. @return false on OOM. */
+static bool edge_add_stats(EdgeTable *table, EdgeKey key, EdgeStats stats) {
+    edge_map_itr itr = vt_get_or_insert(&table->map, key, (EdgeStats){0});
+    if (vt_is_end(itr)) {
+        return false;
+    }
+    itr.data->val.count += stats.count;
+    itr.data->val.total_ns += stats.total_ns;
+    return true;
+}
+
+bool edge_table_add(EdgeTable *table, const FrameInfo *caller, const FrameInfo *callee,
+                    uint64_t elapsed_ns) {
+    REQUIRE(table != nullptr, "edge_table_add: table must not be null");
+    REQUIRE(callee != nullptr, "edge_table_add: callee must not be null");
+
+    if (caller == nullptr || caller->file == nullptr || frame_equal(caller, callee)) {
+        return true;
+    }
+    EdgeKey key = {.caller = *caller, .callee = *callee};
+    return edge_add_stats(table, key, (EdgeStats){.count = 1, .total_ns = elapsed_ns});
+}
+
+bool edge_table_merge(EdgeTable *dst, const EdgeTable *src) {
+    REQUIRE(dst != nullptr, "edge_table_merge: dst must not be null");
+    REQUIRE(src != nullptr, "edge_table_merge: src must not be null");
+    REQUIRE(dst != src, "edge_table_merge: cannot merge a table into itself");
+
+    /* verstable iteration takes a non-const table; src is not modified */
+    edge_map *map = (edge_map *)&src->map;
+    for (edge_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        if (!edge_add_stats(dst, itr.data->key, itr.data->val)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t edge_table_size(const EdgeTable *table) {
+    REQUIRE(table != nullptr, "edge_table_size: table must not be null");
+    return vt_size((edge_map *)&table->map);
+}
+
+bool edge_table_each(const EdgeTable *table, EdgeVisitor visit, void *ctx) {
+    REQUIRE(table != nullptr, "edge_table_each: table must not be null");
+    REQUIRE(visit != nullptr, "edge_table_each: visit must not be null");
+
+    edge_map *map = (edge_map *)&table->map;
+    for (edge_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        if (!visit(&itr.data->key, &itr.data->val, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,116 @@
+/**
+ * C-side Event Filter Implementation
+ *
+ * Architecture:
+ *   Patterns copied at init (caller's strings may die after start()).
+ *   event_filter_path — include pass (any match), then exclude pass.
+ *
+ * C23: nullptr
+ * POSIX: fnmatch(3)
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/filter.h"
+#include "tracking/invariants.h"
+
+#include <fnmatch.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Internal
+ * ============================================================================ */
+
+static void free_patterns(char **patterns, size_t count) {
+    if (patterns == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        free(patterns[i]);
+    }
+    free(patterns);
+}
+
+/**
+ * Copy count patterns.
+ * @return false on OOM (*out untouched).
+ */
+static bool copy_patterns(const char *const *src, size_t count, char ***out) {
+    if (count == 0) {
+        *out = nullptr;
+        return true;
+    }
+    REQUIRE(src != nullptr, "event_filter_init: pattern array must not be null");
+
+    char **patterns = calloc(count, sizeof(char *));
+    if (patterns == nullptr) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        REQUIRE(src[i] != nullptr, "event_filter_init: pattern must not be null");
+        patterns[i] = strdup(src[i]);
+        if (patterns[i] == nullptr) {
+            free_patterns(patterns, i);
+            return false;
+        }
+    }
+    *out = patterns;
+    return true;
+}
+
+static bool any_match(char *const *patterns, size_t count, const char *file) {
+    for (size_t i = 0; i < count; i++) {
+        if (fnmatch(patterns[i], file, FNM_NOESCAPE) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+bool event_filter_init(EventFilter *filter,
+                       const char *const *include, size_t include_count,
+                       const char *const *exclude, size_t exclude_count,
+                       unsigned types) {
+    REQUIRE(filter != nullptr, "event_filter_init: filter must not be null");
+
+    *filter = (EventFilter){.types = types};
+    char **included = nullptr;
+    char **excluded = nullptr;
+    if (!copy_patterns(include, include_count, &included)) {
+        return false;
+    }
+    if (!copy_patterns(exclude, exclude_count, &excluded)) {
+        free_patterns(included, include_count);
+        return false;
+    }
+
+    filter->include = included;
+    filter->include_count = include_count;
+    filter->exclude = excluded;
+    filter->exclude_count = exclude_count;
+    return true;
+}
+
+void event_filter_destroy(EventFilter *filter) {
+    REQUIRE(filter != nullptr, "event_filter_destroy: filter must not be null");
+
+    free_patterns(filter->include, filter->include_count);
+    free_patterns(filter->exclude, filter->exclude_count);
+    *filter = (EventFilter){0};
+}
+
+bool event_filter_path(const EventFilter *filter, const char *file) {
+    REQUIRE(filter != nullptr, "event_filter_path: filter must not be null");
+
+    if (file == nullptr) {
+        return true;
+    }
+    if (filter->include_count > 0 && !any_match(filter->include, filter->include_count, file)) {
+        return false;
+    }
+    return !any_match(filter->exclude, filter->exclude_count, file);
+}
@@ -7,7 +7,8 @@
  * Architecture:
  *   tl_stack      — dynamic array (realloc on growth)
  *   tl_depth      — current stack depth (0 = empty)
- *   tl_capacity   — current allocation size
+ *   tl_tags       — per-frame memo tags, parallel to tl_stack
+ *   tl_capacity   — current allocation size (both arrays)
  *
  * String Ownership:
  *   StackFrame.file and .func are INTERNED pointers.
@@ -42,6 +43,7 @@ constexpr size_t FRAME_STACK_GROWTH_FACTOR = 2;
  * ============================================================================ */
 
 static _Thread_local StackFrame* tl_stack = nullptr;
+static _Thread_local uint32_t* tl_tags = nullptr;
 static _Thread_local size_t tl_depth = 0;
 static _Thread_local size_t tl_capacity = 0;
 
@@ -66,6 +68,11 @@ static void ensure_capacity(void) {
     REQUIRE(new_stack != nullptr, "frame stack allocation failed");
 
     tl_stack = new_stack;
+
+    uint32_t* new_tags = realloc(tl_tags, new_capacity * sizeof(uint32_t));
+    REQUIRE(new_tags != nullptr, "frame stack allocation failed");
+
+    tl_tags = new_tags;
     tl_capacity = new_capacity;
 }
 
@@ -80,6 +87,7 @@ void frame_stack_push(const StackFrame* info) {
 
     /* Shallow copy (strings are interned, just copy pointers) */
     tl_stack[tl_depth] = *info;
+    tl_tags[tl_depth] = 0;
     tl_depth++;
 }
 
@@ -99,6 +107,29 @@ const StackFrame* frame_stack_caller(void) {
     return &tl_stack[tl_depth - 2];
 }
 
+const StackFrame* frame_stack_top(void) {
+    return frame_stack_peek(0);
+}
+
+const StackFrame* frame_stack_peek(size_t n) {
+    if (n >= tl_depth) {
+        return nullptr;  /* Beyond bottom of stack — valid state, not error */
+    }
+    return &tl_stack[tl_depth - 1 - n];
+}
+
+uint32_t frame_stack_tag(size_t n) {
+    if (n >= tl_depth) {
+        return 0;
+    }
+    return tl_tags[tl_depth - 1 - n];
+}
+
+void frame_stack_set_tag(size_t n, uint32_t tag) {
+    REQUIRE(n < tl_depth, "frame_stack_set_tag: beyond bottom of stack");
+    tl_tags[tl_depth - 1 - n] = tag;
+}
+
 size_t frame_stack_depth(void) {
     return tl_depth;
 }
@@ -110,7 +141,9 @@ void frame_stack_clear(void) {
 
 void frame_stack_destroy(void) {
     free(tl_stack);
+    free(tl_tags);
     tl_stack = nullptr;
+    tl_tags = nullptr;
     tl_depth = 0;
     tl_capacity = 0;
 }
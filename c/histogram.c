@@ -0,0 +1,81 @@
+/**
+ * Latency Histogram Implementation
+ *
+ * Bucket bounds (group = idx / 8, sub = idx % 8):
+ *   group 0:  [sub, sub + 1)
+ *   else:     lower = (8 + sub) << (group - 1), width = 1 << (group - 1)
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: abort on contract violation
+ */
+
+#include "tracking/histogram.h"
+#include "tracking/invariants.h"
+
+#include <string.h>
+
+void histogram_init(LatencyHistogram *hist) {
+    REQUIRE(hist != nullptr, "histogram_init: hist must not be null");
+
+    memset(hist, 0, sizeof(*hist));
+    hist->min_ns = UINT64_MAX;
+}
+
+unsigned histogram_bucket(uint64_t value_ns) {
+    if (value_ns < HIST_SUB_BUCKETS) {
+        return (unsigned)value_ns;
+    }
+    if (value_ns >> HIST_MAX_BITS != 0) {
+        return HIST_BUCKETS - 1;
+    }
+    unsigned msb = 63u - (unsigned)__builtin_clzll(value_ns);
+    unsigned shift = msb - HIST_SUB_BITS;
+    return (shift + 1) * HIST_SUB_BUCKETS + (unsigned)(value_ns >> shift) - HIST_SUB_BUCKETS;
+}
+
+void histogram_bucket_bounds(unsigned idx, uint64_t *lower, uint64_t *upper) {
+    REQUIRE(idx < HIST_BUCKETS, "histogram_bucket_bounds: idx out of range");
+    REQUIRE(lower != nullptr && upper != nullptr, "histogram_bucket_bounds: null output");
+
+    unsigned group = idx / HIST_SUB_BUCKETS;
+    uint64_t sub = idx % HIST_SUB_BUCKETS;
+    if (group == 0) {
+        *lower = sub;
+        *upper = sub + 1;
+        return;
+    }
+    *lower = (HIST_SUB_BUCKETS + sub) << (group - 1);
+    *upper = *lower + (1ull << (group - 1));
+}
+
+void histogram_record(LatencyHistogram *hist, uint64_t value_ns) {
+    hist->count++;
+    hist->total_ns += value_ns;
+    if (value_ns < hist->min_ns) {
+        hist->min_ns = value_ns;
+    }
+    if (value_ns > hist->max_ns) {
+        hist->max_ns = value_ns;
+    }
+    hist->buckets[histogram_bucket(value_ns)]++;
+}
+
+void histogram_merge(LatencyHistogram *dst, const LatencyHistogram *src) {
+    REQUIRE(dst != nullptr, "histogram_merge: dst must not be null");
+    REQUIRE(src != nullptr, "histogram_merge: src must not be null");
+
+    if (src->count == 0) {
+        return;
+    }
+    dst->count += src->count;
+    dst->total_ns += src->total_ns;
+    if (src->min_ns < dst->min_ns) {
+        dst->min_ns = src->min_ns;
+    }
+    if (src->max_ns > dst->max_ns) {
+        dst->max_ns = src->max_ns;
+    }
+    for (unsigned i = 0; i < HIST_BUCKETS; i++) {
+        dst->buckets[i] += src->buckets[i];
+    }
+}
@@ -3,23 +3,34 @@
  *
  * Architecture for Pointer Stability:
  *
- *   strings[]  — array of char*, grows via realloc
- *                existing pointers NEVER invalidated
- *                strings[i] = strdup(input)
+ *   entries    — {hash, chars} bump-allocated from a session arena
+ *                (arena.h), NEVER moved or freed before destroy();
+ *                interned pointer = entry->data; destroy() unmaps the
+ *                arena blocks instead of freeing strings one by one
  *
- *   buckets[]  — hash table of indices into strings[]
- *                rebuilt on resize (rehash)
- *                buckets[hash % cap] = index or EMPTY
+ *   strings[]  — array of entry data pointers, grows via realloc
+ *                (index order for string_table_lookup)
+ *
+ *   buckets    — open-addressing table of _Atomic(entry*), linear probing
+ *                slots only go nullptr → entry (no delete)
+ *                resize builds a NEW array and publishes it atomically;
+ *                old arrays retired (kept until destroy: readers may
+ *                still probe them, total size < 2x the live array)
  *
  * Thread Safety:
- *   - pthread_mutex_t protects all operations
- *   - TSan-compatible (threads.h mtx_t is NOT TSan-compatible)
+ *   - Hits are lock-free: load buckets (acquire), probe slots (acquire);
+ *     an entry is fully written before its slot is published (release)
+ *   - Misses take the mutex and re-probe the CURRENT array: a reader on a
+ *     retired array may miss a string that is already interned, the
+ *     locked re-probe finds it (same pointer, never a duplicate)
+ *   - pthread_mutex_t serializes writers (TSan-compatible, unlike mtx_t)
  *
  * C23 features: constexpr, nullptr, _Atomic
  * POSIX: pthread_mutex_t (TSan-compatible)
  */
 
 #include "tracking/interning.h"
+#include "tracking/arena.h"
 #include "tracking/invariants.h"
 
 #include <string.h>
@@ -46,17 +57,30 @@ static inline uint64_t fnv1a_hash(const char* s) {
  * Global State
  * ============================================================================ */
 
+/** Interned string: hash kept so probes skip strcmp on mismatch. */
+typedef struct {
+    uint64_t hash;
+    char data[];
+} Entry;
+
+/** Bucket array, immutable capacity; published as a whole. */
+typedef struct BucketArray {
+    size_t capacity;                /* Power of 2 */
+    struct BucketArray* retired;    /* Older arrays, freed at destroy */
+    _Atomic(Entry*) slots[];
+} BucketArray;
+
 typedef struct {
-    /* String storage — grows, but existing pointers stable */
+    /* String storage — entries in arena, index array grows */
+    Arena arena;
     char** strings;
-    size_t strings_count;
+    _Atomic(size_t) strings_count;  /* Read without lock by count() */
     size_t strings_capacity;
 
-    /* Hash table — indices into strings[], rebuilt on resize */
-    size_t* buckets;
-    size_t buckets_capacity;
+    /* Hash table — read lock-free, replaced on resize */
+    _Atomic(BucketArray*) buckets;
 
-    /* Thread safety (pthread for TSan compatibility) */
+    /* Writers (pthread for TSan compatibility) */
     pthread_mutex_t mutex;
     bool initialized;
 } StringTable;
@@ -68,33 +92,52 @@ static StringTable g_table = {0};
  * ============================================================================ */
 
 /**
- * Find bucket index for string. Returns bucket containing string or empty bucket.
+ * Allocate bucket array with all slots empty.
+ * FAIL-FIRST: Aborts on allocation failure.
+ */
+static BucketArray* bucket_array_new(size_t capacity) {
+    BucketArray* array = malloc(sizeof(BucketArray) + capacity * sizeof(_Atomic(Entry*)));
+    REQUIRE(array != nullptr, "bucket allocation failed");
+
+    array->capacity = capacity;
+    array->retired = nullptr;
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&array->slots[i], nullptr);
+    }
+    return array;
+}
+
+/**
+ * Find slot for string. Returns slot containing string or empty slot.
+ * Safe without lock (acquire loads); result is only final under the mutex.
  *
+ * @param array     Bucket array to probe
  * @param s         String to find (must not be nullptr)
  * @param hash      Pre-computed hash of s
- * @param found     Output: true if string found, false if empty bucket
- * @return          Bucket index
+ * @param found     Output: entry if found, nullptr if empty slot
+ * @return          Slot index
  */
-static size_t find_bucket(const char* s, uint64_t hash, bool* found) {
-    size_t idx = hash % g_table.buckets_capacity;
+static size_t find_slot(BucketArray* array, const char* s, uint64_t hash, Entry** found) {
+    size_t mask = array->capacity - 1;
+    size_t idx = (size_t)hash & mask;
     size_t start = idx;
 
     do {
-        size_t entry = g_table.buckets[idx];
+        Entry* entry = atomic_load_explicit(&array->slots[idx], memory_order_acquire);
 
-        if (entry == STRING_TABLE_EMPTY) {
-            *found = false;
+        if (entry == nullptr) {
+            *found = nullptr;
             return idx;
         }
 
-        /* Compare string content */
-        if (strcmp(g_table.strings[entry], s) == 0) {
-            *found = true;
+        /* Compare hash first, then content */
+        if (entry->hash == hash && strcmp(entry->data, s) == 0) {
+            *found = entry;
             return idx;
         }
 
         /* Linear probing */
-        idx = (idx + 1) % g_table.buckets_capacity;
+        idx = (idx + 1) & mask;
     } while (idx != start);
 
     /* Table full — should never happen due to load factor check */
@@ -102,47 +145,36 @@ static size_t find_bucket(const char* s, uint64_t hash, bool* found) {
 }
 
 /**
- * Resize hash table (rebuild buckets, NOT strings).
- * Called when load factor exceeded.
+ * Resize hash table (new bucket array, strings untouched).
+ * Called under mutex when load factor exceeded. Readers keep probing
+ * the old array until they load the new one: it stays allocated.
  */
 static void resize_buckets(void) {
-    size_t old_capacity = g_table.buckets_capacity;
-    size_t new_capacity = old_capacity * 2;
-
-    /* Allocate new buckets */
-    size_t* new_buckets = malloc(new_capacity * sizeof(size_t));
-    REQUIRE(new_buckets != nullptr, "bucket allocation failed");
-
-    /* Initialize all to EMPTY */
-    for (size_t i = 0; i < new_capacity; i++) {
-        new_buckets[i] = STRING_TABLE_EMPTY;
-    }
-
-    /* Rehash all strings into new buckets */
-    size_t* old_buckets = g_table.buckets;
-    g_table.buckets = new_buckets;
-    g_table.buckets_capacity = new_capacity;
-
-    for (size_t i = 0; i < old_capacity; i++) {
-        size_t entry = old_buckets[i];
-        if (entry != STRING_TABLE_EMPTY) {
-            const char* s = g_table.strings[entry];
-            uint64_t hash = fnv1a_hash(s);
-            bool found;
-            size_t bucket = find_bucket(s, hash, &found);
+    BucketArray* old_array = atomic_load_explicit(&g_table.buckets, memory_order_relaxed);
+    BucketArray* new_array = bucket_array_new(old_array->capacity * 2);
+
+    /* Rehash all entries (private until published) */
+    for (size_t i = 0; i < old_array->capacity; i++) {
+        Entry* entry = atomic_load_explicit(&old_array->slots[i], memory_order_relaxed);
+        if (entry != nullptr) {
+            Entry* found;
+            size_t slot = find_slot(new_array, entry->data, entry->hash, &found);
             /* Must not find (we're rehashing), just insert */
-            g_table.buckets[bucket] = entry;
+            atomic_store_explicit(&new_array->slots[slot], entry, memory_order_relaxed);
         }
     }
 
-    free(old_buckets);
+    /* Publish: release makes every slot store above visible */
+    new_array->retired = old_array;
+    atomic_store_explicit(&g_table.buckets, new_array, memory_order_release);
 }
 
 /**
  * Grow strings array if needed.
  */
 static void ensure_strings_capacity(void) {
-    if (g_table.strings_count < g_table.strings_capacity) {
+    size_t count = atomic_load_explicit(&g_table.strings_count, memory_order_relaxed);
+    if (count < g_table.strings_capacity) {
         return;
     }
 
@@ -180,19 +212,14 @@ void string_table_init(size_t initial_capacity) {
     }
 
     /* Allocate buckets */
-    g_table.buckets = malloc(capacity * sizeof(size_t));
-    REQUIRE(g_table.buckets != nullptr, "bucket allocation failed");
-
-    for (size_t i = 0; i < capacity; i++) {
-        g_table.buckets[i] = STRING_TABLE_EMPTY;
-    }
-    g_table.buckets_capacity = capacity;
+    atomic_store(&g_table.buckets, bucket_array_new(capacity));
 
-    /* Allocate strings array */
+    /* String storage */
+    arena_init(&g_table.arena, 0);
     g_table.strings_capacity = 256;
     g_table.strings = malloc(g_table.strings_capacity * sizeof(char*));
     REQUIRE(g_table.strings != nullptr, "strings array allocation failed");
-    g_table.strings_count = 0;
+    atomic_store(&g_table.strings_count, 0);
 
     /* Initialize mutex (pthread for TSan compatibility) */
     int result = pthread_mutex_init(&g_table.mutex, NULL);
@@ -207,21 +234,25 @@ void string_table_destroy(void) {
         return;
     }
 
-    /* Free all interned strings */
-    for (size_t i = 0; i < g_table.strings_count; i++) {
-        free(g_table.strings[i]);
+    /* Free all interned strings (bulk: arena blocks) */
+    arena_destroy(&g_table.arena);
+
+    /* Free live and retired bucket arrays */
+    BucketArray* array = atomic_load(&g_table.buckets);
+    while (array != nullptr) {
+        BucketArray* retired = array->retired;
+        free(array);
+        array = retired;
     }
 
     free(g_table.strings);
-    free(g_table.buckets);
     pthread_mutex_destroy(&g_table.mutex);
 
     /* Reset state */
     g_table.strings = nullptr;
-    g_table.strings_count = 0;
+    atomic_store(&g_table.strings_count, 0);
     g_table.strings_capacity = 0;
-    g_table.buckets = nullptr;
-    g_table.buckets_capacity = 0;
+    atomic_store(&g_table.buckets, nullptr);
     g_table.initialized = false;
 }
 
@@ -235,50 +266,75 @@ const char* string_intern(const char* s) {
 
     uint64_t hash = fnv1a_hash(s);
 
-    /* Lock for ALL operations (TSan-safe, no lock-free fast path) */
+    /* Fast path: lock-free hit */
+    Entry* found;
+    BucketArray* array = atomic_load_explicit(&g_table.buckets, memory_order_acquire);
+    (void)find_slot(array, s, hash, &found);
+    if (found != nullptr) {
+        return found->data;
+    }
+
+    /* Slow path: insert under lock, re-probe the current array */
     pthread_mutex_lock(&g_table.mutex);
 
-    bool found;
-    size_t bucket = find_bucket(s, hash, &found);
-    if (found) {
-        const char* result = g_table.strings[g_table.buckets[bucket]];
+    array = atomic_load_explicit(&g_table.buckets, memory_order_relaxed);
+    size_t slot = find_slot(array, s, hash, &found);
+    if (found != nullptr) {
         pthread_mutex_unlock(&g_table.mutex);
-        return result;
+        return found->data;
     }
 
     /* Check load factor before insert */
-    double load = (double)(g_table.strings_count + 1) / (double)g_table.buckets_capacity;
+    size_t count = atomic_load_explicit(&g_table.strings_count, memory_order_relaxed);
+    double load = (double)(count + 1) / (double)array->capacity;
     if (load > STRING_TABLE_LOAD_FACTOR) {
         resize_buckets();
-        /* Re-find bucket after resize */
-        bucket = find_bucket(s, hash, &found);
+        /* Re-find slot after resize */
+        array = atomic_load_explicit(&g_table.buckets, memory_order_relaxed);
+        slot = find_slot(array, s, hash, &found);
         /* Must not find after resize */
-        REQUIRE(!found, "string appeared during resize");
+        REQUIRE(found == nullptr, "string appeared during resize");
     }
 
     /* Ensure strings array has space */
     ensure_strings_capacity();
 
     /* Copy string */
-    char* copy = strdup(s);
-    REQUIRE(copy != nullptr, "strdup failed");
+    size_t len = strlen(s);
+    Entry* entry = arena_alloc(&g_table.arena, sizeof(Entry) + len + 1, alignof(Entry));
+    REQUIRE(entry != nullptr, "string allocation failed");
+    entry->hash = hash;
+    memcpy(entry->data, s, len + 1);
 
     /* Add to strings array */
-    size_t string_idx = g_table.strings_count;
-    g_table.strings[string_idx] = copy;
-    g_table.strings_count++;
+    g_table.strings[count] = entry->data;
+    atomic_store_explicit(&g_table.strings_count, count + 1, memory_order_relaxed);
 
-    /* Add to hash table */
-    g_table.buckets[bucket] = string_idx;
+    /* Publish to hash table: entry complete before readers can see it */
+    atomic_store_explicit(&array->slots[slot], entry, memory_order_release);
 
     pthread_mutex_unlock(&g_table.mutex);
 
-    ENSURE(copy != nullptr, "intern must return non-null for non-null input");
-    return copy;
+    ENSURE(entry->data != nullptr, "intern must return non-null for non-null input");
+    return entry->data;
 }
 
 size_t string_table_count(void) {
-    return g_table.strings_count;
+    return atomic_load_explicit(&g_table.strings_count, memory_order_relaxed);
+}
+
+size_t string_table_bytes(void) {
+    if (!g_table.initialized) {
+        return 0;
+    }
+    pthread_mutex_lock(&g_table.mutex);
+    size_t bytes = arena_mapped(&g_table.arena) + g_table.strings_capacity * sizeof(char*);
+    BucketArray* array = atomic_load_explicit(&g_table.buckets, memory_order_relaxed);
+    for (; array != nullptr; array = array->retired) {
+        bytes += sizeof(BucketArray) + array->capacity * sizeof(_Atomic(Entry*));
+    }
+    pthread_mutex_unlock(&g_table.mutex);
+    return bytes;
 }
 
 bool string_table_is_initialized(void) {
@@ -287,7 +343,7 @@ bool string_table_is_initialized(void) {
 
 const char* string_table_lookup(size_t idx) {
     REQUIRE(g_table.initialized, "string_table_lookup: table not initialized");
-    REQUIRE(idx < g_table.strings_count, "string_table_lookup: index out of bounds");
+    REQUIRE(idx < string_table_count(), "string_table_lookup: index out of bounds");
 
     return g_table.strings[idx];
 }
@@ -0,0 +1,63 @@
+/**
+ * Monitor Stack Implementation
+ *
+ * Architecture:
+ *   tl_entries    — dynamic array (realloc on growth, doubling)
+ *   tl_depth      — open entries (0 = empty)
+ *   tl_capacity   — allocation size
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: abort on allocation failure
+ */
+
+#include "tracking/monitor.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+
+/** Initial stack capacity. Grows as needed. */
+constexpr size_t MONITOR_STACK_INITIAL_CAPACITY = 64;
+
+static _Thread_local MonitorEntry *tl_entries = nullptr;
+static _Thread_local size_t tl_depth = 0;
+static _Thread_local size_t tl_capacity = 0;
+
+MonitorEntry* monitor_stack_push(void) {
+    if (tl_depth == tl_capacity) {
+        size_t capacity = tl_capacity == 0 ? MONITOR_STACK_INITIAL_CAPACITY : tl_capacity * 2;
+        MonitorEntry *entries = realloc(tl_entries, capacity * sizeof(MonitorEntry));
+        REQUIRE(entries != nullptr, "monitor stack allocation failed");
+        tl_entries = entries;
+        tl_capacity = capacity;
+    }
+    MonitorEntry *entry = &tl_entries[tl_depth++];
+    *entry = (MonitorEntry){0};
+    return entry;
+}
+
+void monitor_stack_pop(void) {
+    REQUIRE(tl_depth > 0, "monitor_stack_pop: stack underflow");
+    tl_depth--;
+}
+
+MonitorEntry* monitor_stack_peek(size_t n) {
+    if (n >= tl_depth) {
+        return nullptr;
+    }
+    return &tl_entries[tl_depth - 1 - n];
+}
+
+size_t monitor_stack_depth(void) {
+    return tl_depth;
+}
+
+void monitor_stack_clear(void) {
+    tl_depth = 0;
+}
+
+void monitor_stack_destroy(void) {
+    free(tl_entries);
+    tl_entries = nullptr;
+    tl_depth = 0;
+    tl_capacity = 0;
+}
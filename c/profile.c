@@ -0,0 +1,153 @@
+/**
+ * Function Profile Table Implementation
+ *
+ * Architecture:
+ *   verstable FrameInfo → ProfileStats*. Stats live out of line (two
+ *   histograms are ~5 KB): a rehash moves 8-byte pointers, not histograms.
+ *   Hash mixes the two interned pointers and the line.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/profile.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+
+/* ============================================================================
+ * Key hashing / equality
+ * ============================================================================ */
+
+static inline uint64_t profile_mix(uint64_t hash, uint64_t word) {
+    hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+static inline uint64_t profile_key_hash(FrameInfo key) {
+    uint64_t hash = 0;
+    hash = profile_mix(hash, (uint64_t)(uintptr_t)key.file);
+    hash = profile_mix(hash, (uint64_t)(uintptr_t)key.func);
+    hash = profile_mix(hash, (uint64_t)(uint32_t)key.line);
+    /* Final avalanche: verstable uses both low bits (bucket) and high bits (fragment) */
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline bool profile_key_equal(FrameInfo a, FrameInfo b) {
+    return a.file == b.file && a.func == b.func && a.line == b.line;
+}
+
+/* Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME profile_map
+#define KEY_TY FrameInfo
+#define VAL_TY ProfileStats *
+#define HASH_FN profile_key_hash
+#define CMPR_FN profile_key_equal
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct ProfileTable {
+    profile_map map;
+};
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+ProfileTable* profile_table_new(void) {
+    ProfileTable *table = malloc(sizeof(ProfileTable));
+    if (table == nullptr) {
+        return nullptr;
+    }
+    vt_init(&table->map);
+    return table;
+}
+
+void profile_table_free(ProfileTable *table) {
+    if (table == nullptr) {
+        return;
+    }
+    for (profile_map_itr itr = vt_first(&table->map); !vt_is_end(itr); itr = vt_next(itr)) {
+        free(itr.data->val);
+    }
+    vt_cleanup(&table->map);
+    free(table);
+}
+
+/** Stats of func, created empty on first use. @return nullptr on OOM. */
+static ProfileStats* profile_stats_of(ProfileTable *table, FrameInfo func) {
+    profile_map_itr itr = vt_get(&table->map, func);
+    if (!vt_is_end(itr)) {
+        return itr.data->val;
+    }
+
+    ProfileStats *stats = malloc(sizeof(ProfileStats));
+    if (stats == nullptr) {
+        return nullptr;
+    }
+    histogram_init(&stats->inclusive);
+    histogram_init(&stats->exclusive);
+
+    itr = vt_insert(&table->map, func, stats);
+    if (vt_is_end(itr)) {
+        free(stats);
+        return nullptr;
+    }
+    return stats;
+}
+
+bool profile_table_add(ProfileTable *table, const FrameInfo *func,
+                       uint64_t inclusive_ns, uint64_t exclusive_ns) {
+    REQUIRE(table != nullptr, "profile_table_add: table must not be null");
+    REQUIRE(func != nullptr, "profile_table_add: func must not be null");
+
+    ProfileStats *stats = profile_stats_of(table, *func);
+    if (stats == nullptr) {
+        return false;
+    }
+    histogram_record(&stats->inclusive, inclusive_ns);
+    histogram_record(&stats->exclusive, exclusive_ns);
+    return true;
+}
+
+bool profile_table_merge(ProfileTable *dst, const ProfileTable *src) {
+    REQUIRE(dst != nullptr, "profile_table_merge: dst must not be null");
+    REQUIRE(src != nullptr, "profile_table_merge: src must not be null");
+    REQUIRE(dst != src, "profile_table_merge: cannot merge a table into itself");
+
+    /* verstable iteration takes a non-const table; src is not modified */
+    profile_map *map = (profile_map *)&src->map;
+    for (profile_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        ProfileStats *stats = profile_stats_of(dst, itr.data->key);
+        if (stats == nullptr) {
+            return false;
+        }
+        histogram_merge(&stats->inclusive, &itr.data->val->inclusive);
+        histogram_merge(&stats->exclusive, &itr.data->val->exclusive);
+    }
+    return true;
+}
+
+size_t profile_table_size(const ProfileTable *table) {
+    REQUIRE(table != nullptr, "profile_table_size: table must not be null");
+    return vt_size((profile_map *)&table->map);
+}
+
+bool profile_table_each(const ProfileTable *table, ProfileVisitor visit, void *ctx) {
+    REQUIRE(table != nullptr, "profile_table_each: table must not be null");
+    REQUIRE(visit != nullptr, "profile_table_each: visit must not be null");
+
+    profile_map *map = (profile_map *)&table->map;
+    for (profile_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        if (!visit(&itr.data->key, itr.data->val, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,48 @@
+/**
+ * Call Sampling Implementation
+ *
+ * Architecture:
+ *   every        — thread counter, allow when seen % every == 0
+ *   interval_ns  — thread deadline, allow when now >= next_ns
+ *   max_per_code — fetch_add on the code's counter n: allow n < K, then
+ *                  n = K * 2^j (one recorded call per doubling)
+ *
+ * C23: nullptr, _Atomic
+ * FAIL-FIRST: abort on contract violation
+ */
+
+#include "tracking/sampling.h"
+#include "tracking/invariants.h"
+
+bool sampler_thread_allows(const SamplingConfig *cfg, SamplerState *state, uint64_t now_ns) {
+    REQUIRE(cfg != nullptr, "sampler_thread_allows: config must not be null");
+    REQUIRE(state != nullptr, "sampler_thread_allows: state must not be null");
+
+    if (cfg->every > 1 && state->seen++ % cfg->every != 0) {
+        return false;
+    }
+    if (cfg->interval_ns > 0) {
+        if (now_ns < state->next_ns) {
+            return false;
+        }
+        state->next_ns = now_ns + cfg->interval_ns;
+    }
+    return true;
+}
+
+bool sampler_code_allows(const SamplingConfig *cfg, _Atomic(uint64_t) *fires) {
+    REQUIRE(cfg != nullptr, "sampler_code_allows: config must not be null");
+    REQUIRE(fires != nullptr, "sampler_code_allows: counter must not be null");
+
+    uint64_t limit = cfg->max_per_code;
+    if (limit == 0) {
+        return true;
+    }
+    uint64_t n = atomic_fetch_add_explicit(fires, 1, memory_order_relaxed);
+    if (n < limit) {
+        return true;
+    }
+    /* Backoff: n == K * 2^j */
+    uint64_t multiple = n / limit;
+    return n % limit == 0 && (multiple & (multiple - 1)) == 0;
+}
@@ -0,0 +1,451 @@
+/**
+ * Shared-Memory Event Rings Implementation
+ *
+ * Architecture:
+ *   Segment  one shm_open() object, mapped whole on both sides (fd closed
+ *            right after mmap). Ring i data at data + i * ring_bytes.
+ *   Producer ring + verstable set of ids already defined on the ring.
+ *   Consumer verstable id → string copy (Arena, freed at once), shared by
+ *            all rings: the producer's ids are one pointer space.
+ *
+ * Record write (producer, ring owner):
+ *   head (own, relaxed) and tail (acquire) give the free bytes. A record
+ *   never straddles the ring end: if it does not fit before the end, a PAD
+ *   record fills the rest and the record starts at offset 0 (both count
+ *   against free space). head is published (release) once per record.
+ *
+ * C23: constexpr, nullptr, _Atomic
+ * FAIL-FIRST: abort on contract violation or malformed record;
+ *             OOM / full ring returns false (valid state)
+ */
+
+#define _GNU_SOURCE
+
+#include "tracking/shmring.h"
+#include "tracking/arena.h"
+#include "tracking/invariants.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/* Verstable sets / maps keyed by producer string ids.
+ * Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME shm_id_set
+#define KEY_TY uintptr_t
+#include "vendor/verstable.h"
+
+#define NAME shm_string_map
+#define KEY_TY uint64_t
+#define VAL_TY const char *
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+/** Records are padded to this alignment (RawEvent holds 8-byte fields). */
+constexpr uint32_t SHM_RECORD_ALIGN = 8;
+
+/** Payload prefix of a STRING record: the id. */
+typedef struct {
+    uint64_t id;
+} ShmStringPrefix;
+
+struct ShmProducer {
+    ShmSegment *seg;
+    ShmRing *ring;          /* nullptr = no free ring (events count as unclaimed) */
+    uint8_t *data;
+    shm_id_set sent;        /* Ids with a STRING record on this ring */
+};
+
+struct ShmConsumer {
+    ShmSegment *seg;
+    shm_string_map strings;
+    Arena arena;            /* String copies */
+    uint32_t next_ring;     /* Round-robin start of the next poll */
+};
+
+/* ============================================================================
+ * Internal
+ * ============================================================================ */
+
+static uint32_t record_size(size_t payload) {
+    size_t size = sizeof(ShmRecordHeader) + payload;
+    return (uint32_t)((size + SHM_RECORD_ALIGN - 1) & ~(size_t)(SHM_RECORD_ALIGN - 1));
+}
+
+static size_t segment_size(uint32_t ring_count, uint64_t ring_bytes) {
+    return sizeof(ShmHeader) + ring_count * sizeof(ShmRing) + ring_count * ring_bytes;
+}
+
+static bool valid_geometry(uint32_t ring_count, uint64_t ring_bytes) {
+    return ring_count >= 1 && ring_count <= SHM_MAX_RINGS
+        && ring_bytes >= SHM_MIN_RING_BYTES && ring_bytes <= SHM_MAX_RING_BYTES
+        && (ring_bytes & (ring_bytes - 1)) == 0;
+}
+
+static void segment_bind(ShmSegment *seg, void *base, size_t size) {
+    seg->header = base;
+    seg->rings = (ShmRing *)((uint8_t *)base + sizeof(ShmHeader));
+    seg->data = (uint8_t *)(seg->rings + seg->header->ring_count);
+    seg->size = size;
+}
+
+/** close() that keeps the errno of the failure being reported. */
+static void close_keep_errno(int fd) {
+    int saved = errno;
+    close(fd);
+    errno = saved;
+}
+
+/**
+ * Reserve size contiguous bytes at the ring head (PAD inserted if needed).
+ * @return Record start, or nullptr if the ring is full. Publish with commit().
+ */
+static uint8_t* ring_reserve(ShmProducer *p, uint32_t size) {
+    uint64_t ring_bytes = p->seg->header->ring_bytes;
+    uint64_t head = atomic_load_explicit(&p->ring->head, memory_order_relaxed);
+    uint64_t tail = atomic_load_explicit(&p->ring->tail, memory_order_acquire);
+    uint64_t pos = head & (ring_bytes - 1);
+    uint64_t before_end = ring_bytes - pos;
+    uint64_t pad = size > before_end ? before_end : 0;
+
+    if (size > ring_bytes || head + pad + size - tail > ring_bytes) {
+        return nullptr;
+    }
+    if (pad > 0) {
+        *(ShmRecordHeader *)(p->data + pos) = (ShmRecordHeader){
+            .size = (uint32_t)pad,
+            .type = SHM_RECORD_PAD,
+        };
+        atomic_store_explicit(&p->ring->head, head + pad, memory_order_release);
+        pos = 0;
+    }
+    return p->data + pos;
+}
+
+static void ring_commit(ShmProducer *p, uint32_t size) {
+    uint64_t head = atomic_load_explicit(&p->ring->head, memory_order_relaxed);
+    atomic_store_explicit(&p->ring->head, head + size, memory_order_release);
+}
+
+/** Define id on this ring (once). @return false if the record did not fit. */
+static bool define_string(ShmProducer *p, const char *s) {
+    uintptr_t id = (uintptr_t)s;
+    if (s == nullptr || !vt_is_end(vt_get(&p->sent, id))) {
+        return true;
+    }
+    size_t len = strlen(s);
+    uint32_t size = record_size(sizeof(ShmStringPrefix) + len + 1);
+    uint8_t *rec = ring_reserve(p, size);
+    if (rec == nullptr || vt_is_end(vt_insert(&p->sent, id))) {
+        return false;
+    }
+    *(ShmRecordHeader *)rec = (ShmRecordHeader){.size = size, .type = SHM_RECORD_STRING};
+    *(ShmStringPrefix *)(rec + sizeof(ShmRecordHeader)) = (ShmStringPrefix){.id = id};
+    memcpy(rec + sizeof(ShmRecordHeader) + sizeof(ShmStringPrefix), s, len + 1);
+    ring_commit(p, size);
+    return true;
+}
+
+/** Copy of the string a STRING record defines (first definition wins). */
+static void consume_string(ShmConsumer *c, const uint8_t *payload, uint32_t payload_size) {
+    REQUIRE(payload_size > sizeof(ShmStringPrefix), "shm: STRING record too short");
+    uint64_t id = ((const ShmStringPrefix *)payload)->id;
+    const char *bytes = (const char *)(payload + sizeof(ShmStringPrefix));
+    size_t room = payload_size - sizeof(ShmStringPrefix);
+    size_t len = strnlen(bytes, room);
+    REQUIRE(len < room, "shm: STRING record not NUL-terminated");
+
+    if (!vt_is_end(vt_get(&c->strings, id))) {
+        return;
+    }
+    char *copy = arena_alloc(&c->arena, len + 1, 1);
+    if (copy == nullptr) {
+        return;     /* OOM: fields with this id resolve to nullptr */
+    }
+    memcpy(copy, bytes, len + 1);
+    (void)vt_insert(&c->strings, id, copy);
+}
+
+static void resolve_strings(ShmConsumer *c, RawEvent *ev) {
+    const char **fields[RAW_EVENT_MAX_STRINGS];
+    int count = raw_event_strings(ev, fields);
+    for (int i = 0; i < count; i++) {
+        uint64_t id = (uintptr_t)*fields[i];
+        if (id == 0) {
+            continue;
+        }
+        shm_string_map_itr itr = vt_get(&c->strings, id);
+        *fields[i] = vt_is_end(itr) ? nullptr : itr.data->val;
+    }
+}
+
+/* ============================================================================
+ * Segment
+ * ============================================================================ */
+
+bool shm_segment_create(ShmSegment *seg, const char *name, uint32_t ring_count,
+                        uint64_t ring_bytes) {
+    REQUIRE(seg != nullptr, "seg must not be null");
+    REQUIRE(name != nullptr, "name must not be null");
+    *seg = (ShmSegment){0};
+
+    if (!valid_geometry(ring_count, ring_bytes)) {
+        errno = EINVAL;
+        return false;
+    }
+    size_t size = segment_size(ring_count, ring_bytes);
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+        return false;
+    }
+    if (ftruncate(fd, (off_t)size) != 0) {
+        close_keep_errno(fd);
+        shm_unlink(name);
+        return false;
+    }
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close_keep_errno(fd);
+    if (base == MAP_FAILED) {
+        int saved = errno;
+        shm_unlink(name);
+        errno = saved;
+        return false;
+    }
+
+    /* ftruncate() zeroed the segment: counters, rings and producer = NONE */
+    ShmHeader *header = base;
+    header->version = SHM_FORMAT_VERSION;
+    header->ring_count = ring_count;
+    header->ring_bytes = ring_bytes;
+    header->raw_event_size = sizeof(RawEvent);
+    memcpy(header->magic, SHM_HEADER_MAGIC, sizeof(header->magic));
+    segment_bind(seg, base, size);
+    return true;
+}
+
+bool shm_segment_attach(ShmSegment *seg, const char *name) {
+    REQUIRE(seg != nullptr, "seg must not be null");
+    REQUIRE(name != nullptr, "name must not be null");
+    *seg = (ShmSegment){0};
+
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close_keep_errno(fd);
+        return false;
+    }
+    if ((size_t)st.st_size < sizeof(ShmHeader)) {
+        close(fd);
+        errno = EINVAL;
+        return false;
+    }
+    size_t size = (size_t)st.st_size;
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close_keep_errno(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    ShmHeader *header = base;
+    bool compatible = memcmp(header->magic, SHM_HEADER_MAGIC, sizeof(header->magic)) == 0
+                   && header->version == SHM_FORMAT_VERSION
+                   && header->raw_event_size == sizeof(RawEvent)
+                   && valid_geometry(header->ring_count, header->ring_bytes)
+                   && segment_size(header->ring_count, header->ring_bytes) == size;
+    if (!compatible) {
+        munmap(base, size);
+        errno = EINVAL;
+        return false;
+    }
+    uint32_t expected = SHM_PRODUCER_NONE;
+    if (!atomic_compare_exchange_strong(&header->producer, &expected, SHM_PRODUCER_ATTACHED)) {
+        munmap(base, size);
+        errno = EBUSY;
+        return false;
+    }
+    segment_bind(seg, base, size);
+    return true;
+}
+
+void shm_segment_finish(ShmSegment *seg) {
+    REQUIRE(seg != nullptr && seg->header != nullptr, "segment must be mapped");
+    atomic_store_explicit(&seg->header->producer, SHM_PRODUCER_DONE, memory_order_release);
+}
+
+bool shm_segment_finished(const ShmSegment *seg) {
+    REQUIRE(seg != nullptr && seg->header != nullptr, "segment must be mapped");
+    return atomic_load_explicit(&seg->header->producer, memory_order_acquire)
+        == SHM_PRODUCER_DONE;
+}
+
+uint64_t shm_segment_dropped(const ShmSegment *seg) {
+    REQUIRE(seg != nullptr && seg->header != nullptr, "segment must be mapped");
+    uint64_t dropped = atomic_load_explicit(&seg->header->unclaimed, memory_order_relaxed);
+    for (uint32_t i = 0; i < seg->header->ring_count; i++) {
+        dropped += atomic_load_explicit(&seg->rings[i].dropped, memory_order_relaxed);
+    }
+    return dropped;
+}
+
+void shm_segment_unmap(ShmSegment *seg) {
+    REQUIRE(seg != nullptr, "seg must not be null");
+    if (seg->header != nullptr) {
+        munmap(seg->header, seg->size);
+    }
+    *seg = (ShmSegment){0};
+}
+
+bool shm_segment_unlink(const char *name) {
+    REQUIRE(name != nullptr, "name must not be null");
+    return shm_unlink(name) == 0;
+}
+
+/* ============================================================================
+ * Producer
+ * ============================================================================ */
+
+ShmProducer* shm_producer_new(ShmSegment *seg) {
+    REQUIRE(seg != nullptr && seg->header != nullptr, "segment must be mapped");
+    ShmProducer *p = calloc(1, sizeof(ShmProducer));
+    if (p == nullptr) {
+        return nullptr;
+    }
+    p->seg = seg;
+    vt_init(&p->sent);
+
+    uint32_t index = atomic_fetch_add(&seg->header->rings_claimed, 1);
+    if (index < seg->header->ring_count) {
+        p->ring = &seg->rings[index];
+        p->data = seg->data + (uint64_t)index * seg->header->ring_bytes;
+    }
+    return p;
+}
+
+void shm_producer_free(ShmProducer *producer) {
+    if (producer == nullptr) {
+        return;
+    }
+    vt_cleanup(&producer->sent);
+    free(producer);
+}
+
+bool shm_producer_write(ShmProducer *producer, const RawEvent *ev) {
+    REQUIRE(producer != nullptr, "producer must not be null");
+    REQUIRE(ev != nullptr, "ev must not be null");
+
+    if (producer->ring == nullptr) {
+        atomic_fetch_add_explicit(&producer->seg->header->unclaimed, 1, memory_order_relaxed);
+        return false;
+    }
+
+    RawEvent copy = *ev;
+    const char **fields[RAW_EVENT_MAX_STRINGS];
+    int count = raw_event_strings(&copy, fields);
+    bool ok = true;
+    for (int i = 0; ok && i < count; i++) {
+        ok = define_string(producer, *fields[i]);
+    }
+
+    uint32_t size = record_size(sizeof(RawEvent));
+    uint8_t *rec = ok ? ring_reserve(producer, size) : nullptr;
+    if (rec == nullptr) {
+        atomic_fetch_add_explicit(&producer->ring->dropped, 1, memory_order_relaxed);
+        return false;
+    }
+    *(ShmRecordHeader *)rec = (ShmRecordHeader){.size = size, .type = SHM_RECORD_EVENT};
+    memcpy(rec + sizeof(ShmRecordHeader), &copy, sizeof(RawEvent));
+    ring_commit(producer, size);
+    return true;
+}
+
+/* ============================================================================
+ * Consumer
+ * ============================================================================ */
+
+ShmConsumer* shm_consumer_new(ShmSegment *seg) {
+    REQUIRE(seg != nullptr && seg->header != nullptr, "segment must be mapped");
+    ShmConsumer *c = calloc(1, sizeof(ShmConsumer));
+    if (c == nullptr) {
+        return nullptr;
+    }
+    c->seg = seg;
+    vt_init(&c->strings);
+    arena_init(&c->arena, 0);
+    return c;
+}
+
+void shm_consumer_free(ShmConsumer *consumer) {
+    if (consumer == nullptr) {
+        return;
+    }
+    vt_cleanup(&consumer->strings);
+    arena_destroy(&consumer->arena);
+    free(consumer);
+}
+
+size_t shm_consumer_poll(ShmConsumer *consumer, RawEvent *out, size_t max) {
+    REQUIRE(consumer != nullptr, "consumer must not be null");
+    REQUIRE(out != nullptr || max == 0, "out must not be null");
+
+    const ShmHeader *header = consumer->seg->header;
+    uint64_t ring_bytes = header->ring_bytes;
+    uint32_t claimed = atomic_load_explicit(&header->rings_claimed, memory_order_acquire);
+    uint32_t rings = claimed < header->ring_count ? claimed : header->ring_count;
+    size_t n = 0;
+
+    for (uint32_t visited = 0; visited < rings && n < max; visited++) {
+        uint32_t index = (consumer->next_ring + visited) % rings;
+        ShmRing *ring = &consumer->seg->rings[index];
+        const uint8_t *data = consumer->seg->data + (uint64_t)index * ring_bytes;
+        uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        uint64_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+        while (tail < head && n < max) {
+            uint64_t pos = tail & (ring_bytes - 1);
+            ShmRecordHeader rec = *(const ShmRecordHeader *)(data + pos);
+            REQUIRE(rec.size >= sizeof(ShmRecordHeader) && rec.size % SHM_RECORD_ALIGN == 0
+                    && rec.size <= ring_bytes - pos && rec.size <= head - tail,
+                    "shm: malformed record size");
+            const uint8_t *payload = data + pos + sizeof(ShmRecordHeader);
+            uint32_t payload_size = rec.size - (uint32_t)sizeof(ShmRecordHeader);
+
+            switch (rec.type) {
+                case SHM_RECORD_PAD:
+                    REQUIRE(rec.size == ring_bytes - pos, "shm: PAD must end the ring");
+                    break;
+                case SHM_RECORD_STRING:
+                    consume_string(consumer, payload, payload_size);
+                    break;
+                case SHM_RECORD_EVENT:
+                    REQUIRE(rec.size == record_size(sizeof(RawEvent)), "shm: EVENT record size");
+                    memcpy(&out[n], payload, sizeof(RawEvent));
+                    resolve_strings(consumer, &out[n]);
+                    n++;
+                    break;
+                default:
+                    REQUIRE(false, "shm: unknown record type");
+            }
+            tail += rec.size;
+        }
+        atomic_store_explicit(&ring->tail, tail, memory_order_release);
+        if (n == max) {
+            /* Resume on this ring: it may have more */
+            consumer->next_ring = index;
+        }
+    }
+    if (n < max && rings > 0) {
+        consumer->next_ring = (consumer->next_ring + 1) % rings;
+    }
+    return n;
+}
@@ -0,0 +1,205 @@
+/**
+ * Allocation Site Table Implementation
+ *
+ * Architecture:
+ *   sites  verstable SiteKey → SiteStats*; stats bump-allocated from an
+ *          arena (pointers stable across rehash, freed in bulk)
+ *   live   verstable obj id → {SiteStats*, born_ns}: 24 bytes per live
+ *          object, no string copies
+ *
+ * C23: nullptr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/sites.h"
+#include "tracking/arena.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* ============================================================================
+ * Maps
+ * ============================================================================ */
+
+typedef struct {
+    SiteStats *site;
+    uint64_t born_ns;
+} LiveObject;
+
+static inline uint64_t site_key_hash(SiteKey key) {
+    uint64_t hash = (uint64_t)(uintptr_t)key.type_name ^ ((uint64_t)key.stack << 32);
+    /* Final avalanche: verstable uses both low bits (bucket) and high bits (fragment) */
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static inline bool site_key_equal(SiteKey a, SiteKey b) {
+    return a.stack == b.stack && a.type_name == b.type_name;
+}
+
+/* Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME site_map
+#define KEY_TY SiteKey
+#define VAL_TY SiteStats *
+#define HASH_FN site_key_hash
+#define CMPR_FN site_key_equal
+#include "vendor/verstable.h"
+
+#define NAME live_map
+#define KEY_TY uintptr_t
+#define VAL_TY LiveObject
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct SiteTable {
+    site_map sites;
+    live_map live;
+    Arena stats;
+};
+
+/* ============================================================================
+ * Lifetime histogram
+ * ============================================================================ */
+
+static inline unsigned lifetime_bucket(uint64_t ns) {
+    unsigned msb = ns == 0 ? 0 : 63u - (unsigned)__builtin_clzll(ns);
+    return msb < SITE_LIFETIME_BUCKETS ? msb : SITE_LIFETIME_BUCKETS - 1;
+}
+
+void site_lifetime_bounds(unsigned idx, uint64_t *lower, uint64_t *upper) {
+    REQUIRE(idx < SITE_LIFETIME_BUCKETS, "site_lifetime_bounds: idx out of range");
+    REQUIRE(lower != nullptr && upper != nullptr, "site_lifetime_bounds: null output");
+
+    *lower = idx == 0 ? 0 : 1ull << idx;
+    *upper = 1ull << (idx + 1);
+}
+
+static void site_record_free(SiteStats *site, uint64_t lifetime_ns) {
+    site->freed++;
+    site->lifetime_total_ns += lifetime_ns;
+    if (lifetime_ns < site->lifetime_min_ns) {
+        site->lifetime_min_ns = lifetime_ns;
+    }
+    if (lifetime_ns > site->lifetime_max_ns) {
+        site->lifetime_max_ns = lifetime_ns;
+    }
+    site->lifetime[lifetime_bucket(lifetime_ns)]++;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+SiteTable* site_table_new(void) {
+    SiteTable *table = malloc(sizeof(SiteTable));
+    if (table == nullptr) {
+        return nullptr;
+    }
+    vt_init(&table->sites);
+    vt_init(&table->live);
+    arena_init(&table->stats, 0);
+    return table;
+}
+
+void site_table_free(SiteTable *table) {
+    if (table == nullptr) {
+        return;
+    }
+    vt_cleanup(&table->sites);
+    vt_cleanup(&table->live);
+    arena_destroy(&table->stats);
+    free(table);
+}
+
+/** Stats of key, created empty on first use. @return nullptr on OOM. */
+static SiteStats* site_of(SiteTable *table, SiteKey key) {
+    site_map_itr itr = vt_get(&table->sites, key);
+    if (!vt_is_end(itr)) {
+        return itr.data->val;
+    }
+
+    SiteStats *site = arena_alloc(&table->stats, sizeof(SiteStats), alignof(SiteStats));
+    if (site == nullptr) {
+        return nullptr;
+    }
+    memset(site, 0, sizeof(*site));
+    site->lifetime_min_ns = UINT64_MAX;
+
+    /* On OOM the arena slot is wasted until free: bounded by one per failure */
+    itr = vt_insert(&table->sites, key, site);
+    return vt_is_end(itr) ? nullptr : site;
+}
+
+bool site_table_create(SiteTable *table, uintptr_t obj_id, StackId stack,
+                       const char *type_name, uint64_t now_ns) {
+    REQUIRE(table != nullptr, "site_table_create: table must not be null");
+
+    SiteStats *site = site_of(table, (SiteKey){.stack = stack, .type_name = type_name});
+    if (site == nullptr) {
+        return false;
+    }
+
+    live_map_itr itr = vt_get(&table->live, obj_id);
+    if (!vt_is_end(itr)) {
+        /* Id reused without a DESTROY seen: the old object is gone by now */
+        LiveObject old = itr.data->val;
+        site_record_free(old.site, now_ns > old.born_ns ? now_ns - old.born_ns : 0);
+        itr.data->val = (LiveObject){.site = site, .born_ns = now_ns};
+    } else if (vt_is_end(vt_insert(&table->live, obj_id,
+                                   (LiveObject){.site = site, .born_ns = now_ns}))) {
+        return false;
+    }
+    site->allocated++;
+    return true;
+}
+
+bool site_table_destroy(SiteTable *table, uintptr_t obj_id, uint64_t now_ns) {
+    REQUIRE(table != nullptr, "site_table_destroy: table must not be null");
+
+    live_map_itr itr = vt_get(&table->live, obj_id);
+    if (vt_is_end(itr)) {
+        return false;
+    }
+    LiveObject obj = itr.data->val;
+    vt_erase_itr(&table->live, itr);
+    site_record_free(obj.site, now_ns > obj.born_ns ? now_ns - obj.born_ns : 0);
+    return true;
+}
+
+size_t site_table_size(const SiteTable *table) {
+    REQUIRE(table != nullptr, "site_table_size: table must not be null");
+    return vt_size((site_map *)&table->sites);
+}
+
+size_t site_table_live(const SiteTable *table) {
+    REQUIRE(table != nullptr, "site_table_live: table must not be null");
+    return vt_size((live_map *)&table->live);
+}
+
+SiteEntry* site_table_entries(const SiteTable *table, size_t *count) {
+    REQUIRE(table != nullptr, "site_table_entries: table must not be null");
+    REQUIRE(count != nullptr, "site_table_entries: count must not be null");
+
+    /* verstable iteration takes a non-const table; it is not modified */
+    site_map *sites = (site_map *)&table->sites;
+    size_t n = vt_size(sites);
+    SiteEntry *entries = malloc((n ? n : 1) * sizeof(SiteEntry));
+    if (entries == nullptr) {
+        return nullptr;
+    }
+
+    size_t i = 0;
+    for (site_map_itr itr = vt_first(sites); !vt_is_end(itr); itr = vt_next(itr)) {
+        entries[i].key = itr.data->key;
+        entries[i].stats = *itr.data->val;
+        i++;
+    }
+    *count = i;
+    return entries;
+}
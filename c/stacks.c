@@ -0,0 +1,341 @@
+/**
+ * Call Stack Trie Implementation
+ *
+ * Architecture:
+ *
+ *   chunks[]   — directory of node chunks (STACK_TRIE_CHUNK nodes each),
+ *                a chunk is allocated once and NEVER moved or freed before
+ *                destroy(); node id = chunk * CHUNK + offset, id 0 unused
+ *
+ *   index      — open-addressing table of _Atomic(StackId), linear
+ *                probing, slots only go 0 → id (no delete); resize builds
+ *                a NEW array and publishes it atomically, old arrays are
+ *                retired until destroy (as StringTable buckets)
+ *
+ * Thread Safety:
+ *   - Hits are lock-free: load index (acquire), probe slots (acquire);
+ *     a node (and its chunk pointer) is fully written before its id is
+ *     published (release)
+ *   - Misses take the mutex and re-probe the CURRENT array: a reader on a
+ *     retired array may miss a node that exists, the locked re-probe
+ *     finds it (same id, never a duplicate)
+ *   - pthread_mutex_t serializes writers (TSan-compatible, unlike mtx_t)
+ *
+ * Memory: 32 bytes per node + 8 bytes of index per node (load <= 0.5).
+ *
+ * C23: constexpr, nullptr, _Atomic
+ * FAIL-FIRST: abort on allocation failure
+ */
+
+#include "tracking/stacks.h"
+#include "tracking/invariants.h"
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+/* ============================================================================
+ * Constants
+ * ============================================================================ */
+
+/** Initial index capacity (power of 2). */
+constexpr size_t STACK_INDEX_INITIAL_CAPACITY = 4096;
+
+/** Nodes (ids) available: id 0 is the empty stack. */
+constexpr uint64_t STACK_TRIE_CAPACITY = (uint64_t)STACK_TRIE_CHUNK * STACK_TRIE_MAX_CHUNKS - 1;
+
+static_assert(sizeof(StackNode) == 32, "StackNode must stay 32 bytes");
+static_assert((STACK_TRIE_CHUNK & (STACK_TRIE_CHUNK - 1)) == 0,
+              "STACK_TRIE_CHUNK must be a power of 2");
+static_assert((uint64_t)STACK_TRIE_CHUNK * STACK_TRIE_MAX_CHUNKS <= (uint64_t)UINT32_MAX + 1,
+              "StackId must address every node");
+
+/* ============================================================================
+ * Global State
+ * ============================================================================ */
+
+/** Index array, immutable capacity; published as a whole. */
+typedef struct IndexArray {
+    size_t capacity;                /* Power of 2 */
+    struct IndexArray* retired;     /* Older arrays, freed at destroy */
+    _Atomic(StackId) slots[];
+} IndexArray;
+
+typedef struct {
+    /* Node storage — chunk pointers published before any id in them */
+    _Atomic(StackNode*) chunks[STACK_TRIE_MAX_CHUNKS];
+    _Atomic(uint32_t) count;        /* Nodes allocated (ids 1..count) */
+
+    /* Lookup index — read lock-free, replaced on resize */
+    _Atomic(IndexArray*) index;
+
+    /* Writers (pthread for TSan compatibility) */
+    pthread_mutex_t mutex;
+    bool initialized;
+} StackTrie;
+
+static StackTrie g_trie = {0};
+
+/* ============================================================================
+ * Internal: Nodes
+ * ============================================================================ */
+
+static inline StackNode* node_at(StackId id) {
+    StackNode* chunk = atomic_load_explicit(&g_trie.chunks[id / STACK_TRIE_CHUNK],
+                                            memory_order_relaxed);
+    return &chunk[id % STACK_TRIE_CHUNK];
+}
+
+static inline uint64_t node_mix(uint64_t hash, uint64_t word) {
+    hash ^= word + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+/** Hash of (parent, frame). Interned strings: pointers are identity. */
+static inline uint64_t node_hash(StackId parent, const StackFrame* frame) {
+    uint64_t hash = parent;
+    hash = node_mix(hash, (uint64_t)(uintptr_t)frame->file);
+    hash = node_mix(hash, (uint64_t)(uintptr_t)frame->func);
+    hash = node_mix(hash, (uint64_t)(uint32_t)frame->line);
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+/* ============================================================================
+ * Internal: Index Operations
+ * ============================================================================ */
+
+/**
+ * Allocate index array with all slots empty.
+ * FAIL-FIRST: Aborts on allocation failure.
+ */
+static IndexArray* index_array_new(size_t capacity) {
+    IndexArray* array = malloc(sizeof(IndexArray) + capacity * sizeof(_Atomic(StackId)));
+    REQUIRE(array != nullptr, "stack index allocation failed");
+
+    array->capacity = capacity;
+    array->retired = nullptr;
+    for (size_t i = 0; i < capacity; i++) {
+        atomic_init(&array->slots[i], STACK_EMPTY);
+    }
+    return array;
+}
+
+/**
+ * Find slot of (parent, frame). Returns slot holding its id or empty slot.
+ * Safe without lock (acquire loads); result is only final under the mutex.
+ *
+ * @param found  Output: node id if found, STACK_EMPTY if empty slot
+ * @return       Slot index
+ */
+static size_t find_slot(IndexArray* array, StackId parent, const StackFrame* frame,
+                        uint64_t hash, StackId* found) {
+    size_t mask = array->capacity - 1;
+    size_t idx = (size_t)hash & mask;
+    size_t start = idx;
+
+    do {
+        StackId id = atomic_load_explicit(&array->slots[idx], memory_order_acquire);
+
+        if (id == STACK_EMPTY) {
+            *found = STACK_EMPTY;
+            return idx;
+        }
+
+        const StackNode* node = node_at(id);
+        if (node->parent == parent && frame_equals(&node->frame, frame)) {
+            *found = id;
+            return idx;
+        }
+
+        idx = (idx + 1) & mask;
+    } while (idx != start);
+
+    /* Table full — should never happen due to load factor check */
+    UNREACHABLE("stack index full");
+}
+
+/**
+ * Double the index. Called under mutex; readers keep probing the old
+ * array until they load the new one: it stays allocated.
+ */
+static void resize_index(void) {
+    IndexArray* old_array = atomic_load_explicit(&g_trie.index, memory_order_relaxed);
+    IndexArray* new_array = index_array_new(old_array->capacity * 2);
+
+    for (size_t i = 0; i < old_array->capacity; i++) {
+        StackId id = atomic_load_explicit(&old_array->slots[i], memory_order_relaxed);
+        if (id != STACK_EMPTY) {
+            const StackNode* node = node_at(id);
+            StackId found;
+            size_t slot = find_slot(new_array, node->parent, &node->frame,
+                                    node_hash(node->parent, &node->frame), &found);
+            atomic_store_explicit(&new_array->slots[slot], id, memory_order_relaxed);
+        }
+    }
+
+    /* Publish: release makes every slot store above visible */
+    new_array->retired = old_array;
+    atomic_store_explicit(&g_trie.index, new_array, memory_order_release);
+}
+
+/* ============================================================================
+ * Public API
+ * ============================================================================ */
+
+void stack_trie_init(void) {
+    if (g_trie.initialized) {
+        return;
+    }
+
+    atomic_store(&g_trie.index, index_array_new(STACK_INDEX_INITIAL_CAPACITY));
+    atomic_store(&g_trie.count, 0);
+
+    int result = pthread_mutex_init(&g_trie.mutex, NULL);
+    REQUIRE(result == 0, "mutex init failed");
+
+    g_trie.initialized = true;
+}
+
+void stack_trie_destroy(void) {
+    if (!g_trie.initialized) {
+        return;
+    }
+
+    for (size_t i = 0; i < STACK_TRIE_MAX_CHUNKS; i++) {
+        StackNode* chunk = atomic_load(&g_trie.chunks[i]);
+        if (chunk == nullptr) {
+            break;  /* Chunks are allocated in order */
+        }
+        free(chunk);
+        atomic_store(&g_trie.chunks[i], nullptr);
+    }
+
+    IndexArray* array = atomic_load(&g_trie.index);
+    while (array != nullptr) {
+        IndexArray* retired = array->retired;
+        free(array);
+        array = retired;
+    }
+
+    pthread_mutex_destroy(&g_trie.mutex);
+
+    atomic_store(&g_trie.index, nullptr);
+    atomic_store(&g_trie.count, 0);
+    g_trie.initialized = false;
+}
+
+StackId stack_trie_child(StackId parent, const StackFrame* frame) {
+    ASSERT_INITIALIZED(g_trie.initialized, "StackTrie");
+    REQUIRE(frame != nullptr, "stack_trie_child: frame must not be null");
+    REQUIRE(parent <= atomic_load_explicit(&g_trie.count, memory_order_acquire),
+            "stack_trie_child: unknown parent");
+
+    uint64_t hash = node_hash(parent, frame);
+
+    /* Fast path: lock-free hit */
+    StackId found;
+    IndexArray* array = atomic_load_explicit(&g_trie.index, memory_order_acquire);
+    (void)find_slot(array, parent, frame, hash, &found);
+    if (found != STACK_EMPTY) {
+        return found;
+    }
+
+    /* Slow path: insert under lock, re-probe the current array */
+    pthread_mutex_lock(&g_trie.mutex);
+
+    array = atomic_load_explicit(&g_trie.index, memory_order_relaxed);
+    size_t slot = find_slot(array, parent, frame, hash, &found);
+    if (found != STACK_EMPTY) {
+        pthread_mutex_unlock(&g_trie.mutex);
+        return found;
+    }
+
+    uint32_t count = atomic_load_explicit(&g_trie.count, memory_order_relaxed);
+    if (count >= STACK_TRIE_CAPACITY) {
+        pthread_mutex_unlock(&g_trie.mutex);
+        return STACK_EMPTY;  /* Trie full — valid state, traceback dropped */
+    }
+
+    /* Load factor 0.5: probes stay short on the lock-free path */
+    if ((size_t)(count + 1) * 2 > array->capacity) {
+        resize_index();
+        array = atomic_load_explicit(&g_trie.index, memory_order_relaxed);
+        slot = find_slot(array, parent, frame, hash, &found);
+        REQUIRE(found == STACK_EMPTY, "stack node appeared during resize");
+    }
+
+    StackId id = count + 1;
+    size_t chunk_idx = id / STACK_TRIE_CHUNK;
+    if (atomic_load_explicit(&g_trie.chunks[chunk_idx], memory_order_relaxed) == nullptr) {
+        StackNode* chunk = malloc(STACK_TRIE_CHUNK * sizeof(StackNode));
+        REQUIRE(chunk != nullptr, "stack chunk allocation failed");
+        atomic_store_explicit(&g_trie.chunks[chunk_idx], chunk, memory_order_relaxed);
+    }
+
+    StackNode* node = node_at(id);
+    node->frame = *frame;
+    node->parent = parent;
+    node->depth = parent == STACK_EMPTY ? 1 : node_at(parent)->depth + 1;
+
+    /* Publish: node and chunk complete before readers can see the id */
+    atomic_store_explicit(&g_trie.count, id, memory_order_release);
+    atomic_store_explicit(&array->slots[slot], id, memory_order_release);
+
+    pthread_mutex_unlock(&g_trie.mutex);
+    return id;
+}
+
+StackId stack_trie_current(void) {
+    /* Nearest frame (from the top) whose stack id is memoized */
+    size_t depth = frame_stack_depth();
+    size_t n = 0;
+    while (n < depth && frame_stack_tag(n) == STACK_EMPTY) {
+        n++;
+    }
+    StackId id = n < depth ? frame_stack_tag(n) : STACK_EMPTY;
+
+    /* Extend upward, memoizing every new level */
+    while (n > 0) {
+        n--;
+        id = stack_trie_child(id, frame_stack_peek(n));
+        if (id == STACK_EMPTY) {
+            return STACK_EMPTY;  /* Trie full: no partial stacks */
+        }
+        frame_stack_set_tag(n, id);
+    }
+    return id;
+}
+
+const StackNode* stack_trie_node(StackId id) {
+    REQUIRE(id != STACK_EMPTY, "stack_trie_node: empty stack has no node");
+    REQUIRE(id <= atomic_load_explicit(&g_trie.count, memory_order_acquire),
+            "stack_trie_node: unknown id");
+    return node_at(id);
+}
+
+size_t stack_trie_count(void) {
+    return atomic_load_explicit(&g_trie.count, memory_order_relaxed);
+}
+
+size_t stack_trie_bytes(void) {
+    if (!g_trie.initialized) {
+        return 0;
+    }
+    pthread_mutex_lock(&g_trie.mutex);
+    size_t bytes = 0;
+    for (size_t i = 0; i < STACK_TRIE_MAX_CHUNKS; i++) {
+        if (atomic_load_explicit(&g_trie.chunks[i], memory_order_relaxed) == nullptr) {
+            break;  /* Chunks are allocated in order */
+        }
+        bytes += STACK_TRIE_CHUNK * sizeof(StackNode);
+    }
+    IndexArray* array = atomic_load_explicit(&g_trie.index, memory_order_relaxed);
+    for (; array != nullptr; array = array->retired) {
+        bytes += sizeof(IndexArray) + array->capacity * sizeof(_Atomic(StackId));
+    }
+    pthread_mutex_unlock(&g_trie.mutex);
+    return bytes;
+}
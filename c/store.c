@@ -0,0 +1,336 @@
+/**
+ * Event Store Implementation
+ *
+ * Architecture:
+ *   head → chunk → chunk → ... → tail
+ *   Each chunk: header + data[EVENT_CHUNK_SIZE], records packed back-to-back.
+ *   Append bumps tail->used; a full tail gets a fresh chunk linked after it.
+ *
+ * Pointer Stability:
+ *   Chunks are mmap'd once and never remapped, so Event* handed out by
+ *   reserve() stays valid until destroy() or until the consumer has taken it
+ *   and moved past its chunk. No copy-before-eval needed.
+ *
+ * Writer / Consumer Handoff:
+ *   Writer links chunk->next (release) before any record in it is published,
+ *   then stores `published` (release). Consumer loads `published` (acquire),
+ *   so every chunk link and record byte up to that count is visible.
+ *   A chunk is released only when taken to its end AND next != nullptr:
+ *   the writer never touches a chunk again once it has linked a successor.
+ *
+ * Merge:
+ *   Binary min-heap of per-store cursors keyed by head->seq.
+ *   Drained cursors are removed, so each step is O(log live_stores).
+ *   The taken cursor is refilled on the NEXT call: refilling peeks, and peek
+ *   may release the chunk holding the record just returned.
+ *
+ * Memory:
+ *   Cost per record = record_size (no per-event malloc).
+ *   Unused tail of each chunk < largest record (sizeof(Event) + MAX_ARGS args).
+ *   Out-of-line data (field errors) bump-allocated from the store's aux
+ *   arena: destroy() is one munmap per chunk/block, records are not walked.
+ *
+ * C23: constexpr, nullptr, alignas, _Atomic
+ * FAIL-FIRST: abort on contract violation; OOM returns nullptr (valid state)
+ */
+
+#include "tracking/store.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+/* ============================================================================
+ * Chunk
+ * ============================================================================ */
+
+struct EventChunk {
+    _Atomic(EventChunk *) next;
+    _Atomic(size_t) used;       /* Ordered by `published`, relaxed is enough */
+    alignas(Event) unsigned char data[];
+};
+
+static_assert(EVENT_CHUNK_SIZE >= sizeof(Event) + MAX_ARGS * sizeof(ArgInfo),
+              "EVENT_CHUNK_SIZE must fit the largest record");
+
+constexpr size_t EVENT_CHUNK_MAP_SIZE = sizeof(EventChunk) + EVENT_CHUNK_SIZE;
+
+/* Out-of-line data goes to the store this thread writes (aux_alloc) */
+static _Thread_local EventStore *tl_writer = nullptr;
+
+static EventChunk* chunk_new(void) {
+    void *mem = mmap(nullptr, EVENT_CHUNK_MAP_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        return nullptr;
+    }
+    EventChunk *chunk = mem;
+    atomic_init(&chunk->next, nullptr);
+    atomic_init(&chunk->used, 0);
+    return chunk;
+}
+
+static inline void chunk_free(EventChunk *chunk) {
+    munmap(chunk, EVENT_CHUNK_MAP_SIZE);
+}
+
+static inline size_t chunk_used(const EventChunk *chunk) {
+    return atomic_load_explicit(&chunk->used, memory_order_relaxed);
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+void event_store_init(EventStore *store) {
+    REQUIRE(store != nullptr, "event_store_init: store must not be null");
+
+    store->tail = nullptr;
+    store->count = 0;
+    store->bytes = 0;
+    atomic_init(&store->published, 0);
+    arena_init(&store->aux, 0);
+    store->head = nullptr;
+    store->head_offset = 0;
+    store->taken = 0;
+}
+
+void event_store_destroy(EventStore *store) {
+    REQUIRE(store != nullptr, "event_store_destroy: store must not be null");
+
+    EventChunk *chunk = store->head;
+    while (chunk != nullptr) {
+        EventChunk *next = atomic_load_explicit(&chunk->next, memory_order_relaxed);
+        chunk_free(chunk);
+        chunk = next;
+    }
+    arena_destroy(&store->aux);
+    if (tl_writer == store) {
+        tl_writer = nullptr;
+    }
+    event_store_init(store);
+}
+
+/* ============================================================================
+ * Append (writer)
+ * ============================================================================ */
+
+Event* event_store_reserve(EventStore *store, int max_args) {
+    REQUIRE(store != nullptr, "event_store_reserve: store must not be null");
+    REQUIRE(max_args >= 0 && max_args <= MAX_ARGS,
+            "event_store_reserve: max_args out of range");
+
+    uint32_t size = event_record_size(max_args);
+
+    if (store->tail == nullptr || chunk_used(store->tail) + size > EVENT_CHUNK_SIZE) {
+        EventChunk *chunk = chunk_new();
+        if (chunk == nullptr) {
+            return nullptr;  /* OOM: caller drops event */
+        }
+        if (store->tail == nullptr) {
+            /* First chunk: consumer reads head only after a publish */
+            store->head = chunk;
+        } else {
+            atomic_store_explicit(&store->tail->next, chunk, memory_order_release);
+        }
+        store->tail = chunk;
+    }
+
+    EventChunk *tail = store->tail;
+    size_t used = chunk_used(tail);
+    Event *ev = (Event *)(tail->data + used);
+    memset(ev, 0, size);
+    ev->record_size = size;
+
+    atomic_store_explicit(&tail->used, used + size, memory_order_relaxed);
+    store->bytes += size;
+    store->count++;
+    tl_writer = store;
+    return ev;
+}
+
+void event_store_commit(EventStore *store, Event *ev) {
+    REQUIRE(store != nullptr && ev != nullptr, "event_store_commit: null argument");
+
+    uint32_t actual = event_record_size(ev->arg_count);
+    REQUIRE(actual <= ev->record_size, "event_store_commit: arg_count exceeds reservation");
+
+    /* Only the last record of the tail chunk can give space back */
+    EventChunk *tail = store->tail;
+    unsigned char *end = (unsigned char *)ev + ev->record_size;
+    if (tail == nullptr || end != tail->data + chunk_used(tail)) {
+        return;
+    }
+
+    uint32_t unused = ev->record_size - actual;
+    atomic_store_explicit(&tail->used, chunk_used(tail) - unused, memory_order_relaxed);
+    store->bytes -= unused;
+    ev->record_size = actual;
+}
+
+void* event_store_aux_alloc(size_t size) {
+    REQUIRE(tl_writer != nullptr, "event_store_aux_alloc: no record reserved on this thread");
+    return arena_alloc(&tl_writer->aux, size, alignof(max_align_t));
+}
+
+void event_store_publish(EventStore *store) {
+    REQUIRE(store != nullptr, "event_store_publish: store must not be null");
+
+    atomic_store_explicit(&store->published, store->count, memory_order_release);
+}
+
+/* ============================================================================
+ * Consume (consumer)
+ * ============================================================================ */
+
+Event* event_store_peek(EventStore *store) {
+    REQUIRE(store != nullptr, "event_store_peek: store must not be null");
+
+    size_t published = atomic_load_explicit(&store->published, memory_order_acquire);
+    if (store->taken == published) {
+        return nullptr;
+    }
+
+    /* Published records remain, so a chunk taken to its end has a successor */
+    while (store->head_offset >= chunk_used(store->head)) {
+        EventChunk *next = atomic_load_explicit(&store->head->next, memory_order_acquire);
+        ENSURE(next != nullptr, "event_store_peek: published record past last chunk");
+        chunk_free(store->head);
+        store->head = next;
+        store->head_offset = 0;
+    }
+    return (Event *)(store->head->data + store->head_offset);
+}
+
+Event* event_store_take(EventStore *store) {
+    Event *ev = event_store_peek(store);
+    if (ev != nullptr) {
+        store->head_offset += ev->record_size;
+        store->taken++;
+    }
+    return ev;
+}
+
+/* ============================================================================
+ * Query / Iteration
+ * ============================================================================ */
+
+size_t event_store_count(const EventStore *store) {
+    return store->count;
+}
+
+EventStoreIter event_store_begin(const EventStore *store) {
+    return (EventStoreIter){.chunk = store->head, .offset = store->head_offset};
+}
+
+Event* event_store_next(EventStoreIter *it) {
+    while (it->chunk != nullptr && it->offset >= chunk_used(it->chunk)) {
+        it->chunk = atomic_load_explicit(&it->chunk->next, memory_order_relaxed);
+        it->offset = 0;
+    }
+    if (it->chunk == nullptr) {
+        return nullptr;
+    }
+
+    Event *ev = (Event *)(it->chunk->data + it->offset);
+    it->offset += ev->record_size;
+    return ev;
+}
+
+/* ============================================================================
+ * Merge
+ * ============================================================================ */
+
+static inline bool cursor_less(const EventStoreCursor *a, const EventStoreCursor *b) {
+    return a->head->seq < b->head->seq;
+}
+
+static void merge_sift_down(EventStoreMerge *merge, size_t i) {
+    EventStoreCursor *c = merge->cursors;
+    for (;;) {
+        size_t left = 2 * i + 1;
+        size_t right = left + 1;
+        size_t min = i;
+        if (left < merge->count && cursor_less(&c[left], &c[min])) {
+            min = left;
+        }
+        if (right < merge->count && cursor_less(&c[right], &c[min])) {
+            min = right;
+        }
+        if (min == i) {
+            return;
+        }
+        EventStoreCursor tmp = c[i];
+        c[i] = c[min];
+        c[min] = tmp;
+        i = min;
+    }
+}
+
+/** Next record of store below limit, or nullptr. */
+static inline Event* merge_peek(const EventStoreMerge *merge, EventStore *store) {
+    Event *ev = event_store_peek(store);
+    return ev != nullptr && ev->seq < merge->limit_seq ? ev : nullptr;
+}
+
+bool event_store_merge_init(EventStoreMerge *merge, EventStore *const *stores,
+                            size_t n, uint64_t limit_seq) {
+    REQUIRE(merge != nullptr, "event_store_merge_init: merge must not be null");
+    REQUIRE(n == 0 || stores != nullptr, "event_store_merge_init: stores must not be null");
+
+    merge->cursors = nullptr;
+    merge->count = 0;
+    merge->limit_seq = limit_seq;
+    merge->pending = false;
+    if (n == 0) {
+        return true;
+    }
+
+    merge->cursors = malloc(n * sizeof(EventStoreCursor));
+    if (merge->cursors == nullptr) {
+        return false;
+    }
+
+    /* Stores with nothing below limit never enter the heap */
+    for (size_t i = 0; i < n; i++) {
+        EventStoreCursor cursor = {.store = stores[i]};
+        cursor.head = merge_peek(merge, stores[i]);
+        if (cursor.head != nullptr) {
+            merge->cursors[merge->count++] = cursor;
+        }
+    }
+
+    /* Heapify */
+    for (size_t i = merge->count / 2; i-- > 0;) {
+        merge_sift_down(merge, i);
+    }
+    return true;
+}
+
+Event* event_store_merge_next(EventStoreMerge *merge) {
+    if (merge->pending) {
+        EventStoreCursor *top = &merge->cursors[0];
+        top->head = merge_peek(merge, top->store);
+        if (top->head == nullptr) {
+            merge->cursors[0] = merge->cursors[--merge->count];
+        }
+        merge_sift_down(merge, 0);
+        merge->pending = false;
+    }
+    if (merge->count == 0) {
+        return nullptr;
+    }
+
+    Event *ev = event_store_take(merge->cursors[0].store);
+    ENSURE(ev == merge->cursors[0].head, "event_store_merge_next: cursor out of sync");
+    merge->pending = true;
+    return ev;
+}
+
+void event_store_merge_destroy(EventStoreMerge *merge) {
+    free(merge->cursors);
+    merge->cursors = nullptr;
+    merge->count = 0;
+    merge->pending = false;
+}
@@ -0,0 +1,107 @@
+/**
+ * Task Table Implementation
+ *
+ * Architecture:
+ *   verstable uint64_t → TaskStats, verstable's default integer hash.
+ *   Memory per task: 8-byte key + 32-byte value + verstable metadata.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#include "tracking/tasks.h"
+#include "tracking/invariants.h"
+
+#include <stdlib.h>
+
+/* Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME task_map
+#define KEY_TY uint64_t
+#define VAL_TY TaskStats
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct TaskTable {
+    task_map map;
+};
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+TaskTable* task_table_new(void) {
+    TaskTable *table = malloc(sizeof(TaskTable));
+    if (table == nullptr) {
+        return nullptr;
+    }
+    vt_init(&table->map);
+    return table;
+}
+
+void task_table_free(TaskTable *table) {
+    if (table == nullptr) {
+        return;
+    }
+    vt_cleanup(&table->map);
+    free(table);
+}
+
+/** Add stats to task's row. @return false on OOM. */
+static bool task_add_stats(TaskTable *table, uint64_t task, TaskStats stats) {
+    task_map_itr itr = vt_get_or_insert(&table->map, task, (TaskStats){0});
+    if (vt_is_end(itr)) {
+        return false;
+    }
+    itr.data->val.calls += stats.calls;
+    itr.data->val.own_ns += stats.own_ns;
+    itr.data->val.allocated += stats.allocated;
+    itr.data->val.freed += stats.freed;
+    return true;
+}
+
+bool task_table_add_call(TaskTable *table, uint64_t task, uint64_t own_ns) {
+    REQUIRE(table != nullptr, "task_table_add_call: table must not be null");
+    return task_add_stats(table, task, (TaskStats){.calls = 1, .own_ns = own_ns});
+}
+
+bool task_table_add_object(TaskTable *table, uint64_t task, bool created) {
+    REQUIRE(table != nullptr, "task_table_add_object: table must not be null");
+    TaskStats stats = created ? (TaskStats){.allocated = 1} : (TaskStats){.freed = 1};
+    return task_add_stats(table, task, stats);
+}
+
+bool task_table_merge(TaskTable *dst, const TaskTable *src) {
+    REQUIRE(dst != nullptr, "task_table_merge: dst must not be null");
+    REQUIRE(src != nullptr, "task_table_merge: src must not be null");
+    REQUIRE(dst != src, "task_table_merge: cannot merge a table into itself");
+
+    /* verstable iteration takes a non-const table; src is not modified */
+    task_map *map = (task_map *)&src->map;
+    for (task_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        if (!task_add_stats(dst, itr.data->key, itr.data->val)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t task_table_size(const TaskTable *table) {
+    REQUIRE(table != nullptr, "task_table_size: table must not be null");
+    return vt_size((task_map *)&table->map);
+}
+
+bool task_table_each(const TaskTable *table, TaskVisitor visit, void *ctx) {
+    REQUIRE(table != nullptr, "task_table_each: table must not be null");
+    REQUIRE(visit != nullptr, "task_table_each: visit must not be null");
+
+    task_map *map = (task_map *)&table->map;
+    for (task_map_itr itr = vt_first(map); !vt_is_end(itr); itr = vt_next(itr)) {
+        if (!visit(itr.data->key, &itr.data->val, ctx)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,304 @@
+/**
+ * Binary Trace File Implementation
+ *
+ * Architecture:
+ *   FILE* with a large stdio buffer — records are appended as events arrive
+ *   ids          — verstable pointer → string id, first sight assigns next id
+ *   strings[]    — string section built in memory ({len, bytes} entries),
+ *                  written once by close() after the last record
+ *
+ * Memory:
+ *   O(unique strings) — records are never kept, only written.
+ *
+ * C23: nullptr, constexpr
+ * FAIL-FIRST: abort on contract violation; I/O/OOM errors sticky in w->error
+ */
+
+#include "tracking/tracefile.h"
+#include "tracking/invariants.h"
+#include "tracking/stacks.h"
+
+#include <errno.h>
+#include <stdio_ext.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Verstable hash table: interned/tp_name pointer → string id.
+ * Vendored code is not -Wconversion clean (C tests build with -Werror). */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#define NAME string_id_map
+#define KEY_TY uintptr_t
+#define VAL_TY uint32_t
+#include "vendor/verstable.h"
+#pragma GCC diagnostic pop
+
+struct TraceStringIds {
+    string_id_map map;
+};
+
+/** stdio buffer: fewer write(2) calls for 48-byte records */
+constexpr size_t TRACE_IO_BUFFER_SIZE = 1 << 20;
+
+/* ============================================================================
+ * Internal
+ * ============================================================================ */
+
+/** Record first error (sticky). */
+static inline void writer_fail(TraceWriter *w, int err) {
+    if (w->error == 0) {
+        w->error = err != 0 ? err : EIO;
+    }
+}
+
+static void writer_write(TraceWriter *w, const void *data, size_t size) {
+    if (size == 0) {
+        return;
+    }
+    if (w->error == 0 && fwrite(data, 1, size, w->file) != size) {
+        writer_fail(w, errno);
+    }
+}
+
+/**
+ * Append string to the in-memory string section.
+ * @return New id, or 0 on OOM (recorded as error).
+ */
+static uint32_t writer_add_string(TraceWriter *w, const char *s) {
+    size_t len = strlen(s);
+    uint32_t len32 = (uint32_t)len;
+    size_t need = w->strings_len + sizeof(len32) + len;
+
+    if (need > w->strings_cap) {
+        size_t cap = w->strings_cap ? w->strings_cap * 2 : 4096;
+        while (cap < need) {
+            cap *= 2;
+        }
+        char *grown = realloc(w->strings, cap);
+        if (grown == nullptr) {
+            writer_fail(w, ENOMEM);
+            return 0;
+        }
+        w->strings = grown;
+        w->strings_cap = cap;
+    }
+
+    memcpy(w->strings + w->strings_len, &len32, sizeof(len32));
+    memcpy(w->strings + w->strings_len + sizeof(len32), s, len);
+    w->strings_len = need;
+    return ++w->string_count;
+}
+
+/** Id of a pointer-stable string (interned or tp_name), 0 for nullptr. */
+static uint32_t writer_string_id(TraceWriter *w, const char *s) {
+    if (s == nullptr) {
+        return 0;
+    }
+
+    string_id_map_itr itr = vt_get(&w->ids->map, (uintptr_t)s);
+    if (!vt_is_end(itr)) {
+        return itr.data->val;
+    }
+
+    uint32_t id = writer_add_string(w, s);
+    if (id != 0 && vt_is_end(vt_insert(&w->ids->map, (uintptr_t)s, id))) {
+        writer_fail(w, ENOMEM);  /* String stays valid, just not deduped */
+    }
+    return id;
+}
+
+static inline void record_location(TraceWriter *w, TraceRecord *rec, const FrameInfo *loc) {
+    rec->file = writer_string_id(w, loc->file);
+    rec->func = writer_string_id(w, loc->func);
+    rec->line = loc->line;
+}
+
+static inline void writer_record(TraceWriter *w, const TraceRecord *rec) {
+    writer_write(w, rec, sizeof(*rec));
+    w->record_count++;
+}
+
+/** FRAME records written for a creation stack. */
+static inline uint32_t creation_frames(const CreationInfo *info) {
+    uint32_t depth = stack_trie_depth(info->stack);
+    return depth < TRACE_MAX_FRAMES ? depth : TRACE_MAX_FRAMES;
+}
+
+/** Aux records of a DESTROY creation context: stack walked top → root. */
+static void write_creation(TraceWriter *w, const CreationInfo *info) {
+    uint32_t frames = creation_frames(info);
+    TraceRecord rec = {.kind = TRACE_CREATION, .extra = (uint16_t)frames};
+    const StackNode *node = info->stack != STACK_EMPTY ? stack_trie_node(info->stack) : nullptr;
+    record_location(w, &rec, node != nullptr ? &node->frame : &FRAME_NO_CALLER);
+    rec.type = writer_string_id(w, info->type_name_ref);
+    writer_record(w, &rec);
+
+    for (uint32_t i = 0; i < frames; i++) {
+        TraceRecord frame = {.kind = TRACE_FRAME};
+        record_location(w, &frame, &node->frame);
+        writer_record(w, &frame);
+        node = node->parent != STACK_EMPTY ? stack_trie_node(node->parent) : nullptr;
+    }
+}
+
+/** Aux records of field errors (strings are per-event copies: not deduped). */
+static void write_errors(TraceWriter *w, const Event *ev) {
+    for (int i = 0; i < ev->error_count; i++) {
+        TraceRecord rec = {
+            .kind = TRACE_ERROR,
+            .file = writer_add_string(w, ev->errors[i].field),
+            .func = writer_add_string(w, ev->errors[i].exc_msg),
+            .type = writer_add_string(w, ev->errors[i].exc_type),
+        };
+        writer_record(w, &rec);
+    }
+}
+
+/** Number of aux records written after the primary record of ev. */
+static uint16_t event_extra(const Event *ev) {
+    int extra = ev->error_count;
+    if (ev->type == EVENT_CALL) {
+        extra += ev->arg_count;
+    } else if (ev->type == EVENT_DESTROY && ev->has_creation) {
+        extra += 1 + (int)creation_frames(&ev->creation);
+    }
+    return (uint16_t)extra;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+bool trace_writer_open(TraceWriter *w, const char *path) {
+    REQUIRE(w != nullptr, "trace_writer_open: writer must not be null");
+    REQUIRE(path != nullptr, "trace_writer_open: path must not be null");
+
+    *w = (TraceWriter){0};
+
+    w->ids = malloc(sizeof(TraceStringIds));
+    if (w->ids == nullptr) {
+        errno = ENOMEM;
+        return false;
+    }
+    vt_init(&w->ids->map);
+
+    w->file = fopen(path, "wb");
+    if (w->file == nullptr) {
+        int err = errno;
+        vt_cleanup(&w->ids->map);
+        free(w->ids);
+        errno = err;
+        return false;
+    }
+    (void)setvbuf(w->file, nullptr, _IOFBF, TRACE_IO_BUFFER_SIZE);
+
+    TraceHeader header = {
+        .version = TRACE_FORMAT_VERSION,
+        .record_size = sizeof(TraceRecord),
+        .byte_order = TRACE_BYTE_ORDER,
+    };
+    memcpy(header.magic, TRACE_HEADER_MAGIC, sizeof(header.magic));
+    writer_write(w, &header, sizeof(header));
+    return w->error == 0;
+}
+
+bool trace_writer_event(TraceWriter *w, const Event *ev) {
+    REQUIRE(w != nullptr && w->file != nullptr, "trace_writer_event: writer not open");
+    REQUIRE(ev != nullptr, "trace_writer_event: event must not be null");
+
+    TraceRecord rec = {
+        .kind = (uint8_t)ev->type,
+        .extra = event_extra(ev),
+        .seq = ev->seq,
+    };
+    record_location(w, &rec, &ev->location);
+
+    switch (ev->type) {
+        case EVENT_CALL:
+            if (ev->caller.func) {
+                rec.flags |= TRACE_HAS_CALLER;
+                rec.caller_file = writer_string_id(w, ev->caller.file);
+                rec.caller_func = writer_string_id(w, ev->caller.func);
+                rec.caller_line = ev->caller.line;
+            }
+            break;
+        case EVENT_RETURN:
+            if (ev->obj_id) {
+                rec.flags |= TRACE_HAS_VALUE;
+                rec.id = ev->obj_id;
+                rec.type = writer_string_id(w, ev->type_name_ref);
+            }
+            break;
+        case EVENT_CREATE:
+        case EVENT_DESTROY:
+            rec.id = ev->obj_id;
+            rec.type = writer_string_id(w, ev->type_name_ref);
+            break;
+    }
+    writer_record(w, &rec);
+    w->event_count++;
+
+    if (ev->type == EVENT_CALL) {
+        for (int i = 0; i < ev->arg_count; i++) {
+            TraceRecord arg = {
+                .kind = TRACE_ARG,
+                .id = ev->args[i].id,
+                .func = writer_string_id(w, ev->args[i].name_ref),
+                .type = writer_string_id(w, ev->args[i].type_ref),
+            };
+            writer_record(w, &arg);
+        }
+    } else if (ev->type == EVENT_DESTROY && ev->has_creation) {
+        write_creation(w, &ev->creation);
+    }
+    write_errors(w, ev);
+
+    return w->error == 0;
+}
+
+bool trace_writer_close(TraceWriter *w) {
+    REQUIRE(w != nullptr && w->file != nullptr, "trace_writer_close: writer not open");
+
+    TraceFooter footer = {
+        .records_offset = sizeof(TraceHeader),
+        .record_count = w->record_count,
+        .event_count = w->event_count,
+        .strings_offset = sizeof(TraceHeader) + w->record_count * sizeof(TraceRecord),
+        .string_count = w->string_count,
+    };
+    memcpy(footer.magic, TRACE_FOOTER_MAGIC, sizeof(footer.magic));
+
+    /* Pad string section so the footer is 8-byte aligned for mmap readers */
+    static const unsigned char padding[alignof(TraceFooter)] = {0};
+    size_t pad = -w->strings_len & (alignof(TraceFooter) - 1);
+
+    writer_write(w, w->strings, w->strings_len);
+    writer_write(w, padding, pad);
+    writer_write(w, &footer, sizeof(footer));
+    if (fclose(w->file) != 0) {
+        writer_fail(w, errno);
+    }
+
+    vt_cleanup(&w->ids->map);
+    free(w->ids);
+    free(w->strings);
+
+    int err = w->error;
+    *w = (TraceWriter){0};
+    errno = err;
+    return err == 0;
+}
+
+void trace_writer_abandon(TraceWriter *w) {
+    REQUIRE(w != nullptr && w->file != nullptr, "trace_writer_abandon: writer not open");
+
+    /* Discard the stdio buffer: fclose() must not write() it */
+    __fpurge(w->file);
+    (void)fclose(w->file);
+
+    vt_cleanup(&w->ids->map);
+    free(w->ids);
+    free(w->strings);
+    *w = (TraceWriter){0};
+}
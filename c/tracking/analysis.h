@@ -0,0 +1,126 @@
+/**
+ * Native Column Analysis
+ *
+ * One pass over EventColumns (stop(columnar=True)) that does the work of
+ * AnalyzerService.filter(), build_call_graph() and build_object_flow()
+ * together, on row indices only: no Python object per event.
+ *
+ * Same rules as the Python column path:
+ *   Filter      — kind in kinds; CALL/RETURN with a file also need
+ *                 file_pass[file] (path patterns matched once per string
+ *                 on the Python side)
+ *   Call graph  — one stack per thread column value; RETURN pops its
+ *                 thread's CALL; no caller and self-loops not counted
+ *   Object flow — CREATE opens a lifecycle, DESTROY closes it (orphan if
+ *                 none is open), CALL args add the CALL row to the open
+ *                 lifecycle of each arg
+ *
+ * Parallelism (workers > 1):
+ *   Worker w owns threads t % workers == w (stacks, edges) and objects
+ *   hash(obj_id) % workers == w (lifecycles). Every worker reads every
+ *   row; results are merged into the same order as workers == 1.
+ *
+ * Thread Safety:
+ *   Inputs are read-only during analyze_columns(); workers share nothing
+ *   else. No Python API used: callers may release the GIL.
+ *
+ * C23: nullptr, constexpr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (nothing to free)
+ */
+
+#ifndef TRACKING_ANALYSIS_H
+#define TRACKING_ANALYSIS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Row index meaning "none" (lifecycle still alive, no duplicate). */
+constexpr size_t ANALYSIS_NO_ROW = SIZE_MAX;
+
+/** Most workers analyze_columns() starts. */
+constexpr unsigned ANALYSIS_MAX_WORKERS = 64;
+
+/** Borrowed column arrays (layout of columns.h). */
+typedef struct {
+    size_t count;               /* Rows */
+    const uint8_t *kind;
+    const uint64_t *obj_id;
+    const uint32_t *file;
+    const uint32_t *func;
+    const int32_t *line;
+    const uint32_t *caller_file;
+    const uint32_t *caller_func;
+    const int32_t *caller_line;
+    const uint32_t *thread;
+    const uint16_t *arg_count;
+    const uint64_t *arg_id;     /* sum(arg_count) entries */
+} ColumnsView;
+
+typedef struct {
+    uint8_t kinds;              /* Bit k set: keep rows of EventType k */
+    const uint8_t *file_pass;   /* file_pass[idx] != 0: path kept; nullptr = all kept */
+    size_t file_pass_count;     /* Entries of file_pass (every file idx must be below) */
+} ColumnFilter;
+
+typedef struct {
+    uint32_t caller_file;
+    uint32_t caller_func;
+    uint32_t file;
+    uint32_t func;
+    int32_t caller_line;
+    int32_t line;
+} ColumnEdgeKey;
+
+typedef struct {
+    ColumnEdgeKey key;
+    uint64_t count;
+} ColumnEdge;
+
+typedef struct {
+    size_t create_row;
+    size_t destroy_row;         /* ANALYSIS_NO_ROW: still alive */
+    size_t pass_start;          /* passes[pass_start .. pass_start + pass_count) */
+    size_t pass_count;
+} ColumnLifecycle;
+
+/** Result of analyze_columns(); arrays owned, free with column_analysis_destroy(). */
+typedef struct {
+    size_t *rows;               /* Rows kept by the filter, ascending */
+    size_t row_count;
+
+    ColumnEdge *edges;          /* Distinct edges, unspecified order */
+    size_t edge_count;
+
+    size_t *unmatched;          /* RETURN rows without CALL, then open CALL rows, */
+    size_t unmatched_count;     /* each group ascending */
+
+    ColumnLifecycle *lifecycles; /* Every CREATE kept, by create_row */
+    size_t lifecycle_count;
+    size_t *passes;             /* CALL rows an object was passed to, per lifecycle */
+    size_t pass_count;
+
+    size_t *orphans;            /* DESTROY rows without open lifecycle, ascending */
+    size_t orphan_count;
+
+    size_t duplicate_row;       /* First CREATE of a live obj_id (object flow invalid) */
+} ColumnAnalysis;
+
+/**
+ * Filter, build call edges and lifecycles in one pass.
+ *
+ * @param workers  Threads to split the pass over (1 = calling thread only),
+ *                 at most ANALYSIS_MAX_WORKERS.
+ * @return false on OOM (out untouched).
+ *
+ * FAIL-FIRST: aborts on null pointers, workers out of range, or a file idx
+ *             outside file_pass.
+ */
+[[nodiscard]]
+bool analyze_columns(const ColumnsView *cols, const ColumnFilter *filter, unsigned workers,
+                     ColumnAnalysis *out);
+
+/** Free result arrays. Idempotent. */
+void column_analysis_destroy(ColumnAnalysis *res);
+
+#endif /* TRACKING_ANALYSIS_H */
@@ -0,0 +1,76 @@
+/**
+ * Session Arena
+ *
+ * Bump allocator over large mmap'd blocks for memory that lives until the
+ * end of a tracking session (interned strings, out-of-line event data).
+ * Nothing is freed individually: destroy() unmaps every block at once, so
+ * teardown is O(blocks), not O(allocations), and the traced program's
+ * malloc arenas are never touched.
+ *
+ * Contract:
+ *   - Allocations NEVER move (blocks are never realloc'd)
+ *   - Requests larger than block_size get a dedicated block
+ *   - OOM is a valid runtime state: alloc() returns nullptr
+ *
+ * Thread Safety:
+ *   None. One owner per arena (a writer thread, or callers under a mutex).
+ *
+ * C23: constexpr, nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns nullptr (valid state)
+ */
+
+#ifndef TRACKING_ARENA_H
+#define TRACKING_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/** Default block size (bytes, including header). */
+constexpr size_t ARENA_DEFAULT_BLOCK_SIZE = 1024 * 1024;
+
+/** Opaque mmap'd block (header + data). */
+typedef struct ArenaBlock ArenaBlock;
+
+typedef struct {
+    ArenaBlock *head;       /* Newest block: allocations bump from here */
+    size_t block_size;      /* Size of regular blocks */
+    size_t bytes;           /* Bytes handed out (excluding padding) */
+    size_t mapped;          /* Bytes mapped (all blocks) */
+} Arena;
+
+/**
+ * Initialize empty arena. No mapping until first alloc().
+ *
+ * @param block_size  Regular block size, 0 = ARENA_DEFAULT_BLOCK_SIZE.
+ *                    Rounded up to the page size.
+ */
+void arena_init(Arena *arena, size_t block_size);
+
+/**
+ * Unmap every block and reset to empty. Idempotent.
+ */
+void arena_destroy(Arena *arena);
+
+/**
+ * Allocate size bytes aligned to align (power of 2, at most 4096).
+ *
+ * @return Uninitialized memory valid until destroy(), or nullptr on OOM.
+ *
+ * FAIL-FIRST: Aborts if align is not a power of 2 or exceeds 4096.
+ */
+[[nodiscard]]
+void* arena_alloc(Arena *arena, size_t size, size_t align);
+
+/** Bytes handed out since init. */
+[[nodiscard]]
+static inline size_t arena_bytes(const Arena *arena) {
+    return arena->bytes;
+}
+
+/** Bytes mapped by all blocks. */
+[[nodiscard]]
+static inline size_t arena_mapped(const Arena *arena) {
+    return arena->mapped;
+}
+
+#endif /* TRACKING_ARENA_H */
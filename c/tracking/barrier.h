@@ -4,6 +4,11 @@
  * Reference counting + condition variable barrier for safe callback termination.
  * Fixes use-after-free in _tracking.c:158.
  *
+ * Scalability:
+ *   Counts are per thread, each on its own cache line: enter/leave (twice
+ *   per Python call) never write a line another thread writes. stop() pays
+ *   instead — it scans every thread's count.
+ *
  * Contract:
  *   - try_enter() increments counter BEFORE protected section
  *   - leave() decrements counter AFTER protected section
@@ -13,7 +18,8 @@
  *
  * State Machine:
  *   [UNINITIALIZED] --init()--> [ACTIVE] --stop()--> [STOPPED] --destroy()--> [DESTROYED]
- *        ^                                                                        |
+ *        ^                         ^                     |                        |
+ *        |                         +------resume()-------+                        |
  *        +------------------------------------------------------------------------+
  *                                    (next init())
  *
@@ -63,6 +69,15 @@ typedef enum {
  */
 typedef void (*BarrierCallback)(void* user_data);
 
+/**
+ * Contention counters since init(), see barrier_stats().
+ */
+typedef struct {
+    uint64_t refused;       /* try_enter() turned away while stopping */
+    uint64_t stops;         /* stop() calls that had to wait for a section */
+    uint64_t stop_wait_ns;  /* Time those stop() calls waited */
+} BarrierStats;
+
 /* ============================================================================
  * Lifecycle
  * ============================================================================ */
@@ -105,7 +120,7 @@ void barrier_destroy(void);
  * Protocol:
  *   1. Check initialized — return false if not
  *   2. Check stopping flag — return false if stopping
- *   3. Increment active count (acquire-release)
+ *   3. Increment this thread's count (slot claimed on first enter)
  *   4. Double-check stopping — decrement and return false if race
  *   5. Increment thread-local depth
  *   6. Return true
@@ -131,8 +146,8 @@ bool barrier_try_enter(void);
  *   1. Check initialized — no-op if destroyed (late leave after stop)
  *   2. FAIL-FIRST: abort if depth == 0 (mismatched enter/leave)
  *   3. Decrement thread-local depth
- *   4. Decrement active count (release)
- *   5. Signal condition if count reaches 0 during stop
+ *   4. Decrement this thread's count
+ *   5. Signal condition if it reaches 0 during stop
  *
  * Graceful: No-op if barrier destroyed (late leave after stop is valid).
  * FAIL-FIRST: Aborts on mismatched enter/leave (programming error).
@@ -151,7 +166,7 @@ void barrier_leave(void);
  *   3. Lock mutex
  *   4. Check already stopping — return STOP_OK if yes (idempotent)
  *   5. Set stopping flag (release)
- *   6. Wait on condition until active count == 0
+ *   6. Wait on condition until every thread's count == 0 (scan)
  *   7. Unlock mutex, return STOP_OK
  *
  * Thread-safe: Concurrent stop() calls serialize via mutex.
@@ -160,6 +175,19 @@ void barrier_leave(void);
 [[nodiscard]]
 StopResult barrier_stop(void);
 
+/**
+ * Accept entries again after stop() (pause instead of teardown).
+ *
+ * Transitions: STOPPED -> ACTIVE
+ *
+ * Used around fork(): stop() drains every section so no thread holds a
+ * tracker lock in the copied address space, resume() continues the
+ * session in both processes.
+ *
+ * Graceful: No-op if not initialized or not stopped.
+ */
+void barrier_resume(void);
+
 /* ============================================================================
  * Dispatch API (convenience wrapper)
  * ============================================================================ */
@@ -196,7 +224,7 @@ bool barrier_is_stopping(void);
 /**
  * Get current active callback count.
  *
- * @return Number of callbacks currently in protected sections.
+ * @return Number of callbacks currently in protected sections (all threads).
  *
  * Note: For testing/debugging. Value may change immediately after return.
  * Graceful: Returns 0 if not initialized.
@@ -212,4 +240,13 @@ int64_t barrier_active_count(void);
  */
 bool barrier_in_callback(void);
 
+/**
+ * Contention counters since the last init().
+ *
+ * Refusals are counted only on the refused path: the enter/leave fast
+ * path writes nothing shared.
+ * Graceful: Zeros if never initialized.
+ */
+void barrier_stats(BarrierStats *out);
+
 #endif /* TRACKING_BARRIER_H */
@@ -1,7 +1,7 @@
 /**
  * Event Callback Module
  *
- * Defines event types and callback registration for tracking.
+ * Callback registration for tracking (event types: rawevent.h).
  * Uses Stop Barrier for safe dispatch.
  *
  * Contract:
@@ -21,84 +21,7 @@
 #include <stdbool.h>
 
 #include "tracking/barrier.h"
-
-/* ============================================================================
- * Event Types
- * ============================================================================ */
-
-/**
- * Event kind enumeration.
- */
-typedef enum {
-    EVENT_CALL,     /* Function call */
-    EVENT_RETURN,   /* Function return */
-    EVENT_CREATE,   /* Object creation */
-    EVENT_DESTROY,  /* Object destruction */
-} EventKind;
-
-/**
- * Raw call event data.
- * All strings INTERNED (valid until string_table_destroy).
- */
-typedef struct {
-    const char* callee_file;
-    int32_t callee_line;
-    const char* callee_func;
-    const char* caller_file;
-    int32_t caller_line;
-    const char* caller_func;
-    uint64_t thread_id;
-    uint64_t coro_id;
-    uint64_t timestamp_ns;
-} RawCallEvent;
-
-/**
- * Raw return event data.
- */
-typedef struct {
-    const char* file;
-    int32_t line;
-    const char* func;
-    uint64_t thread_id;
-    uint64_t timestamp_ns;
-    bool has_exception;
-} RawReturnEvent;
-
-/**
- * Raw object creation event.
- */
-typedef struct {
-    uintptr_t obj_id;
-    const char* type_name;  /* Interned */
-    const char* file;
-    int32_t line;
-    const char* func;
-    uint64_t thread_id;
-    uint64_t timestamp_ns;
-} RawCreateEvent;
-
-/**
- * Raw object destruction event.
- */
-typedef struct {
-    uintptr_t obj_id;
-    const char* type_name;  /* Interned */
-    uint64_t thread_id;
-    uint64_t timestamp_ns;
-} RawDestroyEvent;
-
-/**
- * Union of all event types.
- */
-typedef struct {
-    EventKind kind;
-    union {
-        RawCallEvent call;
-        RawReturnEvent ret;
-        RawCreateEvent create;
-        RawDestroyEvent destroy;
-    } data;
-} RawEvent;
+#include "tracking/rawevent.h"
 
 /* ============================================================================
  * Callback Types
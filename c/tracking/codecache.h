@@ -0,0 +1,115 @@
+/**
+ * Code Object Cache
+ *
+ * Per-PyCodeObject metadata, resolved once per tracking session.
+ * Stored in the code object's co_extra slot (PEP 523 extra index).
+ *
+ * Contract:
+ *   - lookup() returns metadata with INTERNED strings (do NOT free)
+ *   - Entry valid only for the session it was filled in: StringTable is
+ *     destroyed on stop(), so a new session re-interns on first use
+ *   - Entry freed by the interpreter together with its code object
+ *   - Entries filled with captured errors are NOT cached: the next call
+ *     retries and captures the error again (Data Completeness)
+ *   - fires and match are the only fields written after publish
+ *     (sampling counter, cached filter result); a fill resets them
+ *
+ * Hot path:
+ *   Cached hit = one co_extra read + session compare. No UTF-8 encoding,
+ *   no hashing, no allocation: file, func AND argument names are interned
+ *   once per code object per session, so a CALL copies pointers and ids.
+ *
+ * Thread Safety:
+ *   Hit path lock-free: session is published with release after the entry
+ *   is filled, readers load it with acquire. Misses (first use, new session)
+ *   fill under a mutex. Safe without the GIL (Py_MOD_GIL_NOT_USED).
+ *
+ * C23: nullptr, [[nodiscard]], _Atomic
+ */
+
+#ifndef TRACKING_CODECACHE_H
+#define TRACKING_CODECACHE_H
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <stdint.h>
+#include <stdatomic.h>
+
+#include "types.h"
+
+/* ============================================================================
+ * Types
+ * ============================================================================ */
+
+/** Cached C-side filter result of a code object (filter.h). */
+typedef enum {
+    CODE_MATCH_UNKNOWN,     /* Not evaluated this session */
+    CODE_MATCH_TRACED,
+    CODE_MATCH_SKIPPED,
+} CodeMatch;
+
+/**
+ * Number of argument slots a CALL record for this code object needs.
+ * Positional + keyword-only + *args + **kwargs, capped at MAX_ARGS.
+ * Fixed per code object (cached as CodeMeta.arg_count).
+ */
+static inline int call_arg_capacity(const PyCodeObject *code) {
+    int argcount = code->co_argcount + code->co_kwonlyargcount;
+    if (code->co_flags & CO_VARARGS) {
+        argcount++;
+    }
+    if (code->co_flags & CO_VARKEYWORDS) {
+        argcount++;
+    }
+    return argcount < MAX_ARGS ? argcount : MAX_ARGS;
+}
+
+typedef struct {
+    _Atomic(uint64_t) session;  /* Session the interned pointers belong to (0 = stale) */
+    FrameInfo location;     /* Interned co_filename/co_qualname, co_firstlineno */
+    int arg_count;          /* call_arg_capacity(code) */
+    const char *arg_names[MAX_ARGS];    /* Interned co_localsplusnames[0..arg_count) */
+    _Atomic(uint64_t) fires;    /* Calls seen this session (sampler_code_allows) */
+    _Atomic(uint8_t) match;     /* CodeMatch for this session's filter */
+} CodeMeta;
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+/**
+ * Reserve the co_extra index. Idempotent.
+ *
+ * @return 0 on success, -1 with Python exception set.
+ */
+[[nodiscard]]
+int code_cache_init(void);
+
+/**
+ * Get metadata for code object, filling it on first use in this session.
+ *
+ * @param code     Code object being called
+ * @param session  Current tracking session id (> 0)
+ * @param ev       Event receiving errors captured while filling, or nullptr
+ *                 to drop them (decisions taken before an event exists);
+ *                 an entry with a failed field is then left uncached
+ * @return         Metadata, never nullptr. On OOM a thread-local scratch
+ *                 entry is returned (valid until next lookup on this thread).
+ *
+ * FAIL-FIRST: Aborts if init() not called or session == 0.
+ *             StringTable must be initialized.
+ */
+[[nodiscard]]
+CodeMeta* code_cache_lookup(PyCodeObject *code, uint64_t session, Event *ev);
+
+/**
+ * Get metadata only if already filled in this session (never fills).
+ *
+ * @return Cached entry, or nullptr on miss (first use, stale, uncached).
+ *
+ * FAIL-FIRST: Aborts if init() not called or session == 0.
+ */
+[[nodiscard]]
+CodeMeta* code_cache_peek(PyCodeObject *code, uint64_t session);
+
+#endif /* TRACKING_CODECACHE_H */
@@ -0,0 +1,125 @@
+/**
+ * Columnar Event Buffers (struct-of-arrays)
+ *
+ * Alternative to one PyDict per event: stop(columnar=True) appends every
+ * event to contiguous per-field arrays and hands them to Python as bytes
+ * (buffer protocol), plus one string list.
+ *
+ * Columns (index i = i-th event in seq order):
+ *
+ *   kind[i]          uint8     EventType
+ *   obj_id[i]        uint64    CREATE/DESTROY: object, RETURN: value (0 = none)
+ *   type_name[i]     uint32    string idx of type name (0 = none)
+ *   file/func[i]     uint32    string idx of location
+ *   line[i]          int32
+ *   caller_file[i]   uint32    CALL: caller location (caller_func 0 = no caller)
+ *   caller_func[i]   uint32
+ *   caller_line[i]   int32
+ *   thread[i]        uint32    recording thread (Event.thread)
+ *   task[i]          uint64    running asyncio task (Event.task, 0 = none)
+ *   creation[i]      uint32    DESTROY: stack entry of the creation context
+ *                              (0 = no creation context)
+ *   creation_type[i] uint32    DESTROY: string idx of the type at creation
+ *   arg_count[i]     uint16    CALL: args of event i, flattened below
+ *
+ *   arg_id[j], arg_name[j], arg_type[j]   all args of all CALLs, in order
+ *                                         (args of event i start at
+ *                                         sum(arg_count[0..i)))
+ *
+ *   stack_parent[k], stack_file[k], stack_func[k], stack_line[k]
+ *                    creation stacks, deduplicated: entry k is one frame
+ *                    on top of stack entry stack_parent[k]. Entry 0 is
+ *                    unused (no creation), entry 1 the empty stack; each
+ *                    StackId (stacks.h) gets one entry, on first sight
+ *
+ * Strings:
+ *   strings[0] = nullptr, strings[1..string_count) unique pointers in order
+ *   of first sight. Dedup by pointer: interned (StringTable) and tp_name.
+ *   Borrowed: valid until the session's StringTable is destroyed.
+ *
+ * Not in columns:
+ *   Field errors (rare) — the caller keeps them out-of-band.
+ *
+ * Thread Safety:
+ *   None. Built by the single consumer (see drain_mutex).
+ *
+ * C23: nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_COLUMNS_H
+#define TRACKING_COLUMNS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/** Dedup maps: string pointer → idx, StackId → stack entry (defined in columns.c). */
+typedef struct ColumnIds ColumnIds;
+
+/** Stack entries with a fixed meaning. */
+constexpr uint32_t COLUMN_STACK_NONE = 0;
+constexpr uint32_t COLUMN_STACK_ROOT = 1;
+
+typedef struct {
+    /* Per-event columns (count rows, cap allocated) */
+    size_t count;
+    size_t cap;
+    uint8_t *kind;
+    uint64_t *obj_id;
+    uint32_t *type_name;
+    uint32_t *file;
+    uint32_t *func;
+    int32_t *line;
+    uint32_t *caller_file;
+    uint32_t *caller_func;
+    int32_t *caller_line;
+    uint32_t *thread;
+    uint64_t *task;
+    uint32_t *creation;
+    uint32_t *creation_type;
+    uint16_t *arg_count;
+
+    /* Flattened CALL args */
+    size_t arg_total;
+    size_t arg_cap;
+    uint64_t *arg_id;
+    uint32_t *arg_name;
+    uint32_t *arg_type;
+
+    /* Creation stack entries (stack_count >= 2: NONE and ROOT) */
+    uint32_t stack_count;
+    uint32_t stack_cap;
+    uint32_t *stack_parent;
+    uint32_t *stack_file;
+    uint32_t *stack_func;
+    int32_t *stack_line;
+
+    /* Deduplicated strings (borrowed), strings[0] = nullptr */
+    const char **strings;
+    uint32_t string_count;
+    uint32_t string_cap;
+    ColumnIds *ids;
+} EventColumns;
+
+/**
+ * Initialize empty columns.
+ * @return false on OOM (nothing to destroy).
+ */
+[[nodiscard]]
+bool event_columns_init(EventColumns *cols);
+
+/**
+ * Append one event as a row. A DESTROY with creation context adds the
+ * frames of its creation stack not seen yet (stack trie must be alive).
+ * @return false on OOM (no row added, columns still valid).
+ */
+[[nodiscard]]
+bool event_columns_append(EventColumns *cols, const Event *ev);
+
+/** Release all buffers. Strings are borrowed, not freed. */
+void event_columns_destroy(EventColumns *cols);
+
+#endif /* TRACKING_COLUMNS_H */
@@ -5,7 +5,7 @@
  *   - thread_id:    OS thread identifier
  *   - timestamp_ns: monotonic clock timestamp
  *   - coro_id:      Python coroutine identifier (Python-dependent)
- *   - task_id:      asyncio task identifier (Phase 5 stub)
+ *   - task_id:      running asyncio task identifier (Python-dependent)
  *
  * Architecture:
  *   Platform context (thread_id, timestamp_ns): standalone C, context.c
@@ -62,10 +62,10 @@ uint64_t context_timestamp_ns(void);
 /**
  * Get current coroutine identifier.
  *
- * Extracts coroutine ID from PyThreadState current frame.
- * Returns object ID of the coroutine if inside async context.
+ * Owner of the PyThreadState's current frame, if that frame belongs to a
+ * coroutine or async generator: O(1), no frame walk.
  *
- * @return Coroutine ID, or 0 if not in async context.
+ * @return Coroutine ID (object address), or 0 if not in async context.
  *
  * Implementation: _tracking.c (requires Python.h)
  */
@@ -75,10 +75,12 @@ uint64_t context_coro_id(void);
 /**
  * Get current asyncio task identifier.
  *
- * Phase 5 stub. Currently returns 0.
- * Full implementation requires asyncio.current_task() call.
+ * The task _asyncio keeps as running on this thread (the value
+ * asyncio.current_task() returns), read from the PyThreadState: one load,
+ * no Python call. The field changes only on a task switch, so it is the
+ * per-thread cache itself. Tasks of a pure-Python asyncio are not seen.
  *
- * @return Task ID, or 0 (stub).
+ * @return Task ID (id() of the asyncio.Task), or 0 outside any task.
  *
  * Implementation: _tracking.c (requires Python.h)
  */
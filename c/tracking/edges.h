@@ -0,0 +1,87 @@
+/**
+ * Call Edge Table (aggregate mode)
+ *
+ * start(aggregate=True) records no CALL/RETURN events: every completed
+ * call bumps its (caller, callee) edge instead. Memory is O(distinct
+ * edges), not O(calls) — a whole day of traffic fits.
+ *
+ * Key:
+ *   Caller and callee FrameInfo by value. file/func are INTERNED, so
+ *   pointer equality is string equality (within one session).
+ *
+ * Same rules as AnalyzerService.build_call_graph():
+ *   caller = frame below the callee on the shadow stack at CALL time;
+ *   counted at RETURN; no caller (file nullptr) and self-loops skipped.
+ *   Calls still running at stop() are not counted.
+ *
+ * Value:
+ *   count     completed calls
+ *   total_ns  inclusive wall time of those calls (0 unless timed);
+ *             recursion through another function counts nested time twice
+ *
+ * Thread Safety:
+ *   None. One table per thread buffer; merged once hooks are off.
+ *
+ * C23: nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_EDGES_H
+#define TRACKING_EDGES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+
+typedef struct {
+    FrameInfo caller;
+    FrameInfo callee;
+} EdgeKey;
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+} EdgeStats;
+
+/** Opaque: verstable EdgeKey → EdgeStats (defined in edges.c). */
+typedef struct EdgeTable EdgeTable;
+
+/** Visitor of edge_table_each(); returns false to stop. */
+typedef bool (*EdgeVisitor)(const EdgeKey *key, const EdgeStats *stats, void *ctx);
+
+/** @return New empty table, or nullptr on OOM. */
+[[nodiscard]]
+EdgeTable* edge_table_new(void);
+
+/** Free table. nullptr is a no-op. */
+void edge_table_free(EdgeTable *table);
+
+/**
+ * Count one completed call of callee from caller.
+ * No caller (nullptr or file nullptr) and caller == callee are skipped.
+ * @return false on OOM (call not counted).
+ */
+[[nodiscard]]
+bool edge_table_add(EdgeTable *table, const FrameInfo *caller, const FrameInfo *callee,
+                    uint64_t elapsed_ns);
+
+/**
+ * Add every edge of src into dst (sums count and total_ns).
+ * @return false on OOM (dst holds a partial merge).
+ */
+[[nodiscard]]
+bool edge_table_merge(EdgeTable *dst, const EdgeTable *src);
+
+/** Number of distinct edges. */
+[[nodiscard]]
+size_t edge_table_size(const EdgeTable *table);
+
+/**
+ * Visit every edge (unspecified order).
+ * @return false if the visitor stopped early.
+ */
+bool edge_table_each(const EdgeTable *table, EdgeVisitor visit, void *ctx);
+
+#endif /* TRACKING_EDGES_H */
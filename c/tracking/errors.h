@@ -5,12 +5,20 @@
 #include <Python.h>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "types.h"
+#include "interning.h"
+#include "store.h"
 
 /**
  * Capture current Python exception into event's error list.
  * Clears the exception after capturing.
  *
+ * Errors are rare, so they live out-of-line in the store's aux arena
+ * (store.h): each capture copies ev->errors into a one-longer array, the
+ * old one stays in the arena (at most MAX_FIELD_ERRORS - 1 per event).
+ * Nothing to free per event. On OOM the exception is cleared and dropped.
+ *
  * @param ev    Event to add error to
  * @param field Field name that caused the error (e.g., "file", "func", "arg[0]")
  */
@@ -18,6 +26,17 @@ static inline void capture_error(Event *ev, const char *field) {
     if (!ev || ev->error_count >= MAX_FIELD_ERRORS) return;
     if (!PyErr_Occurred()) return;
 
+    size_t count = (size_t)ev->error_count;
+    FieldError *grown = event_store_aux_alloc((count + 1) * sizeof(FieldError));
+    if (!grown) {
+        PyErr_Clear();
+        return;
+    }
+    if (count > 0) {
+        memcpy(grown, ev->errors, count * sizeof(FieldError));
+    }
+    ev->errors = grown;
+
     PyObject *type, *value, *tb;
     PyErr_Fetch(&type, &value, &tb);
 
@@ -76,26 +95,28 @@ static inline const char* safe_utf8(PyObject *obj, Event *ev, const char *field)
     if (!PyUnicode_Check(obj)) return nullptr;
 
     const char *result = PyUnicode_AsUTF8(obj);
-    if (!result && ev) {
-        capture_error(ev, field);
+    if (!result) {
+        if (ev) {
+            capture_error(ev, field);
+        } else {
+            PyErr_Clear();  /* No event to report to: drop */
+        }
     }
     return result;
 }
 
 /**
- * Copy UTF-8 string from Python object.
- * Returns heap-allocated copy that must be freed with free().
- * Safe to use after Python object is garbage collected.
+ * Intern UTF-8 string from Python object.
+ * Returns StringTable pointer: no per-call allocation for known strings,
+ * valid after Python object is garbage collected, do NOT free.
  *
  * @param obj   Python unicode object
  * @param ev    Event to capture error into (can be nullptr to skip capture)
  * @param field Field name for error reporting
- * @return      Heap-allocated string copy or nullptr on error
+ * @return      Interned string or nullptr on error
  */
-static inline char* copy_utf8(PyObject *obj, Event *ev, const char *field) {
-    const char *tmp = safe_utf8(obj, ev, field);
-    if (!tmp) return nullptr;
-    return strdup(tmp);
+static inline const char* intern_utf8(PyObject *obj, Event *ev, const char *field) {
+    return string_intern(safe_utf8(obj, ev, field));
 }
 
 #endif /* TRACKING_ERRORS_H */
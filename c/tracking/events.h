@@ -10,66 +10,53 @@
 
 #include "types.h"
 #include "errors.h"
-#include "memory.h"
+#include "codecache.h"
 
 /* ============================================================================
  * Event filling (single responsibility: fill Event struct)
  *
  * Functions fill Event* without knowing about global event storage.
  * Caller is responsible for:
- *   - Allocating Event (ensure_events_capacity)
- *   - memset(ev, 0, sizeof(Event)) before calling
+ *   - Reserving a zeroed record (event_store_reserve), CALL with
+ *     CodeMeta.arg_count trailing args (0 when arguments are skipped)
+ *   - Committing CALL records after fill (event_store_commit)
  *   - Managing event lifetime (free_events)
+ *
+ * All strings stored in events are INTERNED: filling never allocates
+ * per event, locations are plain struct copies.
  * ============================================================================ */
 
 /**
- * Fill CALL event from code object and call stack.
+ * Fill CALL event from cached code metadata and call stack.
+ * Names come from the cache: per argument only its id and type are read.
  *
- * @param ev           Pre-zeroed Event to fill
- * @param code         Code object being called
- * @param frame        Interpreter frame with arguments
+ * @param ev           Pre-zeroed Event with arg_slots trailing arg slots
+ * @param meta         Code metadata (code_cache_lookup, same session)
+ * @param frame        Interpreter frame with arguments (nullptr if arg_slots is 0)
  * @param caller       Caller location (can be nullptr)
+ * @param arg_slots    Arguments to capture: meta->arg_count, or 0 to skip
  */
 static inline void fill_call_event(
     Event *ev,
-    PyCodeObject *code,
+    const CodeMeta *meta,
     _PyInterpreterFrame *frame,
-    const FrameInfo *caller)
+    const FrameInfo *caller,
+    int arg_slots)
 {
     ev->type = EVENT_CALL;
-    ev->location.line = code->co_firstlineno;
-
-    /* Copy strings - survive frame exit */
-    ev->location.file = copy_utf8(code->co_filename, ev, "file");
-    ev->location.func = copy_utf8(code->co_qualname, ev, "func");
+    ev->location = meta->location;
 
     /* Caller info */
     if (caller) {
-        copy_frame_info(&ev->caller, caller);
-    }
-
-    /* Extract arguments */
-    _PyStackRef *localsarray = frame->localsplus;
-    PyObject *names = code->co_localsplusnames;
-    int argcount = code->co_argcount + code->co_kwonlyargcount;
-    if (code->co_flags & CO_VARARGS) {
-        argcount++;
+        ev->caller = *caller;
     }
-    if (code->co_flags & CO_VARKEYWORDS) {
-        argcount++;
-    }
-    int max_args = argcount < MAX_ARGS ? argcount : MAX_ARGS;
 
-    for (int i = 0; i < max_args; i++) {
-        _PyStackRef ref = localsarray[i];
+    /* Extract arguments into trailing slots */
+    for (int i = 0; i < arg_slots; i++) {
+        _PyStackRef ref = frame->localsplus[i];
         if (!PyStackRef_IsNull(ref)) {
             PyObject *value = PyStackRef_AsPyObjectBorrow(ref);
-            PyObject *name_obj = PyTuple_GET_ITEM(names, i);
-
-            char field[ERROR_FIELD_LEN];
-            (void)snprintf(field, sizeof(field), "arg[%d]", i);
-
-            ev->args[ev->arg_count].name_owned = copy_utf8(name_obj, ev, field);
+            ev->args[ev->arg_count].name_ref = meta->arg_names[i];
             ev->args[ev->arg_count].id = (uintptr_t)value;
             ev->args[ev->arg_count].type_ref = Py_TYPE(value)->tp_name;
             ev->arg_count++;
@@ -90,9 +77,7 @@ static inline void fill_return_event(
     PyObject *result)
 {
     ev->type = EVENT_RETURN;
-
-    /* Copy location strings - each event owns its strings */
-    copy_frame_info(&ev->location, location);
+    ev->location = *location;
 
     if (result) {
         ev->obj_id = (uintptr_t)result;
@@ -106,22 +91,20 @@ static inline void fill_return_event(
  * @param ev           Pre-zeroed Event to fill
  * @param obj_id       Object id (uintptr_t cast of PyObject*)
  * @param type_name    Type name (borrowed from tp_name)
- * @param call_stack   Current call stack
- * @param stack_depth  Call stack depth
+ * @param current      Top of call stack (can be nullptr)
  */
 static inline void fill_create_event(
     Event *ev,
     uintptr_t obj_id,
     const char *type_name,
-    const FrameInfo *call_stack,
-    int stack_depth)
+    const FrameInfo *current)
 {
     ev->type = EVENT_CREATE;
     ev->obj_id = obj_id;
     ev->type_name_ref = type_name;
 
-    if (stack_depth > 0) {
-        copy_frame_info(&ev->location, &call_stack[stack_depth - 1]);
+    if (current) {
+        ev->location = *current;
     }
 }
 
@@ -131,29 +114,30 @@ static inline void fill_create_event(
  * @param ev             Pre-zeroed Event to fill
  * @param obj_id         Object id
  * @param type_name      Type name (borrowed from tp_name)
- * @param call_stack     Current call stack
- * @param stack_depth    Call stack depth
- * @param creation_copy  Heap-allocated CreationInfo (ownership transferred)
+ * @param current        Top of call stack (can be nullptr)
+ * @param creation       Creation context (copied), nullptr if unknown
  */
 static inline void fill_destroy_event(
     Event *ev,
     uintptr_t obj_id,
     const char *type_name,
-    const FrameInfo *call_stack,
-    int stack_depth,
-    CreationInfo *creation_copy)
+    const FrameInfo *current,
+    const CreationInfo *creation)
 {
     ev->type = EVENT_DESTROY;
     ev->obj_id = obj_id;
     ev->type_name_ref = type_name;
 
     /* Destruction context */
-    if (stack_depth > 0) {
-        copy_frame_info(&ev->location, &call_stack[stack_depth - 1]);
+    if (current) {
+        ev->location = *current;
     }
 
-    /* Creation context (ownership transferred) */
-    ev->creation_info = creation_copy;
+    /* Creation context (stack id by value: nothing to free) */
+    if (creation) {
+        ev->creation = *creation;
+        ev->has_creation = true;
+    }
 }
 
 #endif /* TRACKING_EVENTS_H */
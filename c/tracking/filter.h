@@ -0,0 +1,86 @@
+/**
+ * C-side Event Filter (compiled FilterConfig)
+ *
+ * Pre-filter applied while recording, so events AnalyzerService.filter()
+ * would drop are never allocated. Same semantics as the Python filter:
+ *
+ *   - include/exclude path globs apply to CALL/RETURN only, matched
+ *     against the code object's co_filename (nullptr file passes)
+ *   - include: at least one must match (none given = all files)
+ *   - exclude: none may match (applied after include)
+ *   - type mask applies to all event types
+ *
+ * Matching:
+ *   POSIX fnmatch(3) with FNM_NOESCAPE: `*` and `?` cross `/`, backslash
+ *   is literal — as Python's fnmatch.fnmatch on POSIX (no normcase).
+ *   Callers cache the result per code object (codecache.h), so a pattern
+ *   list is walked once per code object per session, not per call.
+ *
+ * Thread Safety:
+ *   Built and destroyed only while hooks are off; read-only while tracking.
+ *
+ * C23: constexpr, nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_FILTER_H
+#define TRACKING_FILTER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/** Type mask bit of one EventType. */
+#define EVENT_TYPE_BIT(type) (1u << (unsigned)(type))
+
+/** Mask of every EventType (no type filter). */
+constexpr unsigned EVENT_TYPES_ALL = EVENT_TYPE_BIT(EVENT_DESTROY + 1) - 1;
+static_assert(EVENT_DESTROY == 3, "EVENT_TYPES_ALL assumes DESTROY is the last EventType");
+
+typedef struct {
+    char **include;         /* Owned pattern copies */
+    size_t include_count;
+    char **exclude;
+    size_t exclude_count;
+    unsigned types;         /* EVENT_TYPE_BIT mask of recorded types */
+} EventFilter;
+
+/**
+ * Compile filter (copies patterns).
+ *
+ * @param types  EVENT_TYPE_BIT mask (EVENT_TYPES_ALL = no type filter)
+ * @return false on OOM (nothing to destroy).
+ *
+ * FAIL-FIRST: Aborts if a count > 0 comes with a nullptr array or pattern.
+ */
+[[nodiscard]]
+bool event_filter_init(EventFilter *filter,
+                       const char *const *include, size_t include_count,
+                       const char *const *exclude, size_t exclude_count,
+                       unsigned types);
+
+/** Release patterns. Idempotent (zeroed filter is valid). */
+void event_filter_destroy(EventFilter *filter);
+
+/** @return true if any path pattern is set. */
+[[nodiscard]]
+static inline bool event_filter_has_paths(const EventFilter *filter) {
+    return filter->include_count > 0 || filter->exclude_count > 0;
+}
+
+/** @return true if events of type are recorded. */
+[[nodiscard]]
+static inline bool event_filter_type(const EventFilter *filter, EventType type) {
+    return (filter->types & EVENT_TYPE_BIT(type)) != 0;
+}
+
+/**
+ * Path check for CALL/RETURN of one file.
+ * @param file  UTF-8 path, nullptr passes (unknown file is never dropped)
+ */
+[[nodiscard]]
+bool event_filter_path(const EventFilter *filter, const char *file);
+
+#endif /* TRACKING_FILTER_H */
@@ -79,6 +79,28 @@ void frame_stack_pop(void);
 [[nodiscard]]
 const StackFrame* frame_stack_caller(void);
 
+/**
+ * Get current frame (top of stack).
+ *
+ * @return Pointer to top StackFrame, or nullptr if stack is empty.
+ *
+ * Returned pointer valid until next push/pop on same thread.
+ */
+[[nodiscard]]
+const StackFrame* frame_stack_top(void);
+
+/**
+ * Get frame n levels below top (0 = top, 1 = caller, ...).
+ *
+ * @param n  Distance from top of stack.
+ * @return   Pointer to StackFrame, or nullptr if n >= depth.
+ *
+ * Used to capture tracebacks without copying the whole stack.
+ * Returned pointer valid until next push/pop on same thread.
+ */
+[[nodiscard]]
+const StackFrame* frame_stack_peek(size_t n);
+
 /**
  * Get current stack depth.
  *
@@ -87,6 +109,26 @@ const StackFrame* frame_stack_caller(void);
 [[nodiscard]]
 size_t frame_stack_depth(void);
 
+/**
+ * Get memo tag of frame n levels below top (0 = top, 1 = caller, ...).
+ *
+ * One uint32_t per frame for callers that cache per-frame derived data
+ * (stacks.h memoizes the StackId of the stack ending at that frame).
+ * push() starts every frame with tag 0 (unset).
+ *
+ * @param n  Distance from top of stack.
+ * @return   Tag, or 0 if n >= depth.
+ */
+[[nodiscard]]
+uint32_t frame_stack_tag(size_t n);
+
+/**
+ * Set memo tag of frame n levels below top.
+ *
+ * FAIL-FIRST: Aborts if n >= depth.
+ */
+void frame_stack_set_tag(size_t n, uint32_t tag);
+
 /**
  * Clear thread-local call stack.
  *
@@ -4,7 +4,7 @@
 #include <stdint.h>
 #include "types.h"
 
-/* Verstable hash table: obj_id → CreationInfo */
+/* Verstable hash table: obj_id → CreationInfo (stack id + type, by value) */
 #define NAME creation_map
 #define KEY_TY uintptr_t
 #define VAL_TY CreationInfo
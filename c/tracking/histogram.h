@@ -0,0 +1,64 @@
+/**
+ * Latency Histogram (profile mode)
+ *
+ * Log-linear buckets, HDR-style: values below 8 ns get one bucket each;
+ * above that every power of two is split into HIST_SUB_BUCKETS equal
+ * sub-buckets, so any recorded value is known within 12.5% (1/8 of its
+ * power of two). Values of 2^40 ns (~18 minutes) or more land in the
+ * last bucket. Fixed size, no allocation: record() is a few shifts and
+ * one increment.
+ *
+ * Bucket index (v = value in ns):
+ *   v < 8:   idx = v
+ *   else:    m = msb(v), shift = m - 3
+ *            idx = (shift + 1) * 8 + (v >> shift) - 8
+ *
+ * Thread Safety:
+ *   None. One histogram per owner; merged once hooks are off.
+ *
+ * C23: constexpr, [[nodiscard]]
+ */
+
+#ifndef TRACKING_HISTOGRAM_H
+#define TRACKING_HISTOGRAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/** log2 of sub-buckets per power of two (precision 1/8). */
+constexpr unsigned HIST_SUB_BITS = 3;
+constexpr unsigned HIST_SUB_BUCKETS = 1u << HIST_SUB_BITS;
+
+/** Values >= 2^HIST_MAX_BITS ns are clamped into the last bucket. */
+constexpr unsigned HIST_MAX_BITS = 40;
+
+constexpr unsigned HIST_BUCKETS = (HIST_MAX_BITS - HIST_SUB_BITS + 1) * HIST_SUB_BUCKETS;
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t min_ns;        /* UINT64_MAX while empty */
+    uint64_t max_ns;
+    uint64_t buckets[HIST_BUCKETS];
+} LatencyHistogram;
+
+/** Reset to empty. */
+void histogram_init(LatencyHistogram *hist);
+
+/** Bucket index of value_ns. */
+[[nodiscard]]
+unsigned histogram_bucket(uint64_t value_ns);
+
+/**
+ * Bounds of bucket idx: every value v with lower <= v < upper maps to
+ * idx (the last bucket also holds everything above its upper bound).
+ */
+void histogram_bucket_bounds(unsigned idx, uint64_t *lower, uint64_t *upper);
+
+/** Record one value. */
+void histogram_record(LatencyHistogram *hist, uint64_t value_ns);
+
+/** Add every value of src into dst. */
+void histogram_merge(LatencyHistogram *dst, const LatencyHistogram *src);
+
+#endif /* TRACKING_HISTOGRAM_H */
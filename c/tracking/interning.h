@@ -6,10 +6,13 @@
  *   - intern(nullptr) returns nullptr
  *   - Pointers remain valid after resize (pointer stability)
  *   - Thread-safe for concurrent intern() calls
+ *   - Hit (already interned) never blocks: lock-free probe
  *
  * Architecture:
- *   strings[] — stores char* (strdup), grows but NEVER moves existing entries
- *   buckets[] — hash table of indices into strings[], rebuilt on resize
+ *   strings[] — stores char* into a session arena (no malloc per string,
+ *               freed in bulk by destroy), grows but NEVER moves entries
+ *   buckets   — open-addressing table of atomic entry pointers, replaced
+ *               (not rebuilt in place) on resize; misses insert under a mutex
  *
  * Complexity:
  *   intern: O(1) amortized
@@ -40,9 +43,6 @@ constexpr double STRING_TABLE_LOAD_FACTOR = 0.75;
 /** Tombstone marker for deleted entries (not used, but reserved). */
 constexpr size_t STRING_TABLE_TOMBSTONE = SIZE_MAX;
 
-/** Empty bucket marker. */
-constexpr size_t STRING_TABLE_EMPTY = SIZE_MAX - 1;
-
 /* ============================================================================
  * API
  * ============================================================================ */
@@ -88,6 +88,14 @@ const char* string_intern(const char* s);
  */
 size_t string_table_count(void);
 
+/**
+ * Bytes held by the table: string arena, index and bucket arrays.
+ * Takes the writer mutex (not for hot paths).
+ *
+ * @return 0 if not initialized.
+ */
+size_t string_table_bytes(void);
+
 /**
  * Check if string table is initialized.
  *
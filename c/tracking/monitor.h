@@ -0,0 +1,88 @@
+/**
+ * Monitor Stack
+ *
+ * Thread-local stack of open frames for the sys.monitoring backend
+ * (PEP 669). The frame eval hook keeps per-call state on its own C stack
+ * around the evaluation; with sys.monitoring, the start of a frame
+ * (PY_START/PY_RESUME/PY_THROW) and its end (PY_RETURN/PY_YIELD/PY_UNWIND)
+ * are separate callbacks, so that state is pushed here instead.
+ *
+ * Contract:
+ *   - push() returns a zeroed entry, valid until the next push/pop on the
+ *     same thread
+ *   - Entry code is a frame identity only (never dereferenced): an end
+ *     event whose frame is not the top entry's has no matching start
+ *     (frame began before start(), or its start was disabled) and is
+ *     ignored
+ *   - location/caller hold INTERNED strings of entry.session
+ *   - FAIL-FIRST: abort on allocation failure or pop of an empty stack
+ *
+ * Data Completeness:
+ *   Stack grows without limit (no depth cap), as frame.h.
+ *
+ * Thread Safety:
+ *   Thread-local, no synchronization.
+ *
+ * C23: nullptr, [[nodiscard]]
+ */
+
+#ifndef TRACKING_MONITOR_H
+#define TRACKING_MONITOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "frame.h"
+
+/** What the start callback did for this frame (what its end must undo). */
+typedef enum {
+    MONITOR_RECORDED = 0,   /* CALL recorded, RETURN pending */
+    MONITOR_SKIPPED = 1,    /* Sampled out / no frame events: shadow frame only */
+    MONITOR_AGGREGATED = 2, /* Aggregate mode: edge counted at end */
+    MONITOR_PROFILED = 3,   /* Profile mode: histograms fed at end */
+    MONITOR_TASKED = 4,     /* Tasks mode: own time charged to task at end */
+} MonitorKind;
+
+typedef struct {
+    const void *code;       /* Frame identity: interpreter frame or code object */
+    StackFrame location;    /* Callee, interned in session */
+    StackFrame caller;      /* Aggregate mode: caller at start */
+    uint64_t session;       /* Session the strings belong to */
+    uint64_t start;         /* Clock ticks or ns at start (profile/aggregate_time/tasks) */
+    uint64_t child_ticks;   /* Profile/tasks mode: ticks (ns) of timed callees */
+    uint64_t task;          /* Tasks mode: asyncio task running at start */
+    size_t depth_before;    /* frame_stack_depth() before the shadow push */
+    MonitorKind kind;
+} MonitorEntry;
+
+/**
+ * Push a zeroed entry on this thread's stack.
+ * FAIL-FIRST: aborts if allocation fails.
+ */
+[[nodiscard]]
+MonitorEntry* monitor_stack_push(void);
+
+/**
+ * Pop the top entry.
+ * FAIL-FIRST: aborts if the stack is empty.
+ */
+void monitor_stack_pop(void);
+
+/**
+ * Entry n levels below top (0 = top).
+ * @return nullptr if n >= depth.
+ */
+[[nodiscard]]
+MonitorEntry* monitor_stack_peek(size_t n);
+
+/** Number of open entries on this thread. */
+[[nodiscard]]
+size_t monitor_stack_depth(void);
+
+/** Drop all entries (new session), keep the allocation. */
+void monitor_stack_clear(void);
+
+/** Free this thread's stack (push reallocates). */
+void monitor_stack_destroy(void);
+
+#endif /* TRACKING_MONITOR_H */
@@ -5,6 +5,12 @@
 #include <Python.h>
 #include <string.h>
 #include "types.h"
+#include "columns.h"
+#include "edges.h"
+#include "profile.h"
+#include "rawevent.h"
+#include "sites.h"
+#include "stacks.h"
 
 /* ============================================================================
  * Output errors tracking
@@ -144,24 +150,30 @@ static inline PyObject* creation_info_to_dict(const CreationInfo *info, OutputEr
 
     char ctx[128];
 
+    /* Location = innermost frame of the creation stack */
+    const StackNode *node = info->stack != STACK_EMPTY ? stack_trie_node(info->stack) : nullptr;
+    const FrameInfo *location = node ? &node->frame : &FRAME_NO_CALLER;
+
     snprintf(ctx, sizeof(ctx), "%s.file", prefix);
-    dict_set_string(dict, "file", info->location.file, oe, ctx);
+    dict_set_string(dict, "file", location->file, oe, ctx);
 
-    dict_set_long(dict, "line", info->location.line);
+    dict_set_long(dict, "line", location->line);
 
     snprintf(ctx, sizeof(ctx), "%s.func", prefix);
-    dict_set_string(dict, "func", info->location.func, oe, ctx);
+    dict_set_string(dict, "func", location->func, oe, ctx);
 
     snprintf(ctx, sizeof(ctx), "%s.type", prefix);
     dict_set_string(dict, "type", info->type_name_ref, oe, ctx);
 
-    /* Traceback */
-    PyObject *tb = PyList_New(info->traceback_depth);
+    /* Traceback: full stack, innermost first (node → root) */
+    Py_ssize_t depth = node ? (Py_ssize_t)node->depth : 0;
+    PyObject *tb = PyList_New(depth);
     if (tb) {
-        for (int i = 0; i < info->traceback_depth; i++) {
+        for (Py_ssize_t i = 0; i < depth; i++) {
             char frame_prefix[128];
-            snprintf(frame_prefix, sizeof(frame_prefix), "%s.traceback[%d]", prefix, i);
-            PyObject *frame = frame_info_to_dict(&info->traceback[i], oe, frame_prefix);
+            snprintf(frame_prefix, sizeof(frame_prefix), "%s.traceback[%zd]", prefix, i);
+            PyObject *frame = frame_info_to_dict(&node->frame, oe, frame_prefix);
+            node = node->parent != STACK_EMPTY ? stack_trie_node(node->parent) : nullptr;
             if (frame) {
                 PyList_SET_ITEM(tb, i, frame);
             } else {
@@ -244,9 +256,9 @@ static inline void serialize_lifecycle_fields(PyObject *entry, const Event *evt,
     dict_set_string(entry, "type", evt->type_name_ref, oe, ctx);
 
     /* DESTROY: include creation context */
-    if (evt->type == EVENT_DESTROY && evt->creation_info) {
+    if (evt->type == EVENT_DESTROY && evt->has_creation) {
         (void)snprintf(ctx, sizeof(ctx), "events[%zu].creation", idx);
-        PyObject *creation = creation_info_to_dict(evt->creation_info, oe, ctx);
+        PyObject *creation = creation_info_to_dict(&evt->creation, oe, ctx);
         if (creation) {
             PyDict_SetItemString(entry, "creation", creation);
             Py_DECREF(creation);
@@ -280,7 +292,7 @@ static inline void serialize_call_fields(PyObject *entry, const Event *evt,
                 PyObject *arg_dict = PyDict_New();
                 if (arg_dict) {
                     (void)snprintf(ctx, sizeof(ctx), "events[%zu].args[%d].name", idx, j);
-                    dict_set_string(arg_dict, "name", evt->args[j].name_owned, oe, ctx);
+                    dict_set_string(arg_dict, "name", evt->args[j].name_ref, oe, ctx);
 
                     dict_set_ulonglong(arg_dict, "id", evt->args[j].id);
 
@@ -383,4 +395,296 @@ static inline PyObject* serialize_event(const Event *evt, size_t idx, OutputErro
     return entry;
 }
 
+/* ============================================================================
+ * Columnar serialization (EventColumns → bytes per column + string list)
+ * ============================================================================ */
+
+/** dict[key] = bytes(data[0..count)): one copy, exposed via buffer protocol. */
+static inline bool dict_set_column(PyObject *dict, const char *key,
+                                   const void *data, size_t count, size_t size) {
+    PyObject *buf = PyBytes_FromStringAndSize(data, (Py_ssize_t)(count * size));
+    if (!buf) {
+        return false;
+    }
+    int rc = PyDict_SetItemString(dict, key, buf);
+    Py_DECREF(buf);
+    return rc == 0;
+}
+
+#define DICT_SET_COLUMN(dict, cols, name, count) \
+    dict_set_column((dict), #name, (cols)->name, (count), sizeof(*(cols)->name))
+
+/**
+ * Row, arg and stack columns as {name: bytes}.
+ * Keys match archcheck.domain.events.COLUMN_FORMATS.
+ *
+ * @return New dict, or nullptr with Python exception set.
+ */
+static inline PyObject* columns_to_dict(const EventColumns *cols) {
+    PyObject *dict = PyDict_New();
+    if (!dict) {
+        return nullptr;
+    }
+
+    size_t n = cols->count;
+    size_t a = cols->arg_total;
+    size_t s = cols->stack_count;
+    bool ok = DICT_SET_COLUMN(dict, cols, kind, n)
+           && DICT_SET_COLUMN(dict, cols, obj_id, n)
+           && DICT_SET_COLUMN(dict, cols, type_name, n)
+           && DICT_SET_COLUMN(dict, cols, file, n)
+           && DICT_SET_COLUMN(dict, cols, func, n)
+           && DICT_SET_COLUMN(dict, cols, line, n)
+           && DICT_SET_COLUMN(dict, cols, caller_file, n)
+           && DICT_SET_COLUMN(dict, cols, caller_func, n)
+           && DICT_SET_COLUMN(dict, cols, caller_line, n)
+           && DICT_SET_COLUMN(dict, cols, thread, n)
+           && DICT_SET_COLUMN(dict, cols, task, n)
+           && DICT_SET_COLUMN(dict, cols, creation, n)
+           && DICT_SET_COLUMN(dict, cols, creation_type, n)
+           && DICT_SET_COLUMN(dict, cols, arg_count, n)
+           && DICT_SET_COLUMN(dict, cols, arg_id, a)
+           && DICT_SET_COLUMN(dict, cols, arg_name, a)
+           && DICT_SET_COLUMN(dict, cols, arg_type, a)
+           && DICT_SET_COLUMN(dict, cols, stack_parent, s)
+           && DICT_SET_COLUMN(dict, cols, stack_file, s)
+           && DICT_SET_COLUMN(dict, cols, stack_func, s)
+           && DICT_SET_COLUMN(dict, cols, stack_line, s);
+    if (!ok) {
+        Py_DECREF(dict);
+        return nullptr;
+    }
+    return dict;
+}
+
+/**
+ * Deduplicated strings as list: one str per unique string, [0] = None.
+ * @return New list, or nullptr on allocation failure.
+ */
+static inline PyObject* column_strings_to_list(const EventColumns *cols, OutputErrors *oe) {
+    PyObject *list = PyList_New(cols->string_count);
+    if (!list) {
+        return nullptr;
+    }
+
+    for (uint32_t i = 0; i < cols->string_count; i++) {
+        PyObject *item = cols->strings[i] ? PyUnicode_FromString(cols->strings[i]) : nullptr;
+        if (!item) {
+            if (cols->strings[i]) {
+                char ctx[CTX_BUFFER_SIZE];
+                (void)snprintf(ctx, sizeof(ctx), "strings[%u]", i);
+                output_error(oe, ctx);
+            }
+            item = Py_NewRef(Py_None);
+        }
+        PyList_SET_ITEM(list, i, item);
+    }
+    return list;
+}
+
+/* ============================================================================
+ * Aggregated call edges (start(aggregate=True))
+ * ============================================================================ */
+
+/**
+ * {caller, callee, count, total_ns} for edges[idx].
+ * total_ns only when calls were timed (absent = not measured).
+ *
+ * @return New dict, or nullptr with Python exception set.
+ */
+static inline PyObject* edge_to_dict(const EdgeKey *key, const EdgeStats *stats, bool timed,
+                                     size_t idx, OutputErrors *oe) {
+    char ctx[CTX_BUFFER_SIZE];
+    (void)snprintf(ctx, sizeof(ctx), "edges[%zu].caller", idx);
+    PyObject *caller = frame_info_to_dict(&key->caller, oe, ctx);
+    (void)snprintf(ctx, sizeof(ctx), "edges[%zu].callee", idx);
+    PyObject *callee = frame_info_to_dict(&key->callee, oe, ctx);
+    if (!caller || !callee) {
+        Py_XDECREF(caller);
+        Py_XDECREF(callee);
+        return nullptr;
+    }
+
+    PyObject *dict = Py_BuildValue("{s:N,s:N,s:K}", "caller", caller, "callee", callee,
+                                   "count", (unsigned long long)stats->count);
+    if (dict && timed) {
+        dict_set_ulonglong(dict, "total_ns", stats->total_ns);
+    }
+    return dict;
+}
+
+/**
+ * {count, total_ns, min_ns, max_ns, buckets: [(lower_ns, upper_ns, count), ...]}
+ * Only non-empty buckets, ascending.
+ */
+static inline PyObject* histogram_to_dict(const LatencyHistogram *hist) {
+    PyObject *buckets = PyList_New(0);
+    if (!buckets) {
+        return nullptr;
+    }
+    for (unsigned i = 0; i < HIST_BUCKETS; i++) {
+        if (hist->buckets[i] == 0) {
+            continue;
+        }
+        uint64_t lower = 0, upper = 0;
+        histogram_bucket_bounds(i, &lower, &upper);
+        PyObject *bucket = Py_BuildValue("(KKK)", (unsigned long long)lower,
+                                         (unsigned long long)upper,
+                                         (unsigned long long)hist->buckets[i]);
+        int rc = bucket ? PyList_Append(buckets, bucket) : -1;
+        Py_XDECREF(bucket);
+        if (rc != 0) {
+            Py_DECREF(buckets);
+            return nullptr;
+        }
+    }
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:N}",
+                         "count", (unsigned long long)hist->count,
+                         "total_ns", (unsigned long long)hist->total_ns,
+                         "min_ns", (unsigned long long)(hist->count ? hist->min_ns : 0),
+                         "max_ns", (unsigned long long)hist->max_ns,
+                         "buckets", buckets);
+}
+
+static inline PyObject* profile_to_dict(const FrameInfo *func, const ProfileStats *stats,
+                                        size_t idx, OutputErrors *oe) {
+    char ctx[CTX_BUFFER_SIZE];
+    (void)snprintf(ctx, sizeof(ctx), "functions[%zu].function", idx);
+    PyObject *function = frame_info_to_dict(func, oe, ctx);
+    PyObject *inclusive = histogram_to_dict(&stats->inclusive);
+    PyObject *exclusive = histogram_to_dict(&stats->exclusive);
+    if (!function || !inclusive || !exclusive) {
+        Py_XDECREF(function);
+        Py_XDECREF(inclusive);
+        Py_XDECREF(exclusive);
+        return nullptr;
+    }
+    return Py_BuildValue("{s:N,s:N,s:N}", "function", function,
+                         "inclusive", inclusive, "exclusive", exclusive);
+}
+
+/**
+ * Lifetimes of a site's freed objects, same shape as histogram_to_dict().
+ * @return None if nothing was freed.
+ */
+static inline PyObject* site_lifetime_to_dict(const SiteStats *stats) {
+    if (stats->freed == 0) {
+        Py_RETURN_NONE;
+    }
+    PyObject *buckets = PyList_New(0);
+    if (!buckets) {
+        return nullptr;
+    }
+    for (unsigned i = 0; i < SITE_LIFETIME_BUCKETS; i++) {
+        if (stats->lifetime[i] == 0) {
+            continue;
+        }
+        uint64_t lower = 0, upper = 0;
+        site_lifetime_bounds(i, &lower, &upper);
+        PyObject *bucket = Py_BuildValue("(KKK)", (unsigned long long)lower,
+                                         (unsigned long long)upper,
+                                         (unsigned long long)stats->lifetime[i]);
+        int rc = bucket ? PyList_Append(buckets, bucket) : -1;
+        Py_XDECREF(bucket);
+        if (rc != 0) {
+            Py_DECREF(buckets);
+            return nullptr;
+        }
+    }
+    return Py_BuildValue("{s:K,s:K,s:K,s:K,s:N}",
+                         "count", (unsigned long long)stats->freed,
+                         "total_ns", (unsigned long long)stats->lifetime_total_ns,
+                         "min_ns", (unsigned long long)stats->lifetime_min_ns,
+                         "max_ns", (unsigned long long)stats->lifetime_max_ns,
+                         "buckets", buckets);
+}
+
+/** {site: {file, line, func, type, traceback}, allocated, freed, live, lifetime} */
+static inline PyObject* site_to_dict(const SiteEntry *entry, size_t idx, OutputErrors *oe) {
+    char ctx[CTX_BUFFER_SIZE];
+    (void)snprintf(ctx, sizeof(ctx), "sites[%zu].site", idx);
+    CreationInfo info = {.stack = entry->key.stack, .type_name_ref = entry->key.type_name};
+    PyObject *site = creation_info_to_dict(&info, oe, ctx);
+    PyObject *lifetime = site_lifetime_to_dict(&entry->stats);
+    if (!site || !lifetime) {
+        Py_XDECREF(site);
+        Py_XDECREF(lifetime);
+        return nullptr;
+    }
+    const SiteStats *stats = &entry->stats;
+    return Py_BuildValue("{s:N,s:K,s:K,s:K,s:N}", "site", site,
+                         "allocated", (unsigned long long)stats->allocated,
+                         "freed", (unsigned long long)stats->freed,
+                         "live", (unsigned long long)(stats->allocated - stats->freed),
+                         "lifetime", lifetime);
+}
+
+/* ============================================================================
+ * Raw event serialization (shared-memory collector)
+ * ============================================================================ */
+
+/**
+ * RawEvent → PyDict with the keys of serialize_event(). Raw events carry no
+ * arguments, return values, field errors or creation contexts.
+ *
+ * @return New reference to PyDict, or nullptr on allocation failure.
+ */
+static inline PyObject* raw_event_to_dict(const RawEvent *ev, size_t idx, OutputErrors *oe) {
+    PyObject *entry = PyDict_New();
+    if (!entry) {
+        return nullptr;
+    }
+    char ctx[CTX_BUFFER_SIZE];
+    const char *file = nullptr;
+    const char *func = nullptr;
+    int32_t line = 0;
+    const char *type_name = nullptr;
+    uintptr_t obj_id = 0;
+    switch (ev->kind) {
+        case EVENT_CALL:
+            file = ev->data.call.callee_file;
+            line = ev->data.call.callee_line;
+            func = ev->data.call.callee_func;
+            break;
+        case EVENT_RETURN:
+            file = ev->data.ret.file;
+            line = ev->data.ret.line;
+            func = ev->data.ret.func;
+            break;
+        case EVENT_CREATE:
+            file = ev->data.create.file;
+            line = ev->data.create.line;
+            func = ev->data.create.func;
+            type_name = ev->data.create.type_name;
+            obj_id = ev->data.create.obj_id;
+            break;
+        case EVENT_DESTROY:
+            type_name = ev->data.destroy.type_name;
+            obj_id = ev->data.destroy.obj_id;
+            break;
+    }
+
+    (void)snprintf(ctx, sizeof(ctx), "events[%zu].event", idx);
+    dict_set_string(entry, "event", event_type_name(ev->kind), oe, ctx);
+    (void)snprintf(ctx, sizeof(ctx), "events[%zu].file", idx);
+    dict_set_string(entry, "file", file, oe, ctx);
+    dict_set_long(entry, "line", line);
+    (void)snprintf(ctx, sizeof(ctx), "events[%zu].func", idx);
+    dict_set_string(entry, "func", func, oe, ctx);
+
+    if (ev->kind == EVENT_CALL && ev->data.call.caller_func) {
+        (void)snprintf(ctx, sizeof(ctx), "events[%zu].caller_file", idx);
+        dict_set_string(entry, "caller_file", ev->data.call.caller_file, oe, ctx);
+        dict_set_long(entry, "caller_line", ev->data.call.caller_line);
+        (void)snprintf(ctx, sizeof(ctx), "events[%zu].caller_func", idx);
+        dict_set_string(entry, "caller_func", ev->data.call.caller_func, oe, ctx);
+    }
+    if (ev->kind == EVENT_CREATE || ev->kind == EVENT_DESTROY) {
+        dict_set_ulonglong(entry, "id", obj_id);
+        (void)snprintf(ctx, sizeof(ctx), "events[%zu].type", idx);
+        dict_set_string(entry, "type", type_name, oe, ctx);
+    }
+    return entry;
+}
+
 #endif /* TRACKING_OUTPUT_H */
@@ -0,0 +1,79 @@
+/**
+ * Function Profile Table (profile mode)
+ *
+ * start(profile=True) records no CALL/RETURN events: every completed
+ * call records its latency into the callee's two histograms instead.
+ * Memory is O(distinct functions) — ~5 KB each.
+ *
+ * Key:
+ *   Callee FrameInfo by value (file/func INTERNED: pointer equality).
+ *
+ * Value:
+ *   inclusive  wall time from entry to return (children included)
+ *   exclusive  inclusive minus time spent in profiled callees; callees
+ *              skipped by filters or sampling count as the caller's own
+ *
+ *   Each generator/coroutine resume is a separate call. Calls still
+ *   running at stop() are not recorded.
+ *
+ * Thread Safety:
+ *   None. One table per thread buffer; merged once hooks are off.
+ *
+ * C23: nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_PROFILE_H
+#define TRACKING_PROFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "histogram.h"
+#include "types.h"
+
+typedef struct {
+    LatencyHistogram inclusive;
+    LatencyHistogram exclusive;
+} ProfileStats;
+
+/** Opaque: verstable FrameInfo → ProfileStats* (defined in profile.c). */
+typedef struct ProfileTable ProfileTable;
+
+/** Visitor of profile_table_each(); returns false to stop. */
+typedef bool (*ProfileVisitor)(const FrameInfo *func, const ProfileStats *stats, void *ctx);
+
+/** @return New empty table, or nullptr on OOM. */
+[[nodiscard]]
+ProfileTable* profile_table_new(void);
+
+/** Free table. nullptr is a no-op. */
+void profile_table_free(ProfileTable *table);
+
+/**
+ * Record one completed call of func.
+ * @return false on OOM (call not recorded).
+ */
+[[nodiscard]]
+bool profile_table_add(ProfileTable *table, const FrameInfo *func,
+                       uint64_t inclusive_ns, uint64_t exclusive_ns);
+
+/**
+ * Add every function of src into dst (histograms merged).
+ * @return false on OOM (dst holds a partial merge).
+ */
+[[nodiscard]]
+bool profile_table_merge(ProfileTable *dst, const ProfileTable *src);
+
+/** Number of distinct functions. */
+[[nodiscard]]
+size_t profile_table_size(const ProfileTable *table);
+
+/**
+ * Visit every function (unspecified order).
+ * @return false if the visitor stopped early.
+ */
+bool profile_table_each(const ProfileTable *table, ProfileVisitor visit, void *ctx);
+
+#endif /* TRACKING_PROFILE_H */
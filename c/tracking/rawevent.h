@@ -0,0 +1,183 @@
+/**
+ * Raw Events
+ *
+ * Compact, fixed-size event records: what a consumer outside the tracker
+ * sees (callback.h dispatch, shmring.h wire format). Locations and type
+ * names only — no arguments, field errors or creation tracebacks.
+ *
+ * Contract:
+ *   - All string fields are INTERNED (pointer stable, pointer equality)
+ *   - Across processes (shmring.h) a string pointer is an opaque id,
+ *     defined once per ring by a STRING record
+ *   - EventKind is EventType: same values as Event.type and tracefile kinds
+ *
+ * C23: constexpr, nullptr
+ */
+
+#ifndef TRACKING_RAWEVENT_H
+#define TRACKING_RAWEVENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/* ============================================================================
+ * Event Types
+ * ============================================================================ */
+
+/** Event kind (EVENT_CALL, EVENT_RETURN, EVENT_CREATE, EVENT_DESTROY). */
+typedef EventType EventKind;
+
+/**
+ * Raw call event data.
+ * All strings INTERNED (valid until string_table_destroy).
+ */
+typedef struct {
+    const char* callee_file;
+    int32_t callee_line;
+    const char* callee_func;
+    const char* caller_file;
+    int32_t caller_line;
+    const char* caller_func;
+    uint64_t thread_id;
+    uint64_t coro_id;
+    uint64_t timestamp_ns;
+} RawCallEvent;
+
+/**
+ * Raw return event data.
+ */
+typedef struct {
+    const char* file;
+    int32_t line;
+    const char* func;
+    uint64_t thread_id;
+    uint64_t timestamp_ns;
+    bool has_exception;
+} RawReturnEvent;
+
+/**
+ * Raw object creation event.
+ */
+typedef struct {
+    uintptr_t obj_id;
+    const char* type_name;  /* Interned */
+    const char* file;
+    int32_t line;
+    const char* func;
+    uint64_t thread_id;
+    uint64_t timestamp_ns;
+} RawCreateEvent;
+
+/**
+ * Raw object destruction event.
+ */
+typedef struct {
+    uintptr_t obj_id;
+    const char* type_name;  /* Interned */
+    uint64_t thread_id;
+    uint64_t timestamp_ns;
+} RawDestroyEvent;
+
+/**
+ * Union of all event types.
+ */
+typedef struct {
+    EventKind kind;
+    union {
+        RawCallEvent call;
+        RawReturnEvent ret;
+        RawCreateEvent create;
+        RawDestroyEvent destroy;
+    } data;
+} RawEvent;
+
+/* ============================================================================
+ * Conversion
+ * ============================================================================ */
+
+/** String fields one RawEvent can carry (CALL: callee and caller file/func). */
+constexpr int RAW_EVENT_MAX_STRINGS = 4;
+
+/**
+ * Compact copy of a recorded Event.
+ * RETURN: has_exception when no return value was recorded; coro_id is 0.
+ */
+static inline void raw_event_from(RawEvent *out, const Event *ev,
+                                  uint64_t thread_id, uint64_t timestamp_ns) {
+    *out = (RawEvent){.kind = ev->type};
+    switch (ev->type) {
+        case EVENT_CALL:
+            out->data.call = (RawCallEvent){
+                .callee_file = ev->location.file,
+                .callee_line = ev->location.line,
+                .callee_func = ev->location.func,
+                .caller_file = ev->caller.file,
+                .caller_line = ev->caller.line,
+                .caller_func = ev->caller.func,
+                .thread_id = thread_id,
+                .timestamp_ns = timestamp_ns,
+            };
+            break;
+        case EVENT_RETURN:
+            out->data.ret = (RawReturnEvent){
+                .file = ev->location.file,
+                .line = ev->location.line,
+                .func = ev->location.func,
+                .thread_id = thread_id,
+                .timestamp_ns = timestamp_ns,
+                .has_exception = ev->type_name_ref == nullptr,
+            };
+            break;
+        case EVENT_CREATE:
+            out->data.create = (RawCreateEvent){
+                .obj_id = ev->obj_id,
+                .type_name = ev->type_name_ref,
+                .file = ev->location.file,
+                .line = ev->location.line,
+                .func = ev->location.func,
+                .thread_id = thread_id,
+                .timestamp_ns = timestamp_ns,
+            };
+            break;
+        case EVENT_DESTROY:
+            out->data.destroy = (RawDestroyEvent){
+                .obj_id = ev->obj_id,
+                .type_name = ev->type_name_ref,
+                .thread_id = thread_id,
+                .timestamp_ns = timestamp_ns,
+            };
+            break;
+    }
+}
+
+/**
+ * Addresses of the string fields of ev, for rewriting them (ids ↔ pointers).
+ * @return number of fields stored in fields (≤ RAW_EVENT_MAX_STRINGS).
+ */
+static inline int raw_event_strings(RawEvent *ev, const char **fields[RAW_EVENT_MAX_STRINGS]) {
+    switch (ev->kind) {
+        case EVENT_CALL:
+            fields[0] = &ev->data.call.callee_file;
+            fields[1] = &ev->data.call.callee_func;
+            fields[2] = &ev->data.call.caller_file;
+            fields[3] = &ev->data.call.caller_func;
+            return 4;
+        case EVENT_RETURN:
+            fields[0] = &ev->data.ret.file;
+            fields[1] = &ev->data.ret.func;
+            return 2;
+        case EVENT_CREATE:
+            fields[0] = &ev->data.create.type_name;
+            fields[1] = &ev->data.create.file;
+            fields[2] = &ev->data.create.func;
+            return 3;
+        case EVENT_DESTROY:
+            fields[0] = &ev->data.destroy.type_name;
+            return 1;
+    }
+    return 0;
+}
+
+#endif /* TRACKING_RAWEVENT_H */
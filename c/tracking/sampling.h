@@ -0,0 +1,76 @@
+/**
+ * Call Sampling (always-on production mode)
+ *
+ * Decides per CALL whether it is recorded, BEFORE any event is reserved.
+ * A skipped call records neither CALL nor RETURN (pairing stays exact);
+ * it still goes on the shadow stack, so callers and creation sites of
+ * recorded events are never misattributed.
+ *
+ * Stages (a call is recorded only if every enabled stage allows it;
+ * each stage sees only calls the previous one allowed):
+ *
+ *   every        per thread: 1st, (N+1)th, (2N+1)th ... call   (0/1 = all)
+ *   interval_ns  per thread: at most one call per interval      (0 = off)
+ *   max_per_code per code object: first K calls, then backoff
+ *                to calls K, 2K, 4K, 8K ... (log of hot paths)  (0 = off)
+ *
+ * The first call of a code object in a session is always recorded: it
+ * fills the code cache (codecache.h), whose location a skipped call pushes.
+ *
+ * Thread Safety:
+ *   Config written only while hooks are off (read-only while tracking).
+ *   SamplerState is thread-local. Per-code counters are atomic (relaxed:
+ *   approximate under contention, never torn).
+ *
+ * C23: nullptr, [[nodiscard]], _Atomic
+ * FAIL-FIRST: abort on contract violation
+ */
+
+#ifndef TRACKING_SAMPLING_H
+#define TRACKING_SAMPLING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct {
+    uint64_t every;         /* Record every Nth call per thread (0/1 = all) */
+    uint64_t interval_ns;   /* Min time between recorded calls per thread (0 = off) */
+    uint64_t max_per_code;  /* Calls per code object before backoff (0 = off) */
+} SamplingConfig;
+
+/** Per-thread sampler state. Zero = fresh (first call recorded). */
+typedef struct {
+    uint64_t seen;      /* Calls counted by the every-Nth stage */
+    uint64_t next_ns;   /* Earliest timestamp of the next recorded call */
+} SamplerState;
+
+/** @return true if any stage is enabled (otherwise record everything). */
+[[nodiscard]]
+static inline bool sampling_enabled(const SamplingConfig *cfg) {
+    return cfg->every > 1 || cfg->interval_ns > 0 || cfg->max_per_code > 0;
+}
+
+/**
+ * Per-thread stages (every, interval_ns).
+ *
+ * @param now_ns  Monotonic timestamp (only read if interval_ns > 0)
+ * @return true if the call passes both stages.
+ *
+ * FAIL-FIRST: Aborts if cfg or state is nullptr.
+ */
+[[nodiscard]]
+bool sampler_thread_allows(const SamplingConfig *cfg, SamplerState *state, uint64_t now_ns);
+
+/**
+ * Per-code stage (max_per_code). Counts the call in *fires.
+ *
+ * @param fires  Calls of this code object seen by this stage (this session)
+ * @return true if the call is recorded.
+ *
+ * FAIL-FIRST: Aborts if cfg or fires is nullptr.
+ */
+[[nodiscard]]
+bool sampler_code_allows(const SamplingConfig *cfg, _Atomic(uint64_t) *fires);
+
+#endif /* TRACKING_SAMPLING_H */
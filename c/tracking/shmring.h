@@ -0,0 +1,221 @@
+/**
+ * Shared-Memory Event Rings
+ *
+ * Transport for start(shm_name=...): the traced process copies each
+ * published event as a RawEvent (rawevent.h) into a POSIX shared memory
+ * segment; a collector process maps the same segment and reads them. The
+ * traced process builds no Python object per event and keeps nothing for
+ * stop() to serialize.
+ *
+ * Layout (one segment, created by the collector):
+ *
+ *   ShmHeader                       64 bytes
+ *   ShmRing[ring_count]             128 bytes each (producer / consumer line)
+ *   data[ring_count][ring_bytes]    ring_bytes a power of two
+ *
+ * Rings (single producer, single consumer):
+ *   A traced thread claims one ring on first use (claimed rings are never
+ *   shared; threads beyond ring_count count as `unclaimed` drops). head
+ *   and tail are monotonic byte counts: the producer writes a record, then
+ *   publishes head (release); the consumer reads up to head (acquire),
+ *   then publishes tail (release). A record that does not fit is dropped
+ *   and counted: the traced process never waits for the collector.
+ *
+ * Records (8-byte aligned, header {uint32 size; uint32 type} + payload):
+ *
+ *   SHM_RECORD_PAD     rest of the ring is unused, continue at offset 0
+ *   SHM_RECORD_STRING  {uint64 id; char bytes[]} — NUL-terminated
+ *   SHM_RECORD_EVENT   RawEvent whose string pointers are ids
+ *
+ *   Producer string pointers are ids. Each ring defines an id (STRING)
+ *   before the first EVENT on it that uses the id, so a consumer reading
+ *   rings in order always resolves them.
+ *
+ * Lifecycle:
+ *   Collector: create() ... consumer poll() ... unmap(), unlink().
+ *   Producer:  attach() ... producer write() ... finish(), unmap().
+ *   One producer session per segment: attach() to a used segment fails
+ *   (ids are pointers of that one session's string table).
+ *
+ * Portability:
+ *   Both sides must share the ABI (checked: header.raw_event_size); the
+ *   segment is a same-machine transport, not a file format.
+ *
+ * Thread Safety:
+ *   Producer API: one thread per ShmProducer. Consumer API: one thread
+ *   per segment. claim and header counters are atomic.
+ *
+ * C23: constexpr, nullptr, [[nodiscard]], _Atomic, static_assert, alignas
+ * POSIX: shm_open(), ftruncate(), mmap(); errno on failure
+ */
+
+#ifndef TRACKING_SHMRING_H
+#define TRACKING_SHMRING_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rawevent.h"
+
+/* ============================================================================
+ * Segment format
+ * ============================================================================ */
+
+/** Bumped on any incompatible layout change. */
+constexpr uint32_t SHM_FORMAT_VERSION = 1;
+
+#define SHM_HEADER_MAGIC "ARCHSHM"      /* + NUL = 8 bytes */
+
+/** Ring size bounds (bytes, power of two). */
+constexpr uint64_t SHM_MIN_RING_BYTES = 4096;
+constexpr uint64_t SHM_MAX_RING_BYTES = 1ull << 30;
+
+/** Rings per segment (one per traced thread). */
+constexpr uint32_t SHM_MAX_RINGS = 4096;
+
+typedef enum {
+    SHM_RECORD_PAD = 0,
+    SHM_RECORD_STRING = 1,
+    SHM_RECORD_EVENT = 2,
+} ShmRecordType;
+
+typedef enum {
+    SHM_PRODUCER_NONE = 0,      /* Created, waiting for the traced process */
+    SHM_PRODUCER_ATTACHED = 1,  /* start(shm_name=...) running */
+    SHM_PRODUCER_DONE = 2,      /* stop() returned: no more records */
+} ShmProducerState;
+
+typedef struct {
+    char magic[8];                      /* SHM_HEADER_MAGIC */
+    uint32_t version;                   /* SHM_FORMAT_VERSION */
+    uint32_t ring_count;
+    uint64_t ring_bytes;
+    uint32_t raw_event_size;            /* sizeof(RawEvent) on both sides */
+    _Atomic(uint32_t) producer;         /* ShmProducerState */
+    _Atomic(uint32_t) rings_claimed;
+    uint32_t reserved0;
+    _Atomic(uint64_t) unclaimed;        /* Events of threads without a ring */
+    uint64_t reserved[2];
+} ShmHeader;
+
+typedef struct {
+    alignas(64) _Atomic(uint64_t) head; /* Producer: bytes written */
+    _Atomic(uint64_t) dropped;          /* Producer: records that did not fit */
+    alignas(64) _Atomic(uint64_t) tail; /* Consumer: bytes read */
+} ShmRing;
+
+typedef struct {
+    uint32_t size;                      /* Header + payload, multiple of 8 */
+    uint32_t type;                      /* ShmRecordType */
+} ShmRecordHeader;
+
+static_assert(sizeof(ShmHeader) == 64, "ShmHeader layout is shared memory format");
+static_assert(sizeof(ShmRing) == 128, "ShmRing layout is shared memory format");
+static_assert(sizeof(ShmRecordHeader) == 8, "ShmRecordHeader layout is shared memory format");
+
+/** Mapped segment (either side). */
+typedef struct {
+    ShmHeader *header;      /* Mapping base, nullptr = not mapped */
+    ShmRing *rings;
+    uint8_t *data;
+    size_t size;            /* Mapped bytes */
+} ShmSegment;
+
+/* ============================================================================
+ * Segment
+ * ============================================================================ */
+
+/**
+ * Create, size and map a new segment (collector side).
+ *
+ * @param name        shm_open() name ("/archcheck-1234")
+ * @param ring_count  1..SHM_MAX_RINGS
+ * @param ring_bytes  Power of two in [SHM_MIN_RING_BYTES, SHM_MAX_RING_BYTES]
+ * @return false with errno set (EINVAL: bad sizes, EEXIST: name taken).
+ */
+[[nodiscard]]
+bool shm_segment_create(ShmSegment *seg, const char *name, uint32_t ring_count,
+                        uint64_t ring_bytes);
+
+/**
+ * Map an existing segment and mark it attached (traced side).
+ *
+ * @return false with errno set (ENOENT: no segment, EINVAL: not a
+ *         compatible segment, EBUSY: already used by a producer).
+ */
+[[nodiscard]]
+bool shm_segment_attach(ShmSegment *seg, const char *name);
+
+/** Producer side: no more records will be written (release). */
+void shm_segment_finish(ShmSegment *seg);
+
+/** Consumer side: producer finished (acquire). Records may remain unread. */
+[[nodiscard]]
+bool shm_segment_finished(const ShmSegment *seg);
+
+/** Records dropped so far: full rings plus threads without a ring. */
+[[nodiscard]]
+uint64_t shm_segment_dropped(const ShmSegment *seg);
+
+/** Unmap (either side). Idempotent. */
+void shm_segment_unmap(ShmSegment *seg);
+
+/**
+ * Remove the segment name (collector side). Mappings stay valid.
+ * @return false with errno set.
+ */
+bool shm_segment_unlink(const char *name);
+
+/* ============================================================================
+ * Producer (one per traced thread)
+ * ============================================================================ */
+
+typedef struct ShmProducer ShmProducer;
+
+/**
+ * Claim a ring of seg for the calling thread.
+ * If every ring is taken, the producer still works: its events count as
+ * `unclaimed` drops.
+ *
+ * @return nullptr on OOM.
+ */
+[[nodiscard]]
+ShmProducer* shm_producer_new(ShmSegment *seg);
+
+/** Free producer (the ring stays claimed). nullptr is a no-op. */
+void shm_producer_free(ShmProducer *producer);
+
+/**
+ * Write ev, preceded by STRING records for ids not yet defined on this ring.
+ * @return false if dropped (ring full, no ring, or OOM).
+ */
+bool shm_producer_write(ShmProducer *producer, const RawEvent *ev);
+
+/* ============================================================================
+ * Consumer (collector)
+ * ============================================================================ */
+
+typedef struct ShmConsumer ShmConsumer;
+
+/** @return nullptr on OOM. */
+[[nodiscard]]
+ShmConsumer* shm_consumer_new(ShmSegment *seg);
+
+/** Free consumer and every resolved string. nullptr is a no-op. */
+void shm_consumer_free(ShmConsumer *consumer);
+
+/**
+ * Take up to max events, ring by ring (per-thread order; across threads
+ * order by timestamp_ns). String fields point to consumer-owned copies,
+ * valid until shm_consumer_free(); an undefined id resolves to nullptr.
+ *
+ * @return Events stored in out, 0 if every ring is empty.
+ *
+ * FAIL-FIRST: aborts on a malformed record (corrupt segment).
+ */
+[[nodiscard]]
+size_t shm_consumer_poll(ShmConsumer *consumer, RawEvent *out, size_t max);
+
+#endif /* TRACKING_SHMRING_H */
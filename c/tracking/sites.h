@@ -0,0 +1,107 @@
+/**
+ * Allocation Site Table (alloc_sites mode)
+ *
+ * start(alloc_sites=True) records no events: every CREATE bumps its site,
+ * every DESTROY of a tracked object bumps the same site's freed count and
+ * lifetime histogram. Memory is O(distinct sites + live objects), not
+ * O(events) — leak hunting in production.
+ *
+ * Site key:
+ *   (creation stack id, type name). The stack id (stacks.h) names the
+ *   whole creation traceback; its top frame is the creation location.
+ *   type_name is borrowed from tp_name, as Event.type_name_ref.
+ *
+ * Value:
+ *   allocated  objects created at this site
+ *   freed      of those, objects destroyed (live = allocated - freed)
+ *   lifetime   log2 histogram of freed objects' lifetimes (ns)
+ *
+ * Objects created before start() are not tracked: their DESTROY is
+ * ignored. A CREATE of an id still live (DESTROY missed) frees the old
+ * object at that time first.
+ *
+ * Thread Safety:
+ *   None. One shared table; callers serialize (creation_mutex).
+ *
+ * C23: constexpr, nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_SITES_H
+#define TRACKING_SITES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "stacks.h"
+
+/** Lifetime buckets [2^i, 2^(i+1)) ns; the last one holds everything above. */
+constexpr unsigned SITE_LIFETIME_BUCKETS = 48;
+
+typedef struct {
+    StackId stack;
+    const char *type_name;
+} SiteKey;
+
+typedef struct {
+    uint64_t allocated;
+    uint64_t freed;
+    uint64_t lifetime_total_ns;
+    uint64_t lifetime_min_ns;           /* UINT64_MAX while nothing freed */
+    uint64_t lifetime_max_ns;
+    uint64_t lifetime[SITE_LIFETIME_BUCKETS];
+} SiteStats;
+
+/** One site, copied out by site_table_entries(). */
+typedef struct {
+    SiteKey key;
+    SiteStats stats;
+} SiteEntry;
+
+/** Opaque: verstable SiteKey → SiteStats*, obj id → live object (sites.c). */
+typedef struct SiteTable SiteTable;
+
+/** @return New empty table, or nullptr on OOM. */
+[[nodiscard]]
+SiteTable* site_table_new(void);
+
+/** Free table (sites in bulk). nullptr is a no-op. */
+void site_table_free(SiteTable *table);
+
+/**
+ * Count one object created at (stack, type_name) at now_ns.
+ * @return false on OOM (object not tracked).
+ */
+[[nodiscard]]
+bool site_table_create(SiteTable *table, uintptr_t obj_id, StackId stack,
+                       const char *type_name, uint64_t now_ns);
+
+/**
+ * Count destruction of obj_id at now_ns.
+ * @return true if obj_id was tracked (created since start).
+ */
+bool site_table_destroy(SiteTable *table, uintptr_t obj_id, uint64_t now_ns);
+
+/** Number of distinct sites. */
+[[nodiscard]]
+size_t site_table_size(const SiteTable *table);
+
+/** Number of tracked objects still alive. */
+[[nodiscard]]
+size_t site_table_live(const SiteTable *table);
+
+/**
+ * Copy every site out (unspecified order), so callers can format them
+ * without holding the table's lock.
+ *
+ * @return malloc'd array of *count entries (free() it), or nullptr on
+ *         OOM. An empty table returns a valid zero-length array.
+ */
+[[nodiscard]]
+SiteEntry* site_table_entries(const SiteTable *table, size_t *count);
+
+/** Bounds of lifetime bucket idx: [lower, upper). */
+void site_lifetime_bounds(unsigned idx, uint64_t *lower, uint64_t *upper);
+
+#endif /* TRACKING_SITES_H */
@@ -0,0 +1,148 @@
+/**
+ * Call Stack Trie (StackTrie)
+ *
+ * Deduplicated call stacks: a node is (parent node, interned frame), so
+ * one StackId (uint32_t) names a whole stack. Creation tracebacks store
+ * a StackId instead of copying frames — objects created from the same
+ * few thousand stacks share their nodes.
+ *
+ * Contract:
+ *   - child(parent, frame) returns SAME id for SAME (parent, frame)
+ *   - STACK_EMPTY (0) is the root: the empty stack
+ *   - Nodes never move or change: stack_trie_node() pointers stay valid
+ *     until destroy()
+ *   - Stacks have no depth limit
+ *
+ * Architecture:
+ *   nodes   — chunked array (STACK_TRIE_CHUNK nodes per chunk), chunks
+ *             never move; id → chunk[id / CHUNK][id % CHUNK]
+ *   index   — open-addressing table of atomic ids, as StringTable:
+ *             hits lock-free, misses insert under a mutex, resize
+ *             publishes a new array (old ones retired until destroy)
+ *
+ * Thread Safety:
+ *   All operations thread-safe. stack_trie_current() reads this thread's
+ *   frame stack (frame.h) and memoizes ids in its frame tags.
+ *
+ * Lifetime:
+ *   One trie per tracking session (frames are interned per session).
+ *
+ * C23: constexpr, nullptr, [[nodiscard]], _Atomic
+ * FAIL-FIRST: abort on allocation failure (as StringTable); a full trie
+ *             returns STACK_EMPTY (valid state, traceback dropped)
+ */
+
+#ifndef TRACKING_STACKS_H
+#define TRACKING_STACKS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "frame.h"
+
+/* ============================================================================
+ * Types
+ * ============================================================================ */
+
+/** Stack node id. 0 = empty stack. */
+typedef uint32_t StackId;
+
+constexpr StackId STACK_EMPTY = 0;
+
+/** Nodes per chunk. Power of 2. */
+constexpr uint32_t STACK_TRIE_CHUNK = 4096;
+
+/** Chunk directory size: capacity = CHUNK * MAX_CHUNKS - 1 nodes. */
+constexpr uint32_t STACK_TRIE_MAX_CHUNKS = 65536;
+
+/**
+ * One stack level. frame is the innermost frame of the stack this node
+ * names; parent names the stack below it.
+ */
+typedef struct {
+    StackFrame frame;   /* Interned file/func */
+    StackId parent;     /* STACK_EMPTY for a bottom frame */
+    uint32_t depth;     /* Frames in this stack (>= 1) */
+} StackNode;
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+/**
+ * Initialize the global trie.
+ *
+ * FAIL-FIRST: Aborts on allocation failure.
+ * Idempotent: No-op if initialized.
+ */
+void stack_trie_init(void);
+
+/**
+ * Destroy the global trie and free all nodes.
+ *
+ * Idempotent: No-op if not initialized.
+ * Precondition: no concurrent callers (hooks off).
+ */
+void stack_trie_destroy(void);
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+/**
+ * Stack extended by one frame.
+ *
+ * @param parent  Stack below (STACK_EMPTY = frame is the bottom)
+ * @param frame   Innermost frame (interned strings)
+ * @return        Node id, or STACK_EMPTY if the trie is full.
+ *
+ * FAIL-FIRST: Aborts if not initialized, parent unknown or frame nullptr.
+ */
+[[nodiscard]]
+StackId stack_trie_child(StackId parent, const StackFrame *frame);
+
+/**
+ * Id of this thread's current frame stack (frame.h).
+ *
+ * Memoized per frame via frame_stack_tag(): repeated calls in one frame
+ * are O(1), a new frame costs one child() lookup.
+ *
+ * @return Stack id, STACK_EMPTY if the stack is empty or the trie is full.
+ */
+[[nodiscard]]
+StackId stack_trie_current(void);
+
+/**
+ * Node of a stack id.
+ *
+ * @param id  Id returned by child()/current(), not STACK_EMPTY.
+ * @return    Node, valid until destroy(). Lock-free.
+ *
+ * FAIL-FIRST: Aborts if id is STACK_EMPTY or not allocated.
+ */
+[[nodiscard]]
+const StackNode* stack_trie_node(StackId id);
+
+/**
+ * Number of frames of a stack (0 for STACK_EMPTY).
+ */
+[[nodiscard]]
+static inline uint32_t stack_trie_depth(StackId id) {
+    return id == STACK_EMPTY ? 0 : stack_trie_node(id)->depth;
+}
+
+/**
+ * Number of nodes (distinct non-empty stacks).
+ */
+[[nodiscard]]
+size_t stack_trie_count(void);
+
+/**
+ * Bytes held by the trie: node chunks and index arrays.
+ * Takes the writer mutex (not for hot paths). 0 if not initialized.
+ */
+[[nodiscard]]
+size_t stack_trie_bytes(void);
+
+#endif /* TRACKING_STACKS_H */
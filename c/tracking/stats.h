@@ -0,0 +1,59 @@
+/**
+ * Tracker Self-Instrumentation
+ *
+ * Counters behind stats(): what the tracker recorded, dropped and cost,
+ * readable while tracking runs.
+ *
+ * Architecture:
+ *   ThreadStats — one per ThreadBuffer, written only by its thread
+ *                 (load + store, no read-modify-write), read by stats()
+ *                 from any thread: the hot path writes no shared line
+ *   Rare paths  — drops without a buffer, barrier refusals: global
+ *                 atomics, bumped only when they happen
+ *   Hook time   — one outermost section in STATS_HOOK_SAMPLE_EVERY per
+ *                 thread is timed; stats() extrapolates
+ *
+ * Thread Safety:
+ *   Relaxed atomics: stats() sees each counter whole (never torn), not a
+ *   consistent snapshot across counters.
+ *
+ * C23: constexpr, _Atomic, static_assert
+ */
+
+#ifndef TRACKING_STATS_H
+#define TRACKING_STATS_H
+
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "types.h"
+
+/** Event types counted separately (EventType values). */
+constexpr int STATS_EVENT_TYPES = EVENT_DESTROY + 1;
+
+/** Time one outermost section in this many per thread (power of two). */
+constexpr uint32_t STATS_HOOK_SAMPLE_EVERY = 64;
+
+static_assert((STATS_HOOK_SAMPLE_EVERY & (STATS_HOOK_SAMPLE_EVERY - 1)) == 0,
+              "STATS_HOOK_SAMPLE_EVERY must be a power of two");
+
+typedef struct {
+    _Atomic(uint64_t) events[STATS_EVENT_TYPES];   /* Records reserved, by type */
+    _Atomic(uint64_t) dropped_oom;                  /* Records that found no memory */
+    _Atomic(uint64_t) event_bytes;                  /* Record bytes, as of last publish */
+    _Atomic(uint64_t) hook_samples;                 /* Timed sections */
+    _Atomic(uint64_t) hook_ns;                      /* Time inside timed sections */
+} ThreadStats;
+
+/** Add n to a counter only the calling thread writes. */
+static inline void stats_add(_Atomic(uint64_t) *counter, uint64_t n) {
+    uint64_t value = atomic_load_explicit(counter, memory_order_relaxed);
+    atomic_store_explicit(counter, value + n, memory_order_relaxed);
+}
+
+/** Read a counter (any thread). */
+static inline uint64_t stats_get(const _Atomic(uint64_t) *counter) {
+    return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+#endif /* TRACKING_STATS_H */
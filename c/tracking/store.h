@@ -0,0 +1,249 @@
+/**
+ * Event Store
+ *
+ * Append-only chunked storage for compact variable-length Event records.
+ *
+ * Contract:
+ *   - Records NEVER move once reserved (chunks are never realloc'd)
+ *   - Record size = sizeof(Event) + arg_count * sizeof(ArgInfo), Event-aligned
+ *   - Iteration visits records in reservation order
+ *   - Merge takes records of several stores in ascending Event.seq
+ *   - OOM is a valid runtime state: reserve() returns nullptr, caller drops event
+ *
+ * Two-step append for CALL (args known only after filling):
+ *   1. reserve(store, max_args) — space for worst case, record zeroed
+ *   2. fill record, set arg_count
+ *   3. commit(store, ev)        — give back unused tail if still last record
+ *
+ * Records reserved while another one is being filled (e.g. CREATE fired by
+ * PyObject_Str() inside fill_call_event) are placed AFTER it, so event order
+ * is preserved. The outer record then simply keeps its reserved size.
+ *
+ * Streaming (one writer and one consumer, concurrently):
+ *   Writer:   reserve/commit ... publish() — records up to here become visible
+ *   Consumer: peek()/take()                — published records only, in order
+ *   The consumer releases chunks it has fully taken, so memory is bounded by
+ *   records not yet taken, not by trace length.
+ *
+ * Ownership:
+ *   Store owns record memory and out-of-line record data (aux arena:
+ *   field errors), both released in bulk by destroy() — no per-record
+ *   walk. Strings and creation stacks belong to their session tables.
+ *   Aux data of records the consumer took stays until destroy() (rare:
+ *   only events with field errors have any).
+ *
+ * Memory:
+ *   Chunks are anonymous mmaps (not malloc): the traced program's malloc
+ *   arenas see no tracker traffic, released chunks go straight back to
+ *   the OS.
+ *
+ * Thread Safety:
+ *   One writer (reserve/commit/publish) and one consumer (peek/take/merge)
+ *   may run concurrently: they touch disjoint fields, handoff via `published`.
+ *   Iteration, count() and destroy() require both to be quiescent.
+ *
+ * C23: constexpr, nullptr, [[nodiscard]], _Atomic
+ */
+
+#ifndef TRACKING_STORE_H
+#define TRACKING_STORE_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "types.h"
+#include "arena.h"
+
+/* ============================================================================
+ * Types
+ * ============================================================================ */
+
+/** Opaque chunk of contiguous records. */
+typedef struct EventChunk EventChunk;
+
+typedef struct {
+    /* Writer side */
+    EventChunk *tail;
+    size_t count;               /* Reserved records */
+    size_t bytes;               /* Record bytes reserved (excluding chunk headers) */
+    _Atomic(size_t) published;  /* Records visible to the consumer */
+    Arena aux;                  /* Out-of-line record data (writer only) */
+
+    /* Consumer side */
+    EventChunk *head;           /* Oldest chunk not yet released */
+    size_t head_offset;         /* Bytes of head already taken */
+    size_t taken;               /* Records taken */
+} EventStore;
+
+typedef struct {
+    EventChunk *chunk;
+    size_t offset;
+} EventStoreIter;
+
+/** Cursor of one store inside a merge. */
+typedef struct {
+    EventStore *store;
+    Event *head;            /* Next record of this store (seq < limit) */
+} EventStoreCursor;
+
+/** K-way merge state: binary min-heap of cursors keyed by head->seq. */
+typedef struct {
+    EventStoreCursor *cursors;
+    size_t count;           /* Non-drained cursors in heap */
+    uint64_t limit_seq;     /* Records with seq >= limit stay in their store */
+    bool pending;           /* cursors[0] was taken: refill on next call */
+} EventStoreMerge;
+
+/* ============================================================================
+ * Record layout
+ * ============================================================================ */
+
+/**
+ * Size of a record carrying arg_count trailing ArgInfo entries.
+ * Rounded up to alignof(Event) so the next record header is aligned.
+ */
+[[nodiscard]]
+static inline uint32_t event_record_size(int arg_count) {
+    size_t raw = sizeof(Event) + (size_t)arg_count * sizeof(ArgInfo);
+    size_t align = alignof(Event);
+    return (uint32_t)((raw + align - 1) & ~(align - 1));
+}
+
+/* ============================================================================
+ * Lifecycle
+ * ============================================================================ */
+
+/** Initialize empty store. No allocation until first reserve(). */
+void event_store_init(EventStore *store);
+
+/**
+ * Release all chunks and aux data, reset to empty.
+ * Does NOT free strings or stacks referenced from records (see Ownership).
+ * Idempotent.
+ */
+void event_store_destroy(EventStore *store);
+
+/* ============================================================================
+ * Append (writer)
+ * ============================================================================ */
+
+/**
+ * Reserve a zeroed record with room for max_args arguments.
+ *
+ * @param max_args  Upper bound of ArgInfo entries (0..MAX_ARGS).
+ * @return          Record with record_size set, or nullptr on OOM.
+ *
+ * FAIL-FIRST: Aborts if max_args outside [0, MAX_ARGS].
+ */
+[[nodiscard]]
+Event* event_store_reserve(EventStore *store, int max_args);
+
+/**
+ * Shrink record to its actual arg_count.
+ *
+ * No-op if another record was reserved after ev (it keeps reserved size).
+ * Optional for records reserved with max_args == 0.
+ *
+ * FAIL-FIRST: Aborts if ev->arg_count exceeds reserved capacity.
+ */
+void event_store_commit(EventStore *store, Event *ev);
+
+/**
+ * Out-of-line data for a record being filled on this thread (field errors).
+ *
+ * Comes from the aux arena of the store this thread last reserved into
+ * (one writer thread per store), so fill helpers need only the Event.
+ * Never freed individually: released by destroy().
+ *
+ * @param size  Bytes (aligned for any record data).
+ * @return      Uninitialized memory, or nullptr on OOM.
+ *
+ * FAIL-FIRST: Aborts if this thread has not reserved into a live store.
+ */
+[[nodiscard]]
+void* event_store_aux_alloc(size_t size);
+
+/**
+ * Make every record reserved so far visible to the consumer.
+ *
+ * Call only when no record is still being filled: publication has release
+ * semantics, the consumer sees complete records.
+ */
+void event_store_publish(EventStore *store);
+
+/* ============================================================================
+ * Consume (consumer)
+ * ============================================================================ */
+
+/**
+ * Next published record, without taking it.
+ *
+ * Releases chunks that are fully taken and left behind by the writer.
+ *
+ * @return Record, or nullptr if no published record remains.
+ *         Valid until the next peek()/take() on this store.
+ */
+[[nodiscard]]
+Event* event_store_peek(EventStore *store);
+
+/**
+ * Take next published record.
+ *
+ * @return Record, or nullptr if no published record remains.
+ *         Valid until the next peek()/take() on this store.
+ */
+[[nodiscard]]
+Event* event_store_take(EventStore *store);
+
+/* ============================================================================
+ * Query / Iteration
+ * ============================================================================ */
+
+/** Number of reserved records (taken ones included). */
+[[nodiscard]]
+size_t event_store_count(const EventStore *store);
+
+/** Iterator positioned before the first record not yet taken. */
+[[nodiscard]]
+EventStoreIter event_store_begin(const EventStore *store);
+
+/**
+ * Advance iterator.
+ *
+ * @return Next record, or nullptr at end.
+ */
+[[nodiscard]]
+Event* event_store_next(EventStoreIter *it);
+
+/* ============================================================================
+ * Merge (per-thread stores → global order)
+ * ============================================================================ */
+
+/**
+ * Prepare k-way merge that TAKES published records of n stores.
+ *
+ * Each store must already be ordered by seq (true for a single writer that
+ * takes seq from a monotonic counter). Complexity: O(taken · log n).
+ *
+ * @param limit_seq  Stop at records with seq >= limit_seq
+ *                   (UINT64_MAX = everything published).
+ * @return           false on OOM (merge unusable, nothing to destroy).
+ */
+[[nodiscard]]
+bool event_store_merge_init(EventStoreMerge *merge, EventStore *const *stores,
+                            size_t n, uint64_t limit_seq);
+
+/**
+ * Take the record with the smallest seq across all stores.
+ *
+ * @return Record, or nullptr when every store is drained up to the limit.
+ *         Valid until the next merge_next() call.
+ */
+[[nodiscard]]
+Event* event_store_merge_next(EventStoreMerge *merge);
+
+/** Release merge state. Idempotent. Records not taken stay in their stores. */
+void event_store_merge_destroy(EventStoreMerge *merge);
+
+#endif /* TRACKING_STORE_H */
@@ -0,0 +1,87 @@
+/**
+ * Task Table (tasks mode)
+ *
+ * start(tasks=True) records no events: completed calls and object
+ * creations/destructions are charged to the asyncio task running on the
+ * recording thread (context_task_id()), so slow or allocation-heavy
+ * requests show up without rebuilding them from events.
+ *
+ * Key:
+ *   Task id: address of the running asyncio.Task (id(task) in Python),
+ *   0 = no task (synchronous code, event loop machinery). An address may
+ *   be reused by a later task once the first one is freed.
+ *
+ * Value:
+ *   calls      completed frame evaluations (each coroutine resume counts)
+ *   own_ns     exclusive wall time of those calls: time the task ran
+ *              Python code, callees charged to their own task once
+ *   allocated  objects created while the task ran
+ *   freed      objects destroyed while the task ran
+ *
+ * Thread Safety:
+ *   None. One table per thread buffer; merged once hooks are off. A task
+ *   runs on its loop's thread, so its row lives in one table.
+ *
+ * C23: nullptr, [[nodiscard]]
+ * FAIL-FIRST: abort on contract violation; OOM returns false (valid state)
+ */
+
+#ifndef TRACKING_TASKS_H
+#define TRACKING_TASKS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    uint64_t calls;
+    uint64_t own_ns;
+    uint64_t allocated;
+    uint64_t freed;
+} TaskStats;
+
+/** Opaque: verstable task id → TaskStats (defined in tasks.c). */
+typedef struct TaskTable TaskTable;
+
+/** Visitor of task_table_each(); returns false to stop. */
+typedef bool (*TaskVisitor)(uint64_t task, const TaskStats *stats, void *ctx);
+
+/** @return New empty table, or nullptr on OOM. */
+[[nodiscard]]
+TaskTable* task_table_new(void);
+
+/** Free table. nullptr is a no-op. */
+void task_table_free(TaskTable *table);
+
+/**
+ * Charge one completed call of own_ns exclusive time to task.
+ * @return false on OOM (call not counted).
+ */
+[[nodiscard]]
+bool task_table_add_call(TaskTable *table, uint64_t task, uint64_t own_ns);
+
+/**
+ * Charge one object creation (created) or destruction (!created) to task.
+ * @return false on OOM (object not counted).
+ */
+[[nodiscard]]
+bool task_table_add_object(TaskTable *table, uint64_t task, bool created);
+
+/**
+ * Add every task of src into dst (sums all counters).
+ * @return false on OOM (dst holds a partial merge).
+ */
+[[nodiscard]]
+bool task_table_merge(TaskTable *dst, const TaskTable *src);
+
+/** Number of distinct tasks. */
+[[nodiscard]]
+size_t task_table_size(const TaskTable *table);
+
+/**
+ * Visit every task (unspecified order).
+ * @return false if the visitor stopped early.
+ */
+bool task_table_each(const TaskTable *table, TaskVisitor visit, void *ctx);
+
+#endif /* TRACKING_TASKS_H */
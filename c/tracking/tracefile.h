@@ -0,0 +1,183 @@
+/**
+ * Binary Trace File (writer)
+ *
+ * On-disk format for long captures: events go straight to a file instead of
+ * Python dicts. Read back by archcheck.infrastructure.tracefile (mmap).
+ *
+ * Layout (host byte order, checked via header.byte_order):
+ *
+ *   TraceHeader                     32 bytes
+ *   TraceRecord[record_count]       48 bytes each, fixed width
+ *   string section                  string_count × {uint32 len; char[len]},
+ *                                   zero-padded to 8 bytes
+ *   TraceFooter                     48 bytes, at end of file (index)
+ *
+ * Records:
+ *   One primary record per event (kind = EventType), followed by `extra`
+ *   aux records owned by it. Fixed width: record i is at
+ *   records_offset + i * sizeof(TraceRecord), no per-record framing.
+ *
+ *   kind      file        func        type        id        caller_*
+ *   CALL      location    location    —           —         caller
+ *   RETURN    location    location    ret type    ret id    —
+ *   CREATE    location    location    type        obj id    —
+ *   DESTROY   location    location    type        obj id    —
+ *   ARG       —           arg name    arg type    arg id    —
+ *   CREATION  location    location    type        —         — (extra = FRAMEs)
+ *   FRAME     location    location    —           —         —
+ *   ERROR     field       message     exc type    —         —
+ *
+ *   CALL:    ARG × arg_count, then ERROR × error_count
+ *   DESTROY: [CREATION, FRAME × depth] if creation known, then ERROR × n
+ *            (depth capped at TRACE_MAX_FRAMES, innermost frames kept)
+ *   others:  ERROR × error_count
+ *
+ * Strings:
+ *   String id 0 = nullptr; ids 1..string_count index the string section in
+ *   order. Writer dedups by pointer: interned strings (StringTable) and
+ *   tp_name get one id each; field error strings are copied per error.
+ *
+ * Ownership:
+ *   Writer copies strings into its own buffer on first sight, so records may
+ *   be released right after trace_writer_event(); the StringTable may be
+ *   destroyed after trace_writer_close().
+ *
+ * Thread Safety:
+ *   None. One writer per file (caller serializes, see drain_mutex).
+ *
+ * C23: constexpr, nullptr, [[nodiscard]], static_assert
+ * FAIL-FIRST: abort on contract violation; I/O and OOM errors are sticky,
+ *             reported by close() (errno preserved)
+ */
+
+#ifndef TRACKING_TRACEFILE_H
+#define TRACKING_TRACEFILE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "types.h"
+
+/* ============================================================================
+ * On-disk format
+ * ============================================================================ */
+
+/** Bumped on any incompatible layout change. */
+constexpr uint32_t TRACE_FORMAT_VERSION = 1;
+
+/** Written as-is; reader sees 0x04030201 on a foreign byte order. */
+constexpr uint32_t TRACE_BYTE_ORDER = 0x01020304;
+
+#define TRACE_HEADER_MAGIC "ARCHTRC"    /* + NUL = 8 bytes */
+#define TRACE_FOOTER_MAGIC "ARCHEND"
+
+typedef enum {
+    /* Primary records: same values as EventType */
+    TRACE_CALL     = EVENT_CALL,
+    TRACE_RETURN   = EVENT_RETURN,
+    TRACE_CREATE   = EVENT_CREATE,
+    TRACE_DESTROY  = EVENT_DESTROY,
+
+    /* Aux records (follow their primary record) */
+    TRACE_ARG      = 16,
+    TRACE_CREATION = 17,
+    TRACE_FRAME    = 18,
+    TRACE_ERROR    = 19,
+} TraceKind;
+
+/** TraceRecord.flags */
+constexpr uint8_t TRACE_HAS_CALLER = 1 << 0;   /* CALL: caller_* valid */
+constexpr uint8_t TRACE_HAS_VALUE  = 1 << 1;   /* RETURN: id/type valid */
+
+typedef struct {
+    char magic[8];              /* TRACE_HEADER_MAGIC */
+    uint32_t version;           /* TRACE_FORMAT_VERSION */
+    uint32_t record_size;       /* sizeof(TraceRecord) */
+    uint32_t byte_order;        /* TRACE_BYTE_ORDER */
+    uint32_t reserved[3];
+} TraceHeader;
+
+typedef struct {
+    uint8_t kind;               /* TraceKind */
+    uint8_t flags;              /* TRACE_HAS_* */
+    uint16_t extra;             /* Aux records following this one */
+    int32_t line;
+    uint64_t seq;               /* Primary: Event.seq */
+    uint64_t id;                /* Object id (see table above) */
+    uint32_t file;              /* String ids (0 = nullptr) */
+    uint32_t func;
+    uint32_t type;
+    int32_t caller_line;
+    uint32_t caller_file;
+    uint32_t caller_func;
+} TraceRecord;
+
+typedef struct {
+    uint64_t records_offset;
+    uint64_t record_count;      /* Primary + aux records */
+    uint64_t event_count;       /* Primary records only */
+    uint64_t strings_offset;
+    uint64_t string_count;
+    char magic[8];              /* TRACE_FOOTER_MAGIC */
+} TraceFooter;
+
+static_assert(sizeof(TraceHeader) == 32, "TraceHeader layout is on-disk format");
+static_assert(sizeof(TraceRecord) == 48, "TraceRecord layout is on-disk format");
+static_assert(sizeof(TraceFooter) == 48, "TraceFooter layout is on-disk format");
+/** Creation traceback frames a DESTROY can carry (extra is uint16_t). */
+constexpr uint32_t TRACE_MAX_FRAMES = UINT16_MAX - 1 - MAX_FIELD_ERRORS;
+
+static_assert(MAX_ARGS + MAX_FIELD_ERRORS <= UINT16_MAX, "TraceRecord.extra is uint16_t");
+
+/* ============================================================================
+ * Writer
+ * ============================================================================ */
+
+/** String dedup map: pointer → id (defined in tracefile.c). */
+typedef struct TraceStringIds TraceStringIds;
+
+typedef struct {
+    FILE *file;
+    TraceStringIds *ids;
+    char *strings;              /* String section, written by close() */
+    size_t strings_len;
+    size_t strings_cap;
+    uint32_t string_count;
+    uint64_t record_count;
+    uint64_t event_count;
+    int error;                  /* First errno seen, 0 = none */
+} TraceWriter;
+
+/**
+ * Create file at path and write its header.
+ *
+ * @return false with errno set (writer unusable, nothing to close).
+ */
+[[nodiscard]]
+bool trace_writer_open(TraceWriter *w, const char *path);
+
+/**
+ * Append one event with its aux records.
+ *
+ * @return false once an I/O or OOM error occurred (sticky).
+ */
+bool trace_writer_event(TraceWriter *w, const Event *ev);
+
+/**
+ * Write string section and footer, close file, release writer.
+ *
+ * @return false with errno set if any write failed (file left incomplete).
+ */
+[[nodiscard]]
+bool trace_writer_close(TraceWriter *w);
+
+/**
+ * Release writer WITHOUT writing anything still buffered (no footer).
+ * For a forked child: the parent owns the file and its buffered records,
+ * flushing the child's copy would duplicate them.
+ */
+void trace_writer_abandon(TraceWriter *w);
+
+#endif /* TRACKING_TRACEFILE_H */
@@ -1,17 +1,17 @@
 #ifndef TRACKING_TYPES_H
 #define TRACKING_TYPES_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 #include "constants.h"
+#include "frame.h"
 
 /* ============================================================================
  * C23 static_assert for compile-time invariants
  * ============================================================================ */
 
 static_assert(MAX_ARGS > 0, "MAX_ARGS must be positive");
-static_assert(MAX_TRACEBACK_DEPTH > 0, "MAX_TRACEBACK_DEPTH must be positive");
-static_assert(MAX_STACK_DEPTH > 0, "MAX_STACK_DEPTH must be positive");
 static_assert(MAX_FIELD_ERRORS > 0, "MAX_FIELD_ERRORS must be positive");
 static_assert(ERROR_MSG_LEN >= 64, "ERROR_MSG_LEN too small");
 static_assert(ERROR_FIELD_LEN >= 16, "ERROR_FIELD_LEN too small");
@@ -19,13 +19,12 @@ static_assert(CTX_BUFFER_SIZE >= 64, "CTX_BUFFER_SIZE too small for context stri
 
 /* ============================================================================
  * Frame location
+ *
+ * Same layout as StackFrame (frame.h): file/func are INTERNED via
+ * StringTable. Do NOT free — released by string_table_destroy().
  * ============================================================================ */
 
-typedef struct {
-    char *file;  /* Heap-allocated, must free */
-    int line;
-    char *func;  /* Heap-allocated, must free */
-} FrameInfo;
+typedef StackFrame FrameInfo;
 
 /* ============================================================================
  * Error captured during event processing
@@ -39,12 +38,13 @@ typedef struct {
 
 /* ============================================================================
  * Creation info stored in hash table
+ *
+ * The traceback is a StackTrie id (stacks.h): location = top node's frame,
+ * traceback = node → root. Shared by every object created from that stack.
  * ============================================================================ */
 
 typedef struct {
-    FrameInfo location;
-    FrameInfo traceback[MAX_TRACEBACK_DEPTH];
-    int traceback_depth;
+    uint32_t stack;             /* StackId, 0 = empty stack (no location) */
     const char *type_name_ref;  /* Borrowed from tp_name, do NOT free */
 } CreationInfo;
 
@@ -53,7 +53,7 @@ typedef struct {
  * ============================================================================ */
 
 typedef struct {
-    char *name_owned;           /* Heap-allocated via strdup, must free */
+    const char *name_ref;       /* Interned (StringTable), do NOT free */
     uintptr_t id;
     const char *type_ref;       /* Borrowed from tp_name, do NOT free */
 } ArgInfo;
@@ -84,30 +84,57 @@ static inline const char* event_type_name(EventType ev) {
 }
 
 /* ============================================================================
- * Event record
+ * Event record (compact, variable-length)
+ *
+ * Fixed header shared by all EventTypes; type-specific fields overlap in a
+ * union. CALL arguments trail the header (args[arg_count]), field errors are
+ * allocated out-of-line (store aux arena) only when one is captured.
+ *
+ *   CREATE/RETURN/DESTROY: sizeof(Event)
+ *   CALL:                  sizeof(Event) + arg_count * sizeof(ArgInfo)
+ *
+ * Records live in EventStore (store.h); never allocate Event by value.
  * ============================================================================ */
 
 typedef struct {
     EventType type;
-    uintptr_t obj_id;
+    uint32_t record_size;       /* Bytes occupied in EventStore, set by store */
+    uint64_t seq;               /* Global sequence number (order across threads) */
+    uintptr_t obj_id;           /* CREATE/DESTROY: object, RETURN: return value */
     const char *type_name_ref;  /* Borrowed from tp_name, do NOT free */
 
     /* Location of this event */
     FrameInfo location;
 
-    /* For CALL: caller info */
-    FrameInfo caller;
+    union {
+        /* CALL: caller info */
+        FrameInfo caller;
+
+        /* DESTROY: where object was created (valid if has_creation) */
+        struct {
+            CreationInfo creation;
+            bool has_creation;
+        };
+    };
 
-    /* For CALL: arguments */
-    ArgInfo args[MAX_ARGS];
-    int arg_count;
+    /* Errors captured during this event (store aux arena, nullptr if none) */
+    FieldError *errors;
+    uint16_t error_count;
 
-    /* For DESTROY: where object was created */
-    CreationInfo *creation_info;
+    /* CALL: number of trailing args */
+    uint16_t arg_count;
 
-    /* Errors captured during this event */
-    FieldError errors[MAX_FIELD_ERRORS];
-    int error_count;
+    /* Recording thread: index of its buffer in this session (0 = first) */
+    uint32_t thread;
+
+    /* asyncio task running when recorded (context_task_id(), 0 = none) */
+    uint64_t task;
+
+    /* CALL: arguments (flexible array member) */
+    ArgInfo args[];
 } Event;
 
+static_assert(MAX_ARGS <= UINT16_MAX, "arg_count is uint16_t");
+static_assert(MAX_FIELD_ERRORS <= UINT16_MAX, "error_count is uint16_t");
+
 #endif /* TRACKING_TYPES_H */
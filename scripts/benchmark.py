@@ -1,21 +1,46 @@
 #!/usr/bin/env python3
 """Benchmark script for archcheck performance testing.
 
-Outputs results in JSON format compatible with github-action-benchmark.
+Outputs results in JSON format compatible with github-action-benchmark
+(customSmallerIsBetter: every value is a cost).
+
+End-to-end overhead: each workload (call-heavy, allocation-heavy, async,
+multithreaded) runs untracked and under each tracking mode, every pair in
+its own subprocess so peak RSS belongs to that pair alone. Reported per
+workload and mode:
+    slowdown     tracked / untracked wall time (best of --repeat)
+    ns/event     extra time per event the full events mode records for
+                 the workload (same denominator for all modes, so modes
+                 that record less show what they save)
+    stop()       latency of the mode's stop function
+    peak RSS     of the subprocess (untracked runs included)
+
+C primitive microbenchmarks (tests/c/bench_primitives.c, `make -C
+tests/c bench`) write the same JSON format; --c-results merges them.
 """
 
 from __future__ import annotations
 
 import argparse
+import asyncio
 import importlib
 import json
+import resource
+import subprocess
 import sys
+import tempfile
+import threading
 import time
+from dataclasses import dataclass, field
 from pathlib import Path
+from typing import TYPE_CHECKING, Any
 
 from archcheck.domain.events import CallEvent, Location
 from archcheck.infrastructure import tracking
 
+if TYPE_CHECKING:
+    from collections.abc import Callable
+
 
 def benchmark_import_time() -> float:
     """Measure import time of archcheck package (already imported, measures reimport)."""
@@ -50,6 +75,211 @@ def benchmark_tracking() -> float:
     return elapsed
 
 
+# =============================================================================
+# End-to-end workloads
+# =============================================================================
+
+
+def _leaf(x: int) -> int:
+    return x + 1
+
+
+def _branch(x: int) -> int:
+    return _leaf(x) + _leaf(x + 1)
+
+
+def workload_calls() -> None:
+    """Call-heavy: 60k short Python calls, nothing allocated per call."""
+    total = 0
+    for i in range(20_000):
+        total += _branch(i)
+
+
+class _Node:
+    __slots__ = ("value",)
+
+    def __init__(self, value: int) -> None:
+        self.value = value
+
+
+def workload_allocs() -> None:
+    """Allocation-heavy: 20k objects created and destroyed in batches."""
+    for batch in range(200):
+        nodes = [_Node(batch + i) for i in range(100)]
+        del nodes
+
+
+async def _task(n: int) -> int:
+    total = 0
+    for i in range(10):
+        await asyncio.sleep(0)
+        total += _leaf(n + i)
+    return total
+
+
+def workload_async() -> None:
+    """Async: 500 tasks, 10 suspensions each, on one event loop."""
+
+    async def main() -> None:
+        await asyncio.gather(*(_task(n) for n in range(500)))
+
+    asyncio.run(main())
+
+
+def workload_threads() -> None:
+    """Multithreaded: 4 threads running the call-heavy loop at 1/4 size."""
+
+    def run() -> None:
+        total = 0
+        for i in range(5_000):
+            total += _branch(i)
+
+    threads = [threading.Thread(target=run) for _ in range(4)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+
+
+WORKLOADS: dict[str, Callable[[], None]] = {
+    "calls": workload_calls,
+    "allocs": workload_allocs,
+    "async": workload_async,
+    "threads": workload_threads,
+}
+
+
+# =============================================================================
+# Tracking modes
+# =============================================================================
+
+
+@dataclass(frozen=True, slots=True)
+class Mode:
+    """tracking.start() options and the stop function collecting them."""
+
+    start: dict[str, Any] = field(default_factory=dict)
+    stop: Callable[[], object] = tracking.stop
+    trace_file: bool = False
+
+
+MODES: dict[str, Mode] = {
+    "events": Mode(),
+    "no_args": Mode(start={"capture_args": False}),
+    "sampled": Mode(start={"sample_every": 16}),
+    "monitoring": Mode(start={"backend": "monitoring"}),
+    "trace_file": Mode(trace_file=True),
+    "aggregate": Mode(start={"aggregate": True}, stop=tracking.stop_call_graph),
+    "profile": Mode(start={"profile": True}, stop=tracking.stop_profile),
+    "alloc_sites": Mode(start={"alloc_sites": True}, stop=tracking.stop_allocations),
+    "tasks": Mode(start={"tasks": True}, stop=tracking.stop_tasks),
+}
+
+
+def _peak_rss_mib() -> float:
+    """Peak RSS of this process (ru_maxrss: KiB on Linux, bytes on macOS)."""
+    peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    return peak / (1024 * 1024) if sys.platform == "darwin" else peak / 1024
+
+
+def _event_count(result: object) -> int:
+    """Events in a stop() result (0 for modes that record none)."""
+    events = getattr(result, "events", None)
+    return 0 if events is None else len(events)
+
+
+def measure(workload: str, mode_name: str, repeat: int) -> dict[str, float]:
+    """Time one workload untracked and under one mode (run in a subprocess)."""
+    run = WORKLOADS[workload]
+    mode = MODES[mode_name]
+    run()  # warm-up: imports, code objects, specialization
+
+    untracked = min(_timed(run) for _ in range(repeat))
+    tracked, stop, events = float("inf"), float("inf"), 0
+    with tempfile.TemporaryDirectory() as tmp:
+        for _ in range(repeat):
+            options = dict(mode.start)
+            if mode.trace_file:
+                options["trace_path"] = Path(tmp) / "bench.trace"
+            tracking.start(**options)
+            elapsed = _timed(run)
+            stop_start = time.perf_counter()
+            result = mode.stop()
+            stop = min(stop, time.perf_counter() - stop_start)
+            tracked = min(tracked, elapsed)
+            events = _event_count(result)
+            del result
+    return {
+        "untracked_s": untracked,
+        "tracked_s": tracked,
+        "stop_s": stop,
+        "events": events,
+        "peak_rss_mib": _peak_rss_mib(),
+    }
+
+
+def _timed(run: Callable[[], None]) -> float:
+    start = time.perf_counter()
+    run()
+    return time.perf_counter() - start
+
+
+def _measure_subprocess(workload: str, mode: str, repeat: int) -> dict[str, float]:
+    """measure() in a fresh interpreter (own peak RSS, no leftover state)."""
+    completed = subprocess.run(  # noqa: S603 - runs this script with fixed arguments
+        [sys.executable, __file__, "--measure", workload, mode, "--repeat", str(repeat)],
+        capture_output=True,
+        text=True,
+        check=True,
+    )
+    return json.loads(completed.stdout)
+
+
+def benchmark_end_to_end(
+    workloads: list[str], modes: list[str], repeat: int
+) -> list[dict[str, Any]]:
+    """Overhead entries for every workload x mode pair."""
+    results: list[dict[str, Any]] = []
+    for workload in workloads:
+        # Full events mode first: its event count is the ns/event denominator
+        runs = {"events": _measure_subprocess(workload, "events", repeat)}
+        for mode in modes:
+            if mode not in runs:
+                runs[mode] = _measure_subprocess(workload, mode, repeat)
+        events = max(int(runs["events"]["events"]), 1)
+        untracked = runs["events"]["untracked_s"]
+        results.append(
+            {"name": f"E2E {workload}: untracked", "unit": "ms", "value": untracked * 1e3}
+        )
+        for mode in modes:
+            run = runs[mode]
+            prefix = f"E2E {workload}/{mode}"
+            extra_ns = max(run["tracked_s"] - run["untracked_s"], 0.0) * 1e9
+            results += [
+                {
+                    "name": f"{prefix}: slowdown",
+                    "unit": "x",
+                    "value": run["tracked_s"] / run["untracked_s"],
+                },
+                {"name": f"{prefix}: overhead", "unit": "ns/event", "value": extra_ns / events},
+                {"name": f"{prefix}: stop()", "unit": "ms", "value": run["stop_s"] * 1e3},
+                {"name": f"{prefix}: peak RSS", "unit": "MiB", "value": run["peak_rss_mib"]},
+            ]
+    return results
+
+
+def _names(value: str, choices: dict[str, object]) -> list[str]:
+    """Parse a comma-separated subset of choices ("all" = every choice)."""
+    if value == "all":
+        return list(choices)
+    names = value.split(",")
+    unknown = [name for name in names if name not in choices]
+    if unknown:
+        msg = f"unknown {', '.join(unknown)} (choose from {', '.join(choices)})"
+        raise argparse.ArgumentTypeError(msg)
+    return names
+
+
 def main() -> None:
     """Run benchmarks and output results."""
     parser = argparse.ArgumentParser(description="Run archcheck benchmarks")
@@ -59,8 +289,34 @@ def main() -> None:
         default=Path("benchmark-results.json"),
         help="Output file for benchmark results",
     )
+    parser.add_argument(
+        "--c-results",
+        type=Path,
+        action="append",
+        default=[],
+        help="Merge results of `make -C tests/c bench` (repeatable)",
+    )
+    parser.add_argument(
+        "--workloads",
+        type=lambda value: _names(value, WORKLOADS),
+        default=list(WORKLOADS),
+        help=f"Comma-separated end-to-end workloads ({', '.join(WORKLOADS)}; default all)",
+    )
+    parser.add_argument(
+        "--modes",
+        type=lambda value: _names(value, MODES),
+        default=list(MODES),
+        help=f"Comma-separated tracking modes ({', '.join(MODES)}; default all)",
+    )
+    parser.add_argument("--repeat", type=int, default=3, help="Runs per measurement (best)")
+    parser.add_argument("--measure", nargs=2, metavar=("WORKLOAD", "MODE"), help=argparse.SUPPRESS)
     args = parser.parse_args()
 
+    if args.measure:
+        workload, mode = args.measure
+        sys.stdout.write(json.dumps(measure(workload, mode, args.repeat)) + "\n")
+        return
+
     results = []
 
     # Import time
@@ -93,6 +349,13 @@ def main() -> None:
         },
     )
 
+    # End-to-end workloads x tracking modes
+    results += benchmark_end_to_end(args.workloads, args.modes, args.repeat)
+
+    # C primitives
+    for path in args.c_results:
+        results += json.loads(path.read_text())
+
     # Write results
     args.output.write_text(json.dumps(results, indent=2))
     sys.stdout.write(f"Benchmark results written to {args.output}\n")
@@ -1,5 +1,41 @@
-def start() -> None: ...
-def stop() -> dict[str, object]: ...
+import os
+from collections.abc import Mapping, Sequence
+
+def start(
+    *,
+    trace_path: str | bytes | os.PathLike[str] | None = None,
+    sample_every: int = 1,
+    sample_interval_ns: int = 0,
+    max_calls_per_code: int = 0,
+    include_paths: Sequence[str] | None = None,
+    exclude_paths: Sequence[str] | None = None,
+    include_types: Sequence[str] | None = None,
+    aggregate: bool = False,
+    aggregate_time: bool = False,
+    profile: bool = False,
+    profile_clock: str | None = None,
+    alloc_sites: bool = False,
+    capture_args: bool = True,
+    backend: str | None = None,
+    shm_name: str | None = None,
+    tasks: bool = False,
+) -> None: ...
+def stop(*, columnar: bool = False, prefer_columnar: bool = False) -> dict[str, object]: ...
+def drain(max_events: int, /) -> dict[str, object]: ...
+def flush(max_events: int, /) -> int: ...
 def count() -> int: ...
+def snapshot() -> dict[str, object]: ...
+def stats() -> dict[str, object]: ...
 def is_active() -> bool: ...
 def get_origin(obj: object) -> dict[str, object] | None: ...
+def shm_create(name: str, /, *, rings: int = 64, ring_bytes: int = 1048576) -> object: ...
+def shm_poll(handle: object, max_events: int, /) -> dict[str, object]: ...
+def shm_close(handle: object, /) -> None: ...
+def analyze_columns(
+    columns: Mapping[str, object],
+    /,
+    *,
+    kinds: int = 15,
+    file_pass: object | None = None,
+    workers: int = 1,
+) -> dict[str, object]: ...
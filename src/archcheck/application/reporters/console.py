@@ -8,13 +8,16 @@ from io import StringIO
 from typing import TYPE_CHECKING
 
 from rich.console import Console
+from rich.table import Table
 
 from archcheck.application.reporters.strategies import (
     ByTypeStrategy,
     GroupStrategy,
     format_location_short,
 )
+from archcheck.application.reporters.topk import TopKCounter
 from archcheck.domain.events import (
+    CallEvent,
     CreateEvent,
     DestroyEvent,
     EventType,
@@ -22,7 +25,7 @@ from archcheck.domain.events import (
 )
 
 if TYPE_CHECKING:
-    from collections.abc import Mapping
+    from collections.abc import Iterator, Mapping, Sequence
 
     from archcheck.domain.events import Event, TrackingResult
 
@@ -43,6 +46,10 @@ class ConsoleConfig:
         include_types: Event types to include. None = all types.
         exclude_paths: Glob patterns for files to exclude.
         width: Console output width in characters.
+        top_k: Summarise instead of listing events: the top_k hottest
+            functions, busiest files and most-allocated types, counted in
+            bounded memory (group_by and lifecycle section not used).
+            None = list every event.
     """
 
     show_lifecycle: bool = True
@@ -52,6 +59,13 @@ class ConsoleConfig:
     include_types: frozenset[EventType] | None = None
     exclude_paths: tuple[str, ...] = ()
     width: int = 120
+    top_k: int | None = None
+
+    def __post_init__(self) -> None:
+        """Validate top_k."""
+        if self.top_k is not None and self.top_k < 1:
+            msg = f"top_k must be >= 1, got {self.top_k}"
+            raise ValueError(msg)
 
 
 @dataclass(frozen=True, slots=True)
@@ -62,6 +76,11 @@ class _Summary:
     by_type: Mapping[str, int]
 
 
+# Keys kept per top-K counter: slack over K keeps the reported ranks exact
+# unless the key distribution is very flat
+_TOP_K_SLACK = 16
+
+
 class ConsoleReporter:
     """Console reporter: outputs rich formatted text.
 
@@ -89,6 +108,10 @@ class ConsoleReporter:
         output = StringIO()
         console = Console(file=output, force_terminal=True, width=self._config.width)
 
+        if self._config.top_k is not None:
+            self._render_top(console, result, self._config.top_k)
+            return output.getvalue()
+
         events = self._filter_events(result.events)
         summary = self._build_summary(events)
 
@@ -103,12 +126,15 @@ class ConsoleReporter:
 
         return output.getvalue()
 
-    def _filter_events(self, events: tuple[Event, ...]) -> tuple[Event, ...]:
+    def _filter_events(self, events: Sequence[Event]) -> tuple[Event, ...]:
         """Filter events by config. Only explicit config filters applied."""
-        filtered: list[Event] = []
+        return tuple(self._iter_filtered(events))
 
+    def _iter_filtered(self, events: Sequence[Event]) -> Iterator[Event]:
+        """Events passing config filters, one at a time (max_events honoured)."""
+        kept = 0
         for event in events:
-            if self._config.max_events is not None and len(filtered) >= self._config.max_events:
+            if self._config.max_events is not None and kept >= self._config.max_events:
                 break
 
             event_type = get_event_type(event)
@@ -120,9 +146,54 @@ class ConsoleReporter:
                 if any(fnmatch.fnmatch(file_path, p) for p in self._config.exclude_paths):
                     continue
 
-            filtered.append(event)
+            kept += 1
+            yield event
+
+    def _render_top(self, console: Console, result: TrackingResult, k: int) -> None:
+        """Render summary and top-K tables; events streamed, never all held."""
+        capacity = k * _TOP_K_SLACK
+        functions = TopKCounter(capacity)
+        files = TopKCounter(capacity)
+        types = TopKCounter(capacity)
+        by_type: dict[str, int] = {}
+
+        for event in self._iter_filtered(result.events):
+            event_type = get_event_type(event).value
+            by_type[event_type] = by_type.get(event_type, 0) + 1
+            files.add(event.location.file or "<unknown>")
+            match event:
+                case CallEvent():
+                    functions.add(format_location_short(event.location))
+                case CreateEvent():
+                    types.add(event.type_name)
+
+        self._render_header(console, _Summary(total=sum(by_type.values()), by_type=by_type))
+        self._render_top_table(console, "HOTTEST FUNCTIONS", "Calls", functions, k)
+        self._render_top_table(console, "BUSIEST FILES", "Events", files, k)
+        self._render_top_table(console, "MOST ALLOCATED TYPES", "Created", types, k)
+
+        if result.output_errors:
+            self._render_errors(console, result)
+
+    def _render_top_table(
+        self, console: Console, title: str, unit: str, counter: TopKCounter, k: int
+    ) -> None:
+        """Render one top-K table; approximate counts marked with their error."""
+        entries = counter.top(k)
+        if not entries:
+            return
 
-        return tuple(filtered)
+        console.print(f"[bold]{title}[/bold] (top {len(entries)} of {counter.total})")
+        table = Table(show_header=True, header_style="bold", box=None)
+        table.add_column(unit, justify="right")
+        table.add_column("Share", justify="right", style="dim")
+        table.add_column("Key", style="cyan")
+        for entry in entries:
+            count = f"{entry.count} (±{entry.error})" if entry.error else str(entry.count)
+            share = f"{100 * entry.count / counter.total:.1f}%"
+            table.add_row(count, share, entry.key)
+        console.print(table)
+        console.print()
 
     def _build_summary(self, events: tuple[Event, ...]) -> _Summary:
         """Build summary statistics."""
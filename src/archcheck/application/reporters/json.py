@@ -1,4 +1,4 @@
-"""JSON reporter: TrackingResult → JSON string."""
+"""JSON reporter: TrackingResult → JSON string, or streamed to a text stream."""
 
 from __future__ import annotations
 
@@ -15,6 +15,9 @@ from archcheck.domain.events import (
 )
 
 if TYPE_CHECKING:
+    from collections.abc import Iterator
+    from typing import TextIO
+
     from archcheck.domain.events import (
         ArgInfo,
         CreationInfo,
@@ -57,6 +60,75 @@ class JsonReporter:
         return json.dumps(data, indent=self._indent)
 
 
+class JsonExporter:
+    """Streaming JSON exporter: writes one event at a time, O(1) memory.
+
+    Same document as JsonReporter (events, output_errors, summary), one
+    event per line; the summary is counted while writing and comes last.
+    ndjson=True writes one JSON object per line instead:
+    {"event": ...}, then {"output_error": ...}, then {"summary": ...}.
+
+    out is any text stream: open(path, "w"), sys.stdout,
+    socket.makefile("w"). Not flushed or closed here.
+    """
+
+    def __init__(self, *, ndjson: bool = False) -> None:
+        """Initialize exporter.
+
+        Args:
+            ndjson: Newline-delimited records instead of one JSON document.
+        """
+        self._ndjson = ndjson
+
+    def export(self, result: TrackingResult, out: TextIO) -> int:
+        """Write tracking result to out.
+
+        Lazy events (stop()) are built one at a time while writing.
+
+        Args:
+            result: Tracking result to write.
+            out: Destination text stream.
+
+        Returns:
+            Number of events written.
+        """
+        by_type: dict[str, int] = {}
+        events = (self._count(event, by_type) for event in result.events)
+        errors = (_output_error_to_dict(e) for e in result.output_errors)
+
+        if self._ndjson:
+            for record in events:
+                out.write(json.dumps({"event": record}) + "\n")
+            for record in errors:
+                out.write(json.dumps({"output_error": record}) + "\n")
+        else:
+            out.write('{"events": [')
+            _write_items(out, events)
+            out.write('],\n"output_errors": [')
+            _write_items(out, errors)
+            out.write("],\n")
+
+        total = sum(by_type.values())
+        summary = json.dumps({"total": total, "by_type": by_type})
+        out.write(f'{{"summary": {summary}}}\n' if self._ndjson else f'"summary": {summary}}}\n')
+        return total
+
+    @staticmethod
+    def _count(event: Event, by_type: dict[str, int]) -> dict[str, object]:
+        type_name = get_event_type(event).value
+        by_type[type_name] = by_type.get(type_name, 0) + 1
+        return _event_to_dict(event)
+
+
+def _write_items(out: TextIO, items: Iterator[dict[str, object]]) -> None:
+    """Write items as JSON array elements, one per line."""
+    separator = "\n"
+    for item in items:
+        out.write(separator)
+        out.write(json.dumps(item))
+        separator = ",\n"
+
+
 def _build_summary(result: TrackingResult) -> dict[str, object]:
     """Build summary statistics."""
     by_type: dict[str, int] = {}
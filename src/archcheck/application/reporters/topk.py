@@ -0,0 +1,91 @@
+"""Bounded top-K counting for summarising reporters.
+
+TopKCounter keeps at most 2 * capacity keys however many distinct keys
+are added (Space-Saving with batched eviction): when full, the capacity
+heaviest keys are kept and the largest evicted count becomes the floor.
+A key seen again after eviction restarts at floor + weight, with floor
+recorded as its possible overcount.
+
+Guarantee: a key's true count lies in [count - error, count]; any key
+heavier than the floor is tracked.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+
+
+@dataclass(frozen=True, slots=True)
+class TopKEntry:
+    """One counted key.
+
+    Attributes:
+        key: Counted key.
+        count: Upper bound of the true count.
+        error: count - error is a lower bound (0 = exact).
+    """
+
+    key: str
+    count: int
+    error: int
+
+
+class TopKCounter:
+    """Approximate heavy-hitter counts in O(capacity) memory.
+
+    Exact while at most 2 * capacity distinct keys were added.
+    """
+
+    __slots__ = ("_capacity", "_counts", "_errors", "_floor", "_total")
+
+    def __init__(self, capacity: int) -> None:
+        """Initialize empty counter.
+
+        Args:
+            capacity: Keys kept after each eviction (at least the K reported).
+
+        Raises:
+            ValueError: capacity < 1.
+        """
+        if capacity < 1:
+            msg = f"capacity must be >= 1, got {capacity}"
+            raise ValueError(msg)
+        self._capacity = capacity
+        self._counts: dict[str, int] = {}
+        self._errors: dict[str, int] = {}
+        self._floor = 0
+        self._total = 0
+
+    @property
+    def total(self) -> int:
+        """Sum of all weights added (exact)."""
+        return self._total
+
+    def add(self, key: str, weight: int = 1) -> None:
+        """Count weight for key."""
+        self._total += weight
+        count = self._counts.get(key)
+        if count is not None:
+            self._counts[key] = count + weight
+            return
+        if len(self._counts) >= 2 * self._capacity:
+            self._evict()
+        self._counts[key] = self._floor + weight
+        if self._floor:
+            self._errors[key] = self._floor
+
+    def top(self, k: int) -> list[TopKEntry]:
+        """Up to k heaviest keys, heaviest first."""
+        heaviest = sorted(self._counts.items(), key=lambda item: item[1], reverse=True)[:k]
+        return [
+            TopKEntry(key=key, count=count, error=self._errors.get(key, 0))
+            for key, count in heaviest
+        ]
+
+    def _evict(self) -> None:
+        """Keep the capacity heaviest keys; floor = largest evicted count."""
+        ranked = sorted(self._counts.items(), key=lambda item: item[1], reverse=True)
+        kept, evicted = ranked[: self._capacity], ranked[self._capacity :]
+        self._floor = max(self._floor, evicted[0][1])
+        self._counts = dict(kept)
+        self._errors = {key: self._errors[key] for key, _ in kept if key in self._errors}
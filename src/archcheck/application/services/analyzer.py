@@ -1,17 +1,26 @@
 """Analyzer service: orchestrates filtering and analysis.
 
-Produces CallGraph, ObjectFlow, and AnalysisResult from TrackingResult.
+Produces CallGraph, ObjectFlow, and AnalysisResult from TrackingResult
+or EventColumns. Columns are processed by row index: strings compared by
+index, Locations built once per distinct (file, line, func). A
+TrackingResult whose events are an EventSequence (stop()) takes the
+column path too: its events are never all materialized.
 """
 
 from __future__ import annotations
 
-import fnmatch
-from typing import TYPE_CHECKING
+import itertools
+from typing import TYPE_CHECKING, overload
 
 from archcheck.domain.events import (
+    COLUMN_KINDS,
     CallEvent,
     CreateEvent,
     DestroyEvent,
+    EventColumns,
+    EventSequence,
+    EventType,
+    Location,
     ReturnEvent,
     TrackingResult,
     get_event_type,
@@ -26,9 +35,95 @@ from archcheck.domain.graphs import (
 )
 
 if TYPE_CHECKING:
-    from archcheck.domain.events import Location
+    from collections.abc import Iterable
+
+    from archcheck.domain.events import Event, FieldError
     from archcheck.domain.graphs import FilterConfig
 
+_CALL = COLUMN_KINDS.index(EventType.CALL)
+_RETURN = COLUMN_KINDS.index(EventType.RETURN)
+_CREATE = COLUMN_KINDS.index(EventType.CREATE)
+_DESTROY = COLUMN_KINDS.index(EventType.DESTROY)
+
+type _LocationKey = tuple[int, int, int]  # (file idx, line, func idx)
+
+
+class _ObjectFlowBuilder:
+    """Accumulates lifecycles; shared by event and column paths."""
+
+    __slots__ = ("completed", "creates", "orphan_destroys")
+
+    def __init__(self) -> None:
+        # obj_id → (CreateEvent, list of locations)
+        self.creates: dict[int, tuple[CreateEvent, list[Location]]] = {}
+        self.orphan_destroys: list[DestroyEvent] = []
+        # Completed lifecycles (CREATE + DESTROY seen)
+        self.completed: dict[int, ObjectLifecycle] = {}
+
+    def create(self, event: CreateEvent) -> None:
+        if event.obj_id in self.creates:
+            # Duplicate CREATE without DESTROY - error (C bug)
+            raise DuplicateCreateError(event.obj_id)
+        self.creates[event.obj_id] = (event, [])
+
+    def destroy(self, event: DestroyEvent) -> None:
+        if event.obj_id in self.creates:
+            # Complete the lifecycle
+            create_event, locations = self.creates.pop(event.obj_id)
+            self.completed[event.obj_id] = ObjectLifecycle(
+                obj_id=event.obj_id,
+                type_name=create_event.type_name,
+                created=create_event,
+                destroyed=event,
+                locations=tuple(locations),
+            )
+        else:
+            # DESTROY without CREATE (Data Completeness)
+            self.orphan_destroys.append(event)
+
+    def passed(self, obj_id: int, location: Location) -> None:
+        """Object passed as argument at location."""
+        entry = self.creates.get(obj_id)
+        if entry is not None:
+            entry[1].append(location)
+
+    def build(self) -> ObjectFlow:
+        # Build lifecycles for still-alive objects (CREATE without DESTROY)
+        objects: dict[int, ObjectLifecycle] = {}
+        for obj_id, (create_event, locations) in self.creates.items():
+            objects[obj_id] = ObjectLifecycle(
+                obj_id=obj_id,
+                type_name=create_event.type_name,
+                created=create_event,
+                destroyed=None,  # still alive
+                locations=tuple(locations),
+            )
+
+        # Merge completed lifecycles (may overwrite if same id reused)
+        objects.update(self.completed)
+
+        return ObjectFlow(objects=objects, orphan_destroys=tuple(self.orphan_destroys))
+
+
+class _ColumnLocations:
+    """Location flyweights for one EventColumns."""
+
+    __slots__ = ("_cache", "_strings")
+
+    def __init__(self, columns: EventColumns) -> None:
+        self._strings = columns.strings
+        self._cache: dict[_LocationKey, Location] = {}
+
+    def get(self, key: _LocationKey) -> Location:
+        location = self._cache.get(key)
+        if location is None:
+            file_idx, line, func_idx = key
+            location = Location(
+                file=self._strings[file_idx], line=line, func=self._strings[func_idx]
+            )
+            self._cache[key] = location
+        return location
+
 
 class AnalyzerService:
     """Orchestrates event filtering and graph construction.
@@ -38,9 +133,19 @@ class AnalyzerService:
         build_call_graph(): Construct CallGraph from events
         build_object_flow(): Construct ObjectFlow from events
         analyze(): Full analysis pipeline
+
+    Every method accepts TrackingResult or EventColumns (stop_columns()).
     """
 
-    def filter(self, result: TrackingResult, config: FilterConfig) -> TrackingResult:
+    @overload
+    def filter(self, result: TrackingResult, config: FilterConfig) -> TrackingResult: ...
+
+    @overload
+    def filter(self, result: EventColumns, config: FilterConfig) -> EventColumns: ...
+
+    def filter(
+        self, result: TrackingResult | EventColumns, config: FilterConfig
+    ) -> TrackingResult | EventColumns:
         """Filter events based on configuration.
 
         Path filters (include_paths, exclude_paths) apply ONLY to CALL/RETURN.
@@ -48,15 +153,53 @@ class AnalyzerService:
         include_types applies to all event types.
 
         Args:
-            result: Raw tracking result.
+            result: Raw tracking result or columns.
             config: Filter configuration.
 
         Returns:
-            TrackingResult with filtered events, output_errors preserved.
+            Same kind as result with filtered events, output_errors preserved.
         """
+        if isinstance(result, EventColumns):
+            return self._filter_columns(result, config)
+        if isinstance(result.events, EventSequence):
+            columns = result.events.to_columns()
+            rows = self._filter_rows(columns, config)
+            events = EventSequence(columns, rows if len(rows) < len(columns) else None)
+            return TrackingResult(events=events, output_errors=result.output_errors)
         filtered_events = tuple(e for e in result.events if self._should_include(e, config))
         return TrackingResult(events=filtered_events, output_errors=result.output_errors)
 
+    def _filter_columns(self, columns: EventColumns, config: FilterConfig) -> EventColumns:
+        """Column filter: kept rows copied into new columns (columns itself if all kept)."""
+        rows = self._filter_rows(columns, config)
+        if len(rows) == len(columns):
+            return columns
+        return columns.select(rows)
+
+    def _filter_rows(self, columns: EventColumns, config: FilterConfig) -> list[int]:
+        """Rows passing config; path patterns matched once per distinct file string."""
+        kinds = (
+            None
+            if config.include_types is None
+            else frozenset(COLUMN_KINDS.index(t) for t in config.include_types)
+        )
+        path_passes: dict[int, bool] = {}
+
+        rows: list[int] = []
+        for row, (kind, file_idx) in enumerate(zip(columns.kind, columns.file, strict=True)):
+            if kinds is not None and kind not in kinds:
+                continue
+            if kind in (_CALL, _RETURN) and file_idx != 0:
+                passes = path_passes.get(file_idx)
+                if passes is None:
+                    file_path = columns.strings[file_idx]
+                    passes = file_path is None or config.path_passes(file_path)
+                    path_passes[file_idx] = passes
+                if not passes:
+                    continue
+            rows.append(row)
+        return rows
+
     def _should_include(
         self,
         event: CallEvent | ReturnEvent | CreateEvent | DestroyEvent,
@@ -74,20 +217,11 @@ class AnalyzerService:
         if isinstance(event, (CallEvent, ReturnEvent)):
             file_path = event.location.file
             if file_path is not None:
-                # include_paths: must match at least one pattern (if specified)
-                if config.include_paths and not any(
-                    fnmatch.fnmatch(file_path, p) for p in config.include_paths
-                ):
-                    return False
-                # exclude_paths: must not match any pattern
-                if config.exclude_paths and any(
-                    fnmatch.fnmatch(file_path, p) for p in config.exclude_paths
-                ):
-                    return False
+                return config.path_passes(file_path)
 
         return True
 
-    def build_call_graph(self, result: TrackingResult) -> CallGraph:
+    def build_call_graph(self, result: TrackingResult | EventColumns) -> CallGraph:
         """Build call graph from tracking result.
 
         Algorithm:
@@ -97,21 +231,61 @@ class AnalyzerService:
             4. Aggregate duplicate edges by incrementing count
             5. Filter self-loops (caller == callee)
 
+        Columns carry the recording thread: there is one stack per thread,
+        so interleaved calls of several threads pair up correctly
+        (TrackingResult with tuple events does not: they share one stack).
+
         Data Completeness:
             - Unmatched CALL (no RETURN): tracked in unmatched
             - Unmatched RETURN (no CALL): tracked in unmatched
+            - Columns: unmatched RETURNs in row order, then unmatched CALLs
 
         Args:
-            result: Tracking result (typically filtered).
+            result: Tracking result or columns (typically filtered).
 
         Returns:
             CallGraph with edges and unmatched events.
         """
-        call_stack: list[CallEvent] = []
+        if isinstance(result, EventColumns):
+            return self._build_call_graph_columns(result)
+        if isinstance(result.events, EventSequence):
+            return self._build_call_graph_columns(result.events.to_columns())
+
         edge_counts: dict[tuple[Location, Location], int] = {}
         unmatched: list[CallEvent | ReturnEvent] = []
+        self._count_call_edges(result.events, edge_counts, unmatched)
+        return self._call_graph(edge_counts, unmatched)
 
-        for event in result.events:
+    def build_merged_call_graph(self, traces: Iterable[Iterable[Event]]) -> CallGraph:
+        """Build one call graph from the event streams of several processes.
+
+        Single streaming pass: each stream (e.g. tracefile.read_trace() of
+        one forked worker) is consumed once with its own call stack, so a
+        CALL is never paired with a RETURN of another process; edge counts
+        are summed across streams.
+
+        Args:
+            traces: One event iterable per process, consumed in order.
+
+        Returns:
+            CallGraph with summed edges and every stream's unmatched events.
+        """
+        edge_counts: dict[tuple[Location, Location], int] = {}
+        unmatched: list[CallEvent | ReturnEvent] = []
+        for events in traces:
+            self._count_call_edges(events, edge_counts, unmatched)
+        return self._call_graph(edge_counts, unmatched)
+
+    def _count_call_edges(
+        self,
+        events: Iterable[Event],
+        edge_counts: dict[tuple[Location, Location], int],
+        unmatched: list[CallEvent | ReturnEvent],
+    ) -> None:
+        """Add one event stream's edges to edge_counts (own call stack)."""
+        call_stack: list[CallEvent] = []
+
+        for event in events:
             match event:
                 case CallEvent():
                     call_stack.append(event)
@@ -132,15 +306,68 @@ class AnalyzerService:
         # Remaining CALLs on stack are unmatched (Data Completeness)
         unmatched.extend(call_stack)
 
-        # Build edges
+    def _call_graph(
+        self,
+        edge_counts: dict[tuple[Location, Location], int],
+        unmatched: list[CallEvent | ReturnEvent],
+    ) -> CallGraph:
+        """Freeze counted edges into a CallGraph."""
         edges = frozenset(
             CallEdge(caller=caller, callee=callee, count=count)
             for (caller, callee), count in edge_counts.items()
         )
+        return CallGraph(edges=edges, unmatched=tuple(unmatched))
+
+    def _build_call_graph_columns(self, columns: EventColumns) -> CallGraph:
+        """Column call graph: edges keyed by string indices, one stack per thread."""
+        kinds = list(columns.kind)
+        threads = list(columns.thread)
+        file, line, func = list(columns.file), list(columns.line), list(columns.func)
+        caller_file = list(columns.caller_file)
+        caller_line = list(columns.caller_line)
+        caller_func = list(columns.caller_func)
+
+        call_stacks: dict[int, list[int]] = {}
+        edge_counts: dict[tuple[_LocationKey, _LocationKey], int] = {}
+        unmatched_rows: list[int] = []
+
+        for row, kind in enumerate(kinds):
+            if kind == _CALL:
+                call_stacks.setdefault(threads[row], []).append(row)
+            elif kind == _RETURN:
+                call_stack = call_stacks.get(threads[row])
+                if call_stack:
+                    call = call_stack.pop()
+                    # Skip if no caller info (file=None) or self-loop
+                    if caller_func[call] != 0 and caller_file[call] != 0:
+                        caller = (caller_file[call], caller_line[call], caller_func[call])
+                        callee = (file[call], line[call], func[call])
+                        if caller != callee:
+                            key = (caller, callee)
+                            edge_counts[key] = edge_counts.get(key, 0) + 1
+                else:
+                    # RETURN without matching CALL (Data Completeness)
+                    unmatched_rows.append(row)
+
+        # Remaining CALLs on stacks are unmatched (Data Completeness)
+        unmatched_rows.extend(sorted(itertools.chain.from_iterable(call_stacks.values())))
+
+        locations = _ColumnLocations(columns)
+        edges = frozenset(
+            CallEdge(caller=locations.get(caller), callee=locations.get(callee), count=count)
+            for (caller, callee), count in edge_counts.items()
+        )
+
+        errors: dict[int, tuple[FieldError, ...]] = dict(columns.errors)
+        unmatched: list[CallEvent | ReturnEvent] = []
+        for row in unmatched_rows:
+            match columns.event(row, errors.get(row, ())):
+                case CallEvent() | ReturnEvent() as event:
+                    unmatched.append(event)
 
         return CallGraph(edges=edges, unmatched=tuple(unmatched))
 
-    def build_object_flow(self, result: TrackingResult) -> ObjectFlow:
+    def build_object_flow(self, result: TrackingResult | EventColumns) -> ObjectFlow:
         """Build object flow from tracking result.
 
         Algorithm:
@@ -156,66 +383,57 @@ class AnalyzerService:
             - Multiple CREATE with same obj_id: raises ValueError
 
         Args:
-            result: Tracking result (typically filtered).
+            result: Tracking result or columns (typically filtered).
 
         Returns:
             ObjectFlow with lifecycles and orphan destroys.
         """
-        # Track creates: obj_id → (CreateEvent, list of locations)
-        creates: dict[int, tuple[CreateEvent, list[Location]]] = {}
-        orphan_destroys: list[DestroyEvent] = []
-
-        # Completed lifecycles (CREATE + DESTROY seen)
-        completed: dict[int, ObjectLifecycle] = {}
+        if isinstance(result, EventColumns):
+            return self._build_object_flow_columns(result)
+        if isinstance(result.events, EventSequence):
+            return self._build_object_flow_columns(result.events.to_columns())
 
+        flow = _ObjectFlowBuilder()
         for event in result.events:
             match event:
                 case CreateEvent():
-                    if event.obj_id in creates:
-                        # Duplicate CREATE without DESTROY - error (C bug)
-                        raise DuplicateCreateError(event.obj_id)
-                    creates[event.obj_id] = (event, [])
-
+                    flow.create(event)
                 case DestroyEvent():
-                    if event.obj_id in creates:
-                        # Complete the lifecycle
-                        create_event, locations = creates.pop(event.obj_id)
-                        completed[event.obj_id] = ObjectLifecycle(
-                            obj_id=event.obj_id,
-                            type_name=create_event.type_name,
-                            created=create_event,
-                            destroyed=event,
-                            locations=tuple(locations),
-                        )
-                    else:
-                        # DESTROY without CREATE (Data Completeness)
-                        orphan_destroys.append(event)
-
+                    flow.destroy(event)
                 case CallEvent():
                     # Track where objects are passed as arguments
                     for arg in event.args:
-                        if arg.obj_id in creates:
-                            creates[arg.obj_id][1].append(event.location)
-
-        # Build lifecycles for still-alive objects (CREATE without DESTROY)
-        objects: dict[int, ObjectLifecycle] = {}
-        for obj_id, (create_event, locations) in creates.items():
-            objects[obj_id] = ObjectLifecycle(
-                obj_id=obj_id,
-                type_name=create_event.type_name,
-                created=create_event,
-                destroyed=None,  # still alive
-                locations=tuple(locations),
-            )
-
-        # Merge completed lifecycles (may overwrite if same id reused)
-        objects.update(completed)
-
-        return ObjectFlow(objects=objects, orphan_destroys=tuple(orphan_destroys))
+                        flow.passed(arg.obj_id, event.location)
+
+        return flow.build()
+
+    def _build_object_flow_columns(self, columns: EventColumns) -> ObjectFlow:
+        """Column object flow: only CREATE/DESTROY rows become domain events."""
+        kinds = list(columns.kind)
+        arg_count = list(columns.arg_count)
+        arg_id = list(columns.arg_id)
+        offsets = columns.arg_offsets
+        locations = _ColumnLocations(columns)
+
+        flow = _ObjectFlowBuilder()
+        for row, kind in enumerate(kinds):
+            if kind in (_CREATE, _DESTROY):
+                match columns.event(row):
+                    case CreateEvent() as event:
+                        flow.create(event)
+                    case DestroyEvent() as event:
+                        flow.destroy(event)
+            elif kind == _CALL and arg_count[row]:
+                location = locations.get((columns.file[row], columns.line[row], columns.func[row]))
+                start = offsets[row]
+                for obj_id in arg_id[start : start + arg_count[row]]:
+                    flow.passed(obj_id, location)
+
+        return flow.build()
 
     def analyze(
         self,
-        result: TrackingResult,
+        result: TrackingResult | EventColumns,
         config: FilterConfig,
     ) -> AnalysisResult:
         """Full analysis pipeline: filter → build graphs.
@@ -227,11 +445,11 @@ class AnalyzerService:
             4. Combine into AnalysisResult
 
         Args:
-            result: Raw tracking result.
+            result: Raw tracking result or columns.
             config: Filter configuration.
 
         Returns:
-            AnalysisResult with filtered result, call graph, and object flow.
+            AnalysisResult with filtered result (same kind), call graph, and object flow.
         """
         filtered = self.filter(result, config)
         call_graph = self.build_call_graph(filtered)
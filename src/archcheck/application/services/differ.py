@@ -0,0 +1,87 @@
+"""Differ service: regression report between two captured runs.
+
+Streams the events of each run (e.g. tracefile.read_trace() of every
+worker's trace file) once: call edges are counted by AnalyzerService and
+live objects per creation site are counted alongside, in the same pass.
+Memory grows with distinct edges, sites and live objects, not events.
+The reduced runs are then compared by domain.diff's merge-joins.
+"""
+
+from __future__ import annotations
+
+from typing import TYPE_CHECKING
+
+from archcheck.application.services.analyzer import AnalyzerService
+from archcheck.domain.diff import TraceDiff, diff_edges, diff_sites
+from archcheck.domain.events import CreateEvent, CreationInfo, DestroyEvent
+
+if TYPE_CHECKING:
+    from collections.abc import Iterable, Iterator
+
+    from archcheck.domain.events import Event
+    from archcheck.domain.graphs import CallGraph
+
+
+class DiffService:
+    """Compares two runs given as event streams.
+
+    Methods:
+        diff_traces(): Ranked edge count changes and site growth
+    """
+
+    def __init__(self, analyzer: AnalyzerService | None = None) -> None:
+        """Initialize with the analyzer building call graphs (default: new one)."""
+        self._analyzer = analyzer or AnalyzerService()
+
+    def diff_traces(
+        self,
+        before: Iterable[Iterable[Event]],
+        after: Iterable[Iterable[Event]],
+        *,
+        limit: int | None = None,
+    ) -> TraceDiff:
+        """Diff two runs, each one event stream per process.
+
+        Sites are (creation location, type) with an empty traceback, as
+        for an ObjectFlow; objects destroyed before the end of their
+        stream do not count. Trace files carry no timings: latency stays
+        empty (compare profiles with domain.diff.diff_latency()).
+
+        Args:
+            before: Event streams of the earlier run, consumed once.
+            after: Event streams of the later run, consumed once.
+            limit: Keep only the limit largest changes per category.
+
+        Returns:
+            TraceDiff with ranked edges and sites.
+        """
+        old_graph, old_live = self._reduce(before)
+        new_graph, new_live = self._reduce(after)
+        return TraceDiff(
+            edges=diff_edges(old_graph, new_graph, limit=limit),
+            sites=diff_sites(old_live, new_live, limit=limit),
+        )
+
+    def _reduce(
+        self, traces: Iterable[Iterable[Event]]
+    ) -> tuple[CallGraph, dict[CreationInfo, int]]:
+        """One pass over every stream: call graph and live objects per site."""
+        live: dict[CreationInfo, int] = {}
+        graph = self._analyzer.build_merged_call_graph(
+            _counting_sites(events, live) for events in traces
+        )
+        return graph, live
+
+
+def _counting_sites(events: Iterable[Event], live: dict[CreationInfo, int]) -> Iterator[Event]:
+    """Pass one process's events through, adding its live objects to live."""
+    objects: dict[int, CreationInfo] = {}
+    for event in events:
+        match event:
+            case CreateEvent(location=location, obj_id=obj_id, type_name=type_name):
+                objects[obj_id] = CreationInfo(location=location, type_name=type_name, traceback=())
+            case DestroyEvent(obj_id=obj_id):
+                objects.pop(obj_id, None)
+        yield event
+    for site in objects.values():
+        live[site] = live.get(site, 0) + 1
@@ -0,0 +1,502 @@
+"""Incremental service: static and merged call graphs kept current per file.
+
+IncrementalGraph parses a directory once; update(paths) then parses only
+the given files and resolves calls again only in modules whose result
+can change:
+
+- the changed modules themselves
+- modules that looked a changed module up, when its interface (function
+  names, classes with their bases and methods, imports) changed or it was
+  added or removed
+- modules whose resolution searched classes by short name (base class
+  fallback in call_resolver), when the classes of some module changed
+
+Dependencies are recorded while resolve_module_calls() runs (every
+module whose definitions or symbol table the SymbolIndex was asked for,
+misses included), so they are exactly what the resolver used, not an
+approximation from import statements. A body-only edit re-resolves one
+module.
+
+With a runtime CallGraph, the MergedCallGraph is kept current too: runtime
+edges touching a changed file are resolved again and only the affected
+caller modules are re-merged. Graphs are immutable; each property builds
+a new graph from cached per-module parts after an update.
+
+watch() polls the tree and yields one GraphUpdate per batch of edits.
+"""
+
+import itertools
+import os
+import time
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+from archcheck.application.services.merger import classify_edges, location_key, module_func_index
+from archcheck.application.services.parser import (
+    DEFAULT_EXCLUDES,
+    compute_module_name,
+    find_python_files,
+    parse_codebase,
+    parse_file,
+)
+from archcheck.domain.codebase import Codebase, Module
+from archcheck.domain.exceptions import ParseError
+from archcheck.domain.merged_graph import MergedCallEdge, MergedCallGraph
+from archcheck.domain.static_graph import StaticCallEdge, StaticCallGraph, UnresolvedCall
+from archcheck.infrastructure.analyzers import SymbolIndex, resolve_module_calls
+
+if TYPE_CHECKING:
+    import pathlib
+    from collections.abc import Iterable, Iterator, Mapping
+
+    from archcheck.domain.codebase import Class, Function, Import
+    from archcheck.domain.graphs import CallEdge, CallGraph
+
+type _EdgeKey = tuple[str, str]  # (caller_fqn, callee_fqn)
+type _FuncKey = tuple[str, str, int]  # merger function index: (resolved file, func, line)
+type _Resolution = tuple[tuple[StaticCallEdge, ...], tuple[UnresolvedCall, ...]]
+type _ClassInterface = tuple[str, tuple[str, ...], tuple[tuple[str, str], ...]]
+type _Interface = tuple[tuple[str, ...], tuple[_ClassInterface, ...], tuple[Import, ...]]
+
+
+@dataclass(frozen=True, slots=True)
+class GraphUpdate:
+    """Result of one IncrementalGraph.update().
+
+    changed: modules parsed again (or added), in update order.
+    removed: modules whose file is gone.
+    resolved: modules whose calls were resolved again (changed + dependents).
+    errors: files that failed to parse; their module keeps its last good
+        version (Data Completeness: reported, not dropped).
+    """
+
+    changed: tuple[str, ...]
+    removed: tuple[str, ...]
+    resolved: tuple[str, ...]
+    errors: tuple[ParseError, ...]
+
+
+class _RecordingIndex(SymbolIndex):
+    """SymbolIndex that records which modules one resolution reads.
+
+    looked_up: modules whose definitions or symbol table were asked for
+        (found or not).
+    scanned: classes were searched by short name across all modules.
+    """
+
+    __slots__ = ("looked_up", "scanned")
+
+    def __init__(self, modules: Iterable[Module]) -> None:
+        self.looked_up: set[str] = set()
+        self.scanned = False
+        super().__init__(modules)
+
+    def reset(self) -> None:
+        """Start recording one resolution.
+
+        Cached MROs are dropped: computing them again records their reads.
+        """
+        self.looked_up = set()
+        self.scanned = False
+        self._mro.clear()
+
+    def module(self, name: str) -> Module | None:
+        self.looked_up.add(name)
+        return super().module(name)
+
+    def function(self, fqn: str) -> Function | None:
+        self.looked_up.add(fqn.rpartition(".")[0])
+        return super().function(fqn)
+
+    def get_class(self, fqn: str) -> Class | None:
+        self.looked_up.add(fqn.rpartition(".")[0])
+        return super().get_class(fqn)
+
+    def first_class_named(self, name: str) -> str | None:
+        self.scanned = True
+        return super().first_class_named(name)
+
+    def symbol_table(self, module_name: str) -> Mapping[str, str]:
+        self.looked_up.add(module_name)
+        return super().symbol_table(module_name)
+
+
+class IncrementalGraph:
+    """StaticCallGraph (and MergedCallGraph) of one directory, updated per file.
+
+    Usage:
+        graph = IncrementalGraph(root, runtime=call_graph)
+        for update in graph.watch():
+            check(graph.static_graph, graph.merged_graph)
+
+    Contracts:
+        - After any sequence of updates, static_graph has the edges of
+          parse_directory() on the current tree (grouped by module, modules
+          in parse order, new modules last), merged_graph the edges of
+          merge() on it
+        - Where call_resolver's base-class fallback finds one class name in
+          several modules, the first module in that order wins
+        - One thread at a time
+    """
+
+    __slots__ = (
+        "_dependents",
+        "_exclude",
+        "_file_modules",
+        "_files",
+        "_func_index",
+        "_index",
+        "_index_entries",
+        "_interfaces",
+        "_lookups",
+        "_merged",
+        "_merged_graph",
+        "_module_files",
+        "_modules",
+        "_resolved",
+        "_root_package",
+        "_root_path",
+        "_runtime",
+        "_runtime_by_file",
+        "_runtime_edges",
+        "_runtime_keys",
+        "_runtime_locations",
+        "_runtime_owned",
+        "_runtime_owners",
+        "_scanners",
+        "_static_graph",
+    )
+
+    def __init__(
+        self,
+        root_path: pathlib.Path,
+        *,
+        exclude: frozenset[str] = DEFAULT_EXCLUDES,
+        runtime: CallGraph | None = None,
+        workers: int | None = None,
+        cache_dir: pathlib.Path | None = None,
+    ) -> None:
+        """Parse root_path and resolve every module.
+
+        Args:
+            root_path: Root directory to parse.
+            exclude: Directory names to skip.
+            runtime: Runtime call graph to keep merged; None: static only.
+            workers: Parser processes for the initial parse (parse_directory).
+            cache_dir: ParseCache directory for the initial parse.
+
+        Raises:
+            ParseError: Any file has invalid syntax (initial parse only).
+            ValueError: workers < 1.
+        """
+        self._root_path = root_path
+        self._exclude = exclude
+        # Taken before parsing: edits made meanwhile are seen by watch()
+        self._files = _stat_tree(root_path, exclude)
+
+        codebase = parse_codebase(root_path, exclude=exclude, workers=workers, cache_dir=cache_dir)
+        self._modules: dict[str, Module] = dict(codebase.modules)
+        self._root_package = codebase.root_package
+        self._index = _RecordingIndex(self._modules.values())
+        self._resolved: dict[str, _Resolution] = {}
+        self._lookups: dict[str, frozenset[str]] = {}
+        self._dependents: dict[str, set[str]] = {}
+        self._scanners: set[str] = set()
+        self._interfaces = {name: _interface(module) for name, module in self._modules.items()}
+        for name in self._modules:
+            self._resolve(name)
+        self._static_graph: StaticCallGraph | None = None
+
+        self._runtime = runtime
+        self._func_index: dict[_FuncKey, str] = {}
+        self._index_entries: dict[str, tuple[_FuncKey, ...]] = {}
+        self._module_files: dict[str, str] = {}
+        self._file_modules: dict[str, str] = {}
+        self._runtime_edges: tuple[CallEdge, ...] = ()
+        self._runtime_locations: list[tuple[_FuncKey | None, _FuncKey | None]] = []
+        self._runtime_keys: list[_EdgeKey | None] = []
+        self._runtime_owners: list[str | None] = []
+        self._runtime_owned: dict[str, set[int]] = {}
+        self._runtime_by_file: dict[str, list[int]] = {}
+        self._merged: dict[str, tuple[MergedCallEdge, ...]] = {}
+        self._merged_graph: MergedCallGraph | None = None
+        if runtime is not None:
+            self._init_runtime(runtime)
+
+    @property
+    def codebase(self) -> Codebase:
+        """Current codebase (snapshot)."""
+        return Codebase(
+            root_path=self._root_path,
+            root_package=self._root_package,
+            modules=dict(self._modules),
+        )
+
+    @property
+    def static_graph(self) -> StaticCallGraph:
+        """Current static call graph."""
+        if self._static_graph is None:
+            parts = [self._resolved[name] for name in self._modules]
+            self._static_graph = StaticCallGraph(
+                edges=tuple(itertools.chain.from_iterable(edges for edges, _ in parts)),
+                unresolved=tuple(itertools.chain.from_iterable(unres for _, unres in parts)),
+            )
+        return self._static_graph
+
+    @property
+    def merged_graph(self) -> MergedCallGraph | None:
+        """Current merged call graph, None without a runtime graph."""
+        if self._runtime is None:
+            return None
+        if self._merged_graph is None:
+            edges = itertools.chain.from_iterable(
+                self._merged.get(name, ()) for name in self._modules
+            )
+            self._merged_graph = MergedCallGraph(edges=tuple(edges))
+        return self._merged_graph
+
+    def update(self, paths: Iterable[pathlib.Path]) -> GraphUpdate:
+        """Apply edits of paths (changed, added or deleted .py files).
+
+        Paths outside the tree, in excluded directories or not ending in
+        .py are ignored.
+        """
+        parsed: dict[str, Module] = {}
+        gone: list[str] = []
+        errors: list[ParseError] = []
+        for path in paths:
+            if not self._tracks(path):
+                continue
+            name = compute_module_name(path, self._root_path)
+            if path.is_file():
+                try:
+                    parsed[name] = parse_file(path, self._root_path)
+                except ParseError as e:
+                    errors.append(e)
+            elif name in self._modules and name not in gone:
+                gone.append(name)
+
+        return self._apply(parsed, tuple(gone), tuple(errors))
+
+    def watch(self, *, interval_s: float = 0.5) -> Iterator[GraphUpdate]:
+        """Poll the tree every interval_s; yield the update of each batch of edits.
+
+        Files are compared by (mtime, size). Runs until the caller stops
+        iterating.
+        """
+        while True:
+            current = _stat_tree(self._root_path, self._exclude)
+            edited = [path for path, stat in current.items() if self._files.get(path) != stat]
+            edited.extend(path for path in self._files if path not in current)
+            self._files = current
+            if edited:
+                yield self.update(edited)
+            else:
+                time.sleep(interval_s)
+
+    # -------------------------------------------------------------------------
+    # Static graph
+    # -------------------------------------------------------------------------
+
+    def _tracks(self, path: pathlib.Path) -> bool:
+        """Is path a module file of this tree."""
+        if path.suffix != ".py" or not path.is_relative_to(self._root_path):
+            return False
+        directories = path.relative_to(self._root_path).parts[:-1]
+        return not any(part in self._exclude for part in directories)
+
+    def _apply(
+        self,
+        parsed: dict[str, Module],
+        gone: tuple[str, ...],
+        errors: tuple[ParseError, ...],
+    ) -> GraphUpdate:
+        """Replace parsed modules, drop gone ones, re-resolve what depends on them."""
+        dirty: set[str] = set(gone)
+        class_names_changed = False
+
+        for name, module in parsed.items():
+            interface = _interface(module)
+            old_interface = self._interfaces.get(name)
+            if old_interface != interface:
+                dirty.add(name)
+                class_names_changed |= old_interface is None or old_interface[1] != interface[1]
+            self._modules[name] = module
+            self._interfaces[name] = interface
+            self._index.add(module)
+
+        for name in gone:
+            class_names_changed |= bool(self._interfaces[name][1])
+            del self._modules[name]
+            del self._interfaces[name]
+            self._index.remove(name)
+            del self._resolved[name]
+            self._forget_lookups(name)
+
+        targets = set(parsed)
+        for name in dirty:
+            targets |= self._dependents.get(name, set())
+        if class_names_changed:
+            targets |= self._scanners
+        resolved = tuple(name for name in self._modules if name in targets)
+        for name in resolved:
+            self._resolve(name)
+        self._static_graph = None
+
+        if self._runtime is not None:
+            self._update_runtime(parsed, gone, resolved)
+
+        return GraphUpdate(
+            changed=tuple(parsed),
+            removed=gone,
+            resolved=resolved,
+            errors=errors,
+        )
+
+    def _resolve(self, name: str) -> None:
+        """Resolve calls of one module and record what it looked up."""
+        self._index.reset()
+        self._resolved[name] = resolve_module_calls(self._modules[name], self._index)
+        looked_up = frozenset(self._index.looked_up)
+
+        self._forget_lookups(name)
+        for target in looked_up:
+            self._dependents.setdefault(target, set()).add(name)
+        self._lookups[name] = looked_up
+        if self._index.scanned:
+            self._scanners.add(name)
+
+    def _forget_lookups(self, name: str) -> None:
+        for target in self._lookups.pop(name, frozenset()):
+            self._dependents[target].discard(name)
+        self._scanners.discard(name)
+
+    # -------------------------------------------------------------------------
+    # Merged graph
+    # -------------------------------------------------------------------------
+
+    def _init_runtime(self, runtime: CallGraph) -> None:
+        """Index every module and resolve every runtime edge once."""
+        for name, module in self._modules.items():
+            self._index_module(name, module)
+
+        self._runtime_edges = tuple(runtime.edges)
+        for position, edge in enumerate(self._runtime_edges):
+            keys = (location_key(edge.caller), location_key(edge.callee))
+            self._runtime_locations.append(keys)
+            self._runtime_keys.append(None)
+            self._runtime_owners.append(None)
+            for file in {key[0] for key in keys if key is not None}:
+                self._runtime_by_file.setdefault(file, []).append(position)
+            self._resolve_runtime(position)
+
+        for name in self._modules:
+            self._merge_module(name)
+
+    def _update_runtime(
+        self,
+        parsed: dict[str, Module],
+        gone: tuple[str, ...],
+        resolved: tuple[str, ...],
+    ) -> None:
+        """Re-index changed modules, re-resolve runtime edges touching their files."""
+        files: set[str] = set()
+        for name in (*gone, *parsed):
+            old_file = self._unindex_module(name)
+            if old_file is not None:
+                files.add(old_file)
+        for name in gone:
+            self._merged.pop(name, None)
+        for name, module in parsed.items():
+            files.add(self._index_module(name, module))
+
+        remerge = set(resolved)
+        touched = {position for file in files for position in self._runtime_by_file.get(file, ())}
+        for position in sorted(touched):
+            old_owner = self._runtime_owners[position]
+            self._resolve_runtime(position)
+            remerge.update(o for o in (old_owner, self._runtime_owners[position]) if o)
+
+        for name in self._modules:
+            if name in remerge:
+                self._merge_module(name)
+        self._merged_graph = None
+
+    def _index_module(self, name: str, module: Module) -> str:
+        """Add module's function index entries. Returns its file key."""
+        entries = module_func_index(module)
+        self._func_index.update(entries)
+        self._index_entries[name] = tuple(entries)
+        file_key = str(module.path.resolve())
+        self._module_files[name] = file_key
+        self._file_modules[file_key] = name
+        return file_key
+
+    def _unindex_module(self, name: str) -> str | None:
+        """Remove module's function index entries. Returns its old file key."""
+        for key in self._index_entries.pop(name, ()):
+            del self._func_index[key]
+        file_key = self._module_files.pop(name, None)
+        if file_key is not None:
+            del self._file_modules[file_key]
+        return file_key
+
+    def _resolve_runtime(self, position: int) -> None:
+        """Resolve one runtime edge against the current function index."""
+        caller_key, callee_key = self._runtime_locations[position]
+        caller = None if caller_key is None else self._func_index.get(caller_key)
+        callee = None if callee_key is None else self._func_index.get(callee_key)
+
+        old_owner = self._runtime_owners[position]
+        if old_owner is not None:
+            self._runtime_owned[old_owner].discard(position)
+        if caller_key is None or caller is None or callee is None:
+            self._runtime_keys[position] = None
+            self._runtime_owners[position] = None
+            return
+        owner = self._file_modules[caller_key[0]]
+        self._runtime_keys[position] = (caller, callee)
+        self._runtime_owners[position] = owner
+        self._runtime_owned.setdefault(owner, set()).add(position)
+
+    def _merge_module(self, name: str) -> None:
+        """Merged edges whose caller is in module name (runtime order kept)."""
+        static_index = {(e.caller_fqn, e.callee_fqn): e for e in self._resolved[name][0]}
+        owned: list[tuple[_EdgeKey, CallEdge]] = []
+        for position in sorted(self._runtime_owned.get(name, ())):
+            key = self._runtime_keys[position]
+            if key is not None:
+                owned.append((key, self._runtime_edges[position]))
+        self._merged[name] = tuple(classify_edges(static_index, owned))
+
+
+def _interface(module: Module) -> _Interface:
+    """What other modules' resolution reads of module.
+
+    Function names; classes with bases and methods (MRO); imports (symbol
+    table, which resolves the bases).
+    """
+    return (
+        tuple(func.name for func in module.functions),
+        tuple(
+            (
+                cls.name,
+                cls.bases,
+                tuple((method.name, method.qualified_name) for method in cls.methods),
+            )
+            for cls in module.classes
+        ),
+        module.imports,
+    )
+
+
+def _stat_tree(root: pathlib.Path, exclude: frozenset[str]) -> dict[pathlib.Path, tuple[int, int]]:
+    """(mtime_ns, size) of every module file under root."""
+    stats: dict[pathlib.Path, tuple[int, int]] = {}
+    for path in find_python_files(root, exclude):
+        try:
+            stat = os.stat(path)
+        except FileNotFoundError:
+            continue  # Deleted while listing: next poll sees it gone
+        stats[path] = (stat.st_mtime_ns, stat.st_size)
+    return stats
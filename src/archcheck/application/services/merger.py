@@ -13,9 +13,11 @@ from typing import TYPE_CHECKING
 from archcheck.domain.merged_graph import EdgeNature, MergedCallEdge, MergedCallGraph
 
 if TYPE_CHECKING:
-    from archcheck.domain.codebase import Codebase
+    from collections.abc import Iterable, Mapping
+
+    from archcheck.domain.codebase import Codebase, Module
     from archcheck.domain.events import Location
-    from archcheck.domain.graphs import CallGraph
+    from archcheck.domain.graphs import CallEdge, CallGraph
     from archcheck.domain.static_graph import StaticCallEdge, StaticCallGraph
 
 
@@ -52,14 +54,12 @@ def merge(
     static_index: dict[tuple[str, str], StaticCallEdge] = {
         (edge.caller_fqn, edge.callee_fqn): edge for edge in static.edges
     }
-    matched_static: set[tuple[str, str]] = set()
 
     # Step 2: Build function index from codebase
     func_index = _build_func_index(codebase)
 
-    # Step 3: Process runtime edges
-    merged_edges: list[MergedCallEdge] = []
-
+    # Step 3: Resolve runtime edges
+    resolved: list[tuple[tuple[str, str], CallEdge]] = []
     for runtime_edge in runtime.edges:
         caller_fqn = _resolve_location(runtime_edge.caller, func_index)
         callee_fqn = _resolve_location(runtime_edge.callee, func_index)
@@ -68,7 +68,30 @@ def merge(
             # Cannot resolve → skip (Phase 4 will track)
             continue
 
-        key = (caller_fqn, callee_fqn)
+        resolved.append(((caller_fqn, callee_fqn), runtime_edge))
+
+    # Step 4: Classify
+    return MergedCallGraph(edges=tuple(classify_edges(static_index, resolved)))
+
+
+def classify_edges(
+    static_index: Mapping[tuple[str, str], StaticCallEdge],
+    runtime: Iterable[tuple[tuple[str, str], CallEdge]],
+) -> list[MergedCallEdge]:
+    """Classify resolved edges: runtime edges first (in order), then STATIC_ONLY.
+
+    Args:
+        static_index: (caller_fqn, callee_fqn) → StaticCallEdge.
+        runtime: Runtime edges with their resolved (caller_fqn, callee_fqn).
+
+    Returns:
+        Merged edges (merge() on any subset of callers, e.g. one module's).
+    """
+    matched_static: set[tuple[str, str]] = set()
+    merged_edges: list[MergedCallEdge] = []
+
+    for key, runtime_edge in runtime:
+        caller_fqn, callee_fqn = key
         static_edge = static_index.get(key)
 
         if static_edge is not None:
@@ -95,7 +118,7 @@ def merge(
                 ),
             )
 
-    # Step 4: Add unmatched static edges → STATIC_ONLY
+    # Unmatched static edges → STATIC_ONLY
     for key, static_edge in static_index.items():
         if key not in matched_static:
             caller_fqn, callee_fqn = key
@@ -109,7 +132,7 @@ def merge(
                 ),
             )
 
-    return MergedCallGraph(edges=tuple(merged_edges))
+    return merged_edges
 
 
 def _build_func_index(codebase: Codebase) -> dict[tuple[str, str, int], str]:
@@ -125,24 +148,30 @@ def _build_func_index(codebase: Codebase) -> dict[tuple[str, str, int], str]:
         Index mapping (resolved_file_path, func_name, line) to qualified_name.
     """
     index: dict[tuple[str, str, int], str] = {}
-
     for module in codebase.modules.values():
-        file_key = str(module.path.resolve())
-
-        # Index top-level functions
-        for func in module.functions:
-            key = (file_key, func.name, func.location.line)
-            index[key] = func.qualified_name
-
-        # Index class methods (two keys: method_name and Class.method_name)
-        for cls in module.classes:
-            for method in cls.methods:
-                # Key 1: method name only (for some trackers)
-                key = (file_key, method.name, method.location.line)
-                index[key] = method.qualified_name
-                # Key 2: Class.method (Python runtime format)
-                key_with_class = (file_key, f"{cls.name}.{method.name}", method.location.line)
-                index[key_with_class] = method.qualified_name
+        index.update(module_func_index(module))
+    return index
+
+
+def module_func_index(module: Module) -> dict[tuple[str, str, int], str]:
+    """Entries of one module in the (file, func_name, line) → FQN index."""
+    index: dict[tuple[str, str, int], str] = {}
+    file_key = str(module.path.resolve())
+
+    # Index top-level functions
+    for func in module.functions:
+        key = (file_key, func.name, func.location.line)
+        index[key] = func.qualified_name
+
+    # Index class methods (two keys: method_name and Class.method_name)
+    for cls in module.classes:
+        for method in cls.methods:
+            # Key 1: method name only (for some trackers)
+            key = (file_key, method.name, method.location.line)
+            index[key] = method.qualified_name
+            # Key 2: Class.method (Python runtime format)
+            key_with_class = (file_key, f"{cls.name}.{method.name}", method.location.line)
+            index[key_with_class] = method.qualified_name
 
     return index
 
@@ -165,6 +194,17 @@ def _resolve_location(
     Returns:
         Qualified function name or None if unresolvable.
     """
+    key = location_key(location)
+    if key is None:
+        return None
+    return func_index.get(key)
+
+
+def location_key(location: Location) -> tuple[str, str, int] | None:
+    """Function index key of a runtime Location (resolved file, func, line).
+
+    Returns None if location.file or location.func is None, or the path is invalid.
+    """
     if location.file is None or location.func is None:
         return None
 
@@ -175,5 +215,4 @@ def _resolve_location(
         # Invalid path → cannot resolve
         return None
 
-    key = (resolved_file, location.func, location.line)
-    return func_index.get(key)
+    return (resolved_file, location.func, location.line)
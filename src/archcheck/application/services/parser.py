@@ -1,21 +1,27 @@
 """Parser service: parse Python source to Codebase and StaticCallGraph.
 
 Orchestrates analyzers to build domain model from source files.
+parse_directory() spreads files over a process pool and can reuse
+Modules of unchanged files from an on-disk ParseCache.
 FAIL-FIRST: ParseError on syntax errors.
 """
 
 import ast
+import os
+from concurrent.futures import ProcessPoolExecutor
 from typing import TYPE_CHECKING
 
 from archcheck.domain.codebase import Class, Codebase, Function, Module
 from archcheck.domain.exceptions import ParseError
 from archcheck.domain.static_graph import StaticCallEdge, StaticCallGraph, UnresolvedCall
 from archcheck.infrastructure.analyzers import (
+    SymbolIndex,
     analyze_class,
     analyze_function,
     analyze_imports,
-    resolve_calls,
+    resolve_module_calls,
 )
+from archcheck.infrastructure.parse_cache import ParseCache
 
 if TYPE_CHECKING:
     import pathlib
@@ -38,6 +44,9 @@ DEFAULT_EXCLUDES = frozenset(
     },
 )
 
+# workers=None: one worker per this many files (below it, a pool costs more than it saves)
+FILES_PER_WORKER = 256
+
 
 def parse_file(path: pathlib.Path, root_path: pathlib.Path) -> Module:
     """Parse single Python file to Module.
@@ -52,11 +61,14 @@ def parse_file(path: pathlib.Path, root_path: pathlib.Path) -> Module:
     Raises:
         ParseError: Invalid Python syntax.
     """
-    module_name = _compute_module_name(path, root_path)
-    content = path.read_text(encoding="utf-8")
+    module_name = compute_module_name(path, root_path)
+    return _parse_source(path, module_name, path.read_bytes())
+
 
+def _parse_source(path: pathlib.Path, module_name: str, source: bytes) -> Module:
+    """Parse source (UTF-8 bytes of path) to Module."""
     try:
-        tree = ast.parse(content, filename=str(path))
+        tree = ast.parse(source.decode("utf-8"), filename=str(path))
     except SyntaxError as e:
         raise ParseError(path=str(path), reason=str(e)) from e
 
@@ -79,46 +91,98 @@ def parse_directory(
     path: pathlib.Path,
     *,
     exclude: frozenset[str] = DEFAULT_EXCLUDES,
+    workers: int | None = None,
+    cache_dir: pathlib.Path | None = None,
 ) -> tuple[Codebase, StaticCallGraph]:
     """Parse directory to Codebase and StaticCallGraph.
 
     Args:
         path: Root directory to parse.
         exclude: Directory names to skip.
+        workers: Parser processes. None: one per FILES_PER_WORKER files, at
+            most one per CPU. 1: parse in this process.
+        cache_dir: ParseCache directory. Unchanged files are loaded from it
+            instead of parsed; parsed files are added. None: no cache.
 
     Returns:
-        Tuple of (Codebase, StaticCallGraph).
+        Tuple of (Codebase, StaticCallGraph). Same result for any workers
+        and cache state.
+
+    Raises:
+        ParseError: Any file has invalid syntax.
+        ValueError: workers < 1.
+    """
+    codebase = parse_codebase(path, exclude=exclude, workers=workers, cache_dir=cache_dir)
+    static_graph = build_static_graph(codebase)
+
+    return codebase, static_graph
+
+
+def parse_codebase(
+    path: pathlib.Path,
+    *,
+    exclude: frozenset[str] = DEFAULT_EXCLUDES,
+    workers: int | None = None,
+    cache_dir: pathlib.Path | None = None,
+) -> Codebase:
+    """Parse directory to Codebase (parse_directory() without call resolution).
 
     Raises:
         ParseError: Any file has invalid syntax.
+        ValueError: workers < 1.
     """
+    if workers is not None and workers < 1:
+        msg = f"workers must be >= 1, got {workers}"
+        raise ValueError(msg)
+
     root_path = path
     root_package = path.name
 
     # Find all .py files
-    py_files = _find_python_files(path, exclude)
-
-    # Parse each file
-    modules: dict[str, Module] = {}
-    for py_file in py_files:
-        module = parse_file(py_file, root_path)
-        modules[module.name] = module
-
-    codebase = Codebase(
+    py_files = find_python_files(path, exclude)
+
+    cache = None if cache_dir is None else ParseCache.open(cache_dir)
+    if workers is None:
+        workers = min(os.process_cpu_count() or 1, len(py_files) // FILES_PER_WORKER)
+
+    # Parse each file (file order kept: map() yields in submission order)
+    jobs = [(py_file, root_path, cache) for py_file in py_files]
+    if workers <= 1:
+        parsed = [_parse_job(job) for job in jobs]
+    else:
+        chunksize = max(1, len(jobs) // (workers * 4))
+        with ProcessPoolExecutor(max_workers=workers) as pool:
+            parsed = list(pool.map(_parse_job, jobs, chunksize=chunksize))
+    modules = {module.name: module for module in parsed}
+
+    return Codebase(
         root_path=root_path,
         root_package=root_package,
         modules=modules,
     )
 
-    static_graph = build_static_graph(codebase)
 
-    return codebase, static_graph
+def _parse_job(job: tuple[pathlib.Path, pathlib.Path, ParseCache | None]) -> Module:
+    """Parse one file, through the cache if any (runs in pool workers)."""
+    path, root_path, cache = job
+    module_name = compute_module_name(path, root_path)
+    source = path.read_bytes()
+    if cache is None:
+        return _parse_source(path, module_name, source)
+
+    key = cache.key(module_name, source)
+    module = cache.load(key, path)
+    if module is None:
+        module = _parse_source(path, module_name, source)
+        cache.store(key, module)
+    return module
 
 
 def build_static_graph(codebase: Codebase) -> StaticCallGraph:
     """Build StaticCallGraph from Codebase.
 
-    Resolves all calls in all modules using call_resolver.
+    Resolves all calls in all modules using call_resolver, against one
+    SymbolIndex built for the whole codebase.
 
     Args:
         codebase: Parsed codebase.
@@ -128,9 +192,10 @@ def build_static_graph(codebase: Codebase) -> StaticCallGraph:
     """
     all_edges: list[StaticCallEdge] = []
     all_unresolved: list[UnresolvedCall] = []
+    index = SymbolIndex.of(codebase)
 
     for module in codebase.modules.values():
-        edges, unresolved = resolve_calls(module, codebase)
+        edges, unresolved = resolve_module_calls(module, index)
         all_edges.extend(edges)
         all_unresolved.extend(unresolved)
 
@@ -140,7 +205,7 @@ def build_static_graph(codebase: Codebase) -> StaticCallGraph:
     )
 
 
-def _compute_module_name(path: pathlib.Path, root_path: pathlib.Path) -> str:
+def compute_module_name(path: pathlib.Path, root_path: pathlib.Path) -> str:
     """Compute Python module name from file path.
 
     Examples:
@@ -163,14 +228,14 @@ def _compute_module_name(path: pathlib.Path, root_path: pathlib.Path) -> str:
     return ".".join(parts)
 
 
-def _find_python_files(root: pathlib.Path, exclude: frozenset[str]) -> list[pathlib.Path]:
+def find_python_files(root: pathlib.Path, exclude: frozenset[str]) -> list[pathlib.Path]:
     """Find all .py files in directory, excluding specified directories."""
     result: list[pathlib.Path] = []
 
     for item in root.iterdir():
         if item.is_dir():
             if item.name not in exclude:
-                result.extend(_find_python_files(item, exclude))
+                result.extend(find_python_files(item, exclude))
         elif item.is_file() and item.suffix == ".py":
             result.append(item)
 
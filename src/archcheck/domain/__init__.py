@@ -7,6 +7,8 @@ from archcheck.domain.events import (
     CreationInfo,
     DestroyEvent,
     Event,
+    EventColumns,
+    EventSequence,
     EventType,
     FieldError,
     Location,
@@ -32,6 +34,8 @@ __all__ = [
     "CreationInfo",
     "DestroyEvent",
     "Event",
+    "EventColumns",
+    "EventSequence",
     "EventType",
     "FieldError",
     "Location",
@@ -0,0 +1,81 @@
+"""Domain layer: allocation-site statistics (tracking.start(alloc_sites=True)).
+
+Immutable value objects with invariant validation.
+FAIL-FIRST: invalid input raises immediately.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+from archcheck.domain.exceptions import (
+    FreedExceedsAllocatedError,
+    HistogramCountMismatchError,
+    InvalidCountError,
+)
+
+if TYPE_CHECKING:
+    from archcheck.domain.events import CreationInfo
+    from archcheck.domain.profile import LatencyHistogram
+
+
+@dataclass(frozen=True, slots=True)
+class AllocationSite:
+    """Objects created at one (creation stack, type) site.
+
+    lifetime: distribution of freed objects' lifetimes (power-of-two
+    buckets), None while nothing was freed.
+
+    Invariants:
+        - allocated >= 1
+        - 0 <= freed <= allocated
+        - lifetime counts exactly the freed objects
+    """
+
+    site: CreationInfo
+    allocated: int
+    freed: int
+    lifetime: LatencyHistogram | None
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST on inconsistent counts."""
+        if self.allocated < 1:
+            raise InvalidCountError(self.allocated)
+        if not 0 <= self.freed <= self.allocated:
+            raise FreedExceedsAllocatedError(self.allocated, self.freed)
+        lifetime_count = 0 if self.lifetime is None else self.lifetime.count
+        if lifetime_count != self.freed:
+            raise HistogramCountMismatchError(self.freed, lifetime_count)
+
+    @property
+    def live(self) -> int:
+        """Objects created here and not destroyed yet."""
+        return self.allocated - self.freed
+
+
+@dataclass(frozen=True, slots=True)
+class AllocationSnapshot:
+    """Live-by-site table at one point in time.
+
+    sites: sorted by live count, descending.
+    live_objects: tracked objects alive (sum of live over sites).
+    """
+
+    sites: tuple[AllocationSite, ...]
+    live_objects: int
+
+    def growth(self, earlier: AllocationSnapshot) -> tuple[tuple[AllocationSite, int], ...]:
+        """Sites whose live count grew since earlier, with the increase.
+
+        Both snapshots must come from the same tracking session (sites are
+        matched by creation stack and type). Largest increase first.
+        """
+        before = {entry.site: entry.live for entry in earlier.sites}
+        grown = [
+            (entry, entry.live - before.get(entry.site, 0))
+            for entry in self.sites
+            if entry.live > before.get(entry.site, 0)
+        ]
+        grown.sort(key=lambda pair: pair[1], reverse=True)
+        return tuple(grown)
@@ -0,0 +1,190 @@
+"""Domain layer: integer-id directed graph in CSR (compressed sparse row) form.
+
+Nodes are interned once: id i names names[i]. Adjacency of both
+directions lives in flat arrays: successors of i are
+out_targets[out_offsets[i]:out_offsets[i + 1]] (ascending, no
+duplicates), predecessors likewise in in_sources/in_offsets.
+
+Memory: 4 bytes per edge and direction plus 8 per node and direction,
+versus a dict entry and a frozenset per node and direction.
+
+Traversals (SCC, degrees) run on ids only; callers map ids to names at
+the end.
+"""
+
+from __future__ import annotations
+
+from array import array
+from dataclasses import dataclass, field
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from collections.abc import Iterable, Mapping, Sequence
+
+
+@dataclass(frozen=True, slots=True)
+class CsrGraph:
+    """Immutable directed graph over interned node names.
+
+    Invariants (checked in __post_init__):
+        - offsets have len(names) + 1 entries, ascending, ending at the
+          length of their target array
+        - every target/source id is a node id
+    """
+
+    names: tuple[str, ...]
+    out_offsets: Sequence[int]
+    out_targets: Sequence[int]
+    in_offsets: Sequence[int]
+    in_sources: Sequence[int]
+    ids: Mapping[str, int] = field(init=False, repr=False, compare=False)
+
+    def __post_init__(self) -> None:
+        """Validate array shapes, derive ids."""
+        n = len(self.names)
+        for offsets, targets, name in (
+            (self.out_offsets, self.out_targets, "out"),
+            (self.in_offsets, self.in_sources, "in"),
+        ):
+            if len(offsets) != n + 1 or offsets[0] != 0 or offsets[-1] != len(targets):
+                msg = f"{name}_offsets must have {n + 1} entries from 0 to {len(targets)}"
+                raise ValueError(msg)
+            if any(a > b for a, b in zip(offsets, offsets[1:], strict=False)):
+                msg = f"{name}_offsets must be ascending"
+                raise ValueError(msg)
+            if targets and max(targets) >= n:
+                msg = f"{name} adjacency refers to a node id >= {n}"
+                raise ValueError(msg)
+        ids = {name: i for i, name in enumerate(self.names)}
+        if len(ids) != n:
+            msg = "node names must be unique"
+            raise ValueError(msg)
+        object.__setattr__(self, "ids", ids)
+
+    @classmethod
+    def from_edges(cls, edges: Iterable[tuple[str, str]]) -> CsrGraph:
+        """Build from (source, target) name pairs; duplicates collapse.
+
+        Node ids follow first appearance in edges.
+        """
+        ids: dict[str, int] = {}
+        sources = array("I")
+        targets = array("I")
+        for source, target in edges:
+            sources.append(ids.setdefault(source, len(ids)))
+            targets.append(ids.setdefault(target, len(ids)))
+        n = len(ids)
+
+        # Sorted unique (row, column) keys give each row's entries ascending
+        out_keys = sorted({s * n + t for s, t in zip(sources, targets, strict=True)})
+        in_keys = sorted({t * n + s for s, t in zip(sources, targets, strict=True)})
+        out_offsets, out_targets = _csr(out_keys, n)
+        in_offsets, in_sources = _csr(in_keys, n)
+        return cls(
+            names=tuple(ids),
+            out_offsets=out_offsets,
+            out_targets=out_targets,
+            in_offsets=in_offsets,
+            in_sources=in_sources,
+        )
+
+    def __len__(self) -> int:
+        """Number of nodes."""
+        return len(self.names)
+
+    @property
+    def edge_count(self) -> int:
+        """Number of distinct edges."""
+        return len(self.out_targets)
+
+    def successors(self, node: int) -> Sequence[int]:
+        """Ids node has an edge to, ascending."""
+        return self.out_targets[self.out_offsets[node] : self.out_offsets[node + 1]]
+
+    def predecessors(self, node: int) -> Sequence[int]:
+        """Ids with an edge to node, ascending."""
+        return self.in_sources[self.in_offsets[node] : self.in_offsets[node + 1]]
+
+    def fan_out(self, node: int) -> int:
+        """Number of distinct successors."""
+        return self.out_offsets[node + 1] - self.out_offsets[node]
+
+    def fan_in(self, node: int) -> int:
+        """Number of distinct predecessors."""
+        return self.in_offsets[node + 1] - self.in_offsets[node]
+
+    def strongly_connected_components(self) -> tuple[tuple[int, ...], ...]:
+        """SCCs (Tarjan, iterative), each ascending, in reverse topological order.
+
+        Every node is in exactly one component; a successor's component
+        comes before its predecessor's (unless they share one).
+        """
+        n = len(self.names)
+        index = array("q", [-1]) * n
+        low = array("q", [0]) * n
+        on_stack = bytearray(n)
+        stack: list[int] = []
+        components: list[tuple[int, ...]] = []
+        offsets, targets = self.out_offsets, self.out_targets
+        counter = 0
+
+        for root in range(n):
+            if index[root] != -1:
+                continue
+            # Work stack of (node, next edge position)
+            work = [(root, offsets[root])]
+            index[root] = low[root] = counter
+            counter += 1
+            stack.append(root)
+            on_stack[root] = 1
+            while work:
+                node, pos = work[-1]
+                end = offsets[node + 1]
+                while pos < end:
+                    succ = targets[pos]
+                    pos += 1
+                    if index[succ] == -1:
+                        work[-1] = (node, pos)
+                        work.append((succ, offsets[succ]))
+                        index[succ] = low[succ] = counter
+                        counter += 1
+                        stack.append(succ)
+                        on_stack[succ] = 1
+                        break
+                    if on_stack[succ]:
+                        low[node] = min(low[node], index[succ])
+                else:
+                    work.pop()
+                    if work:
+                        parent = work[-1][0]
+                        low[parent] = min(low[parent], low[node])
+                    if low[node] == index[node]:
+                        component: list[int] = []
+                        while True:
+                            member = stack.pop()
+                            on_stack[member] = 0
+                            component.append(member)
+                            if member == node:
+                                break
+                        components.append(tuple(sorted(component)))
+        return tuple(components)
+
+    def cycles(self) -> tuple[tuple[int, ...], ...]:
+        """SCCs that contain a cycle: several nodes, or one with a self-loop."""
+        return tuple(
+            component
+            for component in self.strongly_connected_components()
+            if len(component) > 1 or component[0] in self.successors(component[0])
+        )
+
+
+def _csr(keys: list[int], n: int) -> tuple[array[int], array[int]]:
+    """Offsets and columns of sorted unique row * n + column keys."""
+    offsets = array("Q", [0]) * (n + 1)
+    columns = array("I", [0]) * len(keys)
+    for position, key in enumerate(keys):
+        row, columns[position] = divmod(key, n)
+        offsets[row + 1] += 1
+    for row in range(n):
+        offsets[row + 1] += offsets[row]
+    return offsets, columns
@@ -0,0 +1,370 @@
+"""Domain layer: ranked differences between two runs (before/after a deploy).
+
+Compares call graphs (edge counts), allocation-site tables (live objects)
+and latency profiles (per function). Each comparison keys and sorts both
+inputs (O(distinct keys) memory, O(n log n)), then merge-joins them in one
+pass; only the ranked result (bounded by limit) is kept after the join.
+merge_join() itself streams: given already-sorted iterables it holds one
+item per side.
+
+Keys are tuples of interned strings and ints, built from value objects
+(Location, CreationInfo), so runs of different processes match by
+content and equal keys compare by identity.
+
+FAIL-FIRST: merge_join() raises UnsortedKeysError on unsorted input.
+"""
+
+from __future__ import annotations
+
+import heapq
+import sys
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+from archcheck.domain.allocations import AllocationSnapshot
+from archcheck.domain.events import CreationInfo
+from archcheck.domain.exceptions import MissingDiffSideError, UnsortedKeysError
+from archcheck.domain.graphs import ObjectFlow
+
+if TYPE_CHECKING:
+    from collections.abc import Callable, Iterable, Iterator, Mapping
+
+    from archcheck.domain.events import Location
+    from archcheck.domain.graphs import CallEdge, CallGraph
+    from archcheck.domain.profile import FunctionProfile, Profile
+
+type LocationKey = tuple[str, int, str]
+type SiteSource = AllocationSnapshot | ObjectFlow | Mapping[CreationInfo, int]
+type _SiteItem = tuple[CreationInfo, int]
+
+
+# =============================================================================
+# Deltas
+# =============================================================================
+
+
+@dataclass(frozen=True, slots=True)
+class EdgeDelta:
+    """Call count change of one caller → callee edge.
+
+    before/after: the edge in each run (None = absent in that run).
+
+    Invariants:
+        - before or after present (FAIL-FIRST in __post_init__)
+    """
+
+    before: CallEdge | None
+    after: CallEdge | None
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST if both runs lack the edge."""
+        if self.before is None and self.after is None:
+            raise MissingDiffSideError
+
+    @property
+    def edge(self) -> CallEdge:
+        """The edge of the later run it appears in (caller, callee)."""
+        if self.after is not None:
+            return self.after
+        if self.before is None:
+            raise MissingDiffSideError
+        return self.before
+
+    @property
+    def is_new(self) -> bool:
+        """Edge appears only after."""
+        return self.before is None
+
+    @property
+    def is_removed(self) -> bool:
+        """Edge appears only before."""
+        return self.after is None
+
+    @property
+    def count_delta(self) -> int:
+        """after.count - before.count (absent = 0)."""
+        return _count(self.after) - _count(self.before)
+
+
+@dataclass(frozen=True, slots=True)
+class SiteDelta:
+    """Live object growth of one allocation site.
+
+    before/after: live objects of the site in each run (0 = absent).
+    """
+
+    site: CreationInfo
+    before: int
+    after: int
+
+    @property
+    def growth(self) -> int:
+        """after - before."""
+        return self.after - self.before
+
+
+@dataclass(frozen=True, slots=True)
+class LatencyShift:
+    """Latency change of one function profiled in both runs."""
+
+    before: FunctionProfile
+    after: FunctionProfile
+
+    @property
+    def function(self) -> Location:
+        """Profiled function."""
+        return self.after.function
+
+    @property
+    def mean_shift_ns(self) -> float:
+        """Change of mean inclusive latency (positive = slower)."""
+        return self.after.inclusive.mean_ns - self.before.inclusive.mean_ns
+
+    def percentile_shift_ns(self, q: float) -> int:
+        """Change of the q-th percentile of inclusive latency (within 12.5%)."""
+        return self.after.inclusive.percentile(q) - self.before.inclusive.percentile(q)
+
+
+@dataclass(frozen=True, slots=True)
+class TraceDiff:
+    """Ranked differences between two runs.
+
+    edges: edges whose count changed, largest |count_delta| first.
+    sites: sites whose live count grew, largest growth first.
+    latency: functions profiled in both runs, largest mean_shift_ns first.
+    """
+
+    edges: tuple[EdgeDelta, ...] = ()
+    sites: tuple[SiteDelta, ...] = ()
+    latency: tuple[LatencyShift, ...] = ()
+
+    @property
+    def new_edges(self) -> tuple[EdgeDelta, ...]:
+        """Edges only after, in rank order."""
+        return tuple(delta for delta in self.edges if delta.is_new)
+
+    @property
+    def removed_edges(self) -> tuple[EdgeDelta, ...]:
+        """Edges only before, in rank order."""
+        return tuple(delta for delta in self.edges if delta.is_removed)
+
+    @property
+    def changed_edges(self) -> tuple[EdgeDelta, ...]:
+        """Edges in both runs with a different count, in rank order."""
+        return tuple(
+            delta for delta in self.edges if not delta.is_new and not delta.is_removed
+        )
+
+
+# =============================================================================
+# Merge-join
+# =============================================================================
+
+
+def merge_join[K, A, B](
+    before: Iterable[tuple[K, A]],
+    after: Iterable[tuple[K, B]],
+) -> Iterator[tuple[K, A | None, B | None]]:
+    """Full outer join of two key-sorted streams in one pass.
+
+    Yields (key, before value, after value) in key order, None for the
+    side missing the key. Consumes each input once, holds one item of each.
+
+    Raises:
+        UnsortedKeysError: A key not greater than the previous key of its
+            input (also on duplicate keys).
+    """
+    left = _ascending(before, "before")
+    right = _ascending(after, "after")
+    a = next(left, None)
+    b = next(right, None)
+    while a is not None and b is not None:
+        if a[0] == b[0]:
+            yield a[0], a[1], b[1]
+            a, b = next(left, None), next(right, None)
+        elif a[0] < b[0]:  # type: ignore[operator]
+            yield a[0], a[1], None
+            a = next(left, None)
+        else:
+            yield b[0], None, b[1]
+            b = next(right, None)
+    while a is not None:
+        yield a[0], a[1], None
+        a = next(left, None)
+    while b is not None:
+        yield b[0], None, b[1]
+        b = next(right, None)
+
+
+def _ascending[K, V](items: Iterable[tuple[K, V]], side: str) -> Iterator[tuple[K, V]]:
+    """Pass items through, FAIL-FIRST on a key out of order."""
+    iterator = iter(items)
+    previous = next(iterator, None)
+    if previous is None:
+        return
+    yield previous
+    for item in iterator:
+        if not previous[0] < item[0]:  # type: ignore[operator]
+            raise UnsortedKeysError(side, item[0])
+        yield item
+        previous = item
+
+
+# =============================================================================
+# Keys
+# =============================================================================
+
+
+def location_key(location: Location) -> LocationKey:
+    """Sort key of a Location: (file, line, func), strings interned.
+
+    None and "" map to the same key (the tracker records neither as a
+    real file or function name).
+    """
+    return (sys.intern(location.file or ""), location.line, sys.intern(location.func or ""))
+
+
+def edge_key(edge: CallEdge) -> tuple[LocationKey, LocationKey]:
+    """Sort key of a CallEdge: (caller key, callee key)."""
+    return location_key(edge.caller), location_key(edge.callee)
+
+
+def site_key(site: CreationInfo) -> tuple[LocationKey, str, tuple[LocationKey, ...]]:
+    """Sort key of an allocation site: (location, type, traceback)."""
+    return (
+        location_key(site.location),
+        sys.intern(site.type_name or ""),
+        tuple(location_key(frame) for frame in site.traceback),
+    )
+
+
+def _sorted_by[T, K](items: Iterable[T], key: Callable[[T], K]) -> list[tuple[K, T]]:
+    """Items paired with their key, in key order."""
+    keyed = [(key(item), item) for item in items]
+    keyed.sort(key=lambda pair: pair[0])  # type: ignore[arg-type,return-value]
+    return keyed
+
+
+# =============================================================================
+# Comparisons
+# =============================================================================
+
+
+def diff_edges(
+    before: CallGraph, after: CallGraph, *, limit: int | None = None
+) -> tuple[EdgeDelta, ...]:
+    """Edges whose call count differs, largest |count_delta| first.
+
+    Args:
+        before: Call graph of the earlier run.
+        after: Call graph of the later run.
+        limit: Keep only the limit largest changes (None = all).
+    """
+    joined = merge_join(
+        _sorted_by(before.edges, edge_key),
+        _sorted_by(after.edges, edge_key),
+    )
+    deltas = (
+        EdgeDelta(before=old, after=new)
+        for _, old, new in joined
+        if _count(old) != _count(new)
+    )
+    return _ranked(deltas, lambda delta: abs(delta.count_delta), limit)
+
+
+def live_by_site(source: SiteSource) -> dict[CreationInfo, int]:
+    """Live objects per allocation site.
+
+    ObjectFlow has no creation stacks: its sites are (creation location,
+    type) with an empty traceback.
+    """
+    match source:
+        case AllocationSnapshot():
+            live: dict[CreationInfo, int] = {}
+            for entry in source.sites:
+                live[entry.site] = live.get(entry.site, 0) + entry.live
+            return live
+        case ObjectFlow():
+            live = {}
+            for lifecycle in source.objects.values():
+                if lifecycle.destroyed is None:
+                    site = CreationInfo(
+                        location=lifecycle.created.location,
+                        type_name=lifecycle.type_name,
+                        traceback=(),
+                    )
+                    live[site] = live.get(site, 0) + 1
+            return live
+        case _:
+            return dict(source)
+
+
+def diff_sites(
+    before: SiteSource, after: SiteSource, *, limit: int | None = None
+) -> tuple[SiteDelta, ...]:
+    """Sites with more live objects after than before, largest growth first.
+
+    Args:
+        before: Allocation sites of the earlier run.
+        after: Allocation sites of the later run.
+        limit: Keep only the limit largest growths (None = all).
+    """
+    joined = merge_join(
+        _sorted_by(live_by_site(before).items(), _site_item_key),
+        _sorted_by(live_by_site(after).items(), _site_item_key),
+    )
+    return _ranked(_site_growth(joined), lambda delta: delta.growth, limit)
+
+
+def _site_item_key(item: _SiteItem) -> tuple[object, ...]:
+    return site_key(item[0])
+
+
+def _site_growth(
+    joined: Iterable[tuple[object, _SiteItem | None, _SiteItem | None]],
+) -> Iterator[SiteDelta]:
+    """SiteDelta of every joined site whose live count grew."""
+    for _, old, new in joined:
+        if new is None:
+            continue
+        site, live = new
+        previous = 0 if old is None else old[1]
+        if live > previous:
+            yield SiteDelta(site=site, before=previous, after=live)
+
+
+def diff_latency(
+    before: Profile, after: Profile, *, limit: int | None = None
+) -> tuple[LatencyShift, ...]:
+    """Functions profiled in both runs, largest mean latency increase first.
+
+    Args:
+        before: Profile of the earlier run.
+        after: Profile of the later run.
+        limit: Keep only the limit largest increases (None = all).
+    """
+
+    def key(function: FunctionProfile) -> LocationKey:
+        return location_key(function.function)
+
+    joined = merge_join(
+        _sorted_by(before.functions, key),
+        _sorted_by(after.functions, key),
+    )
+    shifts = (
+        LatencyShift(before=old, after=new)
+        for _, old, new in joined
+        if old is not None and new is not None
+    )
+    return _ranked(shifts, lambda shift: shift.mean_shift_ns, limit)
+
+
+def _count(edge: CallEdge | None) -> int:
+    return 0 if edge is None else edge.count
+
+
+def _ranked[T](items: Iterable[T], score: Callable[[T], float], limit: int | None) -> tuple[T, ...]:
+    """Highest score first; with limit, a bounded heap keeps the top only."""
+    if limit is None:
+        return tuple(sorted(items, key=score, reverse=True))
+    return tuple(heapq.nlargest(limit, items, key=score))
@@ -6,8 +6,16 @@ All objects frozen, invariants validated in __post_init__.
 
 from __future__ import annotations
 
-from dataclasses import dataclass
+import operator
+from array import array
+from collections.abc import Sequence
+from dataclasses import dataclass, field
 from enum import Enum
+from itertools import accumulate, compress
+from typing import TYPE_CHECKING, overload
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator
 
 
 class EventType(Enum):
@@ -144,8 +152,372 @@ def get_event_type(event: Event) -> EventType:
 class TrackingResult:
     """Result of stop(): all events + any output errors.
 
+    events: tuple, or EventSequence (lazy view over EventColumns) when the
+    tracker returned columns; both compare equal for equal events.
+
     Invariant: all captured data preserved (Data Completeness).
     """
 
-    events: tuple[Event, ...]
+    events: Sequence[Event]
+    output_errors: tuple[OutputError, ...]
+
+
+# EventColumns.kind code → EventType (C EventType order)
+COLUMN_KINDS: tuple[EventType, ...] = (
+    EventType.CALL,
+    EventType.RETURN,
+    EventType.CREATE,
+    EventType.DESTROY,
+)
+
+# array/memoryview format per column (C EventColumns element types)
+COLUMN_FORMATS: dict[str, str] = {
+    "kind": "B",
+    "obj_id": "Q",
+    "type_name": "I",
+    "file": "I",
+    "func": "I",
+    "line": "i",
+    "caller_file": "I",
+    "caller_func": "I",
+    "caller_line": "i",
+    "thread": "I",
+    "task": "Q",
+    "creation": "I",
+    "creation_type": "I",
+    "arg_count": "H",
+    "arg_id": "Q",
+    "arg_name": "I",
+    "arg_type": "I",
+    "stack_parent": "I",
+    "stack_file": "I",
+    "stack_func": "I",
+    "stack_line": "i",
+}
+
+_ARG_COLUMNS = ("arg_id", "arg_name", "arg_type")
+_STACK_COLUMNS = ("stack_parent", "stack_file", "stack_func", "stack_line")
+_ROW_COLUMNS = tuple(
+    name for name in COLUMN_FORMATS if name not in _ARG_COLUMNS + _STACK_COLUMNS
+)
+
+# Stack entries with a fixed meaning (C COLUMN_STACK_NONE / COLUMN_STACK_ROOT)
+_STACK_NONE = 0
+_STACK_ROOT = 1
+_NO_LOCATION = Location(file=None, line=0, func=None)
+
+
+@dataclass(frozen=True, slots=True)
+class EventColumns:
+    """Columnar result of stop_columns(): one contiguous array per field.
+
+    Maps to C EventColumns struct (c/tracking/columns.h).
+    Row i = i-th event in seq order. String columns hold indices into
+    strings (0 = None). kind: 0 CALL, 1 RETURN, 2 CREATE, 3 DESTROY.
+    obj_id 0 on RETURN = no return value; caller_func 0 on CALL = no caller.
+    thread: recording thread, numbered per session in first-event order
+    (CALL/RETURN pair up only within one thread).
+    task: id() of the asyncio.Task running when the event was recorded
+    (0 = none).
+
+    Args of all CALL rows are flattened into arg_*: args of row i start at
+    arg_offsets[i] (prefix sum of arg_count).
+
+    DESTROY creation context: creation[i] is an entry of the stack table
+    stack_* (0 = no creation context, 1 = empty stack), creation_type[i]
+    the type at creation. Entry k is frame (stack_file, stack_line,
+    stack_func)[k] on top of entry stack_parent[k]; stacks shared by many
+    objects are stored once.
+
+    Locations, tracebacks and creation contexts are flyweights: built once
+    per distinct value, shared by every event materialized from it.
+
+    Invariant: row columns equal length, arg columns cover sum(arg_count),
+    stack columns equal length, every creation inside the stack table.
+    """
+
+    kind: Sequence[int]
+    obj_id: Sequence[int]
+    type_name: Sequence[int]
+    file: Sequence[int]
+    func: Sequence[int]
+    line: Sequence[int]
+    caller_file: Sequence[int]
+    caller_func: Sequence[int]
+    caller_line: Sequence[int]
+    thread: Sequence[int]
+    task: Sequence[int]
+    creation: Sequence[int]
+    creation_type: Sequence[int]
+    arg_count: Sequence[int]
+    arg_id: Sequence[int]
+    arg_name: Sequence[int]
+    arg_type: Sequence[int]
+    stack_parent: Sequence[int]
+    stack_file: Sequence[int]
+    stack_func: Sequence[int]
+    stack_line: Sequence[int]
+    strings: tuple[str | None, ...]
+    errors: tuple[tuple[int, tuple[FieldError, ...]], ...]
     output_errors: tuple[OutputError, ...]
+    arg_offsets: Sequence[int] = field(init=False, repr=False, compare=False)
+    _locations: dict[tuple[int, int, int], Location] = field(
+        init=False, repr=False, compare=False
+    )
+    _tracebacks: dict[int, tuple[Location, ...]] = field(init=False, repr=False, compare=False)
+    _creations: dict[tuple[int, int], CreationInfo] = field(
+        init=False, repr=False, compare=False
+    )
+    _row_errors: dict[int, tuple[FieldError, ...]] = field(
+        init=False, repr=False, compare=False
+    )
+
+    def __post_init__(self) -> None:
+        """Validate column lengths, derive arg_offsets and flyweight caches."""
+        rows = len(self.kind)
+        for name in _ROW_COLUMNS:
+            if len(getattr(self, name)) != rows:
+                msg = f"column {name} has {len(getattr(self, name))} rows, expected {rows}"
+                raise ValueError(msg)
+        offsets = array("Q", accumulate(self.arg_count, initial=0))
+        for name in _ARG_COLUMNS:
+            if len(getattr(self, name)) != offsets[-1]:
+                msg = f"column {name} has {len(getattr(self, name))} args, expected {offsets[-1]}"
+                raise ValueError(msg)
+        stacks = len(self.stack_parent)
+        for name in _STACK_COLUMNS:
+            if len(getattr(self, name)) != stacks:
+                msg = f"column {name} has {len(getattr(self, name))} entries, expected {stacks}"
+                raise ValueError(msg)
+        if max(self.creation, default=0) >= max(stacks, 1):
+            msg = f"column creation refers past the {stacks} stack entries"
+            raise ValueError(msg)
+        if not self.strings or self.strings[0] is not None:
+            msg = "strings[0] must be None"
+            raise ValueError(msg)
+        object.__setattr__(self, "arg_offsets", memoryview(offsets))
+        object.__setattr__(self, "_locations", {})
+        object.__setattr__(self, "_tracebacks", {_STACK_NONE: (), _STACK_ROOT: ()})
+        object.__setattr__(self, "_creations", {})
+        object.__setattr__(self, "_row_errors", dict(self.errors))
+
+    def __len__(self) -> int:
+        """Number of events (rows)."""
+        return len(self.kind)
+
+    def event_type(self, row: int) -> EventType:
+        """EventType of row."""
+        return COLUMN_KINDS[self.kind[row]]
+
+    def location(self, row: int) -> Location:
+        """Location of row."""
+        return self._location(self.file[row], self.line[row], self.func[row])
+
+    def caller(self, row: int) -> Location | None:
+        """Caller of CALL row, None if not recorded."""
+        if self.caller_func[row] == 0:
+            return None
+        return self._location(self.caller_file[row], self.caller_line[row], self.caller_func[row])
+
+    def creation_info(self, row: int) -> CreationInfo | None:
+        """Creation context of DESTROY row, None if not recorded."""
+        entry = self.creation[row]
+        if entry == _STACK_NONE:
+            return None
+        key = (entry, self.creation_type[row])
+        info = self._creations.get(key)
+        if info is None:
+            traceback = self._traceback(entry)
+            info = CreationInfo(
+                location=traceback[0] if traceback else _NO_LOCATION,
+                type_name=self.strings[key[1]],
+                traceback=traceback,
+            )
+            self._creations[key] = info
+        return info
+
+    def event(self, row: int, errors: tuple[FieldError, ...] | None = None) -> Event:
+        """Materialize one row as domain Event.
+
+        Args:
+            row: Row index.
+            errors: Field errors of a CALL row; None = those recorded in errors.
+
+        Raises:
+            ValueError: CREATE/DESTROY row without type name.
+        """
+        if errors is None:
+            errors = self._row_errors.get(row, ())
+        location = self.location(row)
+        match self.event_type(row):
+            case EventType.CALL:
+                start = self.arg_offsets[row]
+                args = tuple(
+                    ArgInfo(
+                        name=self.strings[self.arg_name[j]],
+                        obj_id=self.arg_id[j],
+                        type_name=self.strings[self.arg_type[j]],
+                    )
+                    for j in range(start, start + self.arg_count[row])
+                )
+                return CallEvent(
+                    location=location, caller=self.caller(row), args=args, errors=errors
+                )
+            case EventType.RETURN:
+                has_value = self.obj_id[row] != 0
+                return ReturnEvent(
+                    location=location,
+                    return_id=self.obj_id[row] if has_value else None,
+                    return_type=self.strings[self.type_name[row]] if has_value else None,
+                )
+            case EventType.CREATE:
+                return CreateEvent(
+                    location=location, obj_id=self.obj_id[row], type_name=self._type(row)
+                )
+            case EventType.DESTROY:
+                return DestroyEvent(
+                    location=location,
+                    obj_id=self.obj_id[row],
+                    type_name=self._type(row),
+                    creation=self.creation_info(row),
+                )
+
+    def _location(self, file: int, line: int, func: int) -> Location:
+        key = (file, line, func)
+        location = self._locations.get(key)
+        if location is None:
+            location = Location(file=self.strings[file], line=line, func=self.strings[func])
+            self._locations[key] = location
+        return location
+
+    def _traceback(self, entry: int) -> tuple[Location, ...]:
+        """Frames of stack entry, innermost first (memoized per entry)."""
+        chain: list[int] = []
+        while entry not in self._tracebacks:
+            chain.append(entry)
+            if len(chain) > len(self.stack_parent):
+                msg = f"stack entry {chain[0]}: parent chain does not reach the root"
+                raise ValueError(msg)
+            entry = self.stack_parent[entry]
+        traceback = self._tracebacks[entry]
+        for k in reversed(chain):
+            frame = self._location(self.stack_file[k], self.stack_line[k], self.stack_func[k])
+            traceback = (frame, *traceback)
+            self._tracebacks[k] = traceback
+        return traceback
+
+    def _type(self, row: int) -> str:
+        type_name = self.strings[self.type_name[row]]
+        if type_name is None:
+            msg = f"row {row}: {self.event_type(row).value} without type name"
+            raise ValueError(msg)
+        return type_name
+
+    def to_result(self) -> TrackingResult:
+        """All rows as TrackingResult; events materialized lazily (EventSequence)."""
+        return TrackingResult(events=EventSequence(self), output_errors=self.output_errors)
+
+    def select(self, rows: Sequence[int]) -> EventColumns:
+        """New columns with the given rows (ascending), args and errors kept."""
+        columns: dict[str, Sequence[int]] = {}
+        for name in _ROW_COLUMNS:
+            column = getattr(self, name)
+            columns[name] = memoryview(array(COLUMN_FORMATS[name], map(column.__getitem__, rows)))
+        arg_count, offsets = self.arg_count, self.arg_offsets
+        arg_rows = [
+            j for r in rows if arg_count[r] for j in range(offsets[r], offsets[r] + arg_count[r])
+        ]
+        for name in _ARG_COLUMNS:
+            column = getattr(self, name)
+            columns[name] = memoryview(
+                array(COLUMN_FORMATS[name], map(column.__getitem__, arg_rows))
+            )
+        for name in _STACK_COLUMNS:
+            columns[name] = getattr(self, name)
+
+        errors: tuple[tuple[int, tuple[FieldError, ...]], ...] = ()
+        if self.errors:
+            new_row = {r: i for i, r in enumerate(rows)}
+            errors = tuple((new_row[r], errs) for r, errs in self.errors if r in new_row)
+        return EventColumns(
+            **columns,
+            strings=self.strings,
+            errors=errors,
+            output_errors=self.output_errors,
+        )
+
+
+class EventSequence(Sequence[Event]):
+    """Lazy events over EventColumns rows: each event built on access.
+
+    len(), slicing and of_type() work on row indices only; no event object
+    exists until it is indexed or iterated. Events are the ordinary frozen
+    dataclasses (isinstance, match), with Location flyweights shared
+    through the columns. Compares equal to any sequence of equal events.
+    """
+
+    __slots__ = ("_columns", "_rows")
+
+    def __init__(self, columns: EventColumns, rows: Sequence[int] | None = None) -> None:
+        """View rows of columns (ascending), every row if None."""
+        self._columns = columns
+        self._rows: Sequence[int] = range(len(columns)) if rows is None else rows
+
+    @property
+    def columns(self) -> EventColumns:
+        """Columns this view reads."""
+        return self._columns
+
+    @property
+    def rows(self) -> Sequence[int]:
+        """Row of each event in columns."""
+        return self._rows
+
+    def to_columns(self) -> EventColumns:
+        """Columns holding exactly the viewed rows (no copy for a full view)."""
+        if self._rows == range(len(self._columns)):
+            return self._columns
+        return self._columns.select(self._rows)
+
+    def of_type(self, *event_types: EventType) -> EventSequence:
+        """View of the events of the given types, order kept."""
+        codes = frozenset(COLUMN_KINDS.index(t) for t in event_types)
+        kind = self._columns.kind
+        keep = (kind[row] in codes for row in self._rows)
+        return EventSequence(self._columns, array("Q", compress(self._rows, keep)))
+
+    def __len__(self) -> int:
+        """Number of events (rows)."""
+        return len(self._rows)
+
+    @overload
+    def __getitem__(self, index: int) -> Event: ...
+
+    @overload
+    def __getitem__(self, index: slice) -> EventSequence: ...
+
+    def __getitem__(self, index: int | slice) -> Event | EventSequence:
+        """Event at index, or lazy view of a slice."""
+        if isinstance(index, slice):
+            return EventSequence(self._columns, self._rows[index])
+        return self._columns.event(self._rows[operator.index(index)])
+
+    def __iter__(self) -> Iterator[Event]:
+        """Events in order, built one at a time."""
+        event = self._columns.event
+        for row in self._rows:
+            yield event(row)
+
+    def __eq__(self, other: object) -> bool:
+        """Equal to any sequence of equal events."""
+        if not isinstance(other, Sequence) or isinstance(other, str | bytes):
+            return NotImplemented
+        return len(self) == len(other) and all(a == b for a, b in zip(self, other, strict=True))
+
+    def __hash__(self) -> int:
+        """Hash of the equal tuple of events."""
+        return hash(tuple(self))
+
+    def __repr__(self) -> str:
+        """Size only: events are not built for repr."""
+        return f"EventSequence({len(self)} events)"
@@ -4,6 +4,8 @@ Hexagonal architecture: all exceptions visible to users defined in domain.
 Infrastructure/Application use these, not define their own public exceptions.
 """
 
+import functools
+
 
 class ArchCheckError(Exception):
     """Base for all archcheck error exceptions.
@@ -81,6 +83,10 @@ class ParseError(ArchCheckError, SyntaxError):
         self.reason = reason
         super().__init__(f"{path}: {reason}")
 
+    def __reduce__(self) -> tuple[object, ...]:
+        """Pickle by keyword arguments (raised in parse_directory workers)."""
+        return (functools.partial(type(self), path=self.path, reason=self.reason), ())
+
 
 class StopTracking(ArchCheckSignal):
     """Signal to stop tracking gracefully.
@@ -149,6 +155,21 @@ class InvalidCountError(ArchCheckError, ValueError):
         super().__init__(f"count must be >= 1, got {count}")
 
 
+class InvalidDurationError(ArchCheckError, ValueError):
+    """Duration must be >= 0.
+
+    Raised when CallEdge has negative total_ns.
+
+    Attributes:
+        total_ns: Invalid duration value.
+    """
+
+    def __init__(self, total_ns: int) -> None:
+        """Initialize with invalid duration."""
+        self.total_ns = total_ns
+        super().__init__(f"total_ns must be >= 0, got {total_ns}")
+
+
 class ObjectIdMismatchError(ArchCheckError, ValueError):
     """Object ID mismatch in lifecycle.
 
@@ -241,3 +262,115 @@ class MissingEdgeSourceError(ArchCheckError, ValueError):
     def __init__(self) -> None:
         """Initialize with fixed message."""
         super().__init__("at least one of static or runtime must be present")
+
+
+class TraceFormatError(ArchCheckError, ValueError):
+    """Binary trace file is malformed or of an unsupported version.
+
+    Raised by the trace reader on bad magic, truncated sections,
+    unknown record kinds or foreign byte order.
+
+    Attributes:
+        path: Trace file path.
+        reason: What is wrong with the file.
+    """
+
+    def __init__(self, *, path: str, reason: str) -> None:
+        """Initialize with file path and reason."""
+        self.path = path
+        self.reason = reason
+        super().__init__(f"{path}: {reason}")
+
+
+class InvalidBucketError(ArchCheckError, ValueError):
+    """Histogram bucket bounds must satisfy 0 <= lower_ns < upper_ns.
+
+    Raised when LatencyBucket has empty or negative bounds.
+
+    Attributes:
+        lower_ns: Invalid lower bound.
+        upper_ns: Invalid upper bound.
+    """
+
+    def __init__(self, lower_ns: int, upper_ns: int) -> None:
+        """Initialize with invalid bounds."""
+        self.lower_ns = lower_ns
+        self.upper_ns = upper_ns
+        super().__init__(
+            f"bucket must satisfy 0 <= lower_ns < upper_ns, got [{lower_ns}, {upper_ns})"
+        )
+
+
+class HistogramCountMismatchError(ArchCheckError, ValueError):
+    """Histogram counts disagree.
+
+    Raised when LatencyHistogram buckets do not sum to its count, or when
+    FunctionProfile inclusive and exclusive histograms count different calls.
+
+    Attributes:
+        expected: Count the histogram claims.
+        actual: Count found.
+    """
+
+    def __init__(self, expected: int, actual: int) -> None:
+        """Initialize with both counts."""
+        self.expected = expected
+        self.actual = actual
+        super().__init__(f"histogram count mismatch: expected {expected}, got {actual}")
+
+
+class InvalidPercentileError(ArchCheckError, ValueError):
+    """Percentile must be in [0, 100].
+
+    Attributes:
+        q: Invalid percentile.
+    """
+
+    def __init__(self, q: float) -> None:
+        """Initialize with invalid percentile."""
+        self.q = q
+        super().__init__(f"percentile must be in [0, 100], got {q}")
+
+
+class FreedExceedsAllocatedError(ArchCheckError, ValueError):
+    """An allocation site cannot free more objects than it allocated.
+
+    Attributes:
+        allocated: Objects allocated at the site.
+        freed: Invalid freed count.
+    """
+
+    def __init__(self, allocated: int, freed: int) -> None:
+        """Initialize with both counts."""
+        self.allocated = allocated
+        self.freed = freed
+        super().__init__(f"freed must be in [0, allocated={allocated}], got {freed}")
+
+
+class MissingDiffSideError(ArchCheckError, ValueError):
+    """An EdgeDelta needs the edge in at least one run.
+
+    Raised when both before and after are None.
+    """
+
+    def __init__(self) -> None:
+        """Initialize with fixed message."""
+        super().__init__("at least one of before or after must be present")
+
+
+class UnsortedKeysError(ArchCheckError, ValueError):
+    """Merge-join input is not strictly ascending by key.
+
+    Raised by diff.merge_join() on a key not greater than its predecessor
+    (unsorted stream or duplicate key).
+
+    Attributes:
+        side: Which input ("before" or "after").
+        key: Offending key.
+    """
+
+    def __init__(self, side: str, key: object) -> None:
+        """Initialize with input side and key."""
+        self.side = side
+        self.key = key
+        super().__init__(f"{side} keys must be strictly ascending, got {key!r} out of order")
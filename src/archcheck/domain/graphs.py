@@ -6,10 +6,15 @@ FAIL-FIRST: invalid input raises immediately.
 
 from __future__ import annotations
 
+import fnmatch
 from dataclasses import dataclass
 from typing import TYPE_CHECKING
 
-from archcheck.domain.exceptions import InvalidCountError, ObjectIdMismatchError
+from archcheck.domain.exceptions import (
+    InvalidCountError,
+    InvalidDurationError,
+    ObjectIdMismatchError,
+)
 
 if TYPE_CHECKING:
     from collections.abc import Mapping
@@ -18,6 +23,7 @@ if TYPE_CHECKING:
         CallEvent,
         CreateEvent,
         DestroyEvent,
+        EventColumns,
         EventType,
         Location,
         ReturnEvent,
@@ -29,8 +35,12 @@ if TYPE_CHECKING:
 class CallEdge:
     """Edge in call graph: caller → callee with invocation count.
 
+    total_ns: inclusive wall time of the counted calls, only when measured
+    (tracking.start(aggregate=True, aggregate_time=True)); None otherwise.
+
     Invariants:
         - count >= 1 (FAIL-FIRST in __post_init__)
+        - total_ns >= 0 if present (FAIL-FIRST in __post_init__)
 
     Note: self-loops (caller == callee) filtered during CallGraph construction,
     not here. CallEdge is a value object, validation at construction level.
@@ -39,11 +49,14 @@ class CallEdge:
     caller: Location
     callee: Location
     count: int
+    total_ns: int | None = None
 
     def __post_init__(self) -> None:
-        """Validate invariants. FAIL-FIRST on invalid count."""
+        """Validate invariants. FAIL-FIRST on invalid count or duration."""
         if self.count < 1:
             raise InvalidCountError(self.count)
+        if self.total_ns is not None and self.total_ns < 0:
+            raise InvalidDurationError(self.total_ns)
 
 
 @dataclass(frozen=True, slots=True)
@@ -120,6 +133,18 @@ class FilterConfig:
     exclude_paths: tuple[str, ...] = ()
     include_types: frozenset[EventType] | None = None
 
+    def path_passes(self, file_path: str) -> bool:
+        """Check include_paths / exclude_paths (fnmatch) for one file path."""
+        # include_paths: must match at least one pattern (if specified)
+        if self.include_paths and not any(
+            fnmatch.fnmatch(file_path, p) for p in self.include_paths
+        ):
+            return False
+        # exclude_paths: must not match any pattern
+        return not (
+            self.exclude_paths and any(fnmatch.fnmatch(file_path, p) for p in self.exclude_paths)
+        )
+
 
 @dataclass(frozen=True, slots=True)
 class AnalysisResult:
@@ -129,6 +154,6 @@ class AnalysisResult:
     Immutable composition of all analysis artifacts.
     """
 
-    filtered: TrackingResult
+    filtered: TrackingResult | EventColumns
     call_graph: CallGraph
     object_flow: ObjectFlow
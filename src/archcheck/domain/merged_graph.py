@@ -1,19 +1,22 @@
 """Domain layer: merged call graph (static + runtime).
 
 Combines static analysis from AST with runtime tracking.
-Indexes computed once in __post_init__ for O(1) lookups.
+Indexes computed once in __post_init__ (one pass over edges): adjacency
+is an integer-id CsrGraph; by_caller/by_callee are FQN views over it.
 """
 
 from __future__ import annotations
 
+from collections.abc import Mapping
 from dataclasses import dataclass, field
 from enum import Enum
 from typing import TYPE_CHECKING
 
+from archcheck.domain.csr_graph import CsrGraph
 from archcheck.domain.exceptions import MissingEdgeSourceError
 
 if TYPE_CHECKING:
-    from collections.abc import Mapping
+    from collections.abc import Iterator, Sequence
 
     from archcheck.domain.graphs import CallEdge
     from archcheck.domain.static_graph import StaticCallEdge
@@ -57,17 +60,58 @@ class MergedCallEdge:
             raise MissingEdgeSourceError
 
 
+class _AdjacencyView(Mapping[str, frozenset[str]]):
+    """FQN → neighbour FQNs, read from one direction of a CsrGraph.
+
+    Keys: nodes with at least one neighbour in that direction. Each
+    frozenset is built on access; nothing per node is stored.
+    """
+
+    __slots__ = ("_graph", "_offsets", "_neighbours")
+
+    def __init__(self, graph: CsrGraph, offsets: Sequence[int], neighbours: Sequence[int]) -> None:
+        self._graph = graph
+        self._offsets = offsets
+        self._neighbours = neighbours
+
+    def __getitem__(self, fqn: str) -> frozenset[str]:
+        node = self._graph.ids[fqn]
+        start, end = self._offsets[node], self._offsets[node + 1]
+        if start == end:
+            raise KeyError(fqn)
+        names = self._graph.names
+        return frozenset(names[i] for i in self._neighbours[start:end])
+
+    def __contains__(self, fqn: object) -> bool:
+        node = self._graph.ids.get(fqn) if isinstance(fqn, str) else None
+        return node is not None and self._offsets[node] != self._offsets[node + 1]
+
+    def __iter__(self) -> Iterator[str]:
+        offsets, names = self._offsets, self._graph.names
+        return (names[i] for i in range(len(names)) if offsets[i] != offsets[i + 1])
+
+    def __len__(self) -> int:
+        offsets = self._offsets
+        return sum(1 for i in range(len(self._graph)) if offsets[i] != offsets[i + 1])
+
+    def __repr__(self) -> str:
+        return f"{type(self).__name__}({dict(self)!r})"
+
+
 @dataclass(frozen=True, slots=True)
 class MergedCallGraph:
     """Merged call graph with precomputed indexes.
 
     edges: all merged edges
     nodes: all unique FQNs (caller + callee)
-    by_caller: caller_fqn → set of callee_fqns
-    by_callee: callee_fqn → set of caller_fqns
+    graph: integer-id CSR adjacency (node id = first appearance in edges)
+    by_caller: caller_fqn → set of callee_fqns (view over graph)
+    by_callee: callee_fqn → set of caller_fqns (view over graph)
     by_nature: EdgeNature → edges with that nature
 
-    Indexes computed once in __post_init__ for O(1) lookups.
+    Indexes computed once in __post_init__. Validators traversing the
+    graph many times should work on graph ids (fan_in, fan_out, cycles)
+    and map back via graph.names.
     """
 
     edges: tuple[MergedCallEdge, ...]
@@ -75,41 +119,25 @@ class MergedCallGraph:
     by_caller: Mapping[str, frozenset[str]] = field(default_factory=dict)
     by_callee: Mapping[str, frozenset[str]] = field(default_factory=dict)
     by_nature: Mapping[EdgeNature, tuple[MergedCallEdge, ...]] = field(default_factory=dict)
+    graph: CsrGraph = field(init=False, repr=False, compare=False)
 
     def __post_init__(self) -> None:
-        """Compute indexes from edges."""
-        # Collect nodes
-        nodes: set[str] = set()
-        for edge in self.edges:
-            nodes.add(edge.caller_fqn)
-            nodes.add(edge.callee_fqn)
-
-        # Build by_caller: caller → callees
-        by_caller: dict[str, set[str]] = {}
-        for edge in self.edges:
-            by_caller.setdefault(edge.caller_fqn, set()).add(edge.callee_fqn)
-
-        # Build by_callee: callee → callers
-        by_callee: dict[str, set[str]] = {}
-        for edge in self.edges:
-            by_callee.setdefault(edge.callee_fqn, set()).add(edge.caller_fqn)
-
-        # Build by_nature: nature → edges
+        """Compute indexes from edges in one pass."""
         by_nature: dict[EdgeNature, list[MergedCallEdge]] = {}
+        pairs: list[tuple[str, str]] = []
         for edge in self.edges:
+            pairs.append((edge.caller_fqn, edge.callee_fqn))
             by_nature.setdefault(edge.nature, []).append(edge)
+        graph = CsrGraph.from_edges(pairs)
 
         # Freeze and assign via object.__setattr__ (frozen dataclass)
-        object.__setattr__(self, "nodes", frozenset(nodes))
+        object.__setattr__(self, "graph", graph)
+        object.__setattr__(self, "nodes", frozenset(graph.names))
         object.__setattr__(
-            self,
-            "by_caller",
-            {k: frozenset(v) for k, v in by_caller.items()},
+            self, "by_caller", _AdjacencyView(graph, graph.out_offsets, graph.out_targets)
         )
         object.__setattr__(
-            self,
-            "by_callee",
-            {k: frozenset(v) for k, v in by_callee.items()},
+            self, "by_callee", _AdjacencyView(graph, graph.in_offsets, graph.in_sources)
         )
         object.__setattr__(
             self,
@@ -121,3 +149,20 @@ class MergedCallGraph:
     def empty(cls) -> MergedCallGraph:
         """Create empty graph for tests or initial state."""
         return cls(edges=())
+
+    def fan_out(self, fqn: str) -> int:
+        """Distinct callees of fqn (0 if not a node)."""
+        node = self.graph.ids.get(fqn)
+        return 0 if node is None else self.graph.fan_out(node)
+
+    def fan_in(self, fqn: str) -> int:
+        """Distinct callers of fqn (0 if not a node)."""
+        node = self.graph.ids.get(fqn)
+        return 0 if node is None else self.graph.fan_in(node)
+
+    def cycles(self) -> tuple[frozenset[str], ...]:
+        """Call cycles: strongly connected components with a cycle (incl. recursion)."""
+        names = self.graph.names
+        return tuple(
+            frozenset(names[i] for i in component) for component in self.graph.cycles()
+        )
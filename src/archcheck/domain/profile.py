@@ -0,0 +1,138 @@
+"""Domain layer: per-function latency profile (tracking.start(profile=True)).
+
+Immutable value objects with invariant validation.
+FAIL-FIRST: invalid input raises immediately.
+"""
+
+from __future__ import annotations
+
+import math
+from dataclasses import dataclass
+from typing import TYPE_CHECKING
+
+from archcheck.domain.exceptions import (
+    HistogramCountMismatchError,
+    InvalidBucketError,
+    InvalidCountError,
+    InvalidDurationError,
+    InvalidPercentileError,
+)
+
+if TYPE_CHECKING:
+    from archcheck.domain.events import Location
+
+
+@dataclass(frozen=True, slots=True)
+class LatencyBucket:
+    """Histogram bucket: count values (ns) fell in lower_ns <= t < upper_ns.
+
+    Profile buckets are log-linear (8 per power of two), so upper_ns -
+    lower_ns is at most 1/8 of lower_ns: any value is known within 12.5%.
+    Object lifetime buckets (allocations.py) are powers of two.
+
+    Invariants:
+        - 0 <= lower_ns < upper_ns (FAIL-FIRST in __post_init__)
+        - count >= 1 (empty buckets are not reported)
+    """
+
+    lower_ns: int
+    upper_ns: int
+    count: int
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST on invalid bounds or count."""
+        if self.lower_ns < 0 or self.upper_ns <= self.lower_ns:
+            raise InvalidBucketError(self.lower_ns, self.upper_ns)
+        if self.count < 1:
+            raise InvalidCountError(self.count)
+
+
+@dataclass(frozen=True, slots=True)
+class LatencyHistogram:
+    """Latency distribution of one function's calls.
+
+    count, total_ns, min_ns and max_ns are exact; percentiles come from
+    the buckets (ascending, non-empty only).
+
+    Invariants:
+        - count >= 1
+        - 0 <= min_ns <= max_ns, total_ns >= 0
+        - bucket counts sum to count
+    """
+
+    count: int
+    total_ns: int
+    min_ns: int
+    max_ns: int
+    buckets: tuple[LatencyBucket, ...]
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST on inconsistent stats."""
+        if self.count < 1:
+            raise InvalidCountError(self.count)
+        for value in (self.total_ns, self.min_ns, self.max_ns - self.min_ns):
+            if value < 0:
+                raise InvalidDurationError(value)
+        bucket_total = sum(bucket.count for bucket in self.buckets)
+        if bucket_total != self.count:
+            raise HistogramCountMismatchError(self.count, bucket_total)
+
+    @property
+    def mean_ns(self) -> float:
+        """Mean latency (exact)."""
+        return self.total_ns / self.count
+
+    def percentile(self, q: float) -> int:
+        """Latency below which q percent of calls fall (within 12.5%).
+
+        Reports the highest value of the bucket holding the rank, clamped
+        to [min_ns, max_ns]: percentile(0) == min_ns, percentile(100) == max_ns.
+
+        Raises:
+            InvalidPercentileError: q outside [0, 100].
+        """
+        if not 0 <= q <= 100:
+            raise InvalidPercentileError(q)
+        if q == 0:
+            return self.min_ns
+        rank = max(1, math.ceil(q / 100 * self.count))
+        seen = 0
+        for bucket in self.buckets:
+            seen += bucket.count
+            if seen >= rank:
+                return max(self.min_ns, min(bucket.upper_ns - 1, self.max_ns))
+        return self.max_ns
+
+
+@dataclass(frozen=True, slots=True)
+class FunctionProfile:
+    """Latency of one function.
+
+    inclusive: wall time from entry to return.
+    exclusive: inclusive minus time in profiled callees (callees skipped by
+    filter or sampling count as this function's own time).
+
+    Invariants:
+        - inclusive and exclusive count the same calls
+    """
+
+    function: Location
+    inclusive: LatencyHistogram
+    exclusive: LatencyHistogram
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST on mismatched histograms."""
+        if self.exclusive.count != self.inclusive.count:
+            raise HistogramCountMismatchError(self.inclusive.count, self.exclusive.count)
+
+
+@dataclass(frozen=True, slots=True)
+class Profile:
+    """Result of tracking.stop_profile().
+
+    functions: sorted by inclusive total time, descending.
+    clock: timestamp source ("monotonic", "coarse" or "tsc").
+    """
+
+    functions: tuple[FunctionProfile, ...]
+    clock: str
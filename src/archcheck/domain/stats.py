@@ -0,0 +1,132 @@
+"""Domain layer: tracker self-instrumentation (tracking.stats()).
+
+Immutable value objects describing the tracker itself while it runs:
+what it recorded and dropped, the memory of its tables, barrier
+contention and the time spent inside its hooks.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+
+from archcheck.domain.events import EventType
+
+
+@dataclass(frozen=True, slots=True)
+class DropCounts:
+    """Events the tracker saw but did not record.
+
+    oom: no memory for the record (or for the thread's buffer).
+    stopping: hook fired while tracking was starting, stopping or paused
+        around fork().
+    shm: shared-memory mode only, records that did not fit in a ring.
+    """
+
+    oom: int
+    stopping: int
+    shm: int
+
+    @property
+    def total(self) -> int:
+        """All dropped events."""
+        return self.oom + self.stopping + self.shm
+
+
+@dataclass(frozen=True, slots=True)
+class TrackerStats:
+    """Counters of the running tracker (one tracking.stats() call).
+
+    Counters are read one by one while hooks keep running: each value is
+    exact, values are not a consistent snapshot across counters.
+
+    Memory (bytes): event_bytes records reserved this session (drained
+    and flushed records included), creation_map_bytes object -> creation
+    table, string_bytes interned strings, stack_bytes creation-stack trie.
+
+    Hook time: one hook call in hook_sample_every per thread is timed;
+    hook_ns extrapolates the sample to every call.
+    """
+
+    events: dict[EventType, int]
+    dropped: DropCounts
+    event_bytes: int
+    creation_map_bytes: int
+    string_bytes: int
+    stack_bytes: int
+    creation_map_size: int
+    creation_map_buckets: int
+    strings: int
+    stacks: int
+    sites: int
+    threads: int
+    barrier_refused: int
+    barrier_stops: int
+    barrier_stop_wait_ns: int
+    hook_samples: int
+    hook_sampled_ns: int
+    hook_sample_every: int
+
+    @property
+    def recorded(self) -> int:
+        """Events recorded, all types."""
+        return sum(self.events.values())
+
+    @property
+    def memory_bytes(self) -> int:
+        """Bytes held by every tracker table."""
+        return self.event_bytes + self.creation_map_bytes + self.string_bytes + self.stack_bytes
+
+    @property
+    def creation_map_load(self) -> float:
+        """Creation map entries per bucket (0.0 when empty)."""
+        if self.creation_map_buckets == 0:
+            return 0.0
+        return self.creation_map_size / self.creation_map_buckets
+
+    @property
+    def hook_ns(self) -> int:
+        """Estimated time inside the hooks, all calls."""
+        return self.hook_sampled_ns * self.hook_sample_every
+
+    def to_prometheus(self, prefix: str = "archcheck_tracker") -> str:
+        """Prometheus text exposition format, one sample per line."""
+        lines: list[str] = []
+
+        def metric(name: str, kind: str, samples: list[tuple[str, int | float]]) -> None:
+            lines.append(f"# TYPE {prefix}_{name} {kind}")
+            lines.extend(f"{prefix}_{name}{labels} {value}" for labels, value in samples)
+
+        metric(
+            "events_total",
+            "counter",
+            [(f'{{type="{kind.value}"}}', count) for kind, count in self.events.items()],
+        )
+        metric(
+            "dropped_total",
+            "counter",
+            [
+                ('{reason="oom"}', self.dropped.oom),
+                ('{reason="stopping"}', self.dropped.stopping),
+                ('{reason="shm"}', self.dropped.shm),
+            ],
+        )
+        metric(
+            "memory_bytes",
+            "gauge",
+            [
+                ('{table="events"}', self.event_bytes),
+                ('{table="creation_map"}', self.creation_map_bytes),
+                ('{table="strings"}', self.string_bytes),
+                ('{table="stacks"}', self.stack_bytes),
+            ],
+        )
+        metric("creation_map_load", "gauge", [("", self.creation_map_load)])
+        metric("strings", "gauge", [("", self.strings)])
+        metric("stacks", "gauge", [("", self.stacks)])
+        metric("sites", "gauge", [("", self.sites)])
+        metric("threads", "gauge", [("", self.threads)])
+        metric("barrier_refused_total", "counter", [("", self.barrier_refused)])
+        metric("barrier_stops_total", "counter", [("", self.barrier_stops)])
+        metric("barrier_stop_wait_ns_total", "counter", [("", self.barrier_stop_wait_ns)])
+        metric("hook_ns_total", "counter", [("", self.hook_ns)])
+        return "\n".join(lines) + "\n"
@@ -0,0 +1,80 @@
+"""Domain layer: per-asyncio-task totals (tracking.start(tasks=True)).
+
+Immutable value objects with invariant validation.
+FAIL-FIRST: invalid input raises immediately.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+
+from archcheck.domain.exceptions import InvalidCountError, InvalidDurationError
+
+# TaskStats.task of work done outside any asyncio task
+NO_TASK = 0
+
+
+@dataclass(frozen=True, slots=True)
+class TaskStats:
+    """Calls and objects charged to one asyncio task.
+
+    task: id() of the asyncio.Task that was running (NO_TASK = outside any
+    task: synchronous code, event loop machinery). A finished task's id
+    may be reused by a later task.
+    calls: completed frame evaluations; each coroutine resume counts.
+    own_ns: exclusive wall time of those calls, i.e. the time the task
+    spent running Python code (callees charged once, to their own task).
+    allocated/freed: objects created/destroyed while the task ran.
+
+    Invariants:
+        - calls, allocated, freed >= 0, at least one of them >= 1
+        - own_ns >= 0
+    """
+
+    task: int
+    calls: int
+    own_ns: int
+    allocated: int
+    freed: int
+
+    def __post_init__(self) -> None:
+        """Validate invariants. FAIL-FIRST on negative or empty totals."""
+        for count in (self.calls, self.allocated, self.freed):
+            if count < 0:
+                raise InvalidCountError(count)
+        if self.calls + self.allocated + self.freed < 1:
+            raise InvalidCountError(0)
+        if self.own_ns < 0:
+            raise InvalidDurationError(self.own_ns)
+
+    @property
+    def net_allocated(self) -> int:
+        """allocated - freed (negative: the task freed objects made elsewhere)."""
+        return self.allocated - self.freed
+
+
+@dataclass(frozen=True, slots=True)
+class TaskProfile:
+    """Per-task totals of one session.
+
+    tasks: sorted by own_ns, descending (slowest task first).
+    """
+
+    tasks: tuple[TaskStats, ...]
+
+    def task(self, task_id: int) -> TaskStats | None:
+        """Totals of task_id (e.g. id(asyncio.current_task())), None if never charged."""
+        return next((stats for stats in self.tasks if stats.task == task_id), None)
+
+    def slowest(self, limit: int) -> tuple[TaskStats, ...]:
+        """The limit tasks with the most own time, NO_TASK excluded."""
+        return tuple(stats for stats in self.tasks if stats.task != NO_TASK)[:limit]
+
+    def top_allocators(self, limit: int) -> tuple[TaskStats, ...]:
+        """The limit tasks that created the most objects, NO_TASK excluded."""
+        ranked = sorted(
+            (stats for stats in self.tasks if stats.task != NO_TASK),
+            key=lambda stats: stats.allocated,
+            reverse=True,
+        )
+        return tuple(ranked[:limit])
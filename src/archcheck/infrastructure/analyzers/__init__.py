@@ -3,14 +3,20 @@
 Stateless functions: AST node → domain objects.
 """
 
-from archcheck.infrastructure.analyzers.call_resolver import resolve_calls
+from archcheck.infrastructure.analyzers.call_resolver import (
+    SymbolIndex,
+    resolve_calls,
+    resolve_module_calls,
+)
 from archcheck.infrastructure.analyzers.class_analyzer import analyze_class
 from archcheck.infrastructure.analyzers.function_analyzer import analyze_function
 from archcheck.infrastructure.analyzers.import_analyzer import analyze_imports
 
 __all__ = [
+    "SymbolIndex",
     "analyze_class",
     "analyze_function",
     "analyze_imports",
     "resolve_calls",
+    "resolve_module_calls",
 ]
@@ -1,6 +1,9 @@
 """Call resolver: resolve body_calls and decorators to FQN.
 
 Symbol table + import resolution → StaticCallEdge or UnresolvedCall.
+Every lookup into the rest of the codebase goes through a SymbolIndex:
+hash indexes built once per codebase (O(definitions)), so resolution is
+O(call sites), not O(call sites × definitions).
 Data Completeness: unresolved tracked with reason.
 """
 
@@ -14,6 +17,8 @@ from archcheck.domain.exceptions import ImportLevelExceedsDepthError
 from archcheck.domain.static_graph import CallType, StaticCallEdge, UnresolvedCall
 
 if TYPE_CHECKING:
+    from collections.abc import Iterable, Mapping
+
     from archcheck.domain.codebase import Class, Codebase, Function, Import, Module
     from archcheck.domain.events import Location
 
@@ -25,12 +30,190 @@ _SELF_PREFIX = "self."
 _SUPER_PREFIX = "super()."
 
 
+class SymbolIndex:
+    """Hash indexes over a codebase's definitions, for call resolution.
+
+    Keys are "<module>.<name>" for top-level functions and classes (first
+    definition of a name wins, as in source order), short class name →
+    first class in module order (base class fallback), and each class's
+    MRO over statically resolvable bases (C3, computed on first use).
+
+    add()/remove() keep the index current when single modules change
+    (IncrementalGraph); cached MROs and symbol tables are dropped then.
+    """
+
+    __slots__ = (
+        "_class_modules",
+        "_classes",
+        "_classes_by_name",
+        "_computing",
+        "_functions",
+        "_modules",
+        "_mro",
+        "_next_order",
+        "_order",
+        "_symbol_tables",
+    )
+
+    def __init__(self, modules: Iterable[Module] = ()) -> None:
+        """Index modules (in order: it decides the base class fallback)."""
+        self._modules: dict[str, Module] = {}
+        self._order: dict[str, int] = {}
+        self._next_order = 0
+        self._functions: dict[str, Function] = {}
+        self._classes: dict[str, Class] = {}
+        self._class_modules: dict[str, str] = {}
+        self._classes_by_name: dict[str, dict[str, tuple[int, int]]] = {}
+        self._mro: dict[str, tuple[str, ...]] = {}
+        self._computing: set[str] = set()
+        self._symbol_tables: dict[str, Mapping[str, str]] = {}
+        for module in modules:
+            self.add(module)
+
+    @classmethod
+    def of(cls, codebase: Codebase) -> SymbolIndex:
+        """Index every module of codebase."""
+        return cls(codebase.modules.values())
+
+    def add(self, module: Module) -> None:
+        """Index module; replacing a module of the same name keeps its order."""
+        name = module.name
+        if name in self._modules:
+            self._unindex(self._modules[name])
+        else:
+            self._order[name] = self._next_order
+            self._next_order += 1
+        self._modules[name] = module
+
+        order = self._order[name]
+        for func in module.functions:
+            self._functions.setdefault(f"{name}.{func.name}", func)
+        for position, cls in enumerate(module.classes):
+            key = f"{name}.{cls.name}"
+            if key not in self._classes:
+                self._classes[key] = cls
+                self._class_modules[key] = name
+                self._classes_by_name.setdefault(cls.name, {})[key] = (order, position)
+        self._invalidate()
+
+    def remove(self, name: str) -> None:
+        """Drop module name and its definitions.
+
+        Raises:
+            KeyError: name is not indexed.
+        """
+        self._unindex(self._modules.pop(name))
+        del self._order[name]
+        self._invalidate()
+
+    def module(self, name: str) -> Module | None:
+        """Module by name."""
+        return self._modules.get(name)
+
+    def function(self, fqn: str) -> Function | None:
+        """Top-level function "<module>.<name>"."""
+        return self._functions.get(fqn)
+
+    def get_class(self, fqn: str) -> Class | None:
+        """Class "<module>.<name>"."""
+        return self._classes.get(fqn)
+
+    def first_class_named(self, name: str) -> str | None:
+        """FQN of the first class called name (module order, then source order)."""
+        named = self._classes_by_name.get(name)
+        if not named:
+            return None
+        return min(named.items(), key=lambda item: item[1])[0]
+
+    def symbol_table(self, module_name: str) -> Mapping[str, str]:
+        """Symbol table of indexed module module_name (cached)."""
+        table = self._symbol_tables.get(module_name)
+        if table is None:
+            table = _build_symbol_table(self._modules[module_name])
+            self._symbol_tables[module_name] = table
+        return table
+
+    def mro(self, fqn: str) -> tuple[Class, ...]:
+        """Ancestors of class fqn in method resolution order (itself excluded).
+
+        Only bases that resolve to classes of the codebase take part; a
+        cyclic or inconsistent hierarchy ends the order where it breaks.
+        """
+        return tuple(self._classes[key] for key in self._mro_keys(fqn))
+
+    def _mro_keys(self, fqn: str) -> tuple[str, ...]:
+        cached = self._mro.get(fqn)
+        if cached is not None:
+            return cached
+        if fqn in self._computing:
+            return ()  # Cycle: the class is its own ancestor
+        self._computing.add(fqn)
+        try:
+            order = self._linearize(fqn)
+        finally:
+            self._computing.discard(fqn)
+        self._mro[fqn] = order
+        return order
+
+    def _linearize(self, fqn: str) -> tuple[str, ...]:
+        """C3 merge of (base, *mro(base)) per base, then the base list."""
+        cls = self.get_class(fqn)
+        if cls is None:
+            return ()
+        symbols = self.symbol_table(self._class_modules[fqn])
+        bases: list[str] = []
+        for base_name in cls.bases:
+            base_fqn = _find_class_fqn(base_name, symbols, self)
+            if (
+                base_fqn is not None
+                and base_fqn not in bases
+                and base_fqn not in self._computing
+                and self.get_class(base_fqn) is not None
+            ):
+                bases.append(base_fqn)
+
+        sequences = [[base, *self._mro_keys(base)] for base in bases]
+        sequences.append(list(bases))
+        order: list[str] = []
+        while sequences := [sequence for sequence in sequences if sequence]:
+            for sequence in sequences:
+                head = sequence[0]
+                if not any(head in other[1:] for other in sequences):
+                    break
+            else:
+                break  # Inconsistent hierarchy: keep what is ordered so far
+            order.append(head)
+            for sequence in sequences:
+                if sequence[0] == head:
+                    del sequence[0]
+        return tuple(order)
+
+    def _unindex(self, module: Module) -> None:
+        name = module.name
+        for func in module.functions:
+            key = f"{name}.{func.name}"
+            self._functions.pop(key, None)
+        for cls in module.classes:
+            key = f"{name}.{cls.name}"
+            if self._classes.pop(key, None) is None:
+                continue
+            del self._class_modules[key]
+            named = self._classes_by_name[cls.name]
+            del named[key]
+            if not named:
+                del self._classes_by_name[cls.name]
+
+    def _invalidate(self) -> None:
+        self._mro.clear()
+        self._symbol_tables.clear()
+
+
 @dataclass(frozen=True, slots=True)
 class _ResolveContext:
     """Context for call resolution within a module."""
 
-    symbol_table: dict[str, str]
-    codebase: Codebase
+    symbol_table: Mapping[str, str]
+    index: SymbolIndex
     edges: list[StaticCallEdge]
     unresolved: list[UnresolvedCall]
 
@@ -41,6 +224,9 @@ def resolve_calls(
 ) -> tuple[tuple[StaticCallEdge, ...], tuple[UnresolvedCall, ...]]:
     """Resolve all calls in module to FQN.
 
+    Builds a SymbolIndex of codebase; to resolve many modules, build it
+    once and call resolve_module_calls().
+
     Processes:
     - Function decorators → DECORATOR edges
     - Function body_calls → DIRECT/CONSTRUCTOR edges
@@ -54,11 +240,19 @@ def resolve_calls(
     Returns:
         Tuple of (resolved edges, unresolved calls).
     """
+    return resolve_module_calls(module, SymbolIndex.of(codebase))
+
+
+def resolve_module_calls(
+    module: Module,
+    index: SymbolIndex,
+) -> tuple[tuple[StaticCallEdge, ...], tuple[UnresolvedCall, ...]]:
+    """Resolve all calls in module to FQN against a prebuilt SymbolIndex."""
     edges: list[StaticCallEdge] = []
     unresolved: list[UnresolvedCall] = []
     ctx = _ResolveContext(
         symbol_table=_build_symbol_table(module),
-        codebase=codebase,
+        index=index,
         edges=edges,
         unresolved=unresolved,
     )
@@ -240,9 +434,10 @@ def _resolve_method_call(
         )
         return
 
-    # Look for method in owner class
-    for method in owner_class.methods:
-        if method.name == method_name:
+    # Look for method in owner class, then in its ancestors (MRO)
+    for cls in (owner_class, *_ancestors(owner_class, ctx)):
+        method = _find_method(cls, method_name)
+        if method is not None:
             ctx.edges.append(
                 StaticCallEdge(
                     caller_fqn=caller_fqn,
@@ -253,7 +448,7 @@ def _resolve_method_call(
             )
             return
 
-    # Method not found - could be inherited or dynamic
+    # Method not found - defined outside the codebase or dynamic
     ctx.unresolved.append(
         UnresolvedCall(
             caller_fqn=caller_fqn,
@@ -283,27 +478,19 @@ def _resolve_super_call(
         )
         return
 
-    # Try to find method in parent classes
-    for base_name in owner_class.bases:
-        parent_fqn = _find_class_fqn(base_name, ctx.symbol_table, ctx.codebase)
-        if parent_fqn is None:
-            continue
-
-        parent_class = _get_class(parent_fqn, ctx.codebase)
-        if parent_class is None:
-            continue
-
-        for method in parent_class.methods:
-            if method.name == method_name:
-                ctx.edges.append(
-                    StaticCallEdge(
-                        caller_fqn=caller_fqn,
-                        callee_fqn=method.qualified_name,
-                        location=location,
-                        call_type=CallType.SUPER,
-                    ),
-                )
-                return
+    # Next class in the MRO that defines the method
+    for parent_class in _ancestors(owner_class, ctx):
+        method = _find_method(parent_class, method_name)
+        if method is not None:
+            ctx.edges.append(
+                StaticCallEdge(
+                    caller_fqn=caller_fqn,
+                    callee_fqn=method.qualified_name,
+                    location=location,
+                    call_type=CallType.SUPER,
+                ),
+            )
+            return
 
     # Parent method not found
     ctx.unresolved.append(
@@ -352,36 +539,26 @@ def _resolve_attribute_call(
     module_fqn = ctx.symbol_table[obj_name]
 
     # Check if it's a module in codebase
-    if module_fqn in ctx.codebase.modules:
+    if ctx.index.module(module_fqn) is not None:
         # module.func() pattern
-        target_module = ctx.codebase.modules[module_fqn]
         target_fqn = f"{module_fqn}.{attr_name}"
 
-        # Check if function exists
-        for func in target_module.functions:
-            if func.name == attr_name:
-                ctx.edges.append(
-                    StaticCallEdge(
-                        caller_fqn=caller_fqn,
-                        callee_fqn=target_fqn,
-                        location=location,
-                        call_type=CallType.DIRECT,
-                    ),
-                )
-                return
-
-        # Check if class exists (constructor)
-        for cls in target_module.classes:
-            if cls.name == attr_name:
-                ctx.edges.append(
-                    StaticCallEdge(
-                        caller_fqn=caller_fqn,
-                        callee_fqn=target_fqn,
-                        location=location,
-                        call_type=CallType.CONSTRUCTOR,
-                    ),
-                )
-                return
+        # Function, else class (constructor)
+        call_type = None
+        if ctx.index.function(target_fqn) is not None:
+            call_type = CallType.DIRECT
+        elif ctx.index.get_class(target_fqn) is not None:
+            call_type = CallType.CONSTRUCTOR
+        if call_type is not None:
+            ctx.edges.append(
+                StaticCallEdge(
+                    caller_fqn=caller_fqn,
+                    callee_fqn=target_fqn,
+                    location=location,
+                    call_type=call_type,
+                ),
+            )
+            return
 
         # Not found in module
         ctx.unresolved.append(
@@ -428,7 +605,7 @@ def _resolve_name_call(
     fqn = ctx.symbol_table[name]
 
     # Check if in codebase
-    if not _is_in_codebase(fqn, ctx.codebase):
+    if not _is_in_codebase(fqn, ctx.index):
         ctx.unresolved.append(
             UnresolvedCall(
                 caller_fqn=caller_fqn,
@@ -441,7 +618,7 @@ def _resolve_name_call(
 
     # Determine actual call type
     actual_type = call_type
-    if call_type == CallType.DIRECT and _is_class_fqn(fqn, ctx.codebase):
+    if call_type == CallType.DIRECT and ctx.index.get_class(fqn) is not None:
         actual_type = CallType.CONSTRUCTOR
 
     ctx.edges.append(
@@ -456,8 +633,8 @@ def _resolve_name_call(
 
 def _find_class_fqn(
     class_name: str,
-    symbol_table: dict[str, str],
-    codebase: Codebase,
+    symbol_table: Mapping[str, str],
+    index: SymbolIndex,
 ) -> str | None:
     """Find FQN for class name."""
     # Check symbol table first
@@ -468,66 +645,44 @@ def _find_class_fqn(
     if "." in class_name:
         return class_name
 
-    # Search all modules (fallback)
-    for module in codebase.modules.values():
-        for cls in module.classes:
-            if cls.name == class_name:
-                return cls.qualified_name
-
-    return None
+    # First class of that name anywhere (fallback)
+    return index.first_class_named(class_name)
 
 
-def _get_class(fqn: str, codebase: Codebase) -> Class | None:
-    """Get Class by FQN from codebase."""
-    match fqn.rsplit(".", 1):
-        case [module_name, class_name]:
-            pass
-        case _:
-            return None
+def _ancestors(owner_class: Class, ctx: _ResolveContext) -> tuple[Class, ...]:
+    """MRO of owner_class without itself (indexed classes only)."""
+    fqn = owner_class.qualified_name
+    if ctx.index.get_class(fqn) is owner_class:
+        return ctx.index.mro(fqn)
 
-    if module_name not in codebase.modules:
-        return None
+    # Owner not indexed (module outside the codebase, or a shadowed duplicate):
+    # its bases in order, each followed by its own MRO
+    seen: set[str] = set()
+    order: list[Class] = []
+    for base_name in owner_class.bases:
+        base_fqn = _find_class_fqn(base_name, ctx.symbol_table, ctx.index)
+        base = None if base_fqn is None else ctx.index.get_class(base_fqn)
+        if base_fqn is None or base is None:
+            continue
+        for cls in (base, *ctx.index.mro(base_fqn)):
+            if cls.qualified_name not in seen:
+                seen.add(cls.qualified_name)
+                order.append(cls)
+    return tuple(order)
 
-    module = codebase.modules[module_name]
-    for cls in module.classes:
-        if cls.name == class_name:
-            return cls
 
+def _find_method(cls: Class, method_name: str) -> Function | None:
+    """First method of cls called method_name."""
+    for method in cls.methods:
+        if method.name == method_name:
+            return method
     return None
 
 
-def _is_in_codebase(fqn: str, codebase: Codebase) -> bool:
+def _is_in_codebase(fqn: str, index: SymbolIndex) -> bool:
     """Check if FQN exists in codebase (module, class, or function)."""
-    # Check module
-    if fqn in codebase.modules:
-        return True
-
-    # Check class or function: module.name
-    match fqn.rsplit(".", 1):
-        case [module_name, name]:
-            pass
-        case _:
-            return False
-
-    if module_name not in codebase.modules:
-        return False
-
-    module = codebase.modules[module_name]
-    return any(f.name == name for f in module.functions) or any(
-        c.name == name for c in module.classes
+    return (
+        index.module(fqn) is not None
+        or index.function(fqn) is not None
+        or index.get_class(fqn) is not None
     )
-
-
-def _is_class_fqn(fqn: str, codebase: Codebase) -> bool:
-    """Check if FQN is a class in codebase."""
-    match fqn.rsplit(".", 1):
-        case [module_name, class_name]:
-            pass
-        case _:
-            return False
-
-    if module_name not in codebase.modules:
-        return False
-
-    module = codebase.modules[module_name]
-    return any(cls.name == class_name for cls in module.classes)
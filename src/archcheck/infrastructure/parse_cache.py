@@ -0,0 +1,104 @@
+"""Infrastructure layer: on-disk cache of parsed modules.
+
+parse_directory(cache_dir=...) stores each file's Module here, keyed by
+a hash of (archcheck version, Python version, module name, source
+bytes), and loads it back instead of parsing again while the file is
+unchanged. Module.path is not part of the key: entries survive a
+checkout moving to another directory.
+
+Layout: <directory>/<key[:2]>/<key>.pickle. Writes go to a temporary
+file renamed into place, so concurrent workers and interrupted runs
+never leave a partial entry. Entries of changed files are not removed;
+delete the directory to reclaim space.
+
+Entries are pickles: point the cache only at a directory you trust.
+FAIL-FIRST: an unreadable entry raises instead of being reparsed.
+"""
+
+from __future__ import annotations
+
+import dataclasses
+import hashlib
+import importlib.metadata
+import os
+import pickle
+import sys
+import tempfile
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Final
+
+from archcheck.domain.codebase import Module
+from archcheck.domain.exceptions import ConversionError
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+# Bumped when Module (or anything it contains) changes shape
+CACHE_FORMAT: Final = 1
+
+
+@dataclass(frozen=True, slots=True)
+class ParseCache:
+    """Module cache under one directory (picklable: shipped to parser workers).
+
+    fingerprint: distinguishes archcheck and Python versions; entries of
+    other versions are never returned.
+    """
+
+    directory: Path
+    fingerprint: str
+
+    @classmethod
+    def open(cls, directory: Path) -> ParseCache:
+        """Cache for the running archcheck and Python versions.
+
+        Raises:
+            importlib.metadata.PackageNotFoundError: archcheck not installed
+                (its version is part of every key).
+        """
+        version = importlib.metadata.version("archcheck")
+        fingerprint = f"{CACHE_FORMAT}:{version}:{sys.implementation.cache_tag}"
+        return cls(directory=directory, fingerprint=fingerprint)
+
+    def key(self, module_name: str, source: bytes) -> str:
+        """Entry key of one module's source."""
+        digest = hashlib.sha256()
+        for part in (self.fingerprint.encode(), module_name.encode()):
+            digest.update(len(part).to_bytes(8, "little"))
+            digest.update(part)
+        digest.update(source)
+        return digest.hexdigest()
+
+    def load(self, key: str, path: Path) -> Module | None:
+        """Cached Module of key (with path set to path), None on a miss.
+
+        Raises:
+            ConversionError: Entry does not hold a Module.
+            pickle.UnpicklingError, EOFError: Entry is corrupt.
+        """
+        try:
+            data = self._entry(key).read_bytes()
+        except FileNotFoundError:
+            return None
+        module = pickle.loads(data)  # noqa: S301 - trusted cache directory
+        if not isinstance(module, Module):
+            raise ConversionError(expected="Module in parse cache", got=type(module))
+        if module.path != path:
+            module = dataclasses.replace(module, path=path)
+        return module
+
+    def store(self, key: str, module: Module) -> None:
+        """Write module under key (atomic replace)."""
+        entry = self._entry(key)
+        entry.parent.mkdir(parents=True, exist_ok=True)
+        fd, tmp_name = tempfile.mkstemp(dir=entry.parent, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "wb") as tmp:
+                pickle.dump(module, tmp, protocol=pickle.HIGHEST_PROTOCOL)
+            os.replace(tmp_name, entry)
+        except BaseException:
+            os.unlink(tmp_name)
+            raise
+
+    def _entry(self, key: str) -> Path:
+        return self.directory / key[:2] / f"{key}.pickle"
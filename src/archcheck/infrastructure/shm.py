@@ -0,0 +1,127 @@
+"""Infrastructure layer: shared-memory event collector.
+
+Creates the segment a traced process exports to with
+tracking.start(shm_name=...) and reads its events while it runs.
+Layout defined in c/tracking/shmring.h (one ring per traced thread).
+
+The traced process never waits for the collector: events that do not fit
+in a full ring are dropped there and counted (ShmBatch.dropped). Events
+are compact (RawEvent): CALL without args, RETURN without return value,
+DESTROY without creation context. Order is per thread; events of
+different threads interleave by batch.
+"""
+
+from __future__ import annotations
+
+import time
+from dataclasses import dataclass
+from typing import TYPE_CHECKING, Self
+
+from archcheck import _tracking
+from archcheck.infrastructure.tracking import _convert_result, _int
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator
+    from types import TracebackType
+
+    from archcheck.domain.events import TrackingResult
+
+
+@dataclass(frozen=True, slots=True)
+class ShmBatch:
+    """Events taken by one ShmCollector.poll().
+
+    Attributes:
+        result: Events (and output errors) of this batch.
+        dropped: Events the traced process dropped so far (full rings,
+            threads beyond the ring count).
+        done: Traced process called stop() and every event was read.
+    """
+
+    result: TrackingResult
+    dropped: int
+    done: bool
+
+
+class ShmCollector:
+    """Owner of one shared-memory segment, reading it in this process.
+
+    Usage:
+        with ShmCollector("/archcheck-run") as collector:
+            launch traced process (tracking.start(shm_name="/archcheck-run"))
+            for batch in collector.collect():
+                ...
+
+    Contracts:
+        - Segment created on init (OSError if the name exists), unlinked by
+          close() / context exit
+        - One traced session per segment
+        - poll() from one thread at a time
+    """
+
+    __slots__ = ("_handle", "_name")
+
+    def __init__(self, name: str, *, rings: int = 64, ring_bytes: int = 1 << 20) -> None:
+        """Create the segment.
+
+        Args:
+            name: shm_open() name, e.g. "/archcheck-1234".
+            rings: Traced threads that get a ring; later threads drop.
+            ring_bytes: Bytes per ring (power of 2, 4 KiB to 1 GiB).
+
+        Raises:
+            OSError: Segment cannot be created (e.g. name already exists).
+            ValueError: rings or ring_bytes out of range.
+        """
+        self._name = name
+        self._handle = _tracking.shm_create(name, rings=rings, ring_bytes=ring_bytes)
+
+    @property
+    def name(self) -> str:
+        """Segment name to pass to tracking.start(shm_name=...)."""
+        return self._name
+
+    def poll(self, max_events: int = 65536) -> ShmBatch:
+        """Take up to max_events events without waiting.
+
+        Raises:
+            ValueError: max_events < 1, or collector closed.
+        """
+        raw = _tracking.shm_poll(self._handle, max_events)
+        return ShmBatch(
+            result=_convert_result(raw),
+            dropped=_int(raw["dropped"]),
+            done=raw["done"] is True,
+        )
+
+    def collect(self, *, interval_s: float = 0.01, max_events: int = 65536) -> Iterator[ShmBatch]:
+        """Poll until the traced process stopped and everything was read.
+
+        Yields non-empty batches; sleeps interval_s when the rings are empty.
+        Waits forever if the traced process never starts or stops.
+        """
+        while True:
+            batch = self.poll(max_events)
+            if batch.result.events or batch.result.output_errors:
+                yield batch
+            if batch.done:
+                return
+            if not batch.result.events:
+                time.sleep(interval_s)
+
+    def close(self) -> None:
+        """Unmap and unlink the segment. Idempotent."""
+        _tracking.shm_close(self._handle)
+
+    def __enter__(self) -> Self:
+        """Context manager: collector stays open until exit."""
+        return self
+
+    def __exit__(
+        self,
+        exc_type: type[BaseException] | None,
+        exc: BaseException | None,
+        tb: TracebackType | None,
+    ) -> None:
+        """Close on exit."""
+        self.close()
@@ -0,0 +1,386 @@
+"""Infrastructure layer: binary trace file reader.
+
+Reads files written by _tracking.start(trace_path=...).
+Layout defined in c/tracking/tracefile.h (header, fixed-width records,
+string section, footer index).
+
+mmap-backed: records decoded on iteration straight into domain events,
+no intermediate dicts. Strings decoded once on first use, Locations shared.
+Forked workers write "<trace_path>.<pid>" (child_trace_paths(), merge_traces()).
+FAIL-FIRST: TraceFormatError on any malformed input.
+"""
+
+from __future__ import annotations
+
+import mmap
+import os
+import re
+import struct
+from typing import TYPE_CHECKING, Final, Self
+
+from archcheck.domain.events import (
+    ArgInfo,
+    CallEvent,
+    CreateEvent,
+    CreationInfo,
+    DestroyEvent,
+    Event,
+    FieldError,
+    Location,
+    ReturnEvent,
+    TrackingResult,
+)
+from archcheck.domain.exceptions import TraceFormatError
+
+if TYPE_CHECKING:
+    from collections.abc import Iterable, Iterator
+    from types import TracebackType
+
+# =============================================================================
+# On-disk format (mirror of c/tracking/tracefile.h)
+# =============================================================================
+
+FORMAT_VERSION: Final = 1
+_BYTE_ORDER: Final = 0x01020304
+_HEADER_MAGIC: Final = b"ARCHTRC\0"
+_FOOTER_MAGIC: Final = b"ARCHEND\0"
+
+_HEADER: Final = struct.Struct("<8sIII12x")
+# kind, flags, extra, line, seq, id, file, func, type, caller_line, caller_file, caller_func
+_RECORD: Final = struct.Struct("<BBHiQQIIIiII")
+_FOOTER: Final = struct.Struct("<QQQQQ8s")
+_STRLEN: Final = struct.Struct("<I")
+
+# TraceKind
+_CALL: Final = 0
+_RETURN: Final = 1
+_CREATE: Final = 2
+_DESTROY: Final = 3
+_ARG: Final = 16
+_CREATION: Final = 17
+_FRAME: Final = 18
+_ERROR: Final = 19
+
+# TraceRecord.flags
+_HAS_CALLER: Final = 1 << 0
+_HAS_VALUE: Final = 1 << 1
+
+# Suffix of a forked child's trace: ".<pid>", once per fork generation
+_CHILD_SUFFIX: Final = re.compile(r"(?:\.\d+)+")
+
+type _Record = tuple[int, int, int, int, int, int, int, int, int, int, int, int]
+
+
+class TraceReader:
+    """Lazy reader over one binary trace file.
+
+    Usage:
+        with TraceReader(path) as trace:
+            print(len(trace))
+            for event in trace:
+                ...
+
+    Contracts:
+        - FAIL-FIRST: TraceFormatError on open if header/footer invalid
+        - len() = number of events, O(1)
+        - Iteration may be repeated; each pass decodes records again
+    """
+
+    __slots__ = (
+        "_event_count",
+        "_locations",
+        "_mm",
+        "_path",
+        "_record_count",
+        "_records_offset",
+        "_string_offsets",
+        "_strings",
+    )
+
+    def __init__(self, path: str | os.PathLike[str]) -> None:
+        """Map file and validate header, footer and string section.
+
+        Raises:
+            OSError: File cannot be opened or mapped.
+            TraceFormatError: File is not a valid trace.
+        """
+        self._path = os.fspath(path)
+        with open(self._path, "rb") as f:
+            size = os.fstat(f.fileno()).st_size
+            if size < _HEADER.size + _FOOTER.size:
+                raise TraceFormatError(path=self._path, reason="file too small")
+            self._mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        try:
+            self._validate(size)
+        except BaseException:
+            self._mm.close()
+            raise
+        self._strings: dict[int, str] = {}
+        self._locations: dict[tuple[int, int, int], Location] = {}
+
+    def _validate(self, size: int) -> None:
+        magic, version, record_size, byte_order = _HEADER.unpack_from(self._mm, 0)
+        if magic != _HEADER_MAGIC:
+            raise TraceFormatError(path=self._path, reason="bad header magic")
+        if byte_order != _BYTE_ORDER:
+            raise TraceFormatError(path=self._path, reason="foreign byte order")
+        if version != FORMAT_VERSION:
+            raise TraceFormatError(path=self._path, reason=f"unsupported version {version}")
+        if record_size != _RECORD.size:
+            raise TraceFormatError(path=self._path, reason=f"record size {record_size}")
+
+        footer = _FOOTER.unpack_from(self._mm, size - _FOOTER.size)
+        records_offset, record_count, event_count, strings_offset, string_count, end = footer
+        if end != _FOOTER_MAGIC:
+            raise TraceFormatError(path=self._path, reason="bad footer magic (incomplete trace?)")
+        if records_offset + record_count * _RECORD.size != strings_offset:
+            raise TraceFormatError(path=self._path, reason="record section size mismatch")
+        if event_count > record_count or strings_offset > size - _FOOTER.size:
+            raise TraceFormatError(path=self._path, reason="footer index out of range")
+
+        self._records_offset: int = records_offset
+        self._record_count: int = record_count
+        self._event_count: int = event_count
+        self._string_offsets = self._index_strings(strings_offset, string_count, size)
+
+    def _index_strings(self, offset: int, count: int, size: int) -> list[int]:
+        """Offsets of string ids 1..count (index 0 unused: id 0 = None)."""
+        end = size - _FOOTER.size
+        offsets = [0]
+        for _ in range(count):
+            if offset + _STRLEN.size > end:
+                raise TraceFormatError(path=self._path, reason="string section truncated")
+            offsets.append(offset)
+            (length,) = _STRLEN.unpack_from(self._mm, offset)
+            offset += _STRLEN.size + length
+        if offset > end:
+            raise TraceFormatError(path=self._path, reason="string section truncated")
+        return offsets
+
+    # =========================================================================
+    # Public API
+    # =========================================================================
+
+    def __len__(self) -> int:
+        """Number of events in trace."""
+        return self._event_count
+
+    def __iter__(self) -> Iterator[Event]:
+        """Decode events in recorded (seq) order.
+
+        Raises:
+            TraceFormatError: Unknown record kind or misplaced aux record.
+        """
+        records = self._records()
+        for rec in records:
+            yield self._event(rec, records)
+
+    def close(self) -> None:
+        """Unmap file. Idempotent."""
+        self._mm.close()
+
+    def __enter__(self) -> Self:
+        """Enter context: reader stays mapped until exit."""
+        return self
+
+    def __exit__(
+        self,
+        exc_type: type[BaseException] | None,
+        exc: BaseException | None,
+        tb: TracebackType | None,
+    ) -> None:
+        """Exit context: unmap file."""
+        self.close()
+
+    # =========================================================================
+    # Decoding
+    # =========================================================================
+
+    def _records(self) -> Iterator[_Record]:
+        unpack = _RECORD.unpack_from
+        mm = self._mm
+        offset = self._records_offset
+        for _ in range(self._record_count):
+            yield unpack(mm, offset)
+            offset += _RECORD.size
+
+    def _string(self, string_id: int) -> str | None:
+        if string_id == 0:
+            return None
+        cached = self._strings.get(string_id)
+        if cached is not None:
+            return cached
+        if string_id >= len(self._string_offsets):
+            raise TraceFormatError(path=self._path, reason=f"string id {string_id} out of range")
+        offset = self._string_offsets[string_id]
+        (length,) = _STRLEN.unpack_from(self._mm, offset)
+        start = offset + _STRLEN.size
+        value = self._mm[start : start + length].decode("utf-8", errors="replace")
+        self._strings[string_id] = value
+        return value
+
+    def _required_string(self, string_id: int) -> str:
+        value = self._string(string_id)
+        if value is None:
+            raise TraceFormatError(path=self._path, reason="required string missing")
+        return value
+
+    def _location(self, file_id: int, line: int, func_id: int) -> Location:
+        """Flyweight: one Location per distinct (file, line, func)."""
+        key = (file_id, line, func_id)
+        location = self._locations.get(key)
+        if location is None:
+            location = Location(file=self._string(file_id), line=line, func=self._string(func_id))
+            self._locations[key] = location
+        return location
+
+    def _aux(self, records: Iterator[_Record], kind: int) -> _Record:
+        rec = next(records, None)
+        if rec is None or rec[0] != kind:
+            raise TraceFormatError(path=self._path, reason=f"expected aux record kind {kind}")
+        return rec
+
+    def _event(self, rec: _Record, records: Iterator[_Record]) -> Event:
+        kind, flags, extra, line, _seq, obj_id, file_id, func_id, type_id = rec[:9]
+        location = self._location(file_id, line, func_id)
+
+        if kind == _CALL:
+            return self._call_event(rec, location, records)
+        if kind == _DESTROY:
+            return self._destroy_event(rec, location, records)
+        if kind == _RETURN:
+            self._skip_errors(records, extra)
+            has_value = bool(flags & _HAS_VALUE)
+            return ReturnEvent(
+                location=location,
+                return_id=obj_id if has_value else None,
+                return_type=self._string(type_id) if has_value else None,
+            )
+        if kind == _CREATE:
+            self._skip_errors(records, extra)
+            return CreateEvent(
+                location=location,
+                obj_id=obj_id,
+                type_name=self._required_string(type_id),
+            )
+        raise TraceFormatError(path=self._path, reason=f"unexpected record kind {kind}")
+
+    def _call_event(self, rec: _Record, location: Location, records: Iterator[_Record]) -> Event:
+        flags, extra = rec[1], rec[2]
+        caller = self._location(rec[10], rec[9], rec[11]) if flags & _HAS_CALLER else None
+
+        args: list[ArgInfo] = []
+        errors: list[FieldError] = []
+        for _ in range(extra):
+            aux = next(records, None)
+            if aux is None:
+                raise TraceFormatError(path=self._path, reason="CALL aux records truncated")
+            if aux[0] == _ARG and not errors:
+                args.append(
+                    ArgInfo(
+                        name=self._string(aux[7]),
+                        obj_id=aux[5],
+                        type_name=self._string(aux[8]),
+                    )
+                )
+            elif aux[0] == _ERROR:
+                errors.append(self._field_error(aux))
+            else:
+                raise TraceFormatError(path=self._path, reason=f"unexpected aux kind {aux[0]}")
+
+        return CallEvent(location=location, caller=caller, args=tuple(args), errors=tuple(errors))
+
+    def _destroy_event(self, rec: _Record, location: Location, records: Iterator[_Record]) -> Event:
+        extra = rec[2]
+        creation = None
+        remaining = extra
+        if remaining > 0:
+            aux = next(records, None)
+            if aux is None:
+                raise TraceFormatError(path=self._path, reason="DESTROY aux records truncated")
+            remaining -= 1
+            if aux[0] == _CREATION:
+                depth = aux[2]
+                traceback = tuple(
+                    self._location(frame[6], frame[3], frame[7])
+                    for frame in (self._aux(records, _FRAME) for _ in range(depth))
+                )
+                remaining -= depth
+                creation = CreationInfo(
+                    location=self._location(aux[6], aux[3], aux[7]),
+                    type_name=self._string(aux[8]),
+                    traceback=traceback,
+                )
+            elif aux[0] != _ERROR:
+                raise TraceFormatError(path=self._path, reason=f"unexpected aux kind {aux[0]}")
+        self._skip_errors(records, remaining)
+
+        return DestroyEvent(
+            location=location,
+            obj_id=rec[5],
+            type_name=self._required_string(rec[8]),
+            creation=creation,
+        )
+
+    def _field_error(self, aux: _Record) -> FieldError:
+        return FieldError(
+            field=self._required_string(aux[6]),
+            exc_type=self._required_string(aux[8]),
+            exc_msg=self._required_string(aux[7]),
+        )
+
+    def _skip_errors(self, records: Iterator[_Record], count: int) -> None:
+        """Field errors exist only on CallEvent in the domain model."""
+        for _ in range(count):
+            self._aux(records, _ERROR)
+
+
+def read_trace(path: str | os.PathLike[str]) -> Iterator[Event]:
+    """Iterate events of a trace file; file is unmapped when exhausted.
+
+    Raises:
+        OSError: File cannot be opened.
+        TraceFormatError: File is not a valid trace.
+    """
+    with TraceReader(path) as trace:
+        yield from trace
+
+
+def child_trace_paths(trace_path: str | os.PathLike[str]) -> tuple[str, ...]:
+    """Trace files of processes forked while tracing to trace_path.
+
+    A child forked during start(trace_path=P) writes P.<pid> (its own
+    children P.<pid>.<pid>, ...). The parent's own file P is not included.
+
+    Returns:
+        Existing child trace paths, sorted.
+    """
+    path = os.fspath(trace_path)
+    directory, base = os.path.split(path)
+    prefix = base + "."
+    return tuple(
+        sorted(
+            os.path.join(directory, name)
+            for name in os.listdir(directory or ".")
+            if name.startswith(prefix) and _CHILD_SUFFIX.fullmatch(name, len(base))
+        )
+    )
+
+
+def merge_traces(paths: Iterable[str | os.PathLike[str]]) -> TrackingResult:
+    """Events of several trace files (one per process) in one result.
+
+    Single pass: each file is mapped, decoded and unmapped in turn, events
+    appended in file order (per-process order kept; seq and obj_id are
+    per process). For call graphs keep the files apart:
+    AnalyzerService.build_merged_call_graph(map(read_trace, paths)) never
+    pairs a CALL of one process with a RETURN of another.
+
+    Raises:
+        OSError: A file cannot be opened.
+        TraceFormatError: A file is not a valid (complete) trace.
+    """
+    events: list[Event] = []
+    for path in paths:
+        events.extend(read_trace(path))
+    return TrackingResult(events=tuple(events), output_errors=())
@@ -6,14 +6,22 @@ Stateless adapter, FAIL-FIRST on invalid data.
 
 from __future__ import annotations
 
+import os
+import struct
+from typing import TYPE_CHECKING, Any
+
 from archcheck import _tracking
+from archcheck.domain.allocations import AllocationSite, AllocationSnapshot
 from archcheck.domain.events import (
     ArgInfo,
+    COLUMN_FORMATS,
+    COLUMN_KINDS,
     CallEvent,
     CreateEvent,
     CreationInfo,
     DestroyEvent,
     Event,
+    EventColumns,
     EventType,
     FieldError,
     Location,
@@ -21,30 +29,320 @@ from archcheck.domain.events import (
     ReturnEvent,
     TrackingResult,
 )
-from archcheck.domain.exceptions import ConversionError
-
-
-def start() -> None:
+from archcheck.domain.exceptions import ConversionError, DuplicateCreateError
+from archcheck.domain.graphs import (
+    AnalysisResult,
+    CallEdge,
+    CallGraph,
+    FilterConfig,
+    ObjectFlow,
+    ObjectLifecycle,
+)
+from archcheck.domain.profile import FunctionProfile, LatencyBucket, LatencyHistogram, Profile
+from archcheck.domain.stats import DropCounts, TrackerStats
+from archcheck.domain.tasks import TaskProfile, TaskStats
+
+if TYPE_CHECKING:
+    from collections.abc import Iterator
+
+# analyze_columns(): every event type kept
+_ALL_KINDS = (1 << len(COLUMN_KINDS)) - 1
+# C ColumnEdge {caller_file, caller_func, file, func, caller_line, line; count}
+_ANALYSIS_EDGE = struct.Struct("@IIIIiiQ")
+# C ColumnLifecycle {create_row, destroy_row, pass_start, pass_count}
+_ANALYSIS_LIFECYCLE = struct.Struct("@NNNN")
+# ANALYSIS_NO_ROW (SIZE_MAX): lifecycle still alive
+_NO_ROW = (1 << (8 * struct.calcsize("N"))) - 1
+
+
+def start(
+    *,
+    trace_path: str | os.PathLike[str] | None = None,
+    sample_every: int = 1,
+    sample_interval_ns: int = 0,
+    max_calls_per_code: int = 0,
+    filter_config: FilterConfig | None = None,
+    aggregate: bool = False,
+    aggregate_time: bool = False,
+    profile: bool = False,
+    profile_clock: str | None = None,
+    alloc_sites: bool = False,
+    capture_args: bool = True,
+    backend: str = "eval_frame",
+    shm_name: str | None = None,
+    tasks: bool = False,
+) -> None:
     """Start tracking.
 
+    Sampling (for always-on use) decides per CALL, before anything is
+    recorded. A skipped call records neither CALL nor RETURN, so every
+    recorded CALL keeps its RETURN; callers of recorded calls stay exact.
+    The first call of each function per session is always recorded.
+
+    filter_config is compiled into the C tracker: events AnalyzerService.filter()
+    would drop with the same config are never recorded. Path matches are
+    cached per code object, so filtered frames (stdlib, site-packages) cost
+    one lookup per call and no event.
+
+    aggregate records no events at all: each completed call bumps its
+    (caller, callee) edge in C, memory grows with distinct edges only.
+    Collect with stop_call_graph(). Object events are not tracked.
+
+    profile records no events either: each completed call feeds its
+    function's inclusive/exclusive latency histograms in C, memory grows
+    with distinct functions only. Collect with stop_profile(). Object
+    events are not tracked; each generator resume counts as one call.
+
+    alloc_sites records no events either: each CREATE/DESTROY only bumps
+    counters of its (creation stack, type) site in C, memory grows with
+    distinct sites and live objects. Read the live-by-site table with
+    snapshot() while tracking (diff two with AllocationSnapshot.growth())
+    and the final one with stop_allocations(). Calls are not recorded.
+
+    tasks records no events either: each completed call's exclusive time
+    and each CREATE/DESTROY are charged to the asyncio task running on
+    the thread (task id = id() of the asyncio.Task, 0 = no task), memory
+    grows with distinct tasks only. Collect with stop_tasks(). Events of
+    the other modes carry the same task id (EventColumns.task).
+
+    capture_args=False keeps CALL events but drops their arguments: the
+    call costs a location copy instead of one slot per argument, for
+    call-graph-only use (CallEvent.args is empty).
+
+    backend="monitoring" observes frames through sys.monitoring (PEP 669)
+    callbacks instead of replacing the interpreter's eval function, so
+    CPython keeps specializing every frame. Code excluded by filter_config
+    is disabled at its first call and then runs untracked at full speed;
+    calls and objects it creates are attributed to the nearest traced
+    caller. Holds sys.monitoring.PROFILER_ID while tracking.
+
+    shm_name exports events to the shared-memory segment of a collector
+    process (shm.ShmCollector) as they complete: this process keeps no
+    events, never waits for the collector (full rings drop and count) and
+    stop() returns an empty result. Events are compact: no args, return
+    values, field errors or creation contexts.
+
+    fork() while tracking (pre-fork servers): the child does not inherit
+    anything recorded so far; it continues in a fresh session of the same
+    mode, collected by its own stop(). With trace_path each child writes
+    "<trace_path>.<pid>" (tracefile.child_trace_paths(), merge_traces());
+    call stop() before the worker exits or its file stays incomplete. With
+    shm_name the child is not tracked (one traced process per segment).
+    Frames running at fork() get no RETURN in the child.
+
+    Args:
+        trace_path: Write events to this binary trace file instead of
+            returning them from stop(). Read back with tracefile.read_trace().
+        sample_every: Record every Nth call per thread (1 = all).
+        sample_interval_ns: Record at most one call per interval per thread
+            (0 = off).
+        max_calls_per_code: Record the first K calls of each function, then
+            only calls K, 2K, 4K, ... (0 = off).
+        filter_config: Pre-filter applied while recording (None = record all).
+        aggregate: Count call edges in C instead of recording events.
+        aggregate_time: Also sum inclusive wall time per edge (needs aggregate).
+        profile: Record per-function latency histograms instead of events.
+        profile_clock: Timestamp source for profile: "monotonic" (default),
+            "coarse" (cheapest, clock-tick resolution) or "tsc" (x86 with
+            invariant TSC only).
+        alloc_sites: Count objects per allocation site instead of events.
+        capture_args: Record argument ids/types on CALL events.
+        backend: "eval_frame" (PEP 523 frame hook) or "monitoring"
+            (sys.monitoring callbacks).
+        shm_name: Export events to this collector segment instead of
+            returning them from stop().
+        tasks: Charge call time and objects per asyncio task instead of
+            recording events.
+
     Raises:
         RuntimeError: Already started.
+        OSError: Trace file cannot be created, or shm_name segment cannot
+            be attached (missing, incompatible or already used).
+        ValueError: Invalid sampling option, aggregate or profile with
+            trace_path, aggregate with profile, aggregate_time without
+            aggregate, profile_clock without profile, unknown or
+            unavailable profile_clock, alloc_sites with trace_path,
+            aggregate or profile, unknown backend, PROFILER_ID already in
+            use (backend="monitoring"), shm_name with trace_path,
+            aggregate, profile or alloc_sites, or tasks with any of
+            trace_path, shm_name, aggregate, profile or alloc_sites.
     """
-    _tracking.start()
+    config = filter_config or FilterConfig()
+    _tracking.start(
+        trace_path=None if trace_path is None else os.fspath(trace_path),
+        sample_every=sample_every,
+        sample_interval_ns=sample_interval_ns,
+        max_calls_per_code=max_calls_per_code,
+        include_paths=config.include_paths,
+        exclude_paths=config.exclude_paths,
+        include_types=(
+            None
+            if config.include_types is None
+            else tuple(t.value for t in config.include_types)
+        ),
+        aggregate=aggregate,
+        aggregate_time=aggregate_time,
+        profile=profile,
+        profile_clock=profile_clock,
+        alloc_sites=alloc_sites,
+        capture_args=capture_args,
+        backend=backend,
+        shm_name=shm_name,
+        tasks=tasks,
+    )
 
 
 def stop() -> TrackingResult:
     """Stop tracking and return all events.
 
+    events is an EventSequence over the C column buffers: each event is
+    built when accessed, not at stop.
+
+    With trace_path: remaining events go to the trace file, events is empty.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output.
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.stop(prefer_columnar=True)
+    if "columns" in raw:
+        return _convert_columns(raw).to_result()
+    return _convert_result(raw)
+
+
+def stop_columns() -> EventColumns:
+    """Stop tracking and return all events as columns (no per-event dicts).
+
+    Same rows as stop().events, as raw columns for column algorithms
+    (AnalyzerService, analyze_columns()).
+
     Raises:
         RuntimeError: Not started.
+        ValueError: Started with trace_path, aggregate, profile, alloc_sites
+            or tasks.
         KeyError: Missing required field in C output.
         ConversionError: Invalid type in C output.
     """
+    raw = _tracking.stop(columnar=True)
+    return _convert_columns(raw)
+
+
+def stop_call_graph() -> CallGraph:
+    """Stop aggregate tracking and return the call graph counted in C.
+
+    Same edges as AnalyzerService.build_call_graph() over the full event
+    stream. Calls still running at stop are not counted; no events are
+    kept, so unmatched is always empty.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output (not aggregate mode).
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.stop()
+    return _convert_call_graph(raw)
+
+
+def stop_profile() -> Profile:
+    """Stop profile tracking and return per-function latency histograms.
+
+    Calls still running at stop are not recorded.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output (not profile mode).
+        ConversionError: Invalid type in C output.
+    """
     raw = _tracking.stop()
+    return _convert_profile(raw)
+
+
+def stop_allocations() -> AllocationSnapshot:
+    """Stop alloc_sites tracking and return the final live-by-site table.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output (not alloc_sites mode).
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.stop()
+    return _convert_allocations(raw)
+
+
+def stop_tasks() -> TaskProfile:
+    """Stop tasks tracking and return call time and objects per asyncio task.
+
+    Calls still running at stop are not counted. Only tasks of the C
+    asyncio implementation (_asyncio, the default) are told apart; work
+    in other tasks is charged to task 0.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output (not tasks mode).
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.stop()
+    return _convert_tasks(raw)
+
+
+def snapshot() -> AllocationSnapshot:
+    """Current live-by-site table; tracking keeps running.
+
+    Raises:
+        RuntimeError: Not started, or not started with alloc_sites.
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.snapshot()
+    return _convert_allocations(raw)
+
+
+def stats() -> TrackerStats:
+    """Tracker counters (events, drops, memory, hook time); tracking keeps running.
+
+    Raises:
+        RuntimeError: Not started.
+        KeyError: Missing required field in C output.
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.stats()
+    return _convert_stats(raw)
+
+
+def drain(max_events: int) -> TrackingResult:
+    """Take up to max_events completed events while tracking stays active.
+
+    Drained events are released in C and not returned again by stop().
+    Events keep global order across consecutive drain() calls.
+
+    Raises:
+        RuntimeError: Not started, or started with trace_path, aggregate,
+            profile, alloc_sites or shm_name.
+        ValueError: max_events < 1.
+        KeyError: Missing required field in C output.
+        ConversionError: Invalid type in C output.
+    """
+    raw = _tracking.drain(max_events)
     return _convert_result(raw)
 
 
+def flush(max_events: int) -> int:
+    """Write up to max_events completed events to the trace file.
+
+    Keeps memory bounded during long captures; stop() writes the rest.
+
+    Returns:
+        Number of events written.
+
+    Raises:
+        RuntimeError: Not started, or started without trace_path.
+        ValueError: max_events < 1.
+        OSError: Write to trace file failed.
+    """
+    result: int = _tracking.flush(max_events)
+    return result
+
+
 def count() -> int:
     """Current event count."""
     result: int = _tracking.count()
@@ -71,6 +369,46 @@ def get_origin(obj: object) -> CreationInfo | None:
     return _convert_creation_info(raw)
 
 
+def analyze_columns(
+    columns: EventColumns, config: FilterConfig, *, workers: int = 1
+) -> AnalysisResult:
+    """Filter columns and build call graph and object flow in one native pass.
+
+    Same AnalysisResult as AnalyzerService().analyze(columns, config), but
+    filter, per-thread call stacks and lifecycles run in C over the column
+    buffers with the GIL released; only edges, unmatched events and
+    lifecycles become Python objects. Path patterns are matched here once
+    per distinct file string. workers > 1 splits the pass over threads
+    (by recording thread and obj_id hash). Does not need tracking state.
+
+    Raises:
+        DuplicateCreateError: Second CREATE of an obj_id without DESTROY.
+        ValueError: workers outside [1, 64] or inconsistent columns.
+        TypeError: A column is not a buffer (stop_columns() columns are).
+        ConversionError: Invalid type in C output.
+    """
+    kinds = (
+        _ALL_KINDS
+        if config.include_types is None
+        else sum(1 << COLUMN_KINDS.index(t) for t in config.include_types)
+    )
+    file_pass = None
+    if config.include_paths or config.exclude_paths:
+        file_pass = bytearray(b"\x01") * len(columns.strings)
+        for file_idx in set(columns.file):
+            file_path = columns.strings[file_idx]
+            if file_path is not None and not config.path_passes(file_path):
+                file_pass[file_idx] = 0
+
+    raw = _tracking.analyze_columns(
+        {name: getattr(columns, name) for name in COLUMN_FORMATS},
+        kinds=kinds,
+        file_pass=file_pass,
+        workers=workers,
+    )
+    return _convert_analysis(raw, columns)
+
+
 # =============================================================================
 # Conversion functions (dict → domain)
 # =============================================================================
@@ -215,6 +553,251 @@ def _convert_result(raw: dict[str, object]) -> TrackingResult:
     )
 
 
+def _convert_call_edge(raw: dict[str, object]) -> CallEdge:
+    """Convert raw aggregated edge dict to CallEdge."""
+    return CallEdge(
+        caller=_convert_location(_dict(raw["caller"])),
+        callee=_convert_location(_dict(raw["callee"])),
+        count=_int(raw["count"]),
+        total_ns=_int_or_none(raw.get("total_ns")),
+    )
+
+
+def _convert_call_graph(raw: dict[str, object]) -> CallGraph:
+    """Convert raw aggregate-mode dict to CallGraph (no unmatched events)."""
+    edges = frozenset(_convert_call_edge(edge) for edge in _list_of_dicts(raw["edges"]))
+    return CallGraph(edges=edges, unmatched=())
+
+
+def _convert_analysis(raw: dict[str, object], columns: EventColumns) -> AnalysisResult:
+    """Convert raw analyze_columns() dict (row indices into columns) to AnalysisResult."""
+    duplicate_row = _int_or_none(raw["duplicate_row"])
+    if duplicate_row is not None:
+        # Duplicate CREATE without DESTROY - error (C bug)
+        raise DuplicateCreateError(columns.obj_id[duplicate_row])
+
+    locations: dict[tuple[int, int, int], Location] = {}
+
+    def location(file_idx: int, line: int, func_idx: int) -> Location:
+        key = (file_idx, line, func_idx)
+        loc = locations.get(key)
+        if loc is None:
+            loc = Location(
+                file=columns.strings[file_idx], line=line, func=columns.strings[func_idx]
+            )
+            locations[key] = loc
+        return loc
+
+    edges = frozenset(
+        CallEdge(
+            caller=location(caller_file, caller_line, caller_func),
+            callee=location(file, line, func),
+            count=count,
+        )
+        for caller_file, caller_func, file, func, caller_line, line, count in _records(
+            raw["edges"], _ANALYSIS_EDGE
+        )
+    )
+    errors = dict(columns.errors)
+    unmatched: list[CallEvent | ReturnEvent] = []
+    for row in _column(raw["unmatched"], "N"):
+        match columns.event(row, errors.get(row, ())):
+            case CallEvent() | ReturnEvent() as event:
+                unmatched.append(event)
+    call_graph = CallGraph(edges=edges, unmatched=tuple(unmatched))
+
+    # Alive lifecycles first, completed ones over them (same id reused)
+    passes = _column(raw["passes"], "N")
+    objects: dict[int, ObjectLifecycle] = {}
+    completed: list[tuple[int, ObjectLifecycle]] = []
+    for create_row, destroy_row, pass_start, pass_count in _records(
+        raw["lifecycles"], _ANALYSIS_LIFECYCLE
+    ):
+        created = columns.event(create_row)
+        if not isinstance(created, CreateEvent):
+            raise ConversionError(expected="CREATE row", got=type(created))
+        destroyed = None
+        if destroy_row != _NO_ROW:
+            destroyed = columns.event(destroy_row)
+            if not isinstance(destroyed, DestroyEvent):
+                raise ConversionError(expected="DESTROY row", got=type(destroyed))
+        lifecycle = ObjectLifecycle(
+            obj_id=created.obj_id,
+            type_name=created.type_name,
+            created=created,
+            destroyed=destroyed,
+            locations=tuple(
+                location(columns.file[r], columns.line[r], columns.func[r])
+                for r in passes[pass_start : pass_start + pass_count]
+            ),
+        )
+        if destroyed is None:
+            objects[created.obj_id] = lifecycle
+        else:
+            completed.append((destroy_row, lifecycle))
+    objects.update((lc.obj_id, lc) for _, lc in sorted(completed, key=lambda item: item[0]))
+
+    orphan_destroys: list[DestroyEvent] = []
+    for row in _column(raw["orphans"], "N"):
+        match columns.event(row):
+            case DestroyEvent() as event:
+                orphan_destroys.append(event)
+    object_flow = ObjectFlow(objects=objects, orphan_destroys=tuple(orphan_destroys))
+
+    return AnalysisResult(
+        filtered=_convert_selected(raw, columns), call_graph=call_graph, object_flow=object_flow
+    )
+
+
+def _convert_selected(raw: dict[str, object], columns: EventColumns) -> EventColumns:
+    """Kept rows of analyze_columns() as EventColumns (columns itself if all kept)."""
+    selected_raw = raw["selected"]
+    if selected_raw is None:
+        return columns
+    selected = _dict(selected_raw)
+    errors: tuple[tuple[int, tuple[FieldError, ...]], ...] = ()
+    if columns.errors:
+        new_row = {row: i for i, row in enumerate(_column(raw["rows"], "N"))}
+        errors = tuple((new_row[row], errs) for row, errs in columns.errors if row in new_row)
+    return EventColumns(
+        **{name: _column(selected[name], fmt) for name, fmt in COLUMN_FORMATS.items()},
+        strings=columns.strings,
+        errors=errors,
+        output_errors=columns.output_errors,
+    )
+
+
+def _convert_histogram(raw: dict[str, object]) -> LatencyHistogram:
+    """Convert raw histogram dict to LatencyHistogram."""
+    buckets = []
+    for entry in _list(raw["buckets"]):
+        if not isinstance(entry, tuple) or len(entry) != 3:
+            raise ConversionError(expected="tuple[int, int, int]", got=type(entry))
+        lower, upper, count = entry
+        buckets.append(LatencyBucket(lower_ns=_int(lower), upper_ns=_int(upper), count=_int(count)))
+    return LatencyHistogram(
+        count=_int(raw["count"]),
+        total_ns=_int(raw["total_ns"]),
+        min_ns=_int(raw["min_ns"]),
+        max_ns=_int(raw["max_ns"]),
+        buckets=tuple(buckets),
+    )
+
+
+def _convert_function_profile(raw: dict[str, object]) -> FunctionProfile:
+    """Convert raw profile entry dict to FunctionProfile."""
+    return FunctionProfile(
+        function=_convert_location(_dict(raw["function"])),
+        inclusive=_convert_histogram(_dict(raw["inclusive"])),
+        exclusive=_convert_histogram(_dict(raw["exclusive"])),
+    )
+
+
+def _convert_profile(raw: dict[str, object]) -> Profile:
+    """Convert raw profile-mode dict to Profile (hottest functions first)."""
+    functions = [_convert_function_profile(entry) for entry in _list_of_dicts(raw["functions"])]
+    functions.sort(key=lambda fn: fn.inclusive.total_ns, reverse=True)
+    return Profile(functions=tuple(functions), clock=_str(raw["clock"]))
+
+
+def _convert_allocation_site(raw: dict[str, object]) -> AllocationSite:
+    """Convert raw site dict to AllocationSite."""
+    lifetime_raw = raw["lifetime"]
+    return AllocationSite(
+        site=_convert_creation_info(_dict(raw["site"])),
+        allocated=_int(raw["allocated"]),
+        freed=_int(raw["freed"]),
+        lifetime=None if lifetime_raw is None else _convert_histogram(_dict(lifetime_raw)),
+    )
+
+
+def _convert_allocations(raw: dict[str, object]) -> AllocationSnapshot:
+    """Convert raw alloc_sites dict to AllocationSnapshot (most live first)."""
+    sites = [_convert_allocation_site(entry) for entry in _list_of_dicts(raw["sites"])]
+    sites.sort(key=lambda site: site.live, reverse=True)
+    return AllocationSnapshot(sites=tuple(sites), live_objects=_int(raw["live_objects"]))
+
+
+def _convert_tasks(raw: dict[str, object]) -> TaskProfile:
+    """Convert raw tasks-mode dict to TaskProfile (slowest task first)."""
+    tasks = [
+        TaskStats(
+            task=_int(entry["task"]),
+            calls=_int(entry["calls"]),
+            own_ns=_int(entry["own_ns"]),
+            allocated=_int(entry["allocated"]),
+            freed=_int(entry["freed"]),
+        )
+        for entry in _list_of_dicts(raw["tasks"])
+    ]
+    tasks.sort(key=lambda stats: stats.own_ns, reverse=True)
+    return TaskProfile(tasks=tuple(tasks))
+
+
+def _convert_stats(raw: dict[str, object]) -> TrackerStats:
+    """Convert raw stats() dict to TrackerStats."""
+    events = _dict(raw["events"])
+    dropped = _dict(raw["dropped"])
+    memory = _dict(raw["memory"])
+    creation_map = _dict(raw["creation_map"])
+    barrier = _dict(raw["barrier"])
+    hook = _dict(raw["hook"])
+    return TrackerStats(
+        events={kind: _int(events[kind.value]) for kind in EventType},
+        dropped=DropCounts(
+            oom=_int(dropped["oom"]),
+            stopping=_int(dropped["stopping"]),
+            shm=_int(dropped["shm"]),
+        ),
+        event_bytes=_int(memory["events"]),
+        creation_map_bytes=_int(memory["creation_map"]),
+        string_bytes=_int(memory["strings"]),
+        stack_bytes=_int(memory["stacks"]),
+        creation_map_size=_int(creation_map["size"]),
+        creation_map_buckets=_int(creation_map["buckets"]),
+        strings=_int(raw["strings"]),
+        stacks=_int(raw["stacks"]),
+        sites=_int(raw["sites"]),
+        threads=_int(raw["threads"]),
+        barrier_refused=_int(barrier["refused"]),
+        barrier_stops=_int(barrier["stops"]),
+        barrier_stop_wait_ns=_int(barrier["stop_wait_ns"]),
+        hook_samples=_int(hook["samples"]),
+        hook_sampled_ns=_int(hook["sampled_ns"]),
+        hook_sample_every=_int(hook["sample_every"]),
+    )
+
+
+def _convert_columns(raw: dict[str, object]) -> EventColumns:
+    """Convert raw columnar dict to EventColumns. Buffers are wrapped, not copied."""
+    columns_raw = _dict(raw["columns"])
+    columns = {name: _column(columns_raw[name], fmt) for name, fmt in COLUMN_FORMATS.items()}
+
+    strings = tuple(_str_or_none(s) for s in _list(raw["strings"]))
+
+    errors = tuple(
+        (
+            _int(entry["index"]),
+            tuple(_convert_field_error(err) for err in _list_of_dicts(entry["errors"])),
+        )
+        for entry in _list_of_dicts(raw["errors"])
+    )
+
+    output_errors_raw = raw.get("output_errors")
+    output_errors = (
+        ()
+        if output_errors_raw is None
+        else tuple(_convert_output_error(err) for err in _list_of_dicts(output_errors_raw))
+    )
+
+    return EventColumns(
+        **columns,
+        strings=strings,
+        errors=errors,
+        output_errors=output_errors,
+    )
+
+
 # =============================================================================
 # Type extractors (FAIL-FIRST)
 # =============================================================================
@@ -259,6 +842,31 @@ def _dict(value: object) -> dict[str, object]:
     return value
 
 
+def _list(value: object) -> list[object]:
+    """Extract list. Raises ConversionError if not list."""
+    if not isinstance(value, list):
+        raise ConversionError(expected="list", got=type(value))
+    return value
+
+
+def _column(value: object, fmt: str) -> memoryview:
+    """Wrap bytes column as typed memoryview. Raises ConversionError if invalid."""
+    if not isinstance(value, bytes):
+        raise ConversionError(expected="bytes", got=type(value))
+    if len(value) % struct.calcsize(fmt) != 0:
+        raise ConversionError(expected=f"bytes of {fmt!r} items", got=type(value))
+    return memoryview(value).cast(fmt)
+
+
+def _records(value: object, record: struct.Struct) -> Iterator[tuple[Any, ...]]:
+    """Unpack bytes of packed C structs. Raises ConversionError if invalid."""
+    if not isinstance(value, bytes):
+        raise ConversionError(expected="bytes", got=type(value))
+    if len(value) % record.size != 0:
+        raise ConversionError(expected=f"bytes of {record.format!r} records", got=type(value))
+    return record.iter_unpack(value)
+
+
 def _list_of_dicts(value: object) -> list[dict[str, object]]:
     """Extract list of dicts. Raises ConversionError if invalid."""
     if not isinstance(value, list):
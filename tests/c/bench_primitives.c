@@ -0,0 +1,298 @@
+/**
+ * C Primitive Microbenchmarks
+ *
+ * Standalone runner (no Criterion): times the primitives every tracked
+ * event goes through, without Python in the loop.
+ *
+ *   barrier   barrier_try_enter()/barrier_leave() pair, 1..8 threads
+ *   intern    string_intern() hit (known string) and miss (new string)
+ *   frame     frame_stack_push()/frame_stack_pop() pair at depth 64
+ *   vt        creation_map vt_insert()/vt_erase() churn, 4096 live keys
+ *
+ * Output:
+ *   JSON array of {"name", "unit", "value"} (github-action-benchmark
+ *   customSmallerIsBetter) to argv[1], or stdout if absent; a readable
+ *   table goes to stderr. Each value is the best of BENCH_REPEATS runs.
+ *
+ * Build: make bench (-O2, no sanitizers: sanitizers would dominate)
+ *
+ * C23: constexpr, nullptr
+ * POSIX: pthread, clock_gettime(CLOCK_MONOTONIC)
+ */
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tracking/barrier.h"
+#include "tracking/frame.h"
+#include "tracking/interning.h"
+
+/* Vendored verstable is not -Wconversion clean (as in edges.c) */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#include "tracking/hashtable.h"
+#pragma GCC diagnostic pop
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+constexpr int BENCH_REPEATS = 5;
+constexpr int BARRIER_OPS = 2000000;
+constexpr int BARRIER_MAX_THREADS = 8;
+constexpr int INTERN_KEYS = 1024;
+constexpr int INTERN_HIT_OPS = 2000000;
+constexpr int INTERN_MISS_OPS = 200000;
+constexpr int FRAME_DEPTH = 64;
+constexpr int FRAME_ROUNDS = 50000;
+constexpr int VT_LIVE = 4096;
+constexpr int VT_OPS = 2000000;
+constexpr size_t MAX_RESULTS = 16;
+
+/* ============================================================================
+ * Timing and Results
+ * ============================================================================ */
+
+typedef struct {
+    char name[64];
+    double ns_per_op;
+} BenchResult;
+
+static BenchResult g_results[MAX_RESULTS];
+static size_t g_result_count = 0;
+
+/* Keeps the compiler from dropping loops whose results are unused */
+static volatile uintptr_t g_sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void record(const char* name, double ns_per_op) {
+    if (g_result_count == MAX_RESULTS) {
+        fprintf(stderr, "bench: too many results (MAX_RESULTS = %zu)\n", MAX_RESULTS);
+        abort();
+    }
+    BenchResult* result = &g_results[g_result_count++];
+    snprintf(result->name, sizeof(result->name), "%s", name);
+    result->ns_per_op = ns_per_op;
+    fprintf(stderr, "  %-40s %8.2f ns/op\n", name, ns_per_op);
+}
+
+/* Best of BENCH_REPEATS runs of fn (returns ns per op). */
+static double best_of(double (*fn)(void)) {
+    double best = fn();
+    for (int i = 1; i < BENCH_REPEATS; i++) {
+        double t = fn();
+        if (t < best) {
+            best = t;
+        }
+    }
+    return best;
+}
+
+/* ============================================================================
+ * Barrier: enter/leave pair under N threads
+ * ============================================================================ */
+
+static _Atomic(int) g_barrier_ready = 0;
+static _Atomic(bool) g_barrier_go = false;
+
+static void* barrier_worker(void* arg) {
+    (void)arg;
+    atomic_fetch_add(&g_barrier_ready, 1);
+    while (!atomic_load(&g_barrier_go)) {
+        /* spin: all threads start together */
+    }
+    for (int i = 0; i < BARRIER_OPS; i++) {
+        if (barrier_try_enter()) {
+            barrier_leave();
+        }
+    }
+    return nullptr;
+}
+
+/* Wall time per pair: stays flat while threads do not contend. */
+static double bench_barrier(int threads) {
+    pthread_t tids[BARRIER_MAX_THREADS];
+    atomic_store(&g_barrier_ready, 0);
+    atomic_store(&g_barrier_go, false);
+    for (int t = 0; t < threads; t++) {
+        if (pthread_create(&tids[t], nullptr, barrier_worker, nullptr) != 0) {
+            fprintf(stderr, "bench: pthread_create failed\n");
+            abort();
+        }
+    }
+    while (atomic_load(&g_barrier_ready) < threads) {
+        /* spin */
+    }
+    uint64_t start = now_ns();
+    atomic_store(&g_barrier_go, true);
+    for (int t = 0; t < threads; t++) {
+        pthread_join(tids[t], nullptr);
+    }
+    return (double)(now_ns() - start) / BARRIER_OPS;
+}
+
+static void run_barrier(void) {
+    barrier_init();
+    for (int threads = 1; threads <= BARRIER_MAX_THREADS; threads *= 2) {
+        double best = bench_barrier(threads);
+        for (int i = 1; i < BENCH_REPEATS; i++) {
+            double t = bench_barrier(threads);
+            best = t < best ? t : best;
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "barrier enter+leave (%d thread%s)", threads,
+                 threads == 1 ? "" : "s");
+        record(name, best);
+    }
+    if (barrier_stop() != STOP_OK) {
+        fprintf(stderr, "bench: barrier_stop failed\n");
+        abort();
+    }
+    barrier_destroy();
+}
+
+/* ============================================================================
+ * String interning: hit and miss
+ * ============================================================================ */
+
+static char g_keys[INTERN_KEYS][32];
+
+static double bench_intern_hit(void) {
+    string_table_init(0);
+    for (int i = 0; i < INTERN_KEYS; i++) {
+        g_sink = (uintptr_t)string_intern(g_keys[i]);
+    }
+    uint64_t start = now_ns();
+    for (int i = 0; i < INTERN_HIT_OPS; i++) {
+        g_sink = (uintptr_t)string_intern(g_keys[i % INTERN_KEYS]);
+    }
+    double elapsed = (double)(now_ns() - start);
+    string_table_destroy();
+    return elapsed / INTERN_HIT_OPS;
+}
+
+/* Includes amortized resizes; key formatting is outside the timed loop. */
+static double bench_intern_miss(void) {
+    static char misses[INTERN_MISS_OPS][32];
+    for (int i = 0; i < INTERN_MISS_OPS; i++) {
+        snprintf(misses[i], sizeof(misses[i]), "miss.module.func_%d", i);
+    }
+    string_table_init(0);
+    uint64_t start = now_ns();
+    for (int i = 0; i < INTERN_MISS_OPS; i++) {
+        g_sink = (uintptr_t)string_intern(misses[i]);
+    }
+    double elapsed = (double)(now_ns() - start);
+    string_table_destroy();
+    return elapsed / INTERN_MISS_OPS;
+}
+
+/* ============================================================================
+ * Frame stack: push/pop at depth
+ * ============================================================================ */
+
+static double bench_frame(void) {
+    string_table_init(0);
+    StackFrame frames[FRAME_DEPTH];
+    for (int i = 0; i < FRAME_DEPTH; i++) {
+        frames[i] = (StackFrame){
+            .file = string_intern("bench/module.py"),
+            .line = i + 1,
+            .func = string_intern(g_keys[i]),
+        };
+    }
+    uint64_t start = now_ns();
+    for (int round = 0; round < FRAME_ROUNDS; round++) {
+        for (int i = 0; i < FRAME_DEPTH; i++) {
+            frame_stack_push(&frames[i]);
+        }
+        g_sink = (uintptr_t)frame_stack_caller();
+        for (int i = 0; i < FRAME_DEPTH; i++) {
+            frame_stack_pop();
+        }
+    }
+    double elapsed = (double)(now_ns() - start);
+    frame_stack_destroy();
+    string_table_destroy();
+    return elapsed / ((double)FRAME_ROUNDS * FRAME_DEPTH);
+}
+
+/* ============================================================================
+ * Creation map: insert/erase churn (CREATE then DESTROY)
+ * ============================================================================ */
+
+static double bench_vt_churn(void) {
+    creation_map map;
+    vt_init(&map);
+    CreationInfo info = {.stack = 1, .type_name_ref = "Foo"};
+    for (uintptr_t id = 0; id < VT_LIVE; id++) {
+        if (vt_is_end(vt_insert(&map, id * 16, info))) {
+            fprintf(stderr, "bench: vt_insert out of memory\n");
+            abort();
+        }
+    }
+    uint64_t start = now_ns();
+    for (uintptr_t id = VT_LIVE; id < VT_LIVE + (uintptr_t)VT_OPS; id++) {
+        if (vt_is_end(vt_insert(&map, id * 16, info))) {
+            fprintf(stderr, "bench: vt_insert out of memory\n");
+            abort();
+        }
+        g_sink = vt_erase(&map, (id - VT_LIVE) * 16);
+    }
+    double elapsed = (double)(now_ns() - start);
+    vt_cleanup(&map);
+    return elapsed / VT_OPS;
+}
+
+/* ============================================================================
+ * Output
+ * ============================================================================ */
+
+static void write_json(FILE* out) {
+    fprintf(out, "[\n");
+    for (size_t i = 0; i < g_result_count; i++) {
+        fprintf(out, "  {\"name\": \"C: %s\", \"unit\": \"ns/op\", \"value\": %.3f}%s\n",
+                g_results[i].name, g_results[i].ns_per_op, i + 1 < g_result_count ? "," : "");
+    }
+    fprintf(out, "]\n");
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(int argc, char** argv) {
+    for (int i = 0; i < INTERN_KEYS; i++) {
+        snprintf(g_keys[i], sizeof(g_keys[i]), "bench.module.func_%d", i);
+    }
+
+    fprintf(stderr, "═══ C Primitive Benchmarks (best of %d) ═══\n", BENCH_REPEATS);
+    run_barrier();
+    record("string_intern hit", best_of(bench_intern_hit));
+    record("string_intern miss", best_of(bench_intern_miss));
+    record("frame_stack push+pop (depth 64)", best_of(bench_frame));
+    record("creation_map insert+erase (4096 live)", best_of(bench_vt_churn));
+
+    FILE* out = argc > 1 ? fopen(argv[1], "w") : stdout;
+    if (out == nullptr) {
+        perror(argv[1]);
+        return 1;
+    }
+    write_json(out);
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
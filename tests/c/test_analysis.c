@@ -0,0 +1,395 @@
+/**
+ * Native Column Analysis Tests
+ *
+ * Checks per-thread CALL/RETURN pairing, edge skip rules, the filter,
+ * lifecycles with passes and orphans, duplicate CREATE detection, and
+ * that any worker count gives the single-worker result.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: null arguments and bad worker counts abort — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tracking/analysis.h"
+#include "tracking/types.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+constexpr size_t MAX_ROWS = 40000;
+constexpr size_t MAX_ARG_ROWS = 3 * MAX_ROWS;
+
+/* String idxs (0 = none) */
+constexpr uint32_t FILE_APP = 1;
+constexpr uint32_t FILE_LIB = 2;
+constexpr uint32_t FUNC_MAIN = 3;
+constexpr uint32_t FUNC_WORK = 4;
+constexpr uint32_t FUNC_HELP = 5;
+constexpr size_t STRING_COUNT = 6;
+
+/* Columns under construction (static: too large for the stack) */
+typedef struct {
+    size_t count;
+    size_t arg_total;
+    uint8_t kind[MAX_ROWS];
+    uint64_t obj_id[MAX_ROWS];
+    uint32_t file[MAX_ROWS];
+    uint32_t func[MAX_ROWS];
+    int32_t line[MAX_ROWS];
+    uint32_t caller_file[MAX_ROWS];
+    uint32_t caller_func[MAX_ROWS];
+    int32_t caller_line[MAX_ROWS];
+    uint32_t thread[MAX_ROWS];
+    uint16_t arg_count[MAX_ROWS];
+    uint64_t arg_id[MAX_ARG_ROWS];
+} Builder;
+
+static Builder g_builder;
+
+static Builder* builder_reset(void) {
+    memset(&g_builder, 0, sizeof(g_builder));
+    return &g_builder;
+}
+
+static size_t add_row(Builder *b, EventType kind, uint32_t thread, uint32_t file, uint32_t func,
+                      int32_t line) {
+    size_t row = b->count++;
+    b->kind[row] = (uint8_t)kind;
+    b->thread[row] = thread;
+    b->file[row] = file;
+    b->func[row] = func;
+    b->line[row] = line;
+    return row;
+}
+
+static size_t add_call(Builder *b, uint32_t thread, uint32_t func, uint32_t caller_func,
+                       const uint64_t *args, uint16_t nargs) {
+    size_t row = add_row(b, EVENT_CALL, thread, FILE_APP, func, (int32_t)func * 10);
+    if (caller_func != 0) {
+        b->caller_file[row] = FILE_APP;
+        b->caller_func[row] = caller_func;
+        b->caller_line[row] = (int32_t)caller_func * 10;
+    }
+    b->arg_count[row] = nargs;
+    for (uint16_t i = 0; i < nargs; i++) {
+        b->arg_id[b->arg_total++] = args[i];
+    }
+    return row;
+}
+
+static size_t add_return(Builder *b, uint32_t thread) {
+    return add_row(b, EVENT_RETURN, thread, FILE_APP, FUNC_WORK, 0);
+}
+
+static size_t add_object(Builder *b, EventType kind, uint32_t thread, uint64_t obj_id) {
+    size_t row = add_row(b, kind, thread, FILE_APP, FUNC_MAIN, 1);
+    b->obj_id[row] = obj_id;
+    return row;
+}
+
+static ColumnsView builder_view(const Builder *b) {
+    return (ColumnsView){
+        .count = b->count,
+        .kind = b->kind,
+        .obj_id = b->obj_id,
+        .file = b->file,
+        .func = b->func,
+        .line = b->line,
+        .caller_file = b->caller_file,
+        .caller_func = b->caller_func,
+        .caller_line = b->caller_line,
+        .thread = b->thread,
+        .arg_count = b->arg_count,
+        .arg_id = b->arg_id,
+    };
+}
+
+static const ColumnFilter KEEP_ALL = {.kinds = 0x0f};
+
+static uint64_t edge_count(const ColumnAnalysis *res, uint32_t caller_func, uint32_t func) {
+    for (size_t i = 0; i < res->edge_count; i++) {
+        if (res->edges[i].key.caller_func == caller_func && res->edges[i].key.func == func) {
+            return res->edges[i].count;
+        }
+    }
+    return 0;
+}
+
+static int edge_order(const void *a, const void *b) {
+    return memcmp(&((const ColumnEdge *)a)->key, &((const ColumnEdge *)b)->key,
+                  sizeof(ColumnEdgeKey));
+}
+
+static bool rows_equal(const size_t *a, size_t na, const size_t *b, size_t nb) {
+    return na == nb && (na == 0 || memcmp(a, b, na * sizeof(size_t)) == 0);
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_interleaved_threads: RETURN pops its own thread's CALL.
+ * A shared stack would pair thread 0's RETURN with thread 1's CALL.
+ */
+static int test_interleaved_threads(void) {
+    Builder *b = builder_reset();
+    add_call(b, 0, FUNC_WORK, FUNC_MAIN, nullptr, 0);
+    size_t pending = add_call(b, 1, FUNC_HELP, FUNC_MAIN, nullptr, 0);
+    add_return(b, 0);
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis res;
+    if (!analyze_columns(&view, &KEEP_ALL, 1, &res)) {
+        return 1;
+    }
+    int ok = res.edge_count == 1
+          && edge_count(&res, FUNC_MAIN, FUNC_WORK) == 1
+          && res.unmatched_count == 1 && res.unmatched[0] == pending
+          && res.row_count == 3;
+    column_analysis_destroy(&res);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_skipped_edges: no caller and self-loops are not counted; RETURNs
+ * without CALL come before open CALLs in unmatched.
+ */
+static int test_skipped_edges(void) {
+    Builder *b = builder_reset();
+    size_t orphan_return = add_return(b, 0);
+    add_call(b, 0, FUNC_WORK, 0, nullptr, 0);          /* No caller */
+    add_return(b, 0);
+    add_call(b, 0, FUNC_WORK, FUNC_WORK, nullptr, 0);  /* Self-loop */
+    add_return(b, 0);
+    size_t open_call = add_call(b, 0, FUNC_HELP, FUNC_MAIN, nullptr, 0);
+    size_t late_return = add_return(b, 1);
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis res;
+    if (!analyze_columns(&view, &KEEP_ALL, 1, &res)) {
+        return 1;
+    }
+    int ok = res.edge_count == 0
+          && res.unmatched_count == 3
+          && res.unmatched[0] == orphan_return
+          && res.unmatched[1] == late_return
+          && res.unmatched[2] == open_call;
+    column_analysis_destroy(&res);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_filter: kinds mask drops rows; file_pass applies to CALL/RETURN only.
+ */
+static int test_filter(void) {
+    Builder *b = builder_reset();
+    size_t call = add_call(b, 0, FUNC_WORK, FUNC_MAIN, nullptr, 0);
+    size_t lib_call = add_row(b, EVENT_CALL, 0, FILE_LIB, FUNC_HELP, 7);
+    size_t lib_create = add_row(b, EVENT_CREATE, 0, FILE_LIB, FUNC_HELP, 8);
+    add_return(b, 0);
+
+    uint8_t pass[STRING_COUNT] = {0};
+    pass[FILE_APP] = 1;
+    ColumnFilter paths = {.kinds = 0x0f, .file_pass = pass, .file_pass_count = STRING_COUNT};
+    ColumnFilter calls = {.kinds = 1u << EVENT_CALL};
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis by_path;
+    ColumnAnalysis by_kind;
+    if (!analyze_columns(&view, &paths, 1, &by_path)) {
+        return 1;
+    }
+    if (!analyze_columns(&view, &calls, 1, &by_kind)) {
+        column_analysis_destroy(&by_path);
+        return 1;
+    }
+    int ok = by_path.row_count == 3
+          && by_path.rows[0] == call && by_path.rows[1] == lib_create
+          && edge_count(&by_path, FUNC_MAIN, FUNC_WORK) == 1
+          && by_kind.row_count == 2
+          && by_kind.rows[0] == call && by_kind.rows[1] == lib_call
+          && by_kind.edge_count == 0
+          && by_kind.unmatched_count == 2;
+    column_analysis_destroy(&by_path);
+    column_analysis_destroy(&by_kind);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_object_flow: passes go to the open lifecycle; orphans and live
+ * objects are kept; lifecycles ordered by CREATE row.
+ */
+static int test_object_flow(void) {
+    Builder *b = builder_reset();
+    uint64_t args[] = {0x1000, 0x2000, 0x1000};
+    size_t create_a = add_object(b, EVENT_CREATE, 0, 0x1000);
+    size_t create_b = add_object(b, EVENT_CREATE, 1, 0x2000);
+    size_t call = add_call(b, 0, FUNC_WORK, FUNC_MAIN, args, 3);
+    size_t destroy_a = add_object(b, EVENT_DESTROY, 1, 0x1000);
+    add_call(b, 0, FUNC_HELP, FUNC_MAIN, args, 1);     /* 0x1000 no longer open */
+    size_t orphan = add_object(b, EVENT_DESTROY, 0, 0x3000);
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis res;
+    if (!analyze_columns(&view, &KEEP_ALL, 1, &res)) {
+        return 1;
+    }
+    const ColumnLifecycle *a = &res.lifecycles[0];
+    const ColumnLifecycle *obj_b = &res.lifecycles[1];
+    int ok = res.lifecycle_count == 2
+          && a->create_row == create_a && a->destroy_row == destroy_a
+          && a->pass_count == 2
+          && res.passes[a->pass_start] == call && res.passes[a->pass_start + 1] == call
+          && obj_b->create_row == create_b && obj_b->destroy_row == ANALYSIS_NO_ROW
+          && obj_b->pass_count == 1 && res.passes[obj_b->pass_start] == call
+          && res.orphan_count == 1 && res.orphans[0] == orphan
+          && res.duplicate_row == ANALYSIS_NO_ROW;
+    column_analysis_destroy(&res);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_duplicate_create: second CREATE of a live obj_id is reported.
+ */
+static int test_duplicate_create(void) {
+    Builder *b = builder_reset();
+    add_object(b, EVENT_CREATE, 0, 0x1000);
+    add_object(b, EVENT_CREATE, 0, 0x2000);
+    size_t duplicate = add_object(b, EVENT_CREATE, 1, 0x1000);
+    add_object(b, EVENT_CREATE, 0, 0x2000);
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis res;
+    if (!analyze_columns(&view, &KEEP_ALL, 4, &res)) {
+        return 1;
+    }
+    int ok = res.duplicate_row == duplicate;
+    column_analysis_destroy(&res);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_workers_match_single: random interleaving of 8 threads and 500
+ * objects; 2, 3 and 8 workers give exactly the single-worker result.
+ */
+static int test_workers_match_single(void) {
+    Builder *b = builder_reset();
+    uint64_t state = 0x2545f4914f6cdd1dull;
+    uint32_t depth[8] = {0};
+    bool live[500] = {false};
+    while (b->count < MAX_ROWS - 1) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint32_t thread = (uint32_t)(state % 8);
+        uint32_t obj = (uint32_t)((state >> 8) % 500);
+        uint64_t obj_id = 0x10000 + (uint64_t)obj * 16;
+        switch ((state >> 20) % 4) {
+            case 0: {
+                uint64_t args[2] = {obj_id, obj_id + 16};
+                uint32_t func = FUNC_WORK + (uint32_t)((state >> 30) % 2);
+                uint32_t caller = depth[thread] ? FUNC_WORK : FUNC_MAIN;
+                add_call(b, thread, func, caller, args, (uint16_t)((state >> 40) % 3));
+                depth[thread]++;
+                break;
+            }
+            case 1:
+                add_return(b, thread);
+                depth[thread] -= depth[thread] > 0;
+                break;
+            default:
+                add_object(b, live[obj] ? EVENT_DESTROY : EVENT_CREATE, thread, obj_id);
+                live[obj] = !live[obj];
+                break;
+        }
+    }
+
+    ColumnsView view = builder_view(b);
+    ColumnAnalysis single;
+    if (!analyze_columns(&view, &KEEP_ALL, 1, &single)) {
+        return 1;
+    }
+    qsort(single.edges, single.edge_count, sizeof(ColumnEdge), edge_order);
+
+    int failures = 0;
+    unsigned counts[] = {2, 3, 8};
+    for (size_t k = 0; k < sizeof(counts) / sizeof(counts[0]); k++) {
+        ColumnAnalysis par;
+        if (!analyze_columns(&view, &KEEP_ALL, counts[k], &par)) {
+            failures++;
+            continue;
+        }
+        qsort(par.edges, par.edge_count, sizeof(ColumnEdge), edge_order);
+        bool same = rows_equal(single.rows, single.row_count, par.rows, par.row_count)
+                 && rows_equal(single.unmatched, single.unmatched_count,
+                               par.unmatched, par.unmatched_count)
+                 && rows_equal(single.orphans, single.orphan_count, par.orphans, par.orphan_count)
+                 && rows_equal(single.passes, single.pass_count, par.passes, par.pass_count)
+                 && single.lifecycle_count == par.lifecycle_count
+                 && memcmp(single.lifecycles, par.lifecycles,
+                           single.lifecycle_count * sizeof(ColumnLifecycle)) == 0
+                 && single.edge_count == par.edge_count
+                 && memcmp(single.edges, par.edges, single.edge_count * sizeof(ColumnEdge)) == 0
+                 && single.duplicate_row == par.duplicate_row;
+        failures += !same;
+        column_analysis_destroy(&par);
+    }
+
+    int ok = failures == 0 && single.edge_count > 0 && single.pass_count > 0
+          && single.lifecycle_count > 0;
+    column_analysis_destroy(&single);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                Native Column Analysis Tests                  ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_interleaved_threads);
+    RUN_TEST(test_skipped_edges);
+    RUN_TEST(test_filter);
+    RUN_TEST(test_object_flow);
+    RUN_TEST(test_duplicate_create);
+    RUN_TEST(test_workers_match_single);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,149 @@
+/**
+ * Session Arena Tests
+ *
+ * Checks bump allocation, alignment, oversized requests, pointer
+ * stability across blocks and bulk release.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: non power-of-2 alignment aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tracking/arena.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_empty_arena: No mapping until first alloc; destroy is idempotent.
+ */
+static int test_empty_arena(void) {
+    Arena arena;
+    arena_init(&arena, 0);
+    bool ok = arena_mapped(&arena) == 0 && arena_bytes(&arena) == 0;
+    arena_destroy(&arena);
+    arena_destroy(&arena);
+    return ok && arena.head == nullptr ? 0 : 1;
+}
+
+/**
+ * test_alignment: Every allocation honours its alignment.
+ */
+static int test_alignment(void) {
+    Arena arena;
+    arena_init(&arena, 0);
+
+    bool ok = true;
+    const size_t aligns[] = {1, 2, 8, 16, 64, 4096};
+    for (int round = 0; round < 100 && ok; round++) {
+        for (size_t i = 0; i < sizeof(aligns) / sizeof(aligns[0]); i++) {
+            unsigned char *p = arena_alloc(&arena, (size_t)round % 7 + 1, aligns[i]);
+            ok = ok && p != nullptr && ((uintptr_t)p % aligns[i]) == 0;
+        }
+    }
+
+    arena_destroy(&arena);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_stability_across_blocks: Earlier allocations survive new blocks.
+ */
+static int test_stability_across_blocks(void) {
+    constexpr int N = 20000;
+    Arena arena;
+    arena_init(&arena, 4096);   /* Small blocks: many of them */
+
+    static char *strings[N];
+    bool ok = true;
+    for (int i = 0; i < N && ok; i++) {
+        strings[i] = arena_alloc(&arena, 16, 1);
+        ok = strings[i] != nullptr;
+        if (ok) {
+            snprintf(strings[i], 16, "s%d", i);
+        }
+    }
+    for (int i = 0; i < N && ok; i++) {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "s%d", i);
+        ok = strcmp(strings[i], expected) == 0;
+    }
+    ok = ok && arena_bytes(&arena) == (size_t)N * 16 && arena_mapped(&arena) > 4096;
+
+    arena_destroy(&arena);
+    return ok && arena_mapped(&arena) == 0 ? 0 : 1;
+}
+
+/**
+ * test_oversized_request: Large request gets its own block; small ones
+ * keep filling the current block.
+ */
+static int test_oversized_request(void) {
+    Arena arena;
+    arena_init(&arena, 4096);
+
+    char *small1 = arena_alloc(&arena, 32, 8);
+    size_t mapped_before = arena_mapped(&arena);
+    char *big = arena_alloc(&arena, 100000, 8);
+    char *small2 = arena_alloc(&arena, 32, 8);
+
+    bool ok = small1 != nullptr && big != nullptr && small2 != nullptr
+           && arena_mapped(&arena) >= mapped_before + 100000
+           && small2 == small1 + 32;   /* Same block, bumped */
+    if (ok) {
+        memset(big, 0xab, 100000);
+    }
+
+    arena_destroy(&arena);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                   Session Arena Tests                        ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_empty_arena);
+    RUN_TEST(test_alignment);
+    RUN_TEST(test_stability_across_blocks);
+    RUN_TEST(test_oversized_request);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
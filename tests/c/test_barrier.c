@@ -2,7 +2,7 @@
  * Stop Barrier TSan Tests
  *
  * Standalone runner (no Criterion — incompatible with TSan).
- * Tests reference counting + condition variable barrier pattern.
+ * Tests per-thread reference counting + condition variable barrier pattern.
  *
  * CRITICAL: Fixes use-after-free in _tracking.c:158
  *
@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sys/wait.h>
 #include <assert.h>
 
 #include "tracking/barrier.h"
@@ -459,6 +460,70 @@ static int test_try_enter_after_stop(void) {
     return 0;
 }
 
+/**
+ * test_resume_after_stop: resume() accepts entries again, stop() still works.
+ */
+static int test_resume_after_stop(void) {
+    barrier_init();
+
+    (void)barrier_stop();
+    barrier_resume();
+
+    if (barrier_is_stopping() || !barrier_try_enter()) {
+        barrier_destroy();
+        return 1;
+    }
+    barrier_leave();
+
+    /* Paused again, then torn down as usual */
+    bool ok = barrier_stop() == STOP_OK && !barrier_try_enter();
+    barrier_destroy();
+
+    /* Graceful after destroy: stays unusable */
+    barrier_resume();
+    if (barrier_try_enter()) {
+        barrier_leave();
+        return 1;
+    }
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_resume_across_fork: stop() before fork(), resume() on both sides.
+ * The child inherits zero counts (no section was open) and enters freely.
+ */
+static int test_resume_across_fork(void) {
+    barrier_init();
+
+    (void)barrier_stop();
+    pid_t pid = fork();
+    if (pid < 0) {
+        barrier_destroy();
+        return 1;
+    }
+    barrier_resume();
+
+    if (pid == 0) {
+        bool entered = barrier_try_enter();
+        if (entered) {
+            barrier_leave();
+        }
+        _exit(entered && barrier_active_count() == 0 ? 0 : 1);
+    }
+
+    bool entered = barrier_try_enter();
+    if (entered) {
+        barrier_leave();
+    }
+    int status = 0;
+    bool child_ok = waitpid(pid, &status, 0) == pid && WIFEXITED(status)
+                 && WEXITSTATUS(status) == 0;
+
+    (void)barrier_stop();
+    barrier_destroy();
+    return entered && child_ok ? 0 : 1;
+}
+
 /**
  * test_nested_enter: Multiple enters not allowed (same thread).
  * This tests that enter sets in_callback flag.
@@ -500,6 +565,138 @@ static int test_nested_enter_flag(void) {
     return 0;
 }
 
+/**
+ * test_stop_waits_for_other_thread: stop() scans every thread's count.
+ * Section held by another thread (own slot) blocks stop until it leaves.
+ */
+typedef struct {
+    _Atomic(bool) entered;
+    _Atomic(bool) release;
+} HolderData;
+
+static void* section_holder(void* arg) {
+    HolderData* data = (HolderData*)arg;
+    if (!barrier_try_enter()) {
+        return nullptr;
+    }
+    atomic_store(&data->entered, true);
+    while (!atomic_load(&data->release)) {
+        sched_yield();
+    }
+    barrier_leave();
+    return nullptr;
+}
+
+static int test_stop_waits_for_other_thread(void) {
+    barrier_init();
+
+    HolderData holder = {0};
+    StopWaitData stop = {0};
+    pthread_t holder_tid, stop_tid;
+    pthread_create(&holder_tid, nullptr, section_holder, &holder);
+    while (!atomic_load(&holder.entered)) {
+        sched_yield();
+    }
+    bool counted = barrier_active_count() == 1 && !barrier_in_callback();
+
+    pthread_create(&stop_tid, nullptr, stop_thread, &stop);
+    usleep(10000);
+    bool waited = !atomic_load(&stop.stop_completed);
+
+    atomic_store(&holder.release, true);
+    pthread_join(holder_tid, nullptr);
+    pthread_join(stop_tid, nullptr);
+
+    bool ok = counted && waited && atomic_load(&stop.stop_completed)
+           && barrier_active_count() == 0;
+    barrier_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_stats_contention: refusals and waiting stops are counted,
+ * init() starts from zero.
+ */
+static int test_stats_contention(void) {
+    barrier_init();
+    BarrierStats stats;
+
+    /* A stop() with nothing in flight does not wait */
+    (void)barrier_stop();
+    for (int i = 0; i < 3; i++) {
+        if (barrier_try_enter()) {
+            barrier_leave();
+        }
+    }
+    barrier_stats(&stats);
+    bool refused = stats.refused == 3 && stats.stops == 0 && stats.stop_wait_ns == 0;
+    barrier_destroy();
+
+    barrier_init();
+    barrier_stats(&stats);
+    bool reset = stats.refused == 0;
+
+    HolderData holder = {0};
+    StopWaitData stop = {0};
+    pthread_t holder_tid, stop_tid;
+    pthread_create(&holder_tid, nullptr, section_holder, &holder);
+    while (!atomic_load(&holder.entered)) {
+        sched_yield();
+    }
+    pthread_create(&stop_tid, nullptr, stop_thread, &stop);
+    usleep(10000);
+    atomic_store(&holder.release, true);
+    pthread_join(holder_tid, nullptr);
+    pthread_join(stop_tid, nullptr);
+
+    barrier_stats(&stats);
+    bool waited = stats.stops == 1 && stats.stop_wait_ns >= 1000000;
+    barrier_destroy();
+    return refused && reset && waited ? 0 : 1;
+}
+
+/**
+ * test_thread_churn: Short-lived threads reuse released slots.
+ * Rounds of threads enter/leave and exit; a stop() races the last round.
+ * TSan: detects races on slot claim/release across thread exit.
+ */
+constexpr int CHURN_ROUNDS = 8;
+
+static void* churn_worker(void* arg) {
+    (void)arg;
+    for (int i = 0; i < DISPATCHES_PER_THREAD; i++) {
+        barrier_dispatch(mock_callback, nullptr);
+    }
+    return nullptr;
+}
+
+static int test_thread_churn(void) {
+    barrier_init();
+    reset_mock_state();
+
+    pthread_t threads[NUM_THREADS];
+    for (int round = 0; round < CHURN_ROUNDS; round++) {
+        for (int t = 0; t < NUM_THREADS; t++) {
+            pthread_create(&threads[t], nullptr, churn_worker, nullptr);
+        }
+        if (round == CHURN_ROUNDS - 1 && barrier_stop() != STOP_OK) {
+            barrier_destroy();
+            return 1;
+        }
+        for (int t = 0; t < NUM_THREADS; t++) {
+            pthread_join(threads[t], nullptr);
+        }
+    }
+
+    /* Earlier rounds ran to completion; the last one was cut by stop() */
+    int full_rounds = (CHURN_ROUNDS - 1) * NUM_THREADS * DISPATCHES_PER_THREAD;
+    bool ok = atomic_load(&g_callback_count) >= full_rounds
+           && atomic_load(&g_callback_in_progress) == 0
+           && barrier_active_count() == 0;
+    barrier_destroy();
+    return ok ? 0 : 1;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -522,7 +719,12 @@ int main(void) {
     RUN_TEST(test_reinit_after_destroy);
     RUN_TEST(test_try_enter_leave);
     RUN_TEST(test_try_enter_after_stop);
+    RUN_TEST(test_resume_after_stop);
+    RUN_TEST(test_resume_across_fork);
     RUN_TEST(test_nested_enter_flag);
+    RUN_TEST(test_stop_waits_for_other_thread);
+    RUN_TEST(test_stats_contention);
+    RUN_TEST(test_thread_churn);
 
     printf("\n");
     printf("─────────────────────────────────────────────────────────────────\n");
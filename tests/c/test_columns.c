@@ -0,0 +1,265 @@
+/**
+ * Columnar Event Buffer Tests
+ *
+ * Appends events and checks rows, flattened args, string dedup and the
+ * deduplicated creation stack table.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: append on uninitialized columns aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tracking/columns.h"
+#include "tracking/stacks.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* Zeroed storage for an Event with room for MAX_ARGS trailing args */
+typedef struct {
+    alignas(Event) unsigned char bytes[sizeof(Event) + MAX_ARGS * sizeof(ArgInfo)];
+} EventBuf;
+
+static const char FILE_A[] = "app.py";
+static const char FUNC_A[] = "handler";
+static const char FUNC_B[] = "main";
+static const char ARG_NAME[] = "request";
+static const char TYPE_A[] = "dict";
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_empty: Init/destroy without rows; strings[0] reserved for nullptr.
+ */
+static int test_empty(void) {
+    EventColumns cols;
+    if (!event_columns_init(&cols)) {
+        return 1;
+    }
+    int ok = cols.count == 0 && cols.arg_total == 0
+          && cols.string_count == 1 && cols.strings[0] == nullptr;
+    event_columns_destroy(&cols);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_call_row: CALL with caller and args; args flattened in order.
+ */
+static int test_call_row(void) {
+    EventColumns cols;
+    if (!event_columns_init(&cols)) {
+        return 1;
+    }
+
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_CALL;
+    ev->location = (FrameInfo){FILE_A, 10, FUNC_A};
+    ev->caller = (FrameInfo){FILE_A, 3, FUNC_B};
+    ev->thread = 7;
+    ev->task = 0x7f0000001000;
+    ev->arg_count = 2;
+    ev->args[0] = (ArgInfo){ARG_NAME, 0x1000, TYPE_A};
+    ev->args[1] = (ArgInfo){ARG_NAME, 0x2000, nullptr};
+
+    bool appended = event_columns_append(&cols, ev);
+    int ok = appended
+          && cols.count == 1
+          && cols.kind[0] == EVENT_CALL
+          && cols.line[0] == 10
+          && cols.caller_line[0] == 3
+          && cols.strings[cols.file[0]] == FILE_A
+          && cols.strings[cols.func[0]] == FUNC_A
+          && cols.strings[cols.caller_func[0]] == FUNC_B
+          && cols.caller_file[0] == cols.file[0]
+          && cols.thread[0] == 7
+          && cols.task[0] == 0x7f0000001000
+          && cols.arg_count[0] == 2
+          && cols.arg_total == 2
+          && cols.arg_id[0] == 0x1000 && cols.arg_id[1] == 0x2000
+          && cols.arg_name[0] == cols.arg_name[1]
+          && cols.strings[cols.arg_type[0]] == TYPE_A
+          && cols.arg_type[1] == 0
+          && cols.type_name[0] == 0
+          && cols.string_count == 6;  /* nullptr + 5 unique */
+
+    event_columns_destroy(&cols);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_lifecycle_rows: CREATE/DESTROY/RETURN carry obj_id and type; no caller.
+ */
+static int test_lifecycle_rows(void) {
+    EventColumns cols;
+    if (!event_columns_init(&cols)) {
+        return 1;
+    }
+
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_CREATE;
+    ev->obj_id = 0xabc;
+    ev->type_name_ref = TYPE_A;
+    ev->location = (FrameInfo){FILE_A, 5, FUNC_A};
+    bool ok = event_columns_append(&cols, ev);
+
+    ev->type = EVENT_DESTROY;
+    ev->location = (FrameInfo){0};
+    ok = ok && event_columns_append(&cols, ev);
+
+    ev->type = EVENT_RETURN;
+    ev->obj_id = 0;
+    ev->type_name_ref = nullptr;
+    ev->location = (FrameInfo){FILE_A, 7, FUNC_A};
+    ok = ok && event_columns_append(&cols, ev);
+
+    ok = ok
+      && cols.count == 3
+      && cols.kind[0] == EVENT_CREATE && cols.kind[1] == EVENT_DESTROY && cols.kind[2] == EVENT_RETURN
+      && cols.obj_id[0] == 0xabc && cols.obj_id[1] == 0xabc && cols.obj_id[2] == 0
+      && cols.type_name[0] == cols.type_name[1] && cols.strings[cols.type_name[0]] == TYPE_A
+      && cols.type_name[2] == 0
+      && cols.file[1] == 0 && cols.func[1] == 0
+      && cols.file[2] == cols.file[0]
+      && cols.caller_func[0] == 0 && cols.arg_count[0] == 0
+      && cols.arg_total == 0;
+
+    event_columns_destroy(&cols);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_creation_stacks: DESTROY creation stacks share entries per frame;
+ * empty stack → ROOT, no creation context → NONE.
+ */
+static int test_creation_stacks(void) {
+    EventColumns cols;
+    if (!event_columns_init(&cols)) {
+        return 1;
+    }
+
+    stack_trie_init();
+    StackId bottom = stack_trie_child(STACK_EMPTY, &(StackFrame){FILE_A, 3, FUNC_B});
+    StackId left = stack_trie_child(bottom, &(StackFrame){FILE_A, 10, FUNC_A});
+    StackId right = stack_trie_child(bottom, &(StackFrame){FILE_A, 12, FUNC_A});
+
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_DESTROY;
+    ev->obj_id = 1;
+    ev->type_name_ref = TYPE_A;
+    ev->has_creation = true;
+    ev->creation = (CreationInfo){left, TYPE_A};
+    bool ok = event_columns_append(&cols, ev);
+    ev->creation.stack = right;
+    ok = ok && event_columns_append(&cols, ev);
+    ev->creation.stack = STACK_EMPTY;
+    ok = ok && event_columns_append(&cols, ev);
+    ev->has_creation = false;
+    ok = ok && event_columns_append(&cols, ev);
+
+    /* left → bottom appended by row 0, right only adds its own frame */
+    uint32_t l = cols.creation[0], r = cols.creation[1];
+    ok = ok
+      && cols.count == 4 && cols.stack_count == 2 + 3
+      && cols.stack_line[l] == 10 && cols.stack_line[r] == 12
+      && cols.stack_parent[l] == cols.stack_parent[r]
+      && cols.stack_line[cols.stack_parent[l]] == 3
+      && cols.strings[cols.stack_func[cols.stack_parent[l]]] == FUNC_B
+      && cols.stack_parent[cols.stack_parent[l]] == COLUMN_STACK_ROOT
+      && cols.strings[cols.creation_type[0]] == TYPE_A
+      && cols.creation[2] == COLUMN_STACK_ROOT
+      && cols.creation[3] == COLUMN_STACK_NONE && cols.creation_type[3] == 0;
+
+    event_columns_destroy(&cols);
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_growth: Many rows and strings cross every initial capacity.
+ */
+static int test_growth(void) {
+    EventColumns cols;
+    if (!event_columns_init(&cols)) {
+        return 1;
+    }
+
+    constexpr size_t COUNT = 20000;
+    constexpr size_t STRINGS = 1000;
+    static char names[STRINGS][16];
+    for (size_t i = 0; i < STRINGS; i++) {
+        (void)snprintf(names[i], sizeof(names[i]), "f%zu", i);
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < COUNT && ok; i++) {
+        EventBuf buf = {0};
+        Event *ev = (Event *)buf.bytes;
+        ev->type = EVENT_CALL;
+        ev->location = (FrameInfo){FILE_A, (int)i, names[i % STRINGS]};
+        ev->arg_count = 1;
+        ev->args[0] = (ArgInfo){ARG_NAME, i, TYPE_A};
+        ok = event_columns_append(&cols, ev);
+    }
+
+    ok = ok && cols.count == COUNT && cols.arg_total == COUNT
+            && cols.string_count == 1 + 3 + STRINGS;
+    for (size_t i = 0; i < COUNT && ok; i += 997) {
+        ok = cols.line[i] == (int)i
+          && cols.strings[cols.func[i]] == names[i % STRINGS]
+          && cols.arg_id[i] == i;
+    }
+
+    event_columns_destroy(&cols);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║              Columnar Event Buffer Tests                     ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_empty);
+    RUN_TEST(test_call_row);
+    RUN_TEST(test_lifecycle_rows);
+    RUN_TEST(test_creation_stacks);
+    RUN_TEST(test_growth);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,242 @@
+/**
+ * Call Edge Table Tests
+ *
+ * Checks counting, skip rules (no caller, self-loop), key identity by
+ * interned pointer + line, merge and growth past the initial buckets.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: null table/callee aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "tracking/edges.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Stand-ins for interned strings: identity is the pointer */
+static const char FILE_A[] = "/app/a.py";
+static const char FILE_B[] = "/app/b.py";
+static const char FUNC_MAIN[] = "main";
+static const char FUNC_WORK[] = "work";
+
+typedef struct {
+    EdgeKey key;
+    EdgeStats stats;
+    size_t seen;
+} Lookup;
+
+static bool find_edge(const EdgeKey *key, const EdgeStats *stats, void *ctx) {
+    Lookup *lookup = ctx;
+    if (key->caller.func == lookup->key.caller.func && key->caller.line == lookup->key.caller.line
+        && key->callee.func == lookup->key.callee.func && key->callee.line == lookup->key.callee.line) {
+        lookup->stats = *stats;
+        lookup->seen++;
+    }
+    return true;
+}
+
+static EdgeStats stats_of(const EdgeTable *table, FrameInfo caller, FrameInfo callee) {
+    Lookup lookup = {.key = {caller, callee}};
+    (void)edge_table_each(table, find_edge, &lookup);
+    return lookup.seen == 1 ? lookup.stats : (EdgeStats){0};
+}
+
+static bool stop_at_first(const EdgeKey *, const EdgeStats *, void *ctx) {
+    (*(size_t *)ctx)++;
+    return false;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_count_and_time: Repeated edge sums count and elapsed time.
+ */
+static int test_count_and_time(void) {
+    EdgeTable *table = edge_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    FrameInfo main_frame = {FILE_A, 1, FUNC_MAIN};
+    FrameInfo work_frame = {FILE_B, 10, FUNC_WORK};
+
+    bool ok = edge_table_add(table, &main_frame, &work_frame, 100)
+           && edge_table_add(table, &main_frame, &work_frame, 50)
+           && edge_table_add(table, &work_frame, &main_frame, 0);
+    EdgeStats forward = stats_of(table, main_frame, work_frame);
+    EdgeStats backward = stats_of(table, work_frame, main_frame);
+    ok = ok && edge_table_size(table) == 2
+         && forward.count == 2 && forward.total_ns == 150
+         && backward.count == 1 && backward.total_ns == 0;
+    edge_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_skipped_edges: No caller, unknown-file caller and self-loops skipped.
+ */
+static int test_skipped_edges(void) {
+    EdgeTable *table = edge_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    FrameInfo work_frame = {FILE_B, 10, FUNC_WORK};
+    FrameInfo builtin = {nullptr, 0, FUNC_MAIN};
+
+    bool ok = edge_table_add(table, nullptr, &work_frame, 1)
+           && edge_table_add(table, &FRAME_NO_CALLER, &work_frame, 1)
+           && edge_table_add(table, &builtin, &work_frame, 1)
+           && edge_table_add(table, &work_frame, &work_frame, 1);
+    ok = ok && edge_table_size(table) == 0;
+    edge_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_line_is_part_of_key: Same function at another first line is a new node.
+ */
+static int test_line_is_part_of_key(void) {
+    EdgeTable *table = edge_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    FrameInfo main_frame = {FILE_A, 1, FUNC_MAIN};
+    FrameInfo work_v1 = {FILE_B, 10, FUNC_WORK};
+    FrameInfo work_v2 = {FILE_B, 20, FUNC_WORK};
+
+    bool ok = edge_table_add(table, &main_frame, &work_v1, 0)
+           && edge_table_add(table, &main_frame, &work_v2, 0);
+    ok = ok && edge_table_size(table) == 2
+         && stats_of(table, main_frame, work_v1).count == 1
+         && stats_of(table, main_frame, work_v2).count == 1;
+    edge_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_merge: Shared edges sum, others are copied; src unchanged.
+ */
+static int test_merge(void) {
+    EdgeTable *dst = edge_table_new();
+    EdgeTable *src = edge_table_new();
+    if (dst == nullptr || src == nullptr) {
+        edge_table_free(dst);
+        edge_table_free(src);
+        return 1;
+    }
+    FrameInfo main_frame = {FILE_A, 1, FUNC_MAIN};
+    FrameInfo work_frame = {FILE_B, 10, FUNC_WORK};
+    FrameInfo helper = {FILE_B, 30, FUNC_MAIN};
+
+    bool ok = edge_table_add(dst, &main_frame, &work_frame, 5)
+           && edge_table_add(src, &main_frame, &work_frame, 7)
+           && edge_table_add(src, &work_frame, &helper, 1)
+           && edge_table_merge(dst, src);
+    EdgeStats shared = stats_of(dst, main_frame, work_frame);
+    ok = ok && edge_table_size(dst) == 2 && edge_table_size(src) == 2
+         && shared.count == 2 && shared.total_ns == 12
+         && stats_of(dst, work_frame, helper).count == 1
+         && stats_of(src, main_frame, work_frame).count == 1;
+    edge_table_free(dst);
+    edge_table_free(src);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_growth: Many distinct edges survive rehashing with exact counts.
+ */
+static int test_growth(void) {
+    constexpr int32_t EDGES = 5000;
+    EdgeTable *table = edge_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    FrameInfo main_frame = {FILE_A, 1, FUNC_MAIN};
+
+    bool ok = true;
+    for (int round = 0; round < 3 && ok; round++) {
+        for (int32_t line = 1; line <= EDGES && ok; line++) {
+            FrameInfo callee = {FILE_B, line, FUNC_WORK};
+            ok = edge_table_add(table, &main_frame, &callee, (uint64_t)line);
+        }
+    }
+    FrameInfo last = {FILE_B, EDGES, FUNC_WORK};
+    EdgeStats stats = stats_of(table, main_frame, last);
+    ok = ok && edge_table_size(table) == (size_t)EDGES
+         && stats.count == 3 && stats.total_ns == 3 * (uint64_t)EDGES;
+    edge_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_each_stops_early: Visitor returning false ends iteration.
+ */
+static int test_each_stops_early(void) {
+    EdgeTable *table = edge_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    FrameInfo main_frame = {FILE_A, 1, FUNC_MAIN};
+    FrameInfo work_v1 = {FILE_B, 10, FUNC_WORK};
+    FrameInfo work_v2 = {FILE_B, 20, FUNC_WORK};
+    size_t visited = 0;
+
+    bool ok = edge_table_add(table, &main_frame, &work_v1, 0)
+           && edge_table_add(table, &main_frame, &work_v2, 0)
+           && !edge_table_each(table, stop_at_first, &visited);
+    edge_table_free(table);
+    edge_table_free(nullptr);  /* No-op */
+    return ok && visited == 1 ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                  Call Edge Table Tests                       ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_count_and_time);
+    RUN_TEST(test_skipped_edges);
+    RUN_TEST(test_line_is_part_of_key);
+    RUN_TEST(test_merge);
+    RUN_TEST(test_growth);
+    RUN_TEST(test_each_stops_early);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
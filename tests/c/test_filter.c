@@ -0,0 +1,176 @@
+/**
+ * C-side Event Filter Tests
+ *
+ * Checks include/exclude glob semantics (as Python fnmatch on POSIX),
+ * type mask and pattern ownership.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: null filter/pattern aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "tracking/filter.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_empty_filter: No patterns, all types — everything passes.
+ */
+static int test_empty_filter(void) {
+    EventFilter filter;
+    if (!event_filter_init(&filter, nullptr, 0, nullptr, 0, EVENT_TYPES_ALL)) {
+        return 1;
+    }
+    bool ok = !event_filter_has_paths(&filter)
+           && event_filter_path(&filter, "/usr/lib/python3.14/os.py")
+           && event_filter_path(&filter, nullptr)
+           && event_filter_type(&filter, EVENT_CALL)
+           && event_filter_type(&filter, EVENT_DESTROY);
+    event_filter_destroy(&filter);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_include_exclude: Include any-of, then exclude none-of.
+ */
+static int test_include_exclude(void) {
+    const char *include[] = {"/app/*", "*/tests/*.py"};
+    const char *exclude[] = {"*/vendor/*"};
+    EventFilter filter;
+    if (!event_filter_init(&filter, include, 2, exclude, 1, EVENT_TYPES_ALL)) {
+        return 1;
+    }
+    bool ok = event_filter_has_paths(&filter)
+           && event_filter_path(&filter, "/app/main.py")
+           && event_filter_path(&filter, "/app/pkg/deep/mod.py")   /* `*` crosses `/` */
+           && event_filter_path(&filter, "/repo/tests/test_x.py")
+           && !event_filter_path(&filter, "/app/vendor/lib.py")
+           && !event_filter_path(&filter, "/usr/lib/python3.14/os.py")
+           && event_filter_path(&filter, nullptr);                 /* unknown file passes */
+    event_filter_destroy(&filter);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_exclude_only: Excluded stdlib/site-packages, rest passes.
+ */
+static int test_exclude_only(void) {
+    const char *exclude[] = {"*/site-packages/*", "/usr/lib/python3.1?/*", "<frozen *>"};
+    EventFilter filter;
+    if (!event_filter_init(&filter, nullptr, 0, exclude, 3, EVENT_TYPES_ALL)) {
+        return 1;
+    }
+    bool ok = event_filter_path(&filter, "/app/main.py")
+           && !event_filter_path(&filter, "/venv/lib/site-packages/rich/console.py")
+           && !event_filter_path(&filter, "/usr/lib/python3.14/json/decoder.py")
+           && !event_filter_path(&filter, "<frozen importlib._bootstrap>")
+           && event_filter_path(&filter, "/usr/lib/python3.9/os.py");
+    event_filter_destroy(&filter);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_literal_backslash_and_sets: `[...]` sets match, backslash is literal.
+ */
+static int test_literal_backslash_and_sets(void) {
+    const char *include[] = {"[ab]*.py", "c\\*"};
+    EventFilter filter;
+    if (!event_filter_init(&filter, include, 2, nullptr, 0, EVENT_TYPES_ALL)) {
+        return 1;
+    }
+    bool ok = event_filter_path(&filter, "a.py")
+           && event_filter_path(&filter, "b/x.py")
+           && !event_filter_path(&filter, "c.py")
+           && event_filter_path(&filter, "c\\anything")
+           && !event_filter_path(&filter, "c*");
+    event_filter_destroy(&filter);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_type_mask: Only masked types are recorded.
+ */
+static int test_type_mask(void) {
+    EventFilter filter;
+    unsigned types = EVENT_TYPE_BIT(EVENT_CALL) | EVENT_TYPE_BIT(EVENT_CREATE);
+    if (!event_filter_init(&filter, nullptr, 0, nullptr, 0, types)) {
+        return 1;
+    }
+    bool ok = event_filter_type(&filter, EVENT_CALL)
+           && !event_filter_type(&filter, EVENT_RETURN)
+           && event_filter_type(&filter, EVENT_CREATE)
+           && !event_filter_type(&filter, EVENT_DESTROY);
+    event_filter_destroy(&filter);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_patterns_copied: Filter survives the caller's pattern buffers.
+ */
+static int test_patterns_copied(void) {
+    char pattern[16];
+    strcpy(pattern, "/app/*");
+    const char *include[] = {pattern};
+    EventFilter filter;
+    if (!event_filter_init(&filter, include, 1, nullptr, 0, EVENT_TYPES_ALL)) {
+        return 1;
+    }
+    memset(pattern, 'x', sizeof(pattern) - 1);
+
+    bool ok = event_filter_path(&filter, "/app/main.py");
+    event_filter_destroy(&filter);
+    event_filter_destroy(&filter);  /* Idempotent */
+    return ok && filter.include == nullptr ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                 C-side Event Filter Tests                    ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_empty_filter);
+    RUN_TEST(test_include_exclude);
+    RUN_TEST(test_exclude_only);
+    RUN_TEST(test_literal_backslash_and_sets);
+    RUN_TEST(test_type_mask);
+    RUN_TEST(test_patterns_copied);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
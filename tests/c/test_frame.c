@@ -170,6 +170,39 @@ static int test_caller_chain(void) {
     return 0;
 }
 
+/**
+ * test_top_and_peek: Top is last pushed, peek walks toward bottom.
+ */
+static int test_top_and_peek(void) {
+    string_table_init(64);
+    frame_stack_clear();
+
+    if (frame_stack_top() != nullptr || frame_stack_peek(0) != nullptr) {
+        frame_stack_destroy();
+        string_table_destroy();
+        return 1;
+    }
+
+    StackFrame f1 = make_frame("a.py", 1, "func_a");
+    StackFrame f2 = make_frame("b.py", 2, "func_b");
+    StackFrame f3 = make_frame("c.py", 3, "func_c");
+
+    frame_stack_push(&f1);
+    frame_stack_push(&f2);
+    frame_stack_push(&f3);
+
+    int ok = frame_equals(frame_stack_top(), &f3)
+          && frame_equals(frame_stack_peek(0), &f3)
+          && frame_equals(frame_stack_peek(1), &f2)
+          && frame_equals(frame_stack_peek(2), &f1)
+          && frame_stack_peek(3) == nullptr
+          && frame_stack_peek(1) == frame_stack_caller();
+
+    frame_stack_destroy();
+    string_table_destroy();
+    return ok ? 0 : 1;
+}
+
 /**
  * test_frame_equals: Pointer equality for interned strings.
  */
@@ -455,6 +488,7 @@ int main(void) {
     RUN_TEST(test_stack_empty);
     RUN_TEST(test_push_pop_single);
     RUN_TEST(test_caller_chain);
+    RUN_TEST(test_top_and_peek);
     RUN_TEST(test_frame_equals);
     RUN_TEST(test_frame_is_empty);
     RUN_TEST(test_clear);
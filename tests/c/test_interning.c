@@ -168,6 +168,23 @@ Test(interning, intern_many_duplicates, .init = setup, .fini = teardown) {
         "Expected %d unique strings, got %zu (memory leak?)", UNIQUE, count);
 }
 
+Test(interning, bytes_grow_with_strings, .init = setup, .fini = teardown) {
+    size_t empty = string_table_bytes();
+    cr_assert_gt(empty, 0, "initialized table holds its bucket array");
+
+    char buf[4096];
+    memset(buf, 'x', sizeof(buf) - 1);
+    buf[sizeof(buf) - 1] = '\0';
+    (void)string_intern(buf);
+
+    cr_assert_geq(string_table_bytes(), empty + sizeof(buf),
+        "arena holds the interned bytes");
+}
+
+Test(interning, bytes_zero_when_destroyed) {
+    cr_assert_eq(string_table_bytes(), 0);
+}
+
 /* ============================================================================
  * Edge cases
  * ============================================================================ */
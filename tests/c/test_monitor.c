@@ -0,0 +1,156 @@
+/**
+ * Monitor Stack Tests
+ *
+ * Checks zeroed push, peek order, growth past the initial capacity,
+ * clear/reuse and per-thread isolation. Callback pairing (sys.monitoring)
+ * tested in integration tests.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: pop of an empty stack aborts — not tested here
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "tracking/monitor.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* Stand-ins for interpreter frames: identity is the pointer */
+static const int FRAME_A = 0;
+static const int FRAME_B = 0;
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/** push() hands out zeroed entries; peek(0) is the newest. */
+static int test_push_peek(void) {
+    MonitorEntry *a = monitor_stack_push();
+    bool ok = a->code == nullptr && a->start == 0 && a->child_ticks == 0;
+    a->code = &FRAME_A;
+    a->kind = MONITOR_PROFILED;
+    a->child_ticks = 7;
+
+    MonitorEntry *b = monitor_stack_push();
+    ok = ok && b->child_ticks == 0 && b->kind == MONITOR_RECORDED;
+    b->code = &FRAME_B;
+
+    ok = ok && monitor_stack_depth() == 2
+       && monitor_stack_peek(0)->code == &FRAME_B
+       && monitor_stack_peek(1)->code == &FRAME_A
+       && monitor_stack_peek(1)->child_ticks == 7
+       && monitor_stack_peek(2) == nullptr;
+
+    monitor_stack_pop();
+    ok = ok && monitor_stack_depth() == 1 && monitor_stack_peek(0)->code == &FRAME_A;
+    monitor_stack_pop();
+    ok = ok && monitor_stack_depth() == 0 && monitor_stack_peek(0) == nullptr;
+
+    monitor_stack_destroy();
+    return ok ? 0 : 1;
+}
+
+/** Deep recursion: entries survive reallocation in order. */
+static int test_growth(void) {
+    constexpr size_t N = 10000;
+    for (size_t i = 0; i < N; i++) {
+        monitor_stack_push()->start = i;
+    }
+    bool ok = monitor_stack_depth() == N;
+    for (size_t i = 0; ok && i < N; i++) {
+        ok = monitor_stack_peek(i)->start == N - 1 - i;
+    }
+    for (size_t i = 0; i < N; i++) {
+        monitor_stack_pop();
+    }
+    ok = ok && monitor_stack_depth() == 0;
+
+    monitor_stack_destroy();
+    return ok ? 0 : 1;
+}
+
+/** clear() drops entries (new session), the next push starts zeroed. */
+static int test_clear_reuse(void) {
+    for (int i = 0; i < 5; i++) {
+        monitor_stack_push()->child_ticks = 99;
+    }
+    monitor_stack_clear();
+    bool ok = monitor_stack_depth() == 0 && monitor_stack_peek(0) == nullptr;
+
+    MonitorEntry *fresh = monitor_stack_push();
+    ok = ok && fresh->child_ticks == 0 && monitor_stack_depth() == 1;
+
+    monitor_stack_destroy();
+    return ok ? 0 : 1;
+}
+
+static void* push_on_thread(void *arg) {
+    (void)arg;
+    for (int i = 0; i < 100; i++) {
+        monitor_stack_push()->start = 1;
+    }
+    size_t depth = monitor_stack_depth();
+    monitor_stack_destroy();
+    return (void *)(uintptr_t)depth;
+}
+
+/** Each thread has its own stack. */
+static int test_thread_local(void) {
+    (void)monitor_stack_push();
+
+    pthread_t thread;
+    void *other_depth = nullptr;
+    bool ok = pthread_create(&thread, nullptr, push_on_thread, nullptr) == 0
+           && pthread_join(thread, &other_depth) == 0;
+    ok = ok && (uintptr_t)other_depth == 100 && monitor_stack_depth() == 1;
+
+    monitor_stack_destroy();
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                   Monitor Stack Tests                        ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_push_peek);
+    RUN_TEST(test_growth);
+    RUN_TEST(test_clear_reuse);
+    RUN_TEST(test_thread_local);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,278 @@
+/**
+ * Profile Mode Tests
+ *
+ * Checks histogram bucket math (exhaustive round trip on small values,
+ * 12.5% bound on large ones), record/merge stats, the profile table
+ * (key identity, merge, growth) and the profiling clocks.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: null table/func aborts — not tested here
+ */
+
+#define _GNU_SOURCE
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "tracking/clock.h"
+#include "tracking/histogram.h"
+#include "tracking/profile.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Stand-ins for interned strings: identity is the pointer */
+static const char FILE_A[] = "/app/a.py";
+static const char FUNC_MAIN[] = "main";
+static const char FUNC_WORK[] = "work";
+
+typedef struct {
+    FrameInfo func;
+    const ProfileStats *stats;
+    size_t seen;
+} Lookup;
+
+static bool find_func(const FrameInfo *func, const ProfileStats *stats, void *ctx) {
+    Lookup *lookup = ctx;
+    if (func->func == lookup->func.func && func->line == lookup->func.line) {
+        lookup->stats = stats;
+        lookup->seen++;
+    }
+    return true;
+}
+
+static const ProfileStats* lookup(const ProfileTable *table, const FrameInfo *func) {
+    Lookup l = {.func = *func};
+    profile_table_each(table, find_func, &l);
+    return l.seen == 1 ? l.stats : nullptr;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_bucket_round_trip: Every value lies within its bucket's bounds;
+ * buckets are contiguous and cover [0, 2^40).
+ */
+static int test_bucket_round_trip(void) {
+    for (uint64_t v = 0; v < 100000; v++) {
+        uint64_t lower = 0, upper = 0;
+        histogram_bucket_bounds(histogram_bucket(v), &lower, &upper);
+        if (v < lower || v >= upper) {
+            return 1;
+        }
+    }
+
+    uint64_t expected_lower = 0;
+    for (unsigned idx = 0; idx < HIST_BUCKETS; idx++) {
+        uint64_t lower = 0, upper = 0;
+        histogram_bucket_bounds(idx, &lower, &upper);
+        if (lower != expected_lower || upper <= lower || histogram_bucket(lower) != idx) {
+            return 1;
+        }
+        expected_lower = upper;
+    }
+    return expected_lower == (1ull << HIST_MAX_BITS) ? 0 : 1;
+}
+
+/**
+ * test_bucket_precision: Bucket width is at most 1/8 of its lower bound;
+ * huge values clamp into the last bucket.
+ */
+static int test_bucket_precision(void) {
+    for (unsigned idx = HIST_SUB_BUCKETS; idx < HIST_BUCKETS; idx++) {
+        uint64_t lower = 0, upper = 0;
+        histogram_bucket_bounds(idx, &lower, &upper);
+        if ((upper - lower) * HIST_SUB_BUCKETS > lower) {
+            return 1;
+        }
+    }
+    return histogram_bucket(UINT64_MAX) == HIST_BUCKETS - 1
+        && histogram_bucket(1ull << HIST_MAX_BITS) == HIST_BUCKETS - 1 ? 0 : 1;
+}
+
+/**
+ * test_record_and_merge: count/total/min/max follow records and merges;
+ * merging an empty histogram changes nothing.
+ */
+static int test_record_and_merge(void) {
+    LatencyHistogram a, b, empty;
+    histogram_init(&a);
+    histogram_init(&b);
+    histogram_init(&empty);
+
+    histogram_record(&a, 100);
+    histogram_record(&a, 300);
+    histogram_record(&b, 5);
+    histogram_record(&b, 100000);
+
+    histogram_merge(&a, &empty);
+    bool ok = a.count == 2 && a.total_ns == 400 && a.min_ns == 100 && a.max_ns == 300;
+
+    histogram_merge(&a, &b);
+    ok = ok && a.count == 4 && a.total_ns == 100405 && a.min_ns == 5 && a.max_ns == 100000;
+
+    uint64_t sum = 0;
+    for (unsigned i = 0; i < HIST_BUCKETS; i++) {
+        sum += a.buckets[i];
+    }
+    ok = ok && sum == 4 && a.buckets[histogram_bucket(100)] == 1 && a.buckets[5] == 1;
+    return ok && empty.min_ns == UINT64_MAX ? 0 : 1;
+}
+
+/**
+ * test_table_add: One entry per (file, func, line); both histograms fed.
+ */
+static int test_table_add(void) {
+    ProfileTable *table = profile_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    FrameInfo main_fn = {.file = FILE_A, .func = FUNC_MAIN, .line = 1};
+    FrameInfo work = {.file = FILE_A, .func = FUNC_WORK, .line = 10};
+    FrameInfo work_other_line = {.file = FILE_A, .func = FUNC_WORK, .line = 20};
+
+    bool ok = profile_table_add(table, &main_fn, 1000, 200)
+           && profile_table_add(table, &work, 400, 400)
+           && profile_table_add(table, &work, 600, 600)
+           && profile_table_add(table, &work_other_line, 50, 50);
+
+    const ProfileStats *stats = lookup(table, &work);
+    ok = ok && profile_table_size(table) == 3 && stats != nullptr
+       && stats->inclusive.count == 2 && stats->inclusive.total_ns == 1000
+       && stats->exclusive.min_ns == 400 && stats->exclusive.max_ns == 600;
+
+    stats = lookup(table, &main_fn);
+    ok = ok && stats != nullptr && stats->inclusive.total_ns == 1000
+       && stats->exclusive.total_ns == 200;
+
+    profile_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_table_merge_and_growth: Merge sums histograms of shared functions
+ * and copies new ones; thousands of functions survive rehashing.
+ */
+static int test_table_merge_and_growth(void) {
+    constexpr int N = 3000;
+    ProfileTable *dst = profile_table_new();
+    ProfileTable *src = profile_table_new();
+    if (dst == nullptr || src == nullptr) {
+        profile_table_free(dst);
+        profile_table_free(src);
+        return 1;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < N && ok; i++) {
+        FrameInfo fn = {.file = FILE_A, .func = FUNC_WORK, .line = i};
+        ok = profile_table_add(src, &fn, (uint64_t)i, 1);
+        if (ok && i % 2 == 0) {
+            ok = profile_table_add(dst, &fn, 7, 7);
+        }
+    }
+    ok = ok && profile_table_merge(dst, src) && profile_table_size(dst) == (size_t)N;
+
+    FrameInfo shared = {.file = FILE_A, .func = FUNC_WORK, .line = 42};
+    FrameInfo only_src = {.file = FILE_A, .func = FUNC_WORK, .line = 43};
+    const ProfileStats *stats = lookup(dst, &shared);
+    ok = ok && stats != nullptr && stats->inclusive.count == 2 && stats->inclusive.total_ns == 49;
+    stats = lookup(dst, &only_src);
+    ok = ok && stats != nullptr && stats->inclusive.count == 1 && stats->exclusive.total_ns == 1;
+
+    profile_table_free(dst);
+    profile_table_free(src);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_clocks: Names round-trip; every available clock is monotonic and
+ * converts a ~2 ms sleep to roughly 2 ms (coarse: within its tick).
+ */
+static int test_clocks(void) {
+    ProfileClockKind kind;
+    if (profile_clock_parse("nope", &kind) || profile_clock_parse(nullptr, &kind)) {
+        return 1;
+    }
+
+    const ProfileClockKind kinds[] = {PROFILE_CLOCK_MONOTONIC, PROFILE_CLOCK_COARSE,
+                                      PROFILE_CLOCK_TSC};
+    for (size_t i = 0; i < sizeof(kinds) / sizeof(kinds[0]); i++) {
+        if (!profile_clock_parse(profile_clock_name(kinds[i]), &kind) || kind != kinds[i]) {
+            return 1;
+        }
+
+        ProfileClock clock;
+        if (!profile_clock_init(&clock, kinds[i])) {
+            if (kinds[i] != PROFILE_CLOCK_TSC) {
+                return 1;  /* Only TSC may be unavailable */
+            }
+            continue;
+        }
+
+        uint64_t start = profile_clock_now(&clock);
+        nanosleep(&(struct timespec){.tv_nsec = 2 * 1000 * 1000}, nullptr);
+        uint64_t end = profile_clock_now(&clock);
+        if (end < start) {
+            return 1;
+        }
+        uint64_t ns = profile_clock_ticks_to_ns(&clock, end - start);
+        uint64_t slack = kinds[i] == PROFILE_CLOCK_COARSE ? 20 * 1000 * 1000 : 1000 * 1000;
+        if (ns + slack < 2 * 1000 * 1000 || ns > 2 * 1000 * 1000 + 50 * slack) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                    Profile Mode Tests                        ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_bucket_round_trip);
+    RUN_TEST(test_bucket_precision);
+    RUN_TEST(test_record_and_merge);
+    RUN_TEST(test_table_add);
+    RUN_TEST(test_table_merge_and_growth);
+    RUN_TEST(test_clocks);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,199 @@
+/**
+ * Call Sampling Tests
+ *
+ * Checks every-Nth, interval and per-code backoff stages, and that the
+ * per-code counter stays exact under concurrent callers.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: null config/state aborts — not tested here
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "tracking/sampling.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_disabled: Zero config records every call.
+ */
+static int test_disabled(void) {
+    SamplingConfig cfg = {0};
+    SamplerState state = {0};
+    _Atomic(uint64_t) fires = 0;
+
+    if (sampling_enabled(&cfg)) {
+        return 1;
+    }
+    for (int i = 0; i < 100; i++) {
+        if (!sampler_thread_allows(&cfg, &state, 0) || !sampler_code_allows(&cfg, &fires)) {
+            return 1;
+        }
+    }
+    /* Disabled code stage does not count */
+    return atomic_load(&fires) == 0 ? 0 : 1;
+}
+
+/**
+ * test_every_nth: 1st, 4th, 7th ... call with every = 3.
+ */
+static int test_every_nth(void) {
+    SamplingConfig cfg = {.every = 3};
+    SamplerState state = {0};
+    int recorded = 0;
+
+    for (int i = 0; i < 30; i++) {
+        bool allowed = sampler_thread_allows(&cfg, &state, 0);
+        if (allowed != (i % 3 == 0)) {
+            return 1;
+        }
+        recorded += allowed;
+    }
+    return sampling_enabled(&cfg) && recorded == 10 ? 0 : 1;
+}
+
+/**
+ * test_interval: At most one call per interval, first call recorded.
+ */
+static int test_interval(void) {
+    SamplingConfig cfg = {.interval_ns = 100};
+    SamplerState state = {0};
+
+    bool ok = sampler_thread_allows(&cfg, &state, 1000)
+           && !sampler_thread_allows(&cfg, &state, 1050)
+           && !sampler_thread_allows(&cfg, &state, 1099)
+           && sampler_thread_allows(&cfg, &state, 1100)
+           && sampler_thread_allows(&cfg, &state, 5000)
+           && !sampler_thread_allows(&cfg, &state, 5001);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_stages_compose: Interval only sees calls every-Nth let through.
+ */
+static int test_stages_compose(void) {
+    SamplingConfig cfg = {.every = 2, .interval_ns = 10};
+    SamplerState state = {0};
+
+    bool ok = sampler_thread_allows(&cfg, &state, 0)     /* 1st: both allow */
+           && !sampler_thread_allows(&cfg, &state, 20)   /* 2nd: every rejects */
+           && !sampler_thread_allows(&cfg, &state, 5)    /* 3rd: interval rejects */
+           && !sampler_thread_allows(&cfg, &state, 30)   /* 4th: every rejects */
+           && sampler_thread_allows(&cfg, &state, 30);   /* 5th: both allow */
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_code_backoff: First K calls, then calls K, 2K, 4K, 8K ...
+ */
+static int test_code_backoff(void) {
+    constexpr uint64_t K = 4;
+    SamplingConfig cfg = {.max_per_code = K};
+    _Atomic(uint64_t) fires = 0;
+
+    for (uint64_t n = 0; n < 200; n++) {
+        bool expected = n < K || n == K || n == 2 * K || n == 4 * K
+                     || n == 8 * K || n == 16 * K || n == 32 * K;
+        if (sampler_code_allows(&cfg, &fires) != expected) {
+            return 1;
+        }
+    }
+    return atomic_load(&fires) == 200 ? 0 : 1;
+}
+
+/* ============================================================================
+ * Concurrency
+ * ============================================================================ */
+
+constexpr int THREADS = 8;
+constexpr int CALLS_PER_THREAD = 10000;
+
+typedef struct {
+    const SamplingConfig *cfg;
+    _Atomic(uint64_t) *fires;
+    _Atomic(int) *recorded;
+} CodeWorker;
+
+static void* code_worker(void *arg) {
+    CodeWorker *w = arg;
+    for (int i = 0; i < CALLS_PER_THREAD; i++) {
+        if (sampler_code_allows(w->cfg, w->fires)) {
+            atomic_fetch_add(w->recorded, 1);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * test_code_concurrent: Shared counter hands out exactly K + backoff slots.
+ */
+static int test_code_concurrent(void) {
+    constexpr uint64_t LIMIT = 100;
+    SamplingConfig cfg = {.max_per_code = LIMIT};
+    _Atomic(uint64_t) fires = 0;
+    _Atomic(int) recorded = 0;
+    CodeWorker w = {&cfg, &fires, &recorded};
+
+    pthread_t threads[THREADS];
+    for (int t = 0; t < THREADS; t++) {
+        pthread_create(&threads[t], nullptr, code_worker, &w);
+    }
+    for (int t = 0; t < THREADS; t++) {
+        pthread_join(threads[t], nullptr);
+    }
+
+    /* 80000 calls: 100 + {100, 200, 400, ..., 51200} = 100 + 10 */
+    return atomic_load(&fires) == (uint64_t)THREADS * CALLS_PER_THREAD
+        && atomic_load(&recorded) == 110 ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                  Call Sampling Tests                         ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_disabled);
+    RUN_TEST(test_every_nth);
+    RUN_TEST(test_interval);
+    RUN_TEST(test_stages_compose);
+    RUN_TEST(test_code_backoff);
+    RUN_TEST(test_code_concurrent);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,364 @@
+/**
+ * Shared-Memory Ring Tests
+ *
+ * Checks segment create/attach errors, event round trip with string
+ * resolution, per-ring string dedup, drop-on-full (never blocks), PAD
+ * wraparound, rings exhausted (unclaimed) and a forked producer process
+ * feeding a consumer in the parent. start(shm_name=...) tested in
+ * integration tests.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: malformed records abort — not tested here
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "tracking/shmring.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* Producer-side "interned" strings: the id is the pointer */
+static const char FILE_A[] = "/app/service.py";
+static const char FUNC_A[] = "handle";
+static const char FILE_B[] = "/app/main.py";
+static const char FUNC_B[] = "main";
+
+static char g_name[64];
+
+/** Fresh segment name per test (pid + counter). */
+static const char* segment_name(void) {
+    static int counter = 0;
+    snprintf(g_name, sizeof(g_name), "/archcheck-test-%d-%d", (int)getpid(), counter++);
+    return g_name;
+}
+
+static RawEvent call_event(int32_t line) {
+    return (RawEvent){
+        .kind = EVENT_CALL,
+        .data.call = {
+            .callee_file = FILE_A, .callee_line = line, .callee_func = FUNC_A,
+            .caller_file = FILE_B, .caller_line = 1, .caller_func = FUNC_B,
+            .thread_id = 7, .timestamp_ns = (uint64_t)line,
+        },
+    };
+}
+
+static uint64_t ring_head(const ShmSegment *seg, uint32_t ring) {
+    return atomic_load(&seg->rings[ring].head);
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/** Geometry validation, name collisions, missing segment, one producer. */
+static int test_segment_lifecycle(void) {
+    ShmSegment seg;
+    ShmSegment other;
+    const char *name = segment_name();
+
+    bool ok = !shm_segment_create(&seg, name, 0, 4096) && errno == EINVAL;
+    ok = ok && !shm_segment_create(&seg, name, 1, 5000) && errno == EINVAL;
+    ok = ok && !shm_segment_create(&seg, name, 1, 1024) && errno == EINVAL;
+    ok = ok && !shm_segment_attach(&other, name) && errno == ENOENT;
+
+    ok = ok && shm_segment_create(&seg, name, 4, 4096);
+    ok = ok && seg.header->ring_count == 4 && seg.header->ring_bytes == 4096;
+    ok = ok && !shm_segment_create(&other, name, 4, 4096) && errno == EEXIST;
+
+    ok = ok && shm_segment_attach(&other, name) && other.header->ring_count == 4;
+    ShmSegment second;
+    ok = ok && !shm_segment_attach(&second, name) && errno == EBUSY;
+
+    ok = ok && !shm_segment_finished(&seg);
+    shm_segment_finish(&other);
+    ok = ok && shm_segment_finished(&seg) && shm_segment_dropped(&seg) == 0;
+
+    shm_segment_unmap(&other);
+    shm_segment_unmap(&other);      /* Idempotent */
+    shm_segment_unmap(&seg);
+    ok = ok && shm_segment_unlink(name) && !shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** Every kind survives the trip; strings resolve to consumer copies. */
+static int test_round_trip(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 2, 4096)) {
+        return 1;
+    }
+    ShmProducer *p = shm_producer_new(&seg);
+    ShmConsumer *c = shm_consumer_new(&seg);
+
+    RawEvent in[4] = {
+        call_event(10),
+        {.kind = EVENT_RETURN, .data.ret = {
+            .file = FILE_A, .line = 10, .func = FUNC_A, .thread_id = 7, .has_exception = true}},
+        {.kind = EVENT_CREATE, .data.create = {
+            .obj_id = 0x1000, .type_name = "Order", .file = FILE_B, .line = 3, .func = FUNC_B}},
+        {.kind = EVENT_DESTROY, .data.destroy = {.obj_id = 0x1000, .type_name = nullptr}},
+    };
+    bool ok = true;
+    for (int i = 0; i < 4; i++) {
+        ok = ok && shm_producer_write(p, &in[i]);
+    }
+
+    RawEvent out[8];
+    ok = ok && shm_consumer_poll(c, out, 8) == 4;
+    ok = ok && out[0].kind == EVENT_CALL
+       && strcmp(out[0].data.call.callee_file, FILE_A) == 0
+       && out[0].data.call.callee_file != FILE_A        /* a copy, not the id */
+       && strcmp(out[0].data.call.caller_func, FUNC_B) == 0
+       && out[0].data.call.callee_line == 10 && out[0].data.call.thread_id == 7;
+    ok = ok && out[1].kind == EVENT_RETURN && out[1].data.ret.has_exception
+       && out[1].data.ret.func == out[0].data.call.callee_func;    /* same copy */
+    ok = ok && out[2].kind == EVENT_CREATE && out[2].data.create.obj_id == 0x1000
+       && strcmp(out[2].data.create.type_name, "Order") == 0;
+    ok = ok && out[3].kind == EVENT_DESTROY && out[3].data.destroy.type_name == nullptr;
+    ok = ok && shm_consumer_poll(c, out, 8) == 0;
+
+    shm_consumer_free(c);
+    shm_producer_free(p);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** A string is sent once per ring; the next event costs one EVENT record. */
+static int test_string_dedup(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 2, 4096)) {
+        return 1;
+    }
+    ShmProducer *first = shm_producer_new(&seg);
+    ShmProducer *second = shm_producer_new(&seg);
+    RawEvent ev = call_event(1);
+
+    bool ok = shm_producer_write(first, &ev);
+    uint64_t with_strings = ring_head(&seg, 0);
+    ok = ok && shm_producer_write(first, &ev);
+    uint64_t event_only = ring_head(&seg, 0) - with_strings;
+    ok = ok && event_only < with_strings && event_only >= sizeof(RawEvent);
+
+    /* Another ring defines the strings again (rings are read independently) */
+    ok = ok && shm_producer_write(second, &ev) && ring_head(&seg, 1) == with_strings;
+
+    shm_producer_free(second);
+    shm_producer_free(first);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** Full ring drops (and counts) instead of waiting; space returns after poll. */
+static int test_full_ring_drops(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 1, 4096)) {
+        return 1;
+    }
+    ShmProducer *p = shm_producer_new(&seg);
+    ShmConsumer *c = shm_consumer_new(&seg);
+
+    int written = 0;
+    int dropped = 0;
+    for (int i = 0; i < 200; i++) {
+        RawEvent ev = call_event(i);
+        if (shm_producer_write(p, &ev)) {
+            written++;
+        } else {
+            dropped++;
+        }
+    }
+    bool ok = written > 0 && dropped > 0 && shm_segment_dropped(&seg) == (uint64_t)dropped;
+
+    RawEvent out[256];
+    ok = ok && shm_consumer_poll(c, out, 256) == (size_t)written;
+    ok = ok && out[written - 1].data.call.callee_line == written - 1;
+    RawEvent again = call_event(999);
+    ok = ok && shm_producer_write(p, &again);
+
+    shm_consumer_free(c);
+    shm_producer_free(p);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** Many laps around a small ring: PAD records skipped, order kept. */
+static int test_wraparound(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 1, 4096)) {
+        return 1;
+    }
+    ShmProducer *p = shm_producer_new(&seg);
+    ShmConsumer *c = shm_consumer_new(&seg);
+
+    constexpr int WRAP_EVENTS = 5000;
+    RawEvent out[16];
+    int next = 0;
+    bool ok = true;
+    for (int i = 0; ok && i < WRAP_EVENTS; i++) {
+        RawEvent ev = call_event(i);
+        ok = shm_producer_write(p, &ev);
+        if (i % 7 == 6) {
+            size_t n = shm_consumer_poll(c, out, 16);
+            for (size_t k = 0; ok && k < n; k++) {
+                ok = out[k].data.call.callee_line == next++
+                  && strcmp(out[k].data.call.callee_func, FUNC_A) == 0;
+            }
+        }
+    }
+    for (size_t n; ok && (n = shm_consumer_poll(c, out, 16)) > 0;) {
+        for (size_t k = 0; ok && k < n; k++) {
+            ok = out[k].data.call.callee_line == next++;
+        }
+    }
+    ok = ok && next == WRAP_EVENTS && ring_head(&seg, 0) > 10 * 4096 && shm_segment_dropped(&seg) == 0;
+
+    shm_consumer_free(c);
+    shm_producer_free(p);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** Threads beyond ring_count keep running; their events count as dropped. */
+static int test_rings_exhausted(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 1, 4096)) {
+        return 1;
+    }
+    ShmProducer *a = shm_producer_new(&seg);
+    ShmProducer *b = shm_producer_new(&seg);
+    RawEvent ev = call_event(1);
+
+    bool ok = shm_producer_write(a, &ev) && !shm_producer_write(b, &ev)
+           && !shm_producer_write(b, &ev);
+    ok = ok && shm_segment_dropped(&seg) == 2;
+
+    ShmConsumer *c = shm_consumer_new(&seg);
+    RawEvent out[4];
+    ok = ok && shm_consumer_poll(c, out, 4) == 1;
+
+    shm_consumer_free(c);
+    shm_producer_free(b);
+    shm_producer_free(a);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/** Producer in a child process, consumer in the parent, until finished. */
+static int test_forked_producer(void) {
+    ShmSegment seg;
+    const char *name = segment_name();
+    if (!shm_segment_create(&seg, name, 4, 1 << 16)) {
+        return 1;
+    }
+    constexpr int CHILD_EVENTS = 20000;
+
+    pid_t child = fork();
+    if (child == 0) {
+        ShmSegment traced;
+        if (!shm_segment_attach(&traced, name)) {
+            _exit(2);
+        }
+        ShmProducer *p = shm_producer_new(&traced);
+        for (int i = 0; i < CHILD_EVENTS;) {
+            RawEvent ev = call_event(i);
+            if (shm_producer_write(p, &ev)) {
+                i++;    /* Test only: retry drops to check every event arrives */
+            }
+        }
+        shm_producer_free(p);
+        shm_segment_finish(&traced);
+        shm_segment_unmap(&traced);
+        _exit(0);
+    }
+
+    ShmConsumer *c = shm_consumer_new(&seg);
+    RawEvent out[512];
+    int received = 0;
+    bool ordered = true;
+    for (;;) {
+        bool finished = shm_segment_finished(&seg);
+        size_t n = shm_consumer_poll(c, out, 512);
+        for (size_t k = 0; k < n; k++) {
+            ordered = ordered && out[k].data.call.callee_line == received++
+                   && strcmp(out[k].data.call.caller_file, FILE_B) == 0;
+        }
+        if (finished && n == 0) {
+            break;
+        }
+    }
+
+    int status = 0;
+    bool ok = waitpid(child, &status, 0) == child && WIFEXITED(status)
+           && WEXITSTATUS(status) == 0;
+    ok = ok && ordered && received == CHILD_EVENTS;
+
+    shm_consumer_free(c);
+    shm_segment_unmap(&seg);
+    (void)shm_segment_unlink(name);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                 Shared-Memory Ring Tests                     ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_segment_lifecycle);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_string_dedup);
+    RUN_TEST(test_full_ring_drops);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_rings_exhausted);
+    RUN_TEST(test_forked_producer);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
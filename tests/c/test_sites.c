@@ -0,0 +1,224 @@
+/**
+ * Allocation Site Table Tests
+ *
+ * Checks per-site counting, lifetime histogram, untracked DESTROYs, id
+ * reuse without DESTROY, entry copies and growth.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: null table aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "tracking/sites.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Stand-ins for tp_name: identity is the pointer */
+static const char TYPE_LIST[] = "list";
+static const char TYPE_DICT[] = "dict";
+
+/** Copy of the site (stack, type), or a zeroed entry if absent. */
+static SiteStats find_site(const SiteTable *table, StackId stack, const char *type_name) {
+    size_t n = 0;
+    SiteEntry *entries = site_table_entries(table, &n);
+    SiteStats found = {0};
+    for (size_t i = 0; entries != nullptr && i < n; i++) {
+        if (entries[i].key.stack == stack && entries[i].key.type_name == type_name) {
+            found = entries[i].stats;
+        }
+    }
+    free(entries);
+    return found;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_counts_per_site: Same (stack, type) shares a site; live objects
+ * stay allocated until destroyed.
+ */
+static int test_counts_per_site(void) {
+    SiteTable *table = site_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = site_table_create(table, 0x1000, 7, TYPE_LIST, 100)
+           && site_table_create(table, 0x2000, 7, TYPE_LIST, 200)
+           && site_table_create(table, 0x3000, 7, TYPE_DICT, 300)
+           && site_table_create(table, 0x4000, 9, TYPE_LIST, 400);
+    ok = ok && site_table_destroy(table, 0x1000, 1100);
+
+    SiteStats lists = find_site(table, 7, TYPE_LIST);
+    ok = ok && site_table_size(table) == 3 && site_table_live(table) == 3
+       && lists.allocated == 2 && lists.freed == 1
+       && lists.lifetime_total_ns == 1000 && lists.lifetime_min_ns == 1000
+       && lists.lifetime_max_ns == 1000;
+    ok = ok && find_site(table, 7, TYPE_DICT).allocated == 1
+       && find_site(table, 9, TYPE_LIST).freed == 0;
+
+    site_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_untracked_destroy: DESTROY of an object created before start (or
+ * destroyed twice) is ignored.
+ */
+static int test_untracked_destroy(void) {
+    SiteTable *table = site_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = !site_table_destroy(table, 0xdead, 10)
+           && site_table_create(table, 0x1000, 1, TYPE_LIST, 0)
+           && site_table_destroy(table, 0x1000, 5)
+           && !site_table_destroy(table, 0x1000, 6);
+    ok = ok && find_site(table, 1, TYPE_LIST).freed == 1 && site_table_live(table) == 0;
+
+    site_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_id_reuse: CREATE of a live id frees the old object first.
+ */
+static int test_id_reuse(void) {
+    SiteTable *table = site_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = site_table_create(table, 0x1000, 1, TYPE_LIST, 100)
+           && site_table_create(table, 0x1000, 2, TYPE_DICT, 150)
+           && site_table_destroy(table, 0x1000, 400);
+
+    SiteStats old = find_site(table, 1, TYPE_LIST);
+    SiteStats fresh = find_site(table, 2, TYPE_DICT);
+    ok = ok && old.allocated == 1 && old.freed == 1 && old.lifetime_total_ns == 50
+       && fresh.allocated == 1 && fresh.freed == 1 && fresh.lifetime_total_ns == 250;
+
+    site_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_lifetime_buckets: Buckets are contiguous powers of two; lifetimes
+ * land in the bucket bounding them, huge ones in the last.
+ */
+static int test_lifetime_buckets(void) {
+    uint64_t expected_lower = 0;
+    for (unsigned idx = 0; idx < SITE_LIFETIME_BUCKETS; idx++) {
+        uint64_t lower = 0, upper = 0;
+        site_lifetime_bounds(idx, &lower, &upper);
+        if (lower != expected_lower || upper <= lower) {
+            return 1;
+        }
+        expected_lower = upper;
+    }
+
+    SiteTable *table = site_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    const uint64_t lifetimes[] = {0, 1, 3, 1000, 1ull << 60};
+    bool ok = true;
+    for (size_t i = 0; i < sizeof(lifetimes) / sizeof(lifetimes[0]) && ok; i++) {
+        ok = site_table_create(table, 0x1000 + i, 1, TYPE_LIST, 0)
+          && site_table_destroy(table, 0x1000 + i, lifetimes[i]);
+    }
+
+    SiteStats site = find_site(table, 1, TYPE_LIST);
+    ok = ok && site.lifetime[0] == 2 && site.lifetime[1] == 1 && site.lifetime[9] == 1
+       && site.lifetime[SITE_LIFETIME_BUCKETS - 1] == 1 && site.lifetime_min_ns == 0
+       && site.lifetime_max_ns == 1ull << 60;
+
+    site_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_growth: Thousands of sites and live objects survive rehashing;
+ * entries() copies every site.
+ */
+static int test_growth(void) {
+    constexpr int N = 5000;
+    SiteTable *table = site_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < N && ok; i++) {
+        ok = site_table_create(table, (uintptr_t)(0x10000 + i * 16), (StackId)(i % 1000),
+                               i % 2 ? TYPE_LIST : TYPE_DICT, (uint64_t)i);
+    }
+
+    size_t n = 0;
+    SiteEntry *entries = site_table_entries(table, &n);
+    uint64_t allocated = 0;
+    for (size_t i = 0; entries != nullptr && i < n; i++) {
+        allocated += entries[i].stats.allocated;
+    }
+    free(entries);
+
+    ok = ok && entries != nullptr && n == 1000 && allocated == (uint64_t)N
+       && site_table_live(table) == (size_t)N;
+
+    site_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                 Allocation Site Tests                        ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_counts_per_site);
+    RUN_TEST(test_untracked_destroy);
+    RUN_TEST(test_id_reuse);
+    RUN_TEST(test_lifetime_buckets);
+    RUN_TEST(test_growth);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
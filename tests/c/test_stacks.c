@@ -0,0 +1,264 @@
+/**
+ * Call Stack Trie Tests
+ *
+ * Standalone runner (no Criterion — incompatible with TSan).
+ * Checks node dedup, parent/depth chains, the per-frame memo of
+ * stack_trie_current() and concurrent inserts racing index resizes.
+ *
+ * C23: constexpr, nullptr, _Atomic
+ * POSIX: pthread (TSan-compatible, unlike <threads.h>)
+ * FAIL-FIRST: unknown ids abort — not tested here
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "tracking/stacks.h"
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================ */
+
+constexpr int NUM_THREADS = 8;
+constexpr int STACKS_PER_THREAD = 2000;
+constexpr int STACK_DEPTH = 6;
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_ready = 0;
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* Stand-ins for interned strings: identity is the pointer */
+static const char FILE_A[] = "app/main.py";
+static const char FILE_B[] = "app/model.py";
+static const char FUNC_MAIN[] = "main";
+static const char FUNC_BUILD[] = "build";
+static const char FUNC_MAKE[] = "make";
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_child_dedup: Same (parent, frame) → same id; any field differs → new id.
+ */
+static int test_child_dedup(void) {
+    stack_trie_init();
+
+    StackFrame main_frame = {FILE_A, 1, FUNC_MAIN};
+    StackId root = stack_trie_child(STACK_EMPTY, &main_frame);
+    StackId again = stack_trie_child(STACK_EMPTY, &main_frame);
+    StackId other_line = stack_trie_child(STACK_EMPTY, &(StackFrame){FILE_A, 2, FUNC_MAIN});
+    StackId nested = stack_trie_child(root, &main_frame);  /* Recursion: new level */
+
+    bool ok = root != STACK_EMPTY
+           && again == root
+           && other_line != root
+           && nested != root
+           && stack_trie_count() == 3;
+
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_node_chain: parent links walk top → bottom, depth counts frames.
+ */
+static int test_node_chain(void) {
+    stack_trie_init();
+
+    StackId bottom = stack_trie_child(STACK_EMPTY, &(StackFrame){FILE_A, 1, FUNC_MAIN});
+    StackId mid = stack_trie_child(bottom, &(StackFrame){FILE_B, 10, FUNC_BUILD});
+    StackId top = stack_trie_child(mid, &(StackFrame){FILE_B, 20, FUNC_MAKE});
+
+    const StackNode *node = stack_trie_node(top);
+    bool ok = node->depth == 3 && node->frame.func == FUNC_MAKE && node->parent == mid;
+    node = stack_trie_node(node->parent);
+    ok = ok && node->depth == 2 && node->frame.line == 10 && node->parent == bottom;
+    node = stack_trie_node(node->parent);
+    ok = ok && node->depth == 1 && node->frame.file == FILE_A && node->parent == STACK_EMPTY;
+    ok = ok && stack_trie_depth(STACK_EMPTY) == 0 && stack_trie_depth(top) == 3;
+
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_current_memoized: current() follows the frame stack, memoizing ids.
+ */
+static int test_current_memoized(void) {
+    stack_trie_init();
+    frame_stack_clear();
+
+    bool ok = stack_trie_current() == STACK_EMPTY;
+
+    frame_stack_push(&(StackFrame){FILE_A, 1, FUNC_MAIN});
+    frame_stack_push(&(StackFrame){FILE_B, 10, FUNC_BUILD});
+    StackId first = stack_trie_current();
+    ok = ok && first != STACK_EMPTY && stack_trie_depth(first) == 2
+            && frame_stack_tag(0) == first && frame_stack_tag(1) != 0;
+
+    /* Memo hit: no new nodes */
+    size_t count = stack_trie_count();
+    ok = ok && stack_trie_current() == first && stack_trie_count() == count;
+
+    /* Sibling call: reuses the bottom node, one new node */
+    frame_stack_pop();
+    frame_stack_push(&(StackFrame){FILE_B, 20, FUNC_MAKE});
+    ok = ok && frame_stack_tag(0) == 0;
+    StackId sibling = stack_trie_current();
+    ok = ok && sibling != first
+            && stack_trie_node(sibling)->parent == stack_trie_node(first)->parent
+            && stack_trie_count() == count + 1;
+
+    /* Same stack again (fresh frames): same id */
+    frame_stack_pop();
+    frame_stack_push(&(StackFrame){FILE_B, 10, FUNC_BUILD});
+    ok = ok && stack_trie_current() == first;
+
+    frame_stack_clear();
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_deep_stack: No depth limit (old tracebacks stopped at 16 frames).
+ */
+static int test_deep_stack(void) {
+    stack_trie_init();
+    frame_stack_clear();
+
+    constexpr int DEPTH = 1000;
+    for (int i = 0; i < DEPTH; i++) {
+        frame_stack_push(&(StackFrame){FILE_A, i + 1, FUNC_MAIN});
+    }
+    StackId top = stack_trie_current();
+    bool ok = stack_trie_depth(top) == (uint32_t)DEPTH
+           && stack_trie_node(top)->frame.line == DEPTH;
+
+    frame_stack_clear();
+    frame_stack_destroy();
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Concurrency
+ * ============================================================================ */
+
+typedef struct {
+    StackId tops[STACKS_PER_THREAD];
+} WorkerData;
+
+/** Every thread builds the same stacks: ids must agree, nodes not duplicated. */
+static void* worker_same_stacks(void* arg) {
+    WorkerData* data = (WorkerData*)arg;
+
+    atomic_fetch_add(&g_ready, 1);
+    while (atomic_load(&g_ready) < NUM_THREADS) {
+        sched_yield();
+    }
+
+    for (int s = 0; s < STACKS_PER_THREAD; s++) {
+        StackId id = STACK_EMPTY;
+        for (int level = 0; level < STACK_DEPTH; level++) {
+            StackFrame frame = {FILE_A, s * STACK_DEPTH + level, FUNC_MAIN};
+            id = stack_trie_child(id, &frame);
+            /* Lock-free read of a node another thread may have just added */
+            (void)stack_trie_node(id)->depth;
+        }
+        data->tops[s] = id;
+    }
+    return NULL;
+}
+
+/**
+ * test_concurrent_inserts: Races on inserts and index resizes (TSan).
+ */
+static int test_concurrent_inserts(void) {
+    stack_trie_init();
+    atomic_store(&g_ready, 0);
+
+    static WorkerData data[NUM_THREADS];
+    pthread_t threads[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; t++) {
+        pthread_create(&threads[t], NULL, worker_same_stacks, &data[t]);
+    }
+    for (int t = 0; t < NUM_THREADS; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    bool ok = stack_trie_count() == (size_t)STACKS_PER_THREAD * STACK_DEPTH;
+    for (int t = 1; t < NUM_THREADS && ok; t++) {
+        for (int s = 0; s < STACKS_PER_THREAD; s++) {
+            if (data[t].tops[s] != data[0].tops[s]) {
+                ok = false;
+                break;
+            }
+        }
+    }
+    ok = ok && stack_trie_depth(data[0].tops[0]) == (uint32_t)STACK_DEPTH;
+
+    stack_trie_destroy();
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_bytes: one node chunk plus the index once a node exists, 0 after destroy.
+ */
+static int test_bytes(void) {
+    stack_trie_init();
+    size_t empty = stack_trie_bytes();
+
+    (void)stack_trie_child(STACK_EMPTY, &(StackFrame){FILE_A, 1, FUNC_MAIN});
+    size_t one = stack_trie_bytes();
+
+    bool ok = empty > 0 && one == empty + STACK_TRIE_CHUNK * sizeof(StackNode);
+    stack_trie_destroy();
+    return ok && stack_trie_bytes() == 0 ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                  Call Stack Trie Tests                       ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_child_dedup);
+    RUN_TEST(test_node_chain);
+    RUN_TEST(test_current_memoized);
+    RUN_TEST(test_deep_stack);
+    RUN_TEST(test_concurrent_inserts);
+    RUN_TEST(test_bytes);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,585 @@
+/**
+ * Event Store Tests
+ *
+ * Tests chunked append-only storage of variable-length Event records,
+ * publish/take streaming (single writer + single consumer) and merge.
+ * Event filling from Python tested in integration tests.
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: reserve(max_args > MAX_ARGS) aborts — not tested here
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tracking/store.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_store_empty: Fresh store has no records and no chunks.
+ */
+static int test_store_empty(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    EventStoreIter it = event_store_begin(&store);
+    int ok = event_store_count(&store) == 0
+          && store.bytes == 0
+          && event_store_next(&it) == nullptr;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_record_compact: Record size scales with args; errors are out-of-line.
+ */
+static int test_record_compact(void) {
+    uint32_t small = event_record_size(0);
+    uint32_t large = event_record_size(MAX_ARGS);
+
+    if (small != sizeof(Event)) {
+        return 1;
+    }
+    if (small % alignof(Event) != 0 || large % alignof(Event) != 0) {
+        return 1;
+    }
+    if (large != small + MAX_ARGS * sizeof(ArgInfo)) {
+        return 1;
+    }
+    /* Header must stay smaller than a single inline FieldError */
+    return sizeof(Event) < sizeof(FieldError) ? 0 : 1;
+}
+
+/**
+ * test_reserve_zeroed: Reserved record is zeroed except record_size.
+ */
+static int test_reserve_zeroed(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    Event *ev = event_store_reserve(&store, 4);
+    if (!ev) {
+        event_store_destroy(&store);
+        return 1;
+    }
+
+    int ok = ev->record_size == event_record_size(4)
+          && ev->type == EVENT_CALL
+          && ev->arg_count == 0
+          && ev->errors == nullptr
+          && ev->location.file == nullptr
+          && ev->args[3].name_ref == nullptr;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_commit_shrinks: Commit of last record returns unused arg slots.
+ */
+static int test_commit_shrinks(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    Event *ev = event_store_reserve(&store, MAX_ARGS);
+    if (!ev) {
+        event_store_destroy(&store);
+        return 1;
+    }
+    ev->arg_count = 2;
+    event_store_commit(&store, ev);
+
+    int ok = ev->record_size == event_record_size(2)
+          && store.bytes == event_record_size(2);
+
+    /* Next record starts right after the shrunk one */
+    Event *next = event_store_reserve(&store, 0);
+    ok = ok && next == (Event *)((unsigned char *)ev + event_record_size(2));
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_nested_reserve: Record reserved during fill keeps order; outer keeps size.
+ */
+static int test_nested_reserve(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    Event *outer = event_store_reserve(&store, 8);
+    Event *inner = event_store_reserve(&store, 0);  /* e.g. CREATE during fill */
+    if (!outer || !inner) {
+        event_store_destroy(&store);
+        return 1;
+    }
+    outer->type = EVENT_CALL;
+    inner->type = EVENT_CREATE;
+    outer->arg_count = 1;
+    event_store_commit(&store, outer);  /* not last: no shrink */
+
+    int ok = outer->record_size == event_record_size(8);
+
+    EventStoreIter it = event_store_begin(&store);
+    ok = ok && event_store_next(&it) == outer;
+    ok = ok && event_store_next(&it) == inner;
+    ok = ok && event_store_next(&it) == nullptr;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_pointer_stability: Records keep their address across chunk growth.
+ */
+static int test_pointer_stability(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    Event *first = event_store_reserve(&store, 0);
+    if (!first) {
+        event_store_destroy(&store);
+        return 1;
+    }
+    first->obj_id = 0xC0FFEE;
+
+    /* Enough records to span several chunks */
+    size_t per_chunk = EVENT_CHUNK_SIZE / event_record_size(MAX_ARGS);
+    size_t total = per_chunk * 3 + 1;
+    for (size_t i = 0; i < total; i++) {
+        Event *ev = event_store_reserve(&store, MAX_ARGS);
+        if (!ev) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        ev->obj_id = i;
+    }
+
+    int ok = first->obj_id == 0xC0FFEE
+          && event_store_count(&store) == total + 1
+          && store.head != store.tail;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_iteration_order: Iteration visits every record once, in append order.
+ */
+static int test_iteration_order(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    constexpr size_t N = 20000;
+    for (size_t i = 0; i < N; i++) {
+        /* Mixed sizes: CALL with args, others without */
+        int args = (int)(i % 3 == 0 ? i % (size_t)MAX_ARGS : 0);
+        Event *ev = event_store_reserve(&store, args);
+        if (!ev) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        ev->obj_id = i;
+        ev->arg_count = (uint16_t)(args / 2);
+        event_store_commit(&store, ev);
+    }
+
+    EventStoreIter it = event_store_begin(&store);
+    size_t seen = 0;
+    for (Event *ev = event_store_next(&it); ev; ev = event_store_next(&it)) {
+        if (ev->obj_id != seen) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        seen++;
+    }
+
+    event_store_destroy(&store);
+    return seen == N ? 0 : 1;
+}
+
+/**
+ * test_destroy_and_reuse: Store is reusable after destroy; destroy is idempotent.
+ */
+static int test_destroy_and_reuse(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    for (int round = 0; round < 3; round++) {
+        for (int i = 0; i < 1000; i++) {
+            Event *ev = event_store_reserve(&store, 1);
+            if (!ev) {
+                event_store_destroy(&store);
+                return 1;
+            }
+        }
+        if (event_store_count(&store) != 1000) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        event_store_destroy(&store);
+        event_store_destroy(&store);
+    }
+
+    EventStoreIter it = event_store_begin(&store);
+    return event_store_count(&store) == 0 && event_store_next(&it) == nullptr ? 0 : 1;
+}
+
+/**
+ * test_aux_errors: Out-of-line errors come from the writer's store, freed by destroy.
+ */
+static int test_aux_errors(void) {
+    EventStore first;
+    EventStore second;
+    event_store_init(&first);
+    event_store_init(&second);
+
+    Event *a = event_store_reserve(&first, 0);
+    FieldError *err_a = a ? event_store_aux_alloc(2 * sizeof(FieldError)) : nullptr;
+    Event *b = event_store_reserve(&second, 0);
+    FieldError *err_b = b ? event_store_aux_alloc(sizeof(FieldError)) : nullptr;
+
+    bool ok = err_a != nullptr && err_b != nullptr
+           && first.aux.bytes == 2 * sizeof(FieldError)
+           && second.aux.bytes == sizeof(FieldError)
+           && ((uintptr_t)err_a % alignof(max_align_t)) == 0;
+    if (ok) {
+        strcpy(err_a[1].field, "arg[1]");
+        a->errors = err_a;
+        a->error_count = 2;
+    }
+
+    /* Many events with errors: still one block per MB, no per-record free */
+    for (int i = 0; i < 10000 && ok; i++) {
+        ok = event_store_reserve(&first, 0) != nullptr
+          && event_store_aux_alloc(sizeof(FieldError)) != nullptr;
+    }
+    ok = ok && strcmp(a->errors[1].field, "arg[1]") == 0;
+
+    event_store_destroy(&first);
+    event_store_destroy(&second);
+    return ok && first.aux.bytes == 0 && first.aux.mapped == 0 ? 0 : 1;
+}
+
+/**
+ * test_merge_by_seq: Interleaved per-thread stores merge into global order.
+ */
+static int test_merge_by_seq(void) {
+    constexpr size_t STORES = 5;
+    constexpr uint64_t TOTAL = 10000;
+    EventStore stores[STORES];
+    EventStore *ptrs[STORES];
+    for (size_t i = 0; i < STORES; i++) {
+        event_store_init(&stores[i]);
+        ptrs[i] = &stores[i];
+    }
+
+    /* Store 4 stays empty; others get seq round-robin with uneven runs */
+    for (uint64_t seq = 0; seq < TOTAL; seq++) {
+        size_t target = (size_t)((seq / 3) % (STORES - 1));
+        Event *ev = event_store_reserve(&stores[target], 0);
+        if (!ev) {
+            return 1;
+        }
+        ev->seq = seq;
+    }
+    for (size_t i = 0; i < STORES; i++) {
+        event_store_publish(&stores[i]);
+    }
+
+    EventStoreMerge merge;
+    if (!event_store_merge_init(&merge, ptrs, STORES, UINT64_MAX)) {
+        return 1;
+    }
+
+    uint64_t expected = 0;
+    int ok = 1;
+    for (Event *ev = event_store_merge_next(&merge); ev; ev = event_store_merge_next(&merge)) {
+        if (ev->seq != expected) {
+            ok = 0;
+            break;
+        }
+        expected++;
+    }
+    ok = ok && expected == TOTAL;
+
+    event_store_merge_destroy(&merge);
+    event_store_merge_destroy(&merge);
+    for (size_t i = 0; i < STORES; i++) {
+        event_store_destroy(&stores[i]);
+    }
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_merge_empty: Zero stores and all-empty stores yield nothing.
+ */
+static int test_merge_empty(void) {
+    EventStoreMerge merge;
+    if (!event_store_merge_init(&merge, nullptr, 0, UINT64_MAX)) {
+        return 1;
+    }
+    int ok = event_store_merge_next(&merge) == nullptr;
+    event_store_merge_destroy(&merge);
+
+    EventStore store;
+    event_store_init(&store);
+    EventStore *ptr = &store;
+    if (!event_store_merge_init(&merge, &ptr, 1, UINT64_MAX)) {
+        return 1;
+    }
+    ok = ok && event_store_merge_next(&merge) == nullptr;
+    event_store_merge_destroy(&merge);
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_take_requires_publish: Consumer sees only published records, in order.
+ */
+static int test_take_requires_publish(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    for (uint64_t i = 0; i < 3; i++) {
+        Event *ev = event_store_reserve(&store, 0);
+        if (!ev) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        ev->seq = i;
+    }
+    int ok = event_store_peek(&store) == nullptr;
+
+    event_store_publish(&store);
+    Event *late = event_store_reserve(&store, 0);  /* after publish: hidden */
+    if (!late) {
+        event_store_destroy(&store);
+        return 1;
+    }
+    late->seq = 3;
+
+    Event *peeked = event_store_peek(&store);
+    ok = ok && peeked != nullptr && peeked->seq == 0;
+    for (uint64_t i = 0; i < 3 && ok; i++) {
+        Event *ev = event_store_take(&store);
+        ok = ev != nullptr && ev->seq == i;
+    }
+    ok = ok && event_store_take(&store) == nullptr;
+
+    event_store_publish(&store);
+    Event *ev = event_store_take(&store);
+    ok = ok && ev == late && event_store_take(&store) == nullptr;
+
+    /* Taken records are not iterated again */
+    EventStoreIter it = event_store_begin(&store);
+    ok = ok && event_store_next(&it) == nullptr;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_take_releases_chunks: Fully taken chunks are freed while writing goes on.
+ */
+static int test_take_releases_chunks(void) {
+    EventStore store;
+    event_store_init(&store);
+
+    size_t per_chunk = EVENT_CHUNK_SIZE / event_record_size(MAX_ARGS);
+    size_t total = per_chunk * 4;
+    EventChunk *first = nullptr;
+    int ok = 1;
+    for (size_t i = 0; i < total && ok; i++) {
+        Event *ev = event_store_reserve(&store, MAX_ARGS);
+        if (!ev) {
+            event_store_destroy(&store);
+            return 1;
+        }
+        ev->seq = i;
+        if (first == nullptr) {
+            first = store.head;
+        }
+        event_store_publish(&store);
+        /* Consumer lags one record behind the writer */
+        if (i > 0) {
+            Event *taken = event_store_take(&store);
+            ok = taken != nullptr && taken->seq == i - 1;
+        }
+    }
+
+    /* Head moved past the first chunks; only the tail is left */
+    ok = ok && store.head != first && store.head == store.tail;
+    Event *last = event_store_take(&store);
+    ok = ok && last != nullptr && last->seq == total - 1;
+
+    event_store_destroy(&store);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_merge_limit: Records at or above limit_seq stay for a later merge.
+ */
+static int test_merge_limit(void) {
+    EventStore stores[2];
+    EventStore *ptrs[2] = {&stores[0], &stores[1]};
+    event_store_init(&stores[0]);
+    event_store_init(&stores[1]);
+
+    for (uint64_t seq = 0; seq < 100; seq++) {
+        Event *ev = event_store_reserve(&stores[seq % 2], 0);
+        if (!ev) {
+            return 1;
+        }
+        ev->seq = seq;
+    }
+    event_store_publish(&stores[0]);
+    event_store_publish(&stores[1]);
+
+    int ok = 1;
+    uint64_t expected = 0;
+    for (uint64_t limit = 30; limit <= 100 && ok; limit += 70) {
+        EventStoreMerge merge;
+        if (!event_store_merge_init(&merge, ptrs, 2, limit)) {
+            return 1;
+        }
+        for (Event *ev = event_store_merge_next(&merge); ev; ev = event_store_merge_next(&merge)) {
+            if (ev->seq != expected) {
+                ok = 0;
+                break;
+            }
+            expected++;
+        }
+        ok = ok && expected == limit;
+        event_store_merge_destroy(&merge);
+    }
+
+    event_store_destroy(&stores[0]);
+    event_store_destroy(&stores[1]);
+    return ok ? 0 : 1;
+}
+
+/* Shared state for test_concurrent_take */
+typedef struct {
+    EventStore store;
+    _Atomic(bool) done;
+    uint64_t total;
+} StreamFixture;
+
+static void* stream_writer(void *arg) {
+    StreamFixture *fx = arg;
+    for (uint64_t i = 0; i < fx->total; i++) {
+        Event *ev = event_store_reserve(&fx->store, (int)(i % (uint64_t)(MAX_ARGS + 1)));
+        if (!ev) {
+            break;
+        }
+        ev->seq = i;
+        ev->arg_count = 0;
+        event_store_commit(&fx->store, ev);
+        if (i % 7 == 0) {
+            event_store_publish(&fx->store);
+        }
+    }
+    event_store_publish(&fx->store);
+    atomic_store(&fx->done, true);
+    return nullptr;
+}
+
+/**
+ * test_concurrent_take: Consumer takes while writer appends; nothing lost.
+ */
+static int test_concurrent_take(void) {
+    StreamFixture fx = {.total = 200000};
+    event_store_init(&fx.store);
+    atomic_init(&fx.done, false);
+
+    pthread_t writer;
+    if (pthread_create(&writer, nullptr, stream_writer, &fx) != 0) {
+        return 1;
+    }
+
+    uint64_t expected = 0;
+    int ok = 1;
+    for (;;) {
+        bool finished = atomic_load(&fx.done);
+        Event *ev;
+        while ((ev = event_store_take(&fx.store)) != nullptr) {
+            if (ev->seq != expected) {
+                ok = 0;
+            }
+            expected++;
+        }
+        if (finished) {
+            break;
+        }
+    }
+    pthread_join(writer, nullptr);
+
+    ok = ok && expected == fx.total && event_store_take(&fx.store) == nullptr;
+    event_store_destroy(&fx.store);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║           Event Store Tests (Variable-Length Records)        ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_store_empty);
+    RUN_TEST(test_record_compact);
+    RUN_TEST(test_reserve_zeroed);
+    RUN_TEST(test_commit_shrinks);
+    RUN_TEST(test_nested_reserve);
+    RUN_TEST(test_pointer_stability);
+    RUN_TEST(test_iteration_order);
+    RUN_TEST(test_destroy_and_reuse);
+    RUN_TEST(test_aux_errors);
+    RUN_TEST(test_merge_by_seq);
+    RUN_TEST(test_merge_empty);
+    RUN_TEST(test_take_requires_publish);
+    RUN_TEST(test_take_releases_chunks);
+    RUN_TEST(test_merge_limit);
+    RUN_TEST(test_concurrent_take);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+        atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
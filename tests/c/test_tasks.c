@@ -0,0 +1,208 @@
+/**
+ * Task Table Tests
+ *
+ * Checks call and object counting per task id, task 0 (no task) as a
+ * regular row, merge and growth past the initial buckets.
+ *
+ * C23: nullptr
+ * FAIL-FIRST: null table aborts — not tested here
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+
+#include "tracking/tasks.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* ============================================================================
+ * Helpers
+ * ============================================================================ */
+
+/* Stand-ins for asyncio.Task addresses */
+constexpr uint64_t TASK_A = 0x7f0000001000;
+constexpr uint64_t TASK_B = 0x7f0000002000;
+
+typedef struct {
+    uint64_t task;
+    TaskStats stats;
+    size_t seen;
+} Lookup;
+
+static bool find_task(uint64_t task, const TaskStats *stats, void *ctx) {
+    Lookup *lookup = ctx;
+    if (task == lookup->task) {
+        lookup->stats = *stats;
+        lookup->seen++;
+    }
+    return true;
+}
+
+static TaskStats stats_of(const TaskTable *table, uint64_t task) {
+    Lookup lookup = {.task = task};
+    (void)task_table_each(table, find_task, &lookup);
+    return lookup.seen == 1 ? lookup.stats : (TaskStats){0};
+}
+
+static bool stop_at_first(uint64_t, const TaskStats *, void *ctx) {
+    (*(size_t *)ctx)++;
+    return false;
+}
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_calls_and_objects: Calls sum own time, objects split created/freed.
+ */
+static int test_calls_and_objects(void) {
+    TaskTable *table = task_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = task_table_add_call(table, TASK_A, 100)
+           && task_table_add_call(table, TASK_A, 50)
+           && task_table_add_object(table, TASK_A, true)
+           && task_table_add_object(table, TASK_A, true)
+           && task_table_add_object(table, TASK_A, false)
+           && task_table_add_call(table, TASK_B, 7);
+    TaskStats a = stats_of(table, TASK_A);
+    TaskStats b = stats_of(table, TASK_B);
+    ok = ok && task_table_size(table) == 2
+         && a.calls == 2 && a.own_ns == 150 && a.allocated == 2 && a.freed == 1
+         && b.calls == 1 && b.own_ns == 7 && b.allocated == 0 && b.freed == 0;
+    task_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_no_task_row: Task 0 (outside any task) is counted like any task.
+ */
+static int test_no_task_row(void) {
+    TaskTable *table = task_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = task_table_add_call(table, 0, 10)
+           && task_table_add_object(table, 0, true);
+    TaskStats none = stats_of(table, 0);
+    ok = ok && task_table_size(table) == 1
+         && none.calls == 1 && none.own_ns == 10 && none.allocated == 1;
+    task_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_merge: Shared tasks sum, others are copied; src unchanged.
+ */
+static int test_merge(void) {
+    TaskTable *dst = task_table_new();
+    TaskTable *src = task_table_new();
+    if (dst == nullptr || src == nullptr) {
+        task_table_free(dst);
+        task_table_free(src);
+        return 1;
+    }
+
+    bool ok = task_table_add_call(dst, TASK_A, 5)
+           && task_table_add_call(src, TASK_A, 7)
+           && task_table_add_object(src, TASK_A, false)
+           && task_table_add_call(src, TASK_B, 1)
+           && task_table_merge(dst, src);
+    TaskStats shared = stats_of(dst, TASK_A);
+    ok = ok && task_table_size(dst) == 2 && task_table_size(src) == 2
+         && shared.calls == 2 && shared.own_ns == 12 && shared.freed == 1
+         && stats_of(dst, TASK_B).calls == 1
+         && stats_of(src, TASK_A).calls == 1;
+    task_table_free(dst);
+    task_table_free(src);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_growth: Many distinct tasks survive rehashing with exact counts.
+ */
+static int test_growth(void) {
+    constexpr uint64_t TASKS = 5000;
+    TaskTable *table = task_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+
+    bool ok = true;
+    for (int round = 0; round < 3 && ok; round++) {
+        for (uint64_t n = 1; n <= TASKS && ok; n++) {
+            ok = task_table_add_call(table, TASK_A + 64 * n, n);
+        }
+    }
+    TaskStats last = stats_of(table, TASK_A + 64 * TASKS);
+    ok = ok && task_table_size(table) == (size_t)TASKS
+         && last.calls == 3 && last.own_ns == 3 * TASKS;
+    task_table_free(table);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_each_stops_early: Visitor returning false ends iteration.
+ */
+static int test_each_stops_early(void) {
+    TaskTable *table = task_table_new();
+    if (table == nullptr) {
+        return 1;
+    }
+    size_t visited = 0;
+
+    bool ok = task_table_add_call(table, TASK_A, 0)
+           && task_table_add_call(table, TASK_B, 0)
+           && !task_table_each(table, stop_at_first, &visited);
+    task_table_free(table);
+    task_table_free(nullptr);  /* No-op */
+    return ok && visited == 1 ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║                     Task Table Tests                         ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_calls_and_objects);
+    RUN_TEST(test_no_task_row);
+    RUN_TEST(test_merge);
+    RUN_TEST(test_growth);
+    RUN_TEST(test_each_stops_early);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -0,0 +1,443 @@
+/**
+ * Trace File Writer Tests
+ *
+ * Writes events with the C writer and checks the raw file layout
+ * (header, fixed-width records, string section, footer index).
+ * Reading via mmap tested in Python (tests/unit/infrastructure/test_tracefile.py).
+ *
+ * C23: constexpr, nullptr
+ * FAIL-FIRST: writer calls on a closed writer abort — not tested here
+ */
+
+/* POSIX: fork(), waitpid() */
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "tracking/tracefile.h"
+#include "tracking/stacks.h"
+
+/* ============================================================================
+ * Test Infrastructure
+ * ============================================================================ */
+
+static _Atomic(int) g_tests_passed = 0;
+static _Atomic(int) g_tests_failed = 0;
+
+#define RUN_TEST(name) \
+    do { \
+        printf("  %s... ", #name); \
+        fflush(stdout); \
+        if (name() == 0) { \
+            printf("\033[32mOK\033[0m\n"); \
+            atomic_fetch_add(&g_tests_passed, 1); \
+        } else { \
+            printf("\033[31mFAIL\033[0m\n"); \
+            atomic_fetch_add(&g_tests_failed, 1); \
+        } \
+    } while (0)
+
+/* Whole file in memory, or nullptr */
+static unsigned char* read_file(const char *path, size_t *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return nullptr;
+    }
+    (void)fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    (void)fseek(f, 0, SEEK_SET);
+    unsigned char *buf = malloc(len > 0 ? (size_t)len : 1);
+    if (buf && fread(buf, 1, (size_t)len, f) != (size_t)len) {
+        free(buf);
+        buf = nullptr;
+    }
+    fclose(f);
+    *size = (size_t)len;
+    return buf;
+}
+
+static void temp_path(char *buf, size_t size) {
+    (void)snprintf(buf, size, "/tmp/archcheck_trace_%d_XXXXXX", (int)getpid());
+    int fd = mkstemp(buf);
+    if (fd >= 0) {
+        close(fd);
+    }
+}
+
+static const TraceFooter* file_footer(const unsigned char *data, size_t size) {
+    return (const TraceFooter *)(data + size - sizeof(TraceFooter));
+}
+
+static const TraceRecord* file_record(const unsigned char *data, size_t i) {
+    return (const TraceRecord *)(data + sizeof(TraceHeader) + i * sizeof(TraceRecord));
+}
+
+/* String id → pointer into string section (not NUL-terminated), len out */
+static const char* file_string(const unsigned char *data, size_t size,
+                               uint32_t id, uint32_t *len) {
+    const TraceFooter *footer = file_footer(data, size);
+    const unsigned char *p = data + footer->strings_offset;
+    for (uint32_t i = 1; i <= footer->string_count; i++) {
+        uint32_t n;
+        memcpy(&n, p, sizeof(n));
+        if (i == id) {
+            *len = n;
+            return (const char *)(p + sizeof(n));
+        }
+        p += sizeof(n) + n;
+    }
+    return nullptr;
+}
+
+static bool string_is(const unsigned char *data, size_t size, uint32_t id, const char *expected) {
+    uint32_t len = 0;
+    const char *s = file_string(data, size, id, &len);
+    return s != nullptr && len == strlen(expected) && memcmp(s, expected, len) == 0;
+}
+
+/* Zeroed storage for an Event with room for MAX_ARGS trailing args */
+typedef struct {
+    alignas(Event) unsigned char bytes[sizeof(Event) + MAX_ARGS * sizeof(ArgInfo)];
+} EventBuf;
+
+/* ============================================================================
+ * Tests
+ * ============================================================================ */
+
+/**
+ * test_empty_trace: Header and footer only.
+ */
+static int test_empty_trace(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    TraceWriter w;
+    if (!trace_writer_open(&w, path) || !trace_writer_close(&w)) {
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char *data = read_file(path, &size);
+    unlink(path);
+    if (!data) {
+        return 1;
+    }
+
+    const TraceHeader *header = (const TraceHeader *)data;
+    const TraceFooter *footer = file_footer(data, size);
+    int ok = size == sizeof(TraceHeader) + sizeof(TraceFooter)
+          && memcmp(header->magic, TRACE_HEADER_MAGIC, 8) == 0
+          && header->version == TRACE_FORMAT_VERSION
+          && header->record_size == sizeof(TraceRecord)
+          && header->byte_order == TRACE_BYTE_ORDER
+          && memcmp(footer->magic, TRACE_FOOTER_MAGIC, 8) == 0
+          && footer->record_count == 0
+          && footer->event_count == 0
+          && footer->string_count == 0
+          && footer->strings_offset == sizeof(TraceHeader);
+
+    free(data);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_call_with_args: CALL record followed by its ARG records; strings deduped.
+ */
+static int test_call_with_args(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    static const char file[] = "app.py";
+    static const char func[] = "handler";
+    static const char arg_name[] = "request";
+    static const char arg_type[] = "dict";
+
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_CALL;
+    ev->seq = 7;
+    ev->location = (FrameInfo){file, 10, func};
+    ev->caller = (FrameInfo){file, 3, func};
+    ev->arg_count = 2;
+    ev->args[0] = (ArgInfo){arg_name, 0x1000, arg_type};
+    ev->args[1] = (ArgInfo){arg_name, 0x2000, arg_type};
+
+    TraceWriter w;
+    if (!trace_writer_open(&w, path)) {
+        return 1;
+    }
+    bool wrote = trace_writer_event(&w, ev);
+    if (!trace_writer_close(&w) || !wrote) {
+        unlink(path);
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char *data = read_file(path, &size);
+    unlink(path);
+    if (!data) {
+        return 1;
+    }
+
+    const TraceFooter *footer = file_footer(data, size);
+    const TraceRecord *call = file_record(data, 0);
+    const TraceRecord *arg0 = file_record(data, 1);
+    const TraceRecord *arg1 = file_record(data, 2);
+
+    int ok = footer->record_count == 3
+          && footer->event_count == 1
+          && footer->string_count == 4  /* file, func, name, type */
+          && call->kind == TRACE_CALL
+          && call->extra == 2
+          && call->seq == 7
+          && call->line == 10
+          && (call->flags & TRACE_HAS_CALLER)
+          && call->caller_line == 3
+          && call->caller_file == call->file
+          && call->caller_func == call->func
+          && string_is(data, size, call->file, file)
+          && string_is(data, size, call->func, func)
+          && arg0->kind == TRACE_ARG && arg0->id == 0x1000
+          && arg1->kind == TRACE_ARG && arg1->id == 0x2000
+          && arg0->func == arg1->func
+          && string_is(data, size, arg0->func, arg_name)
+          && string_is(data, size, arg0->type, arg_type);
+
+    free(data);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_destroy_with_creation: CREATION + FRAME aux records, then ERROR.
+ */
+static int test_destroy_with_creation(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    static const char file[] = "model.py";
+    static const char outer[] = "build";
+    static const char inner[] = "make";
+    static const char type[] = "Widget";
+
+    stack_trie_init();
+    StackId bottom = stack_trie_child(STACK_EMPTY, &(StackFrame){file, 5, outer});
+    CreationInfo info = {
+        .stack = stack_trie_child(bottom, &(StackFrame){file, 20, inner}),
+        .type_name_ref = type,
+    };
+    FieldError error = {.field = "file", .exc_type = "UnicodeError", .exc_msg = "bad"};
+
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_DESTROY;
+    ev->seq = 1;
+    ev->obj_id = 0xabc;
+    ev->type_name_ref = type;
+    ev->creation = info;
+    ev->has_creation = true;
+    ev->errors = &error;
+    ev->error_count = 1;
+
+    TraceWriter w;
+    if (!trace_writer_open(&w, path)) {
+        stack_trie_destroy();
+        return 1;
+    }
+    bool wrote = trace_writer_event(&w, ev);
+    stack_trie_destroy();
+    if (!trace_writer_close(&w) || !wrote) {
+        unlink(path);
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char *data = read_file(path, &size);
+    unlink(path);
+    if (!data) {
+        return 1;
+    }
+
+    const TraceRecord *destroy = file_record(data, 0);
+    const TraceRecord *creation = file_record(data, 1);
+    const TraceRecord *frame1 = file_record(data, 3);
+    const TraceRecord *err = file_record(data, 4);
+
+    int ok = file_footer(data, size)->record_count == 5
+          && destroy->kind == TRACE_DESTROY
+          && destroy->extra == 4
+          && destroy->id == 0xabc
+          && destroy->file == 0 && destroy->func == 0  /* no location */
+          && string_is(data, size, destroy->type, type)
+          && creation->kind == TRACE_CREATION
+          && creation->extra == 2
+          && creation->line == 20
+          && creation->type == destroy->type
+          && frame1->kind == TRACE_FRAME
+          && frame1->line == 5
+          && string_is(data, size, frame1->func, outer)
+          && err->kind == TRACE_ERROR
+          && string_is(data, size, err->file, "file")
+          && string_is(data, size, err->type, "UnicodeError")
+          && string_is(data, size, err->func, "bad");
+
+    free(data);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_many_events: Records stay fixed width; footer offsets consistent.
+ */
+static int test_many_events(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    static const char type[] = "int";
+    constexpr uint64_t COUNT = 100000;
+
+    TraceWriter w;
+    if (!trace_writer_open(&w, path)) {
+        return 1;
+    }
+    for (uint64_t i = 0; i < COUNT; i++) {
+        EventBuf buf = {0};
+        Event *ev = (Event *)buf.bytes;
+        ev->type = i % 2 ? EVENT_DESTROY : EVENT_CREATE;
+        ev->seq = i;
+        ev->obj_id = i + 1;
+        ev->type_name_ref = type;
+        (void)trace_writer_event(&w, ev);
+    }
+    if (!trace_writer_close(&w)) {
+        unlink(path);
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char *data = read_file(path, &size);
+    unlink(path);
+    if (!data) {
+        return 1;
+    }
+
+    const TraceFooter *footer = file_footer(data, size);
+    int ok = footer->record_count == COUNT
+          && footer->event_count == COUNT
+          && footer->string_count == 1
+          && footer->strings_offset == sizeof(TraceHeader) + COUNT * sizeof(TraceRecord)
+          && size == footer->strings_offset + 8 + sizeof(TraceFooter);  /* 4 + 3, padded */
+    for (uint64_t i = 0; i < COUNT && ok; i += 997) {
+        const TraceRecord *rec = file_record(data, i);
+        ok = rec->seq == i && rec->id == i + 1 && rec->kind == (i % 2 ? TRACE_DESTROY : TRACE_CREATE);
+    }
+
+    free(data);
+    return ok ? 0 : 1;
+}
+
+/**
+ * test_open_failure: Unwritable path reports errno, nothing to close.
+ */
+static int test_open_failure(void) {
+    TraceWriter w;
+    errno = 0;
+    bool opened = trace_writer_open(&w, "/nonexistent-dir/trace.bin");
+    return !opened && errno == ENOENT ? 0 : 1;
+}
+
+/**
+ * test_abandon_in_child: A forked child abandons its copy of the writer;
+ * the parent's file gets each record once (nothing flushed twice).
+ */
+static int test_abandon_in_child(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    static const char type[] = "int";
+    constexpr uint64_t HALF = 10;
+
+    TraceWriter w;
+    if (!trace_writer_open(&w, path)) {
+        return 1;
+    }
+    EventBuf buf = {0};
+    Event *ev = (Event *)buf.bytes;
+    ev->type = EVENT_CREATE;
+    ev->type_name_ref = type;
+    for (uint64_t i = 0; i < HALF; i++) {
+        ev->seq = i;
+        (void)trace_writer_event(&w, ev);
+    }
+
+    /* Header and records still in the stdio buffer */
+    pid_t pid = fork();
+    if (pid < 0) {
+        (void)trace_writer_close(&w);
+        unlink(path);
+        return 1;
+    }
+    if (pid == 0) {
+        trace_writer_abandon(&w);
+        exit(w.file == nullptr ? 0 : 1);   /* exit() flushes every open stream */
+    }
+    int status = 0;
+    bool child_ok = waitpid(pid, &status, 0) == pid && WIFEXITED(status)
+                 && WEXITSTATUS(status) == 0;
+
+    for (uint64_t i = HALF; i < 2 * HALF; i++) {
+        ev->seq = i;
+        (void)trace_writer_event(&w, ev);
+    }
+    if (!trace_writer_close(&w)) {
+        unlink(path);
+        return 1;
+    }
+
+    size_t size = 0;
+    unsigned char *data = read_file(path, &size);
+    unlink(path);
+    if (!data) {
+        return 1;
+    }
+    const TraceFooter *footer = file_footer(data, size);
+    int ok = child_ok
+          && memcmp(data, TRACE_HEADER_MAGIC, 8) == 0
+          && footer->record_count == 2 * HALF
+          && size == footer->strings_offset + 8 + sizeof(TraceFooter)
+          && file_record(data, 2 * HALF - 1)->seq == 2 * HALF - 1;
+
+    free(data);
+    return ok ? 0 : 1;
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void) {
+    printf("\n");
+    printf("╔══════════════════════════════════════════════════════════════╗\n");
+    printf("║              Trace File Writer Tests                         ║\n");
+    printf("╚══════════════════════════════════════════════════════════════╝\n");
+    printf("\n");
+
+    RUN_TEST(test_empty_trace);
+    RUN_TEST(test_call_with_args);
+    RUN_TEST(test_destroy_with_creation);
+    RUN_TEST(test_many_events);
+    RUN_TEST(test_open_failure);
+    RUN_TEST(test_abandon_in_child);
+
+    printf("\n");
+    printf("─────────────────────────────────────────────────────────────────\n");
+    printf("Results: %d passed, %d failed\n",
+           atomic_load(&g_tests_passed), atomic_load(&g_tests_failed));
+    printf("─────────────────────────────────────────────────────────────────\n");
+
+    return atomic_load(&g_tests_failed) > 0 ? 1 : 0;
+}
@@ -288,6 +288,74 @@ static int test_pointer_stability(void) {
     return 0;
 }
 
+/**
+ * test_hits_during_resize: Lock-free hits stay exact while a writer
+ * forces resizes (readers may probe a retired bucket array).
+ */
+constexpr int HOT_STRINGS = 64;
+constexpr int RESIZE_INSERTS = 20000;
+
+typedef struct {
+    const char** hot;
+    char (*bufs)[32];
+    _Atomic(bool)* done;
+    _Atomic(int)* mismatches;
+} HitWorker;
+
+static void* worker_hits(void* arg) {
+    HitWorker* w = (HitWorker*)arg;
+    atomic_fetch_add(&g_ready, 1);
+    while (!atomic_load(w->done)) {
+        for (int i = 0; i < HOT_STRINGS; i++) {
+            if (string_intern(w->bufs[i]) != w->hot[i]) {
+                atomic_fetch_add(w->mismatches, 1);
+            }
+        }
+    }
+    return nullptr;
+}
+
+static int test_hits_during_resize(void) {
+    string_table_init(16);
+
+    static char hot_bufs[HOT_STRINGS][32];
+    const char* hot[HOT_STRINGS];
+    for (int i = 0; i < HOT_STRINGS; i++) {
+        snprintf(hot_bufs[i], sizeof(hot_bufs[i]), "hot_%d", i);
+        hot[i] = string_intern(hot_bufs[i]);
+    }
+
+    _Atomic(bool) done = false;
+    _Atomic(int) mismatches = 0;
+    HitWorker w = {hot, hot_bufs, &done, &mismatches};
+    atomic_store(&g_ready, 0);
+
+    pthread_t readers[NUM_THREADS - 1];
+    for (int t = 0; t < NUM_THREADS - 1; t++) {
+        pthread_create(&readers[t], NULL, worker_hits, &w);
+    }
+    while (atomic_load(&g_ready) < NUM_THREADS - 1) {
+        sched_yield();
+    }
+
+    /* Writer: 16 → 32768 buckets, ~11 resizes under readers */
+    char buf[32];
+    for (int i = 0; i < RESIZE_INSERTS; i++) {
+        snprintf(buf, sizeof(buf), "cold_%d", i);
+        (void)string_intern(buf);
+    }
+    atomic_store(&done, true);
+
+    for (int t = 0; t < NUM_THREADS - 1; t++) {
+        pthread_join(readers[t], NULL);
+    }
+
+    size_t expected = (size_t)(HOT_STRINGS + RESIZE_INSERTS);
+    bool ok = atomic_load(&mismatches) == 0 && string_table_count() == expected;
+    string_table_destroy();
+    return ok ? 0 : 1;
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -303,6 +371,7 @@ int main(void) {
     RUN_TEST(test_concurrent_same);
     RUN_TEST(test_concurrent_unique);
     RUN_TEST(test_pointer_stability);
+    RUN_TEST(test_hits_during_resize);
 
     printf("\n");
     printf("─────────────────────────────────────────────────────────────────\n");
@@ -1,11 +1,17 @@
 """Test factories: create domain objects for tests."""
 
+from array import array
+
 from archcheck.domain.events import (
+    COLUMN_FORMATS,
+    COLUMN_KINDS,
     ArgInfo,
     CallEvent,
     CreateEvent,
     CreationInfo,
     DestroyEvent,
+    EventColumns,
+    EventType,
     FieldError,
     Location,
     OutputError,
@@ -129,3 +135,106 @@ def make_tracking_result(
 ) -> TrackingResult:
     """Create TrackingResult with defaults."""
     return TrackingResult(events=events, output_errors=output_errors)
+
+
+def make_event_columns(
+    events: tuple[CallEvent | ReturnEvent | CreateEvent | DestroyEvent, ...] = (),
+    output_errors: tuple[OutputError, ...] = (),
+    threads: tuple[int, ...] | None = None,
+    tasks: tuple[int, ...] | None = None,
+) -> EventColumns:
+    """Encode events as EventColumns, the way C stop(columnar=True) does.
+
+    Strings deduplicated by value; DESTROY creation tracebacks become
+    stack entries shared per distinct suffix (creation location must be
+    the innermost traceback frame, as in C).
+    threads: recording thread of each event (default: all thread 0).
+    tasks: running asyncio task of each event (default: all 0, no task).
+    """
+    strings: list[str | None] = [None]
+    index: dict[str, int] = {}
+
+    def idx(value: str | None) -> int:
+        if value is None:
+            return 0
+        if value not in index:
+            index[value] = len(strings)
+            strings.append(value)
+        return index[value]
+
+    columns: dict[str, list[int]] = {name: [] for name in COLUMN_FORMATS}
+    errors: list[tuple[int, tuple[FieldError, ...]]] = []
+
+    # Entry 0 = no creation context, entry 1 = empty stack
+    for name in ("stack_parent", "stack_file", "stack_func", "stack_line"):
+        columns[name] = [0, 0]
+    stack_index: dict[tuple[Location, ...], int] = {(): 1}
+
+    def stack_entry(traceback: tuple[Location, ...]) -> int:
+        for depth in range(len(traceback) - 1, -1, -1):
+            suffix = traceback[depth:]
+            if suffix not in stack_index:
+                stack_index[suffix] = len(columns["stack_parent"])
+                columns["stack_parent"].append(stack_index[suffix[1:]])
+                columns["stack_file"].append(idx(suffix[0].file))
+                columns["stack_func"].append(idx(suffix[0].func))
+                columns["stack_line"].append(suffix[0].line)
+        return stack_index[traceback]
+
+    def row(kind: EventType, event: CallEvent | ReturnEvent | CreateEvent | DestroyEvent) -> None:
+        columns["kind"].append(COLUMN_KINDS.index(kind))
+        columns["file"].append(idx(event.location.file))
+        columns["line"].append(event.location.line)
+        columns["func"].append(idx(event.location.func))
+        columns["thread"].append(0)
+        columns["task"].append(0)
+        creation = event.creation if isinstance(event, DestroyEvent) else None
+        columns["creation"].append(stack_entry(creation.traceback) if creation else 0)
+        columns["creation_type"].append(idx(creation.type_name) if creation else 0)
+
+    for event in events:
+        match event:
+            case CallEvent():
+                row(EventType.CALL, event)
+                caller = event.caller if event.caller and event.caller.func else None
+                columns["obj_id"].append(0)
+                columns["type_name"].append(0)
+                columns["caller_file"].append(idx(caller.file) if caller else 0)
+                columns["caller_line"].append(caller.line if caller else 0)
+                columns["caller_func"].append(idx(caller.func) if caller else 0)
+                columns["arg_count"].append(len(event.args))
+                for arg in event.args:
+                    columns["arg_id"].append(arg.obj_id)
+                    columns["arg_name"].append(idx(arg.name))
+                    columns["arg_type"].append(idx(arg.type_name))
+                if event.errors:
+                    errors.append((len(columns["kind"]) - 1, event.errors))
+                continue
+            case ReturnEvent():
+                row(EventType.RETURN, event)
+                columns["obj_id"].append(event.return_id or 0)
+                columns["type_name"].append(idx(event.return_type) if event.return_id else 0)
+            case CreateEvent():
+                row(EventType.CREATE, event)
+                columns["obj_id"].append(event.obj_id)
+                columns["type_name"].append(idx(event.type_name))
+            case DestroyEvent():
+                row(EventType.DESTROY, event)
+                columns["obj_id"].append(event.obj_id)
+                columns["type_name"].append(idx(event.type_name))
+        for name in ("caller_file", "caller_line", "caller_func", "arg_count"):
+            columns[name].append(0)
+
+    if threads is not None:
+        columns["thread"] = list(threads)
+    if tasks is not None:
+        columns["task"] = list(tasks)
+    views = {
+        name: memoryview(array(COLUMN_FORMATS[name], values)) for name, values in columns.items()
+    }
+    return EventColumns(
+        **views,
+        strings=tuple(strings),
+        errors=tuple(errors),
+        output_errors=output_errors,
+    )
@@ -10,13 +10,44 @@ Note on RED tests:
 - Ownership (Phase 2A): Already fixed, tests are regression guards
 """
 
+import asyncio
 import importlib.util
+import json
+import os
+import subprocess
+import sys
+import threading
+import uuid
+from collections.abc import Callable, Iterator
+from pathlib import Path
 
 import pytest
 
 from archcheck import _tracking
-from archcheck.domain import CallEvent, ReturnEvent
+from archcheck.application.services.analyzer import AnalyzerService
+from archcheck.domain import (
+    CallEvent,
+    DestroyEvent,
+    EventSequence,
+    EventType,
+    ReturnEvent,
+    TrackingResult,
+)
+from archcheck.domain.events import COLUMN_FORMATS
+from archcheck.domain.exceptions import DuplicateCreateError
+from archcheck.domain.graphs import CallEdge, CallGraph, FilterConfig
+from archcheck.domain.allocations import AllocationSite, AllocationSnapshot
+from archcheck.domain.profile import FunctionProfile, Profile
+from archcheck.domain.tasks import NO_TASK
 from archcheck.infrastructure import tracking
+from archcheck.infrastructure.shm import ShmCollector
+from archcheck.infrastructure.tracefile import (
+    TraceReader,
+    child_trace_paths,
+    merge_traces,
+    read_trace,
+)
+from tests.factories import make_create_event, make_event_columns
 
 
 class TestModuleAPI:
@@ -26,9 +57,14 @@ class TestModuleAPI:
         """Module has all expected C API functions."""
         assert hasattr(_tracking, "start")
         assert hasattr(_tracking, "stop")
+        assert hasattr(_tracking, "drain")
+        assert hasattr(_tracking, "flush")
         assert hasattr(_tracking, "is_active")
         assert hasattr(_tracking, "count")
         assert hasattr(_tracking, "get_origin")
+        assert hasattr(_tracking, "snapshot")
+        assert hasattr(_tracking, "stats")
+        assert hasattr(_tracking, "analyze_columns")
 
     def test_module_spec_valid(self) -> None:
         """Module spec is properly defined."""
@@ -146,6 +182,1414 @@ class TestStringOwnership:
                 assert isinstance(evt.location.func, str)
 
 
+class TestInterning:
+    """Tests that interned strings and per-code cache survive session changes."""
+
+    def test_same_code_across_sessions_strings_valid(self) -> None:
+        """Code cached in one session resolves correctly in the next."""
+
+        def cached() -> int:
+            return 1
+
+        for _ in range(3):
+            tracking.start()
+            cached()
+            cached()
+            tr = tracking.stop()
+
+            calls = [
+                e
+                for e in tr.events
+                if isinstance(e, CallEvent) and e.location.func and "cached" in e.location.func
+            ]
+            assert len(calls) == 2
+            assert all(c.location.file == __file__ for c in calls)
+            assert calls[0].location.line == calls[1].location.line
+
+    def test_caller_beyond_old_depth_limit(self) -> None:
+        """Caller is recorded for frames deeper than the former 256 limit."""
+        tracking.start()
+
+        def recurse(n: int) -> int:
+            if n <= 0:
+                return 0
+            return recurse(n - 1) + 1
+
+        recurse(300)
+        tr = tracking.stop()
+
+        calls = [
+            e
+            for e in tr.events
+            if isinstance(e, CallEvent) and e.location.func and "recurse" in e.location.func
+        ]
+        assert len(calls) == 301
+        nested = calls[1:]
+        assert all(c.caller is not None and c.caller.func is not None for c in nested)
+        assert all("recurse" in c.caller.func for c in nested)
+        assert all(c.args[0].name == "n" for c in calls)
+
+    def test_cached_arg_names_across_sessions(self) -> None:
+        """Argument names cached per code object resolve in every session."""
+
+        def named(alpha: int, *rest: int, beta: int = 0, **extra: int) -> int:
+            return alpha + beta + len(rest) + len(extra)
+
+        for _ in range(3):
+            tracking.start()
+            named(1, 2, beta=3, gamma=4)
+            tr = tracking.stop()
+
+            calls = [
+                e
+                for e in tr.events
+                if isinstance(e, CallEvent) and e.location.func and "named" in e.location.func
+            ]
+            assert len(calls) == 1
+            assert [a.name for a in calls[0].args] == ["alpha", "beta", "rest", "extra"]
+
+    def test_capture_args_false_keeps_calls_without_args(self) -> None:
+        """capture_args=False records every CALL with an empty args tuple."""
+
+        def argful(n: int) -> int:
+            return n
+
+        tracking.start()
+        argful(0)  # Caches argument names for the next session
+        tracking.stop()
+
+        tracking.start(capture_args=False)
+        for i in range(5):
+            argful(i)
+        tr = tracking.stop()
+
+        calls = [
+            e
+            for e in tr.events
+            if isinstance(e, CallEvent) and e.location.func and "argful" in e.location.func
+        ]
+        assert len(calls) == 5
+        assert all(c.args == () for c in calls)
+        assert all(c.location.file == __file__ for c in calls)
+
+
+class TestDrain:
+    """Tests for streaming events out while tracking is active."""
+
+    def test_drain_then_stop_returns_each_event_once(self) -> None:
+        """Drained events are not returned again by stop()."""
+
+        def drained() -> int:
+            return 1
+
+        tracking.start()
+        drained()
+        first = tracking.drain(1_000_000)
+        drained()
+        rest = tracking.stop()
+
+        calls = [
+            e
+            for e in (*first.events, *rest.events)
+            if isinstance(e, CallEvent) and e.location.func and "drained" in e.location.func
+        ]
+        assert len(calls) == 2
+
+    def test_drain_respects_batch_size(self) -> None:
+        """No batch is larger than max_events."""
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start()
+        for i in range(100):
+            work(i)
+        batch = tracking.drain(10)
+        tracking.stop()
+
+        assert len(batch.events) <= 10
+
+    def test_drain_batches_cover_all_calls(self) -> None:
+        """Small batches drained during the run lose no CALL event."""
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start()
+        collected = []
+        for i in range(50):
+            work(i)
+            collected.extend(tracking.drain(7).events)
+        collected.extend(tracking.stop().events)
+
+        calls = [
+            e
+            for e in collected
+            if isinstance(e, CallEvent) and e.location.func and "work" in e.location.func
+        ]
+        assert len(calls) == 50
+        assert [c.args[0].name for c in calls] == ["n"] * 50
+
+    def test_drain_when_not_started_raises(self) -> None:
+        """drain() outside a session fails fast."""
+        with pytest.raises(RuntimeError, match="Not started"):
+            tracking.drain(1)
+
+    def test_drain_rejects_non_positive_batch(self) -> None:
+        """max_events must be positive."""
+        tracking.start()
+        try:
+            with pytest.raises(ValueError, match="max_events"):
+                tracking.drain(0)
+        finally:
+            tracking.stop()
+
+
+class TestTraceFile:
+    """Tests for start(trace_path=...) writing events to a binary file."""
+
+    def test_stop_writes_trace_readable_by_reader(self, tmp_path: Path) -> None:
+        """Events go to the file, stop() returns none of them."""
+        path = tmp_path / "trace.bin"
+
+        def traced(value: int) -> int:
+            return value
+
+        tracking.start(trace_path=path)
+        traced(1)
+        result = tracking.stop()
+
+        assert result.events == ()
+        calls = [
+            e
+            for e in read_trace(path)
+            if isinstance(e, CallEvent) and e.location.func and "traced" in e.location.func
+        ]
+        assert len(calls) == 1
+        assert calls[0].args[0].name == "value"
+
+    def test_flush_streams_during_capture(self, tmp_path: Path) -> None:
+        """flush() writes completed events; file holds each event once."""
+        path = tmp_path / "trace.bin"
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start(trace_path=path)
+        flushed = 0
+        for i in range(50):
+            work(i)
+            flushed += tracking.flush(7)
+        tracking.stop()
+
+        with TraceReader(path) as trace:
+            assert len(trace) >= flushed
+            calls = [
+                e
+                for e in trace
+                if isinstance(e, CallEvent) and e.location.func and "work" in e.location.func
+            ]
+        assert len(calls) == 50
+
+    def test_drain_in_trace_mode_raises(self, tmp_path: Path) -> None:
+        """drain() cannot return events that belong to the file."""
+        tracking.start(trace_path=tmp_path / "trace.bin")
+        try:
+            with pytest.raises(RuntimeError, match="flush"):
+                tracking.drain(1)
+        finally:
+            tracking.stop()
+
+    def test_flush_without_trace_raises(self) -> None:
+        """flush() needs a trace file."""
+        tracking.start()
+        try:
+            with pytest.raises(RuntimeError, match="trace_path"):
+                tracking.flush(1)
+        finally:
+            tracking.stop()
+
+    def test_unwritable_path_raises(self, tmp_path: Path) -> None:
+        """start() fails fast and stays inactive."""
+        with pytest.raises(OSError, match="trace.bin"):
+            tracking.start(trace_path=tmp_path / "missing" / "trace.bin")
+        assert not tracking.is_active()
+
+
+class TestColumnar:
+    """Tests for stop(columnar=True): bytes columns + deduplicated strings."""
+
+    def test_columns_match_dict_events(self) -> None:
+        """Columnar stop() encodes the same events as the dict result."""
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start()
+        work(1)
+        work(2)
+        columns = tracking.stop_columns()
+
+        calls = [
+            e
+            for e in columns.to_result().events
+            if isinstance(e, CallEvent) and e.location.func and "work" in e.location.func
+        ]
+        assert len(calls) == 2
+        assert [c.args[0].name for c in calls] == ["n", "n"]
+        assert calls[0].location == calls[1].location
+
+    def test_raw_columns_are_buffers(self) -> None:
+        """Each column is bytes; strings list starts with None."""
+        tracking.start()
+        raw = _tracking.stop(columnar=True)
+
+        assert all(isinstance(buf, bytes) for buf in raw["columns"].values())
+        assert raw["strings"][0] is None
+        assert len(set(raw["strings"])) == len(raw["strings"])
+
+    def test_stop_events_are_lazy(self) -> None:
+        """stop() wraps the columns: events built on access, creation kept."""
+
+        class Traced:
+            pass
+
+        def create_and_destroy() -> None:
+            obj = Traced()
+            _ = obj
+
+        tracking.start()
+        create_and_destroy()
+        tr = tracking.stop()
+
+        assert isinstance(tr.events, EventSequence)
+        destroys = [
+            e
+            for e in tr.events.of_type(EventType.DESTROY)
+            if isinstance(e, DestroyEvent) and e.type_name == "Traced"
+        ]
+        assert len(destroys) == 1
+        creation = destroys[0].creation
+        assert creation is not None
+        assert creation.traceback
+        assert creation.location == creation.traceback[0]
+        assert creation.location.func is not None
+        assert "create_and_destroy" in creation.location.func
+
+    def test_prefer_columnar_keeps_mode_results(self) -> None:
+        """prefer_columnar only changes results of event-recording sessions."""
+        tracking.start(aggregate=True)
+        raw = _tracking.stop(prefer_columnar=True)
+
+        assert "edges" in raw
+        assert "columns" not in raw
+
+    def test_columnar_with_trace_path_raises(self, tmp_path: Path) -> None:
+        """Columns cannot hold events that belong to the trace file."""
+        tracking.start(trace_path=tmp_path / "trace.bin")
+        try:
+            with pytest.raises(ValueError, match="trace_path"):
+                tracking.stop_columns()
+        finally:
+            tracking.stop()
+
+
+def _threaded_workload() -> None:
+    """Calls in two threads at once, objects passed between functions."""
+
+    class Item:
+        pass
+
+    def consume(item: Item) -> Item:
+        return item
+
+    def produce(n: int) -> list[Item]:
+        return [consume(Item()) for _ in range(n)]
+
+    barrier = threading.Barrier(2)
+
+    def run() -> None:
+        barrier.wait()
+        produce(50)
+
+    threads = [threading.Thread(target=run) for _ in range(2)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    produce(10)
+
+
+class TestNativeAnalysis:
+    """Tests for analyze_columns(): AnalyzerService.analyze() in C over columns."""
+
+    @pytest.mark.parametrize("workers", [1, 4])
+    @pytest.mark.parametrize(
+        "config",
+        [
+            FilterConfig(),
+            FilterConfig(include_paths=("*test_c_module*",)),
+            FilterConfig(exclude_paths=("*threading*",)),
+            FilterConfig(include_types=frozenset({EventType.CALL, EventType.CREATE})),
+        ],
+    )
+    def test_matches_analyzer_service(self, config: FilterConfig, workers: int) -> None:
+        """Same filtered rows, call graph and object flow as the Python path."""
+        tracking.start()
+        _threaded_workload()
+        columns = tracking.stop_columns()
+
+        native = tracking.analyze_columns(columns, config, workers=workers)
+        expected = AnalyzerService().analyze(columns, config)
+
+        assert native.call_graph == expected.call_graph
+        assert native.object_flow == expected.object_flow
+        assert native.filtered.to_result() == expected.filtered.to_result()
+
+    def test_threads_numbered_per_session(self) -> None:
+        """thread column: 0 for the starting thread, one value per thread."""
+        tracking.start()
+        _threaded_workload()
+        columns = tracking.stop_columns()
+
+        assert columns.thread[0] == 0
+        assert len(set(columns.thread)) >= 3
+
+    def test_duplicate_create_raises(self) -> None:
+        """FAIL-FIRST as in AnalyzerService.build_object_flow()."""
+        events = (
+            make_create_event(obj_id=100, type_name="Foo"),
+            make_create_event(obj_id=100, type_name="Foo"),
+        )
+
+        with pytest.raises(DuplicateCreateError):
+            tracking.analyze_columns(make_event_columns(events=events), FilterConfig())
+
+    def test_invalid_workers_raises(self) -> None:
+        """workers outside [1, 64] is rejected before the pass."""
+        columns = make_event_columns(events=(make_create_event(),))
+
+        with pytest.raises(ValueError, match="workers"):
+            tracking.analyze_columns(columns, FilterConfig(), workers=0)
+
+    def test_mismatched_columns_raise(self) -> None:
+        """Raw binding checks every row column has one entry per row."""
+        columns = make_event_columns(events=(make_create_event(), make_create_event(obj_id=2)))
+        raw = {name: getattr(columns, name) for name in COLUMN_FORMATS}
+        raw["thread"] = columns.thread[:1]
+
+        with pytest.raises(ValueError, match="'thread'"):
+            _tracking.analyze_columns(raw)
+
+def _named[E: (CallEvent, ReturnEvent)](
+    result: TrackingResult, kind: type[E], name: str
+) -> list[E]:
+    """Events of one kind whose function name contains name."""
+    return [
+        e
+        for e in result.events
+        if isinstance(e, kind) and e.location.func and name in e.location.func
+    ]
+
+
+class TestSampling:
+    """Tests for start() sampling options (decided before recording)."""
+
+    def test_every_nth_records_subset_paired(self) -> None:
+        """Only every Nth call is recorded, each with its RETURN."""
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start(sample_every=10)
+        for i in range(100):
+            work(i)
+        tr = tracking.stop()
+
+        calls = _named(tr, CallEvent, "work")
+        # First call fills the code cache (always recorded), then 1 in 10
+        assert 10 <= len(calls) <= 12
+        assert len(_named(tr, ReturnEvent, "work")) == len(calls)
+
+    def test_max_calls_per_code_backs_off(self) -> None:
+        """First K calls, then calls K, 2K, 4K, 8K."""
+
+        def hot() -> None:
+            pass
+
+        tracking.start(max_calls_per_code=5)
+        for _ in range(100):
+            hot()
+        tr = tracking.stop()
+
+        assert len(_named(tr, CallEvent, "hot")) == 10
+
+    def test_interval_limits_rate(self) -> None:
+        """Long interval: nothing after the first sampled call."""
+
+        def work() -> None:
+            pass
+
+        tracking.start(sample_interval_ns=10**12)
+        for _ in range(100):
+            work()
+        tr = tracking.stop()
+
+        assert 1 <= len(_named(tr, CallEvent, "work")) <= 2
+
+    def test_sampled_call_graph_has_no_false_unmatched(self) -> None:
+        """Skipped calls produce neither CALL nor RETURN."""
+
+        def work(n: int) -> int:
+            return n
+
+        tracking.start(sample_every=3, max_calls_per_code=4)
+        for i in range(60):
+            work(i)
+        tr = tracking.stop()
+
+        graph = AnalyzerService().build_call_graph(tr)
+
+        assert _named(tr, CallEvent, "work")
+        assert not [e for e in graph.unmatched if e.location.func and "work" in e.location.func]
+
+    def test_skipped_frame_stays_caller(self) -> None:
+        """A recorded call inside a skipped one names the skipped caller."""
+
+        def leaf() -> int:
+            return 1
+
+        def helper(fn: object) -> int:
+            return fn() if callable(fn) else 0
+
+        tracking.start(max_calls_per_code=2)
+        for _ in range(3):
+            helper(None)  # calls 0, 1, 2 recorded; call 3 skipped
+        helper(leaf)
+        tr = tracking.stop()
+
+        leaves = _named(tr, CallEvent, "leaf")
+        assert len(_named(tr, CallEvent, "helper")) == 3
+        assert len(leaves) == 1
+        assert leaves[0].caller is not None
+        assert leaves[0].caller.func is not None
+        assert "helper" in leaves[0].caller.func
+
+    def test_invalid_option_raises(self) -> None:
+        """Invalid sampling options fail fast and stay inactive."""
+        with pytest.raises(ValueError, match="sample_every"):
+            tracking.start(sample_every=0)
+        with pytest.raises(ValueError, match="max_calls_per_code"):
+            tracking.start(max_calls_per_code=-1)
+        assert not tracking.is_active()
+
+
+class TestPrefilter:
+    """Tests for start(filter_config=...): FilterConfig applied in C."""
+
+    def test_excluded_file_records_no_frames(self) -> None:
+        """Frames of an excluded file produce no CALL/RETURN."""
+
+        def work() -> int:
+            return 1
+
+        config = FilterConfig(exclude_paths=(f"*{Path(__file__).name}",))
+        tracking.start(filter_config=config)
+        work()
+        tr = tracking.stop()
+
+        assert _named(tr, CallEvent, "work") == []
+        assert _named(tr, ReturnEvent, "work") == []
+
+    def test_include_matches_python_filter(self) -> None:
+        """Prefiltered run records what AnalyzerService.filter() would keep."""
+
+        def work(n: int) -> str:
+            return json.dumps({"n": n})
+
+        config = FilterConfig(include_paths=(__file__,))
+        tracking.start()
+        work(1)
+        full = AnalyzerService().filter(tracking.stop(), config)
+        tracking.start(filter_config=config)
+        work(1)
+        pre = tracking.stop()
+
+        files = {e.location.file for e in pre.events if isinstance(e, (CallEvent, ReturnEvent))}
+        assert files <= {__file__, None}
+        assert len(_named(pre, CallEvent, "work")) == len(_named(full, CallEvent, "work")) == 1
+        assert len(_named(pre, CallEvent, "dumps")) == 0
+
+    def test_skipped_library_frame_stays_caller(self) -> None:
+        """Callback from a filtered library names the library frame as caller."""
+
+        def fallback(obj: object) -> str:
+            return type(obj).__name__
+
+        config = FilterConfig(include_paths=(__file__,))
+        tracking.start(filter_config=config)
+        json.dumps(object(), default=fallback)
+        tr = tracking.stop()
+
+        calls = _named(tr, CallEvent, "fallback")
+        assert len(calls) == 1
+        assert calls[0].caller is not None
+        assert calls[0].caller.file is not None
+        assert calls[0].caller.file.endswith("encoder.py")
+
+    def test_include_types_records_only_calls(self) -> None:
+        """include_types drops other event types before recording."""
+
+        def work() -> list[int]:
+            return [1, 2]
+
+        tracking.start(filter_config=FilterConfig(include_types=frozenset({EventType.CALL})))
+        work()
+        tr = tracking.stop()
+
+        assert _named(tr, CallEvent, "work")
+        assert all(isinstance(e, CallEvent) for e in tr.events)
+
+    def test_invalid_filter_raises(self) -> None:
+        """Bad patterns or type names fail fast and stay inactive."""
+        with pytest.raises(TypeError, match="include_paths"):
+            _tracking.start(include_paths="*.py")
+        with pytest.raises(ValueError, match="BOGUS"):
+            _tracking.start(include_types=("BOGUS",))
+        assert not tracking.is_active()
+
+
+def _edge(graph: CallGraph, caller: str, callee: str) -> CallEdge:
+    """The single edge whose caller/callee function names end with the given names."""
+    (edge,) = (
+        e
+        for e in graph.edges
+        if (e.caller.func or "").endswith(caller) and (e.callee.func or "").endswith(callee)
+    )
+    return edge
+
+
+class TestAggregate:
+    """Tests for start(aggregate=True): call edges counted in C."""
+
+    def test_edges_match_build_call_graph(self) -> None:
+        """Aggregated edges equal build_call_graph() over the full stream."""
+
+        def leaf(n: int) -> int:
+            return n + 1
+
+        def work() -> int:
+            total = 0
+            for i in range(3):
+                total += leaf(i)
+            return total
+
+        tracking.start()
+        work()
+        full = AnalyzerService().build_call_graph(tracking.stop())
+        tracking.start(aggregate=True)
+        work()
+        graph = tracking.stop_call_graph()
+
+        assert graph.unmatched == ()
+        assert _edge(graph, "work", "leaf").count == 3
+        expected = {e for e in full.edges if (e.callee.func or "").endswith(("work", "leaf"))}
+        assert len(expected) == 2
+        assert expected <= graph.edges
+
+    def test_time_accumulated(self) -> None:
+        """aggregate_time sums inclusive time; without it total_ns is None."""
+
+        def leaf() -> int:
+            return sum(range(1000))
+
+        def work() -> None:
+            for _ in range(5):
+                leaf()
+
+        tracking.start(aggregate=True, aggregate_time=True)
+        work()
+        timed = _edge(tracking.stop_call_graph(), "work", "leaf")
+        tracking.start(aggregate=True)
+        work()
+        untimed = _edge(tracking.stop_call_graph(), "work", "leaf")
+
+        assert timed.count == untimed.count == 5
+        assert timed.total_ns is not None
+        assert timed.total_ns > 0
+        assert untimed.total_ns is None
+
+    def test_no_events_recorded(self) -> None:
+        """Aggregate mode keeps no events: count stays 0, drain refuses."""
+
+        def work() -> list[int]:
+            return [1, 2, 3]
+
+        tracking.start(aggregate=True)
+        try:
+            work()
+            assert tracking.count() == 0
+            with pytest.raises(RuntimeError, match="aggregate"):
+                tracking.drain(10)
+            with pytest.raises(ValueError, match="aggregate"):
+                tracking.stop_columns()
+        finally:
+            tracking.stop_call_graph()
+
+    def test_filter_applies(self) -> None:
+        """Prefiltered frames add no edges but stay callers of traced ones."""
+
+        def fallback(obj: object) -> str:
+            return type(obj).__name__
+
+        config = FilterConfig(include_paths=(__file__,))
+        tracking.start(aggregate=True, filter_config=config)
+        json.dumps(object(), default=fallback)
+        graph = tracking.stop_call_graph()
+
+        (edge,) = (e for e in graph.edges if (e.callee.func or "").endswith("fallback"))
+        assert edge.caller.file is not None
+        assert edge.caller.file.endswith("encoder.py")
+        assert all(e.callee.file == __file__ for e in graph.edges)
+
+    def test_invalid_combinations_raise(self) -> None:
+        """aggregate with trace_path, aggregate_time alone: fail fast, stay inactive."""
+        with pytest.raises(ValueError, match="trace_path"):
+            _tracking.start(aggregate=True, trace_path="/tmp/unused.trace")
+        with pytest.raises(ValueError, match="aggregate_time"):
+            _tracking.start(aggregate_time=True)
+        assert not tracking.is_active()
+
+
+def _profiled(profile: Profile, func: str) -> FunctionProfile:
+    """The single profiled function whose name ends with func."""
+    (fn,) = (f for f in profile.functions if (f.function.func or "").endswith(func))
+    return fn
+
+
+class TestProfile:
+    """Tests for start(profile=True): per-function latency histograms in C."""
+
+    def test_counts_and_exclusive_time(self) -> None:
+        """Every call is counted; the caller's exclusive time excludes callees."""
+
+        def leaf() -> int:
+            return sum(range(2000))
+
+        def work() -> None:
+            for _ in range(10):
+                leaf()
+
+        tracking.start(profile=True)
+        work()
+        profile = tracking.stop_profile()
+
+        assert profile.clock == "monotonic"
+        leaf_fn = _profiled(profile, "leaf")
+        work_fn = _profiled(profile, "work")
+        assert leaf_fn.inclusive.count == 10
+        assert work_fn.inclusive.count == 1
+        assert leaf_fn.exclusive.total_ns == leaf_fn.inclusive.total_ns
+        assert work_fn.inclusive.total_ns >= leaf_fn.inclusive.total_ns
+        assert work_fn.exclusive.total_ns <= work_fn.inclusive.total_ns - leaf_fn.inclusive.total_ns
+        assert leaf_fn.inclusive.min_ns <= leaf_fn.inclusive.percentile(50)
+        assert leaf_fn.inclusive.percentile(50) <= leaf_fn.inclusive.max_ns
+
+    def test_sorted_hottest_first(self) -> None:
+        """functions are sorted by inclusive total time, descending."""
+
+        def leaf() -> None:
+            sum(range(100))
+
+        def work() -> None:
+            for _ in range(3):
+                leaf()
+
+        tracking.start(profile=True)
+        work()
+        totals = [fn.inclusive.total_ns for fn in tracking.stop_profile().functions]
+
+        assert totals == sorted(totals, reverse=True)
+
+    @pytest.mark.parametrize("clock", ["monotonic", "coarse", "tsc"])
+    def test_clocks(self, clock: str) -> None:
+        """Each clock counts calls; tsc is refused where unavailable."""
+
+        def leaf() -> None:
+            sum(range(100))
+
+        try:
+            tracking.start(profile=True, profile_clock=clock)
+        except ValueError:
+            if clock != "tsc":
+                raise
+            pytest.skip("no invariant TSC on this machine")
+        for _ in range(4):
+            leaf()
+        profile = tracking.stop_profile()
+
+        assert profile.clock == clock
+        assert _profiled(profile, "leaf").inclusive.count == 4
+
+    def test_no_events_recorded(self) -> None:
+        """Profile mode keeps no events: count stays 0, drain refuses."""
+
+        def work() -> list[int]:
+            return [1, 2, 3]
+
+        tracking.start(profile=True)
+        try:
+            work()
+            assert tracking.count() == 0
+            with pytest.raises(RuntimeError, match="profile"):
+                tracking.drain(10)
+            with pytest.raises(ValueError, match="profile"):
+                tracking.stop_columns()
+        finally:
+            tracking.stop_profile()
+
+    def test_invalid_combinations_raise(self) -> None:
+        """profile with trace_path or aggregate, bad profile_clock: fail fast."""
+        with pytest.raises(ValueError, match="trace_path"):
+            _tracking.start(profile=True, trace_path="/tmp/unused.trace")
+        with pytest.raises(ValueError, match="aggregate"):
+            _tracking.start(profile=True, aggregate=True)
+        with pytest.raises(ValueError, match="requires profile"):
+            _tracking.start(profile_clock="monotonic")
+        with pytest.raises(ValueError, match="profile_clock must be"):
+            _tracking.start(profile=True, profile_clock="sundial")
+        assert not tracking.is_active()
+
+
+class _Payload:
+    """Distinct type for allocation-site tests."""
+
+
+def _payload_site(snapshot: AllocationSnapshot, func: str) -> AllocationSite:
+    """The single _Payload site created in a function whose name ends with func."""
+    (site,) = (
+        s
+        for s in snapshot.sites
+        if (s.site.type_name or "").endswith("_Payload")
+        and (s.site.location.func or "").endswith(func)
+    )
+    return site
+
+
+class TestAllocationSites:
+    """Tests for start(alloc_sites=True): per-site object counters in C."""
+
+    def test_live_and_freed_per_site(self) -> None:
+        """Kept objects stay live on their creation site, dropped ones are freed."""
+        kept: list[_Payload] = []
+
+        def make_kept() -> None:
+            kept.extend([_Payload() for _ in range(5)])  # Inlined comprehension: same frame
+
+        def make_dropped() -> None:
+            for _ in range(3):
+                _Payload()
+
+        tracking.start(alloc_sites=True)
+        make_kept()
+        make_dropped()
+        result = tracking.stop_allocations()
+
+        kept_site = _payload_site(result, "make_kept")
+        dropped = _payload_site(result, "make_dropped")
+        assert (kept_site.allocated, kept_site.live, kept_site.lifetime) == (5, 5, None)
+        assert (dropped.allocated, dropped.freed) == (3, 3)
+        assert dropped.lifetime is not None
+        assert dropped.lifetime.count == 3
+        assert any(f.func and f.func.endswith("make_dropped") for f in dropped.site.traceback)
+        assert tracking.count() == 0
+
+    def test_snapshot_while_tracking(self) -> None:
+        """snapshot() keeps tracking running; growth() diffs two snapshots."""
+        kept: list[_Payload] = []
+
+        def leak(n: int) -> None:
+            kept.extend([_Payload() for _ in range(n)])
+
+        tracking.start(alloc_sites=True)
+        try:
+            leak(2)
+            first = tracking.snapshot()
+            leak(4)
+            second = tracking.snapshot()
+            assert tracking.is_active()
+        finally:
+            tracking.stop_allocations()
+
+        grown = {site.site: delta for site, delta in second.growth(first)}
+        assert grown[_payload_site(second, "leak").site] == 4
+        assert _payload_site(first, "leak").live == 2
+
+    def test_mode_restrictions(self) -> None:
+        """No events to drain; snapshot() needs alloc_sites; bad combinations fail fast."""
+        tracking.start(alloc_sites=True)
+        try:
+            with pytest.raises(RuntimeError, match="snapshot"):
+                tracking.drain(10)
+            with pytest.raises(ValueError, match="alloc_sites"):
+                tracking.stop_columns()
+        finally:
+            tracking.stop_allocations()
+
+        tracking.start()
+        try:
+            with pytest.raises(RuntimeError, match="alloc_sites"):
+                tracking.snapshot()
+        finally:
+            tracking.stop()
+        with pytest.raises(RuntimeError, match="Not started"):
+            tracking.snapshot()
+        with pytest.raises(ValueError, match="trace_path"):
+            _tracking.start(alloc_sites=True, trace_path="/tmp/unused.trace")
+        with pytest.raises(ValueError, match="profile"):
+            _tracking.start(alloc_sites=True, profile=True)
+        assert not tracking.is_active()
+
+
+async def _spin(n: int) -> int:
+    """Task body: n steps of CPU work, one suspension between steps."""
+    total = 0
+    for _ in range(n):
+        total += sum(range(2000))
+        await asyncio.sleep(0)
+    return total
+
+
+async def _allocate(kept: list[_Payload], n: int) -> None:
+    """Task body: n _Payload objects kept alive, suspending once."""
+    kept.extend([_Payload() for _ in range(n)])
+    await asyncio.sleep(0)
+
+
+def _run_tasks(*bodies: Callable[[], object]) -> list[int]:
+    """Run coroutines from bodies as concurrent tasks; their id()s in order."""
+    ids: list[int] = []
+
+    async def main() -> None:
+        tasks = [asyncio.create_task(body()) for body in bodies]  # type: ignore[arg-type]
+        ids.extend(id(task) for task in tasks)
+        await asyncio.gather(*tasks)
+
+    asyncio.run(main())
+    return ids
+
+
+class TestTasks:
+    """Tests for asyncio task attribution: Event.task and start(tasks=True)."""
+
+    @pytest.mark.parametrize("backend", ["eval_frame", "monitoring"])
+    def test_time_and_objects_per_task(self, backend: str) -> None:
+        """Each task is charged its own calls, time and objects; interleaving kept apart."""
+        kept: list[_Payload] = []
+
+        tracking.start(tasks=True, backend=backend)
+        slow, fast, allocator = _run_tasks(
+            lambda: _spin(50), lambda: _spin(1), lambda: _allocate(kept, 100)
+        )
+        profile = tracking.stop_tasks()
+
+        slow_stats, fast_stats = profile.task(slow), profile.task(fast)
+        allocator_stats = profile.task(allocator)
+        assert slow_stats is not None and fast_stats is not None and allocator_stats is not None
+        assert slow_stats.calls > fast_stats.calls
+        assert slow_stats.own_ns > fast_stats.own_ns
+        assert allocator_stats.allocated >= 100
+        assert profile.top_allocators(1) == (allocator_stats,)
+        assert slow in {stats.task for stats in profile.slowest(2)}
+        assert tracking.count() == 0
+
+    def test_work_outside_tasks(self) -> None:
+        """Synchronous code is charged to NO_TASK."""
+
+        def work() -> list[_Payload]:
+            return [_Payload() for _ in range(10)]
+
+        tracking.start(tasks=True)
+        work()
+        profile = tracking.stop_tasks()
+
+        outside = profile.task(NO_TASK)
+        assert outside is not None
+        assert outside.calls >= 1
+        assert outside.allocated >= 10
+        assert profile.slowest(10) == ()
+
+    def test_task_column(self) -> None:
+        """Events carry the id() of the task running when recorded, 0 outside."""
+
+        def handler() -> None:
+            sum(range(10))
+
+        async def request() -> None:
+            handler()
+            await asyncio.sleep(0)
+            handler()
+
+        tracking.start()
+        handler()
+        first, second = _run_tasks(request, request)
+        columns = tracking.stop_columns()
+
+        handled = [
+            columns.task[row]
+            for row in range(len(columns))
+            if columns.event_type(row) is EventType.CALL
+            and (columns.strings[columns.func[row]] or "").endswith("handler")
+        ]
+        assert handled[0] == NO_TASK
+        assert sorted(handled[1:]) == sorted([first, first, second, second])
+
+    def test_mode_restrictions(self) -> None:
+        """No events to drain or return as columns; bad combinations fail fast."""
+        tracking.start(tasks=True)
+        try:
+            with pytest.raises(RuntimeError, match="tasks"):
+                tracking.drain(10)
+            with pytest.raises(ValueError, match="tasks"):
+                tracking.stop_columns()
+        finally:
+            tracking.stop_tasks()
+
+        with pytest.raises(ValueError, match="trace_path"):
+            _tracking.start(tasks=True, trace_path="/tmp/unused.trace")
+        with pytest.raises(ValueError, match="shm_name"):
+            _tracking.start(tasks=True, shm_name="/unused")
+        with pytest.raises(ValueError, match="profile"):
+            _tracking.start(tasks=True, profile=True)
+        assert not tracking.is_active()
+
+
+def _frame_trace(result: TrackingResult) -> list[tuple[str, str, tuple[str, ...]]]:
+    """(kind, func, arg names) of this file's CALL/RETURN events, in order."""
+    return [
+        (
+            type(e).__name__,
+            e.location.func or "",
+            tuple(a.name for a in e.args) if isinstance(e, CallEvent) else (),
+        )
+        for e in result.events
+        if isinstance(e, (CallEvent, ReturnEvent)) and e.location.file == __file__
+    ]
+
+
+class TestMonitoringBackend:
+    """Tests for start(backend="monitoring"): sys.monitoring callbacks."""
+
+    def test_same_frames_as_eval_frame(self) -> None:
+        """Both backends record the same CALL/RETURN sequence with args."""
+
+        def leaf(n: int, *, scale: int = 2) -> int:
+            return n * scale
+
+        def work(count: int) -> int:
+            total = 0
+            for i in range(count):
+                total += leaf(i, scale=3)
+            return total
+
+        traces = []
+        for backend in ("eval_frame", "monitoring"):
+            tracking.start(backend=backend)
+            work(3)
+            traces.append(_frame_trace(tracking.stop()))
+
+        assert traces[0] == traces[1]
+        kind, func, arg_names = traces[0][0]
+        assert kind == "CallEvent"
+        assert func.endswith("work")
+        assert arg_names == ("count",)
+        assert len(traces[0]) == 8  # work + 3 x leaf, each CALL and RETURN
+
+    def test_unwind_records_return_without_value(self) -> None:
+        """A frame left by an exception gets its RETURN, callers stay exact."""
+
+        def fails() -> None:
+            msg = "boom"
+            raise KeyError(msg)
+
+        def guarded() -> int:
+            try:
+                fails()
+            except KeyError:
+                return 1
+            return 0
+
+        tracking.start(backend="monitoring")
+        guarded()
+        tr = tracking.stop()
+
+        (call,) = _named(tr, CallEvent, "fails")
+        (ret,) = _named(tr, ReturnEvent, "fails")
+        assert call.caller is not None
+        assert call.caller.func is not None
+        assert "guarded" in call.caller.func
+        assert ret.return_id is None
+        unmatched = AnalyzerService().build_call_graph(tr).unmatched
+        assert not [e for e in unmatched if e.location.file == __file__]
+
+    def test_generator_resume_is_a_call(self) -> None:
+        """Each generator resume is one CALL/RETURN pair, as with eval_frame."""
+
+        def gen() -> Iterator[int]:
+            yield 1
+            yield 2
+
+        counts = []
+        for backend in ("eval_frame", "monitoring"):
+            tracking.start(backend=backend)
+            list(gen())
+            tr = tracking.stop()
+            calls, returns = _named(tr, CallEvent, "gen"), _named(tr, ReturnEvent, "gen")
+            counts.append((len(calls), len(returns)))
+
+        assert counts[0] == counts[1] == (3, 3)
+
+    def test_filtered_code_disabled_then_rearmed(self) -> None:
+        """Excluded code records nothing; the next session traces it again."""
+
+        def work() -> int:
+            return 1
+
+        config = FilterConfig(exclude_paths=(f"*{Path(__file__).name}",))
+        tracking.start(filter_config=config, backend="monitoring")
+        for _ in range(3):
+            work()
+        filtered = tracking.stop()
+
+        tracking.start(backend="monitoring")
+        work()
+        rearmed = tracking.stop()
+
+        assert _named(filtered, CallEvent, "work") == []
+        assert len(_named(rearmed, CallEvent, "work")) == 1
+
+    def test_aggregate_matches_eval_frame(self) -> None:
+        """Aggregate mode counts the same edges through either backend."""
+
+        def leaf() -> int:
+            return 1
+
+        def work() -> int:
+            return leaf() + leaf()
+
+        graphs = []
+        for backend in ("eval_frame", "monitoring"):
+            tracking.start(aggregate=True, backend=backend)
+            work()
+            graphs.append(tracking.stop_call_graph())
+
+        assert _edge(graphs[0], "work", "leaf").count == 2
+        assert _edge(graphs[1], "work", "leaf").count == 2
+
+    def test_tool_id_in_use_raises(self) -> None:
+        """A profiler holding PROFILER_ID makes start() fail and stay inactive."""
+        sys.monitoring.use_tool_id(sys.monitoring.PROFILER_ID, "other")
+        try:
+            with pytest.raises(ValueError, match="in use"):
+                tracking.start(backend="monitoring")
+        finally:
+            sys.monitoring.free_tool_id(sys.monitoring.PROFILER_ID)
+        assert not tracking.is_active()
+        assert sys.monitoring.get_tool(sys.monitoring.PROFILER_ID) is None
+
+    def test_unknown_backend_raises(self) -> None:
+        """Unknown backend names fail fast."""
+        with pytest.raises(ValueError, match="backend"):
+            tracking.start(backend="settrace")
+        assert not tracking.is_active()
+
+    def test_stop_releases_tool_id(self) -> None:
+        """stop() frees PROFILER_ID for other tools."""
+        tracking.start(backend="monitoring")
+        assert sys.monitoring.get_tool(sys.monitoring.PROFILER_ID) == "archcheck"
+        tracking.stop()
+        assert sys.monitoring.get_tool(sys.monitoring.PROFILER_ID) is None
+
+
+def _shm_name() -> str:
+    return f"/archcheck-test-{os.getpid()}-{uuid.uuid4().hex[:8]}"
+
+
+def _collected(collector: ShmCollector) -> list[CallEvent | ReturnEvent]:
+    return [
+        event
+        for batch in collector.collect(interval_s=0.001)
+        for event in batch.result.events
+        if isinstance(event, (CallEvent, ReturnEvent))
+    ]
+
+
+class TestSharedMemory:
+    """Tests for start(shm_name=...): events exported to a collector."""
+
+    def test_events_reach_collector(self) -> None:
+        """Completed events arrive in the collector, stop() keeps none."""
+
+        def leaf(n: int) -> int:
+            return n + 1
+
+        def work() -> int:
+            return leaf(1) + leaf(2)
+
+        with ShmCollector(_shm_name()) as collector:
+            tracking.start(shm_name=collector.name)
+            work()
+            result = tracking.stop()
+            assert result.events == ()
+            frames = _collected(collector)
+
+        calls = [e for e in frames if isinstance(e, CallEvent)]
+        work_call = next(e for e in calls if (e.location.func or "").endswith("work"))
+        leaves = [e for e in calls if (e.location.func or "").endswith("leaf")]
+        assert len(leaves) == 2
+        assert all(e.caller == work_call.location for e in leaves)
+        assert all(e.args == () for e in calls)
+        assert sum(isinstance(e, ReturnEvent) for e in frames) >= 3
+
+    def test_traced_process_exports_to_collector(self, tmp_path: Path) -> None:
+        """A separate traced process writes, this one reads, until done."""
+        script = tmp_path / "traced.py"
+        script.write_text(
+            "import sys\n"
+            "from archcheck.infrastructure import tracking\n"
+            "def step(i):\n"
+            "    return i * 2\n"
+            "tracking.start(shm_name=sys.argv[1])\n"
+            "for i in range(100):\n"
+            "    step(i)\n"
+            "tracking.stop()\n",
+        )
+        with ShmCollector(_shm_name(), rings=4) as collector:
+            subprocess.run([sys.executable, str(script), collector.name], check=True)
+            frames = _collected(collector)
+            dropped = collector.poll().dropped
+
+        steps = [
+            e for e in frames if isinstance(e, CallEvent) and e.location.func == "step"
+        ]
+        assert len(steps) == 100
+        assert dropped == 0
+
+    def test_mode_restrictions(self, tmp_path: Path) -> None:
+        """Invalid combinations, missing or used segments fail fast."""
+        with pytest.raises(ValueError, match="shm_name"):
+            tracking.start(shm_name="/x", trace_path=tmp_path / "t.trace")
+        with pytest.raises(ValueError, match="shm_name"):
+            tracking.start(shm_name="/x", aggregate=True)
+        with pytest.raises(OSError, match="No such file"):
+            tracking.start(shm_name=_shm_name())
+        assert not tracking.is_active()
+
+        with ShmCollector(_shm_name()) as collector:
+            tracking.start(shm_name=collector.name)
+            try:
+                with pytest.raises(RuntimeError, match="collector"):
+                    tracking.drain(10)
+            finally:
+                tracking.stop()
+            # One traced session per segment
+            with pytest.raises(OSError, match="busy"):
+                tracking.start(shm_name=collector.name)
+            assert collector.poll().done
+        assert not tracking.is_active()
+
+
+def _in_child(body: Callable[[], bool]) -> int:
+    """Fork, run body in the child (exit status 0 if it returned True), wait."""
+    pid = os.fork()
+    if pid == 0:
+        try:
+            os._exit(0 if body() else 1)
+        finally:
+            os._exit(2)
+    _, status = os.waitpid(pid, 0)
+    return os.waitstatus_to_exitcode(status)
+
+
+class TestFork:
+    """Tests for fork() while tracking: each child gets a fresh session."""
+
+    def test_child_does_not_inherit_events(self) -> None:
+        """Child stops with its own events only, parent keeps tracking."""
+
+        def before_fork() -> None:
+            pass
+
+        def in_child() -> None:
+            pass
+
+        def after_fork() -> None:
+            pass
+
+        def child() -> bool:
+            in_child()
+            funcs = {e.location.func for e in tracking.stop().events if isinstance(e, CallEvent)}
+            return any(f.endswith("in_child") for f in funcs) and not any(
+                f.endswith("before_fork") for f in funcs
+            )
+
+        tracking.start()
+        before_fork()
+        status = _in_child(child)
+        after_fork()
+        funcs = [e.location.func for e in tracking.stop().events if isinstance(e, CallEvent)]
+
+        assert status == 0
+        assert any(f.endswith("before_fork") for f in funcs)
+        assert any(f.endswith("after_fork") for f in funcs)
+        assert not any(f.endswith("in_child") for f in funcs)
+
+    def test_workers_write_own_trace_files(self, tmp_path: Path) -> None:
+        """Each worker writes <trace_path>.<pid>; merged in one pass."""
+
+        def leaf() -> int:
+            return 1
+
+        def worker() -> int:
+            return leaf() + leaf()
+
+        def child() -> bool:
+            worker()
+            return tracking.stop().events == ()
+
+        path = tmp_path / "trace.bin"
+        tracking.start(trace_path=path)
+        statuses = [_in_child(child) for _ in range(3)]
+        tracking.stop()
+
+        workers = child_trace_paths(path)
+        graph = AnalyzerService().build_merged_call_graph(map(read_trace, workers))
+        merged = merge_traces((path, *workers))
+
+        assert statuses == [0, 0, 0]
+        assert len(workers) == 3
+        assert _edge(graph, "worker", "leaf").count == 6
+        assert not any(
+            (e.location.func or "").endswith("leaf")
+            for e in read_trace(path)
+            if isinstance(e, CallEvent)
+        )
+        assert sum(
+            isinstance(e, CallEvent) and (e.location.func or "").endswith("worker")
+            for e in merged.events
+        ) == 3
+
+    def test_shm_child_untraced(self) -> None:
+        """One producer per segment: the child stops tracking, parent goes on."""
+        with ShmCollector(_shm_name()) as collector:
+            tracking.start(shm_name=collector.name)
+            status = _in_child(lambda: not tracking.is_active())
+            assert tracking.is_active()
+            tracking.stop()
+            assert all(batch.dropped == 0 for batch in collector.collect())
+
+        assert status == 0
+
+
+class TestStats:
+    """Tests for stats(): tracker counters while tracking runs."""
+
+    def test_counts_events_by_type(self) -> None:
+        """Recorded counts match the events stop() returns."""
+        tracking.start()
+
+        def work() -> list[int]:
+            return [1, 2, 3]
+
+        work()
+        stats = tracking.stats()
+        tr = tracking.stop()
+
+        calls = sum(isinstance(e, CallEvent) for e in tr.events)
+        assert stats.events[EventType.CALL] >= 1
+        assert stats.events[EventType.CALL] <= calls
+        assert stats.dropped.oom == 0
+        assert stats.threads >= 1
+
+    def test_memory_of_tables(self) -> None:
+        """Events, strings and creation stacks report their bytes."""
+        tracking.start()
+
+        def work() -> object:
+            return object()
+
+        kept = [work() for _ in range(10)]
+        stats = tracking.stats()
+        tracking.stop()
+
+        assert kept
+        assert stats.event_bytes > 0
+        assert stats.string_bytes > 0
+        assert stats.strings > 0
+        assert stats.memory_bytes >= stats.event_bytes
+
+    def test_repeated_calls_grow(self) -> None:
+        """Counters keep growing while tracking stays active."""
+        tracking.start()
+
+        def work() -> int:
+            return 1
+
+        first = tracking.stats()
+        for _ in range(100):
+            work()
+        second = tracking.stats()
+        tracking.stop()
+
+        assert second.events[EventType.CALL] >= first.events[EventType.CALL] + 100
+
+    def test_hook_time_sampled(self) -> None:
+        """Enough hook calls yield timed samples."""
+        tracking.start()
+
+        def work() -> int:
+            return 1
+
+        for _ in range(1000):
+            work()
+        stats = tracking.stats()
+        tracking.stop()
+
+        assert stats.hook_samples > 0
+        assert stats.hook_ns > 0
+
+    def test_not_started_raises(self) -> None:
+        """stats() needs a running session."""
+        with pytest.raises(RuntimeError):
+            tracking.stats()
+
+    def test_fresh_session_resets(self) -> None:
+        """A new session starts counting from zero."""
+        tracking.start()
+
+        def work() -> int:
+            return 1
+
+        for _ in range(100):
+            work()
+        tracking.stop()
+
+        tracking.start()
+        stats = tracking.stats()
+        tracking.stop()
+
+        assert stats.events[EventType.CALL] < 100
+
+    def test_prometheus_export(self) -> None:
+        """Live stats export as Prometheus text."""
+        tracking.start()
+        text = tracking.stats().to_prometheus()
+        tracking.stop()
+
+        assert "archcheck_tracker_events_total" in text
+        assert "archcheck_tracker_memory_bytes" in text
+
+
 class TestEdgeCases:
     """Tests for edge cases and potential memory issues."""
 
@@ -158,7 +1602,7 @@ class TestEdgeCases:
                 return 0
             return recurse(n - 1) + 1
 
-        # MAX_STACK_DEPTH is 256, test near limit
+        # Call stack grows dynamically, no fixed depth limit
         result = recurse(200)
         assert result == 200
 
@@ -188,4 +1632,4 @@ class TestEdgeCases:
 
         assert tr is not None
         # May have some events from stop() itself
-        assert isinstance(tr.events, tuple)
+        assert isinstance(tr.events, EventSequence)
@@ -187,6 +187,67 @@ class TestConcurrentTracking:
         assert len(result["events"]) > 0
 
 
+class TestPerThreadBuffers:
+    """Tests for per-thread event buffers merged in stop()."""
+
+    def test_merged_events_keep_per_thread_order(self) -> None:
+        """Every CALL precedes its RETURN after merging thread buffers."""
+        num_threads = 8
+        calls_per_thread = 50
+        barrier = threading.Barrier(num_threads)
+
+        def leaf(thread_id: int, i: int) -> int:
+            return thread_id + i
+
+        def worker(thread_id: int) -> None:
+            barrier.wait()
+            for i in range(calls_per_thread):
+                leaf(thread_id, i)
+
+        _tracking.start()
+        threads = [threading.Thread(target=worker, args=(i,)) for i in range(num_threads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        result = _tracking.stop()
+
+        events = result["events"]
+        leaf_calls = [
+            i for i, e in enumerate(events) if e["event"] == "CALL" and e["func"].endswith("leaf")
+        ]
+        leaf_returns = [
+            i for i, e in enumerate(events) if e["event"] == "RETURN" and e["func"].endswith("leaf")
+        ]
+
+        # Nothing lost across buffers
+        assert len(leaf_calls) == num_threads * calls_per_thread
+        assert len(leaf_returns) == num_threads * calls_per_thread
+
+        # Global order: k-th CALL of leaf is matched by a later RETURN
+        assert all(c < r for c, r in zip(sorted(leaf_calls), sorted(leaf_returns), strict=True))
+
+    def test_events_of_exited_threads_survive(self) -> None:
+        """Buffers of finished threads are kept until stop()."""
+
+        def short_lived() -> int:
+            return 1
+
+        _tracking.start()
+        for _ in range(4):
+            t = threading.Thread(target=short_lived)
+            t.start()
+            t.join()
+        result = _tracking.stop()
+
+        calls = [
+            e
+            for e in result["events"]
+            if e["event"] == "CALL" and e["func"].endswith("short_lived")
+        ]
+        assert len(calls) == 4
+
+
 class TestThreadLocalState:
     """Tests for thread-local state in tracking."""
 
@@ -232,18 +293,22 @@ class TestThreadLocalState:
 class TestModuleGILDeclaration:
     """Tests for C module GIL declaration."""
 
-    def test_module_loads_with_gil_warning(self) -> None:
-        """Module loads with GIL warning on free-threaded build.
-
-        Our module declares Py_MOD_GIL_USED (safe default),
-        so Python re-enables GIL when loading it.
-        """
+    def test_module_loads(self) -> None:
+        """Module loads and exposes its API."""
         # Module is already loaded, just verify it works
         assert hasattr(_tracking, "start")
         assert hasattr(_tracking, "stop")
         assert callable(_tracking.start)
         assert callable(_tracking.stop)
 
+    @pytest.mark.skipif(
+        not _is_build_free_threaded(),
+        reason="Requires free-threaded Python build",
+    )
+    def test_module_does_not_reenable_gil(self) -> None:
+        """Module declares Py_MOD_GIL_NOT_USED: importing it keeps GIL disabled."""
+        assert _is_gil_actually_disabled()
+
 
 class TestConcurrencyStress:
     """Stress tests for concurrent operations."""
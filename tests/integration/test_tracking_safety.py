@@ -334,6 +334,31 @@ class TestDestroyEvent:
         assert evt.obj_id > 0
         assert evt.type_name == "Traced"
 
+    def test_destroy_creation_traceback_matches_origin(self) -> None:
+        """DESTROY carries the same creation stack get_origin() saw."""
+        tracking.start()
+
+        class Shared:
+            pass
+
+        def make() -> Shared:
+            return Shared()
+
+        obj = make()
+        obj_id = id(obj)
+        origin = tracking.get_origin(obj)
+        del obj
+
+        tr = tracking.stop()
+
+        matching = [e for e in tr.events if isinstance(e, DestroyEvent) and e.obj_id == obj_id]
+        assert origin is not None
+        assert len(matching) == 1
+        assert matching[0].creation == origin
+        assert origin.location == origin.traceback[0]
+        assert origin.location.func is not None
+        assert origin.location.func.endswith("make")
+
 
 class TestCallEventDetails:
     """Tests for CALL event details (caller, args)."""
@@ -409,6 +434,27 @@ class TestGetOrigin:
         assert origin is not None
         assert origin.type_name == "Trackable"
 
+    def test_get_origin_traceback_full_depth(self) -> None:
+        """Tracebacks keep every frame (no 16-frame limit), innermost first."""
+
+        class Deep:
+            pass
+
+        def descend(n: int) -> Deep:
+            return Deep() if n == 0 else descend(n - 1)
+
+        tracking.start()
+        obj = descend(40)
+        origin = tracking.get_origin(obj)
+        tracking.stop()
+
+        assert origin is not None
+        descend_frames = [
+            f for f in origin.traceback if f.func is not None and f.func.endswith("descend")
+        ]
+        assert len(descend_frames) == 41
+        assert origin.traceback[0] == origin.location
+
     def test_get_origin_returns_none_for_unknown(self) -> None:
         """get_origin returns None for object created before tracking."""
         obj = object()  # Created before tracking
@@ -6,8 +6,11 @@ Tests:
 - Event filtering (max_events, include_types, exclude_paths)
 - Strategy integration (group_by)
 - Lifecycle section rendering
+- top_k summary mode
 """
 
+import pytest
+
 from archcheck.application.reporters.console import ConsoleConfig, ConsoleReporter
 from archcheck.application.reporters.strategies import ByFileStrategy, ByFuncStrategy
 from archcheck.domain.events import EventType
@@ -36,6 +39,7 @@ class TestConsoleConfig:
         assert config.include_types is None
         assert config.exclude_paths == ()
         assert config.width == 120
+        assert config.top_k is None
 
     def test_custom_values(self) -> None:
         """Custom values can be set."""
@@ -218,3 +222,50 @@ class TestConsoleReporterLifecycle:
         assert "Traceback" in output
         assert "frame1" in output
         assert "frame2" in output
+
+
+class TestConsoleReporterTopK:
+    """Tests for top_k summary mode."""
+
+    EVENTS = (
+        make_call_event(file="src/hot.py", func="hot"),
+        make_call_event(file="src/hot.py", func="hot"),
+        make_call_event(file="src/cold.py", func="cold"),
+        make_create_event(file="src/hot.py", obj_id=1, type_name="Widget"),
+        make_create_event(file="src/hot.py", obj_id=2, type_name="Widget"),
+        make_create_event(file="src/cold.py", obj_id=3, type_name="Gadget"),
+    )
+
+    def test_tables_rendered(self) -> None:
+        """Summary tables replace the per-event listing."""
+        reporter = ConsoleReporter(ConsoleConfig(top_k=5))
+        output = reporter.report(make_tracking_result(events=self.EVENTS))
+
+        assert "HOTTEST FUNCTIONS" in output
+        assert "BUSIEST FILES" in output
+        assert "MOST ALLOCATED TYPES" in output
+        assert "CALL EVENTS" not in output
+        assert "OBJECT LIFECYCLE" not in output
+
+    def test_top_k_limits_rows(self) -> None:
+        """Only the k heaviest keys are shown, heaviest first."""
+        reporter = ConsoleReporter(ConsoleConfig(top_k=1))
+        output = reporter.report(make_tracking_result(events=self.EVENTS))
+
+        assert "hot.py:10 hot" in output
+        assert "cold.py:10 cold" not in output
+        assert "Widget" in output
+        assert "Gadget" not in output
+
+    def test_filters_apply(self) -> None:
+        """include_types still restricts what is counted."""
+        config = ConsoleConfig(top_k=5, include_types=frozenset({EventType.CREATE}))
+        output = ConsoleReporter(config).report(make_tracking_result(events=self.EVENTS))
+
+        assert "HOTTEST FUNCTIONS" not in output
+        assert "MOST ALLOCATED TYPES" in output
+
+    def test_invalid_top_k_raises(self) -> None:
+        """top_k must be positive."""
+        with pytest.raises(ValueError, match="top_k"):
+            ConsoleConfig(top_k=0)
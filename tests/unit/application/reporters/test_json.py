@@ -6,11 +6,13 @@ Tests:
 - Summary statistics calculation
 - Event serialization for all event types
 - Output errors serialization
+- JsonExporter: streamed document and NDJSON match JsonReporter
 """
 
 import json
+from io import StringIO
 
-from archcheck.application.reporters.json import JsonReporter
+from archcheck.application.reporters.json import JsonExporter, JsonReporter
 from tests.factories import (
     make_arg_info,
     make_call_event,
@@ -213,3 +215,57 @@ class TestJsonReporterErrors:
         data = json.loads(output)
 
         assert len(data["output_errors"]) == 2
+
+
+STREAM_EVENTS = (
+    make_call_event(args=(make_arg_info(),)),
+    make_create_event(obj_id=7),
+    make_return_event(),
+    make_destroy_event(obj_id=7, creation=make_creation_info(traceback=(make_location(),))),
+)
+
+
+class TestJsonExporter:
+    """Tests for JsonExporter (streaming)."""
+
+    def test_document_matches_reporter(self) -> None:
+        """Streamed document parses to the same data as report()."""
+        result = make_tracking_result(events=STREAM_EVENTS, output_errors=(make_output_error(),))
+        out = StringIO()
+
+        written = JsonExporter().export(result, out)
+
+        assert written == len(STREAM_EVENTS)
+        assert json.loads(out.getvalue()) == json.loads(JsonReporter().report(result))
+
+    def test_empty_document(self) -> None:
+        """No events and no errors is still a valid document."""
+        out = StringIO()
+
+        JsonExporter().export(make_tracking_result(), out)
+
+        data = json.loads(out.getvalue())
+        assert data == {"events": [], "output_errors": [], "summary": {"total": 0, "by_type": {}}}
+
+    def test_one_event_per_line(self) -> None:
+        """Each event is written as its own line."""
+        out = StringIO()
+
+        JsonExporter().export(make_tracking_result(events=STREAM_EVENTS), out)
+
+        lines = out.getvalue().splitlines()
+        assert len(lines) >= len(STREAM_EVENTS) + 2
+        assert json.loads(lines[1].rstrip(","))["type"] == "CALL"
+
+    def test_ndjson_records(self) -> None:
+        """NDJSON: events, then output errors, then the summary, one per line."""
+        result = make_tracking_result(events=STREAM_EVENTS, output_errors=(make_output_error(),))
+        out = StringIO()
+
+        JsonExporter(ndjson=True).export(result, out)
+
+        records = [json.loads(line) for line in out.getvalue().splitlines()]
+        expected = json.loads(JsonReporter().report(result))
+        assert [r["event"] for r in records[: len(STREAM_EVENTS)]] == expected["events"]
+        assert records[len(STREAM_EVENTS)] == {"output_error": expected["output_errors"][0]}
+        assert records[-1] == {"summary": expected["summary"]}
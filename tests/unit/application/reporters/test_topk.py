@@ -0,0 +1,67 @@
+"""Tests for TopKCounter.
+
+Tests:
+- Exact counts while keys fit
+- Bounded key count under many distinct keys
+- Heavy hitters survive eviction, error bounds hold
+- FAIL-FIRST on invalid capacity
+"""
+
+import pytest
+
+from archcheck.application.reporters.topk import TopKCounter, TopKEntry
+
+
+class TestTopKCounter:
+    """Tests for TopKCounter."""
+
+    def test_exact_when_keys_fit(self) -> None:
+        """Few distinct keys: exact counts, heaviest first."""
+        counter = TopKCounter(capacity=4)
+        for key in ("a", "b", "a", "c", "a", "b"):
+            counter.add(key)
+
+        assert counter.top(2) == [
+            TopKEntry(key="a", count=3, error=0),
+            TopKEntry(key="b", count=2, error=0),
+        ]
+        assert counter.total == 6
+
+    def test_weight(self) -> None:
+        """add() with weight counts it once."""
+        counter = TopKCounter(capacity=2)
+        counter.add("a", weight=5)
+
+        assert counter.top(1) == [TopKEntry(key="a", count=5, error=0)]
+
+    def test_memory_bounded(self) -> None:
+        """Distinct keys kept never exceed 2 * capacity."""
+        counter = TopKCounter(capacity=8)
+        for i in range(10_000):
+            counter.add(f"k{i}")
+
+        assert len(counter.top(10_000)) <= 16
+        assert counter.total == 10_000
+
+    def test_heavy_hitters_survive(self) -> None:
+        """Keys heavier than the long tail stay on top with valid bounds."""
+        counter = TopKCounter(capacity=8)
+        true_counts = {"hot": 0, "warm": 0}
+        for i in range(5_000):
+            counter.add(f"cold{i}")
+            if i % 2 == 0:
+                counter.add("hot")
+                true_counts["hot"] += 1
+            if i % 5 == 0:
+                counter.add("warm")
+                true_counts["warm"] += 1
+
+        top = counter.top(2)
+        assert [entry.key for entry in top] == ["hot", "warm"]
+        for entry in top:
+            assert entry.count - entry.error <= true_counts[entry.key] <= entry.count
+
+    def test_invalid_capacity_raises(self) -> None:
+        """capacity < 1 is rejected."""
+        with pytest.raises(ValueError, match="capacity"):
+            TopKCounter(capacity=0)
@@ -3,8 +3,11 @@
 Tests:
 - filter(): applies FilterConfig to TrackingResult
 - build_call_graph(): constructs CallGraph from CALL/RETURN events
+- build_merged_call_graph(): one CallGraph from per-process event streams
 - build_object_flow(): constructs ObjectFlow from CREATE/DESTROY events
 - analyze(): orchestrates all analysis steps
+- EventColumns input: same results as TrackingResult input
+- Lazy TrackingResult (EventSequence events): column path, stays lazy
 """
 
 import pytest
@@ -15,6 +18,8 @@ from archcheck.domain.events import (
     CallEvent,
     CreateEvent,
     DestroyEvent,
+    EventColumns,
+    EventSequence,
     EventType,
     Location,
     TrackingResult,
@@ -24,6 +29,7 @@ from tests.factories import (
     make_call_event,
     make_create_event,
     make_destroy_event,
+    make_event_columns,
     make_output_error,
     make_return_event,
     make_tracking_result,
@@ -272,6 +278,45 @@ class TestAnalyzerServiceBuildCallGraph:
         assert len(graph.edges) == 0
 
 
+class TestAnalyzerServiceBuildMergedCallGraph:
+    """Tests for AnalyzerService.build_merged_call_graph()."""
+
+    def test_edges_summed_across_streams(self) -> None:
+        """Same edge in two processes counts twice."""
+        call = make_call_event(file="b.py", func="callee", caller_file="a.py", caller_func="caller")
+        ret = make_return_event(file="b.py", func="callee")
+
+        graph = AnalyzerService().build_merged_call_graph([(call, ret), iter((call, ret))])
+
+        assert len(graph.edges) == 1
+        assert next(iter(graph.edges)).count == 2
+        assert graph.unmatched == ()
+
+    def test_stacks_not_shared_between_streams(self) -> None:
+        """A CALL left open in one process never matches another's RETURN."""
+        call = make_call_event(file="b.py", func="callee", caller_file="a.py", caller_func="caller")
+        ret = make_return_event(file="b.py", func="callee")
+
+        graph = AnalyzerService().build_merged_call_graph([(call,), (ret,)])
+
+        assert len(graph.edges) == 0
+        assert graph.unmatched == (call, ret)
+
+    def test_matches_build_call_graph_for_one_stream(self) -> None:
+        """One stream: same graph as build_call_graph()."""
+        events = (
+            make_call_event(file="b.py", func="callee", caller_file="a.py", caller_func="caller"),
+            make_call_event(file="c.py", func="inner", caller_file="b.py", caller_func="callee"),
+            make_return_event(file="c.py", func="inner"),
+            make_return_event(file="b.py", func="callee"),
+        )
+        service = AnalyzerService()
+
+        merged = service.build_merged_call_graph([events])
+
+        assert merged == service.build_call_graph(make_tracking_result(events=events))
+
+
 class TestAnalyzerServiceBuildObjectFlow:
     """Tests for AnalyzerService.build_object_flow()."""
 
@@ -434,3 +479,160 @@ class TestAnalyzerServiceAnalyze:
 
         assert len(analysis.object_flow.objects) == 1
         assert 100 in analysis.object_flow.objects
+
+
+# Events covering edges, self-loops, unmatched, lifecycles and arg tracking
+SAMPLE_EVENTS = (
+    make_return_event(func="orphan_return"),
+    make_create_event(file="src/model.py", obj_id=100, type_name="Foo"),
+    make_call_event(
+        file="src/service.py",
+        line=20,
+        func="handle",
+        caller_file="src/app.py",
+        caller_line=5,
+        caller_func="main",
+        args=(ArgInfo(name="foo", obj_id=100, type_name="Foo"),),
+    ),
+    make_call_event(
+        file="src/service.py",
+        line=20,
+        func="handle",
+        caller_file="src/service.py",
+        caller_line=20,
+        caller_func="handle",
+    ),
+    make_return_event(file="src/service.py", line=20, func="handle"),
+    make_return_event(
+        file="src/service.py", line=20, func="handle", return_id=None, return_type=None
+    ),
+    CallEvent(
+        location=Location(file="tests/test_x.py", line=3, func="helper"),
+        caller=None,
+        args=(),
+        errors=(),
+    ),
+    make_destroy_event(obj_id=100, type_name="Foo"),
+    make_destroy_event(obj_id=999, type_name="Bar"),
+    make_call_event(file="src/service.py", func="pending"),
+)
+
+
+class TestAnalyzerServiceColumns:
+    """Tests for AnalyzerService on EventColumns (stop_columns())."""
+
+    def test_call_graph_matches_events(self) -> None:
+        """Columns produce the same edges and unmatched events."""
+        service = AnalyzerService()
+
+        from_events = service.build_call_graph(make_tracking_result(events=SAMPLE_EVENTS))
+        from_columns = service.build_call_graph(make_event_columns(events=SAMPLE_EVENTS))
+
+        assert from_columns.edges == from_events.edges
+        assert from_columns.unmatched == from_events.unmatched
+
+    def test_object_flow_matches_events(self) -> None:
+        """Columns produce the same lifecycles, locations and orphans."""
+        service = AnalyzerService()
+
+        from_events = service.build_object_flow(make_tracking_result(events=SAMPLE_EVENTS))
+        from_columns = service.build_object_flow(make_event_columns(events=SAMPLE_EVENTS))
+
+        assert from_columns.objects == from_events.objects
+        assert from_columns.orphan_destroys == from_events.orphan_destroys
+        assert from_columns.objects[100].locations[0].func == "handle"
+
+    def test_duplicate_create_raises(self) -> None:
+        """FAIL-FIRST holds on the column path."""
+        events = (
+            make_create_event(obj_id=100, type_name="Foo"),
+            make_create_event(obj_id=100, type_name="Foo"),
+        )
+
+        with pytest.raises(ValueError, match="Duplicate CREATE"):
+            AnalyzerService().build_object_flow(make_event_columns(events=events))
+
+    @pytest.mark.parametrize(
+        "config",
+        [
+            FilterConfig(),
+            FilterConfig(include_paths=("src/*",)),
+            FilterConfig(exclude_paths=("tests/*",)),
+            FilterConfig(include_types=frozenset({EventType.CALL, EventType.DESTROY})),
+            FilterConfig(include_paths=("src/*",), include_types=frozenset({EventType.RETURN})),
+        ],
+    )
+    def test_filter_matches_events(self, config: FilterConfig) -> None:
+        """Filtered columns materialize to the filtered events."""
+        service = AnalyzerService()
+
+        from_events = service.filter(make_tracking_result(events=SAMPLE_EVENTS), config)
+        from_columns = service.filter(make_event_columns(events=SAMPLE_EVENTS), config)
+
+        assert from_columns.to_result().events == from_events.events
+
+    def test_filter_preserves_output_errors(self) -> None:
+        """output_errors survive column filtering."""
+        columns = make_event_columns(
+            events=SAMPLE_EVENTS, output_errors=(make_output_error(),)
+        )
+
+        filtered = AnalyzerService().filter(columns, FilterConfig(include_paths=("src/*",)))
+
+        assert filtered.output_errors == columns.output_errors
+
+    def test_analyze_keeps_columns(self) -> None:
+        """analyze() on columns returns filtered columns and both graphs."""
+        columns = make_event_columns(events=SAMPLE_EVENTS)
+        config = FilterConfig(include_paths=("src/*",))
+        service = AnalyzerService()
+
+        analysis = service.analyze(columns, config)
+        expected = service.analyze(make_tracking_result(events=SAMPLE_EVENTS), config)
+
+        assert isinstance(analysis.filtered, EventColumns)
+        assert analysis.call_graph == expected.call_graph
+        assert analysis.object_flow == expected.object_flow
+
+    def test_call_stacks_per_thread(self) -> None:
+        """Interleaved CALL/RETURN of two threads pair up within each thread."""
+        events = (
+            make_call_event(func="work", caller_func="main"),
+            make_call_event(func="help", caller_func="main"),
+            make_return_event(func="work"),
+            make_call_event(func="pending", caller_func="main"),
+        )
+        columns = make_event_columns(events=events, threads=(0, 1, 0, 1))
+
+        graph = AnalyzerService().build_call_graph(columns)
+
+        assert {edge.callee.func for edge in graph.edges} == {"work"}
+        assert [event.location.func for event in graph.unmatched] == ["help", "pending"]
+
+
+class TestAnalyzerServiceLazyResult:
+    """Tests for TrackingResult whose events are an EventSequence (stop())."""
+
+    def test_filter_stays_lazy(self) -> None:
+        """Filtered lazy result is a view on the same columns."""
+        columns = make_event_columns(events=SAMPLE_EVENTS)
+        config = FilterConfig(include_paths=("src/*",))
+        service = AnalyzerService()
+
+        filtered = service.filter(columns.to_result(), config)
+        expected = service.filter(make_tracking_result(events=SAMPLE_EVENTS), config)
+
+        assert isinstance(filtered.events, EventSequence)
+        assert filtered.events.columns is columns
+        assert filtered == expected
+
+    def test_analyze_matches_events(self) -> None:
+        """Same call graph and object flow as the tuple-based result."""
+        config = FilterConfig(exclude_paths=("tests/*",))
+        service = AnalyzerService()
+
+        analysis = service.analyze(make_event_columns(events=SAMPLE_EVENTS).to_result(), config)
+        expected = service.analyze(make_tracking_result(events=SAMPLE_EVENTS), config)
+
+        assert analysis.call_graph == expected.call_graph
+        assert analysis.object_flow == expected.object_flow
@@ -0,0 +1,71 @@
+"""Tests for DiffService.
+
+Tests:
+- diff_traces(): edge count changes across per-process event streams
+- diff_traces(): live objects per creation site, destroyed objects excluded
+- Streams consumed once (generators, e.g. read_trace())
+- limit applies per category
+"""
+
+from archcheck.application.services.differ import DiffService
+from archcheck.domain.events import Event
+from tests.factories import (
+    make_call_event,
+    make_create_event,
+    make_creation_info,
+    make_destroy_event,
+    make_return_event,
+)
+
+
+def _calls(func: str, times: int) -> list[Event]:
+    """times completed calls caller → func."""
+    call = make_call_event(file="b.py", func=func, caller_file="a.py", caller_func="caller")
+    ret = make_return_event(file="b.py", func=func)
+    return [call, ret] * times
+
+
+class TestDiffTraces:
+    """Tests for DiffService.diff_traces()."""
+
+    def test_edge_changes_across_processes(self) -> None:
+        """Edge counts are summed over each run's streams before comparing."""
+        before = [_calls("work", 2), _calls("work", 1)]
+        after = [_calls("work", 10), _calls("fresh", 1)]
+
+        diff = DiffService().diff_traces(before, after)
+
+        assert [(d.edge.callee.func, d.count_delta) for d in diff.changed_edges] == [("work", 7)]
+        assert [d.edge.callee.func for d in diff.new_edges] == ["fresh"]
+        assert diff.removed_edges == ()
+        assert diff.latency == ()
+
+    def test_live_objects_per_site(self) -> None:
+        """Objects alive at the end of their stream count toward their site."""
+        leak = [make_create_event(obj_id=i) for i in range(3)]
+        freed = [make_create_event(obj_id=9), make_destroy_event(obj_id=9)]
+
+        diff = DiffService().diff_traces([freed], [leak + freed])
+
+        (site,) = diff.sites
+        assert site.site == make_creation_info()
+        assert (site.before, site.after) == (0, 3)
+
+    def test_obj_ids_per_stream(self) -> None:
+        """A DESTROY in one process does not free an object of another."""
+        created = [make_create_event(obj_id=1)]
+        destroyed = [make_destroy_event(obj_id=1)]
+
+        diff = DiffService().diff_traces([], [created, destroyed])
+
+        assert [site.after for site in diff.sites] == [1]
+
+    def test_generators_consumed_once(self) -> None:
+        """Streams may be one-shot iterators."""
+        before = (iter(_calls(f"f{i}", 1)) for i in range(3))
+        after = (iter(_calls(f"f{i}", 2)) for i in range(3))
+
+        diff = DiffService().diff_traces(before, after, limit=2)
+
+        assert len(diff.changed_edges) == 2
+        assert all(delta.count_delta == 1 for delta in diff.edges)
@@ -0,0 +1,283 @@
+"""Tests for incremental graph service.
+
+Tests:
+- IncrementalGraph initial state: same graphs as parse_directory()/merge()
+- update(): body edits, interface changes, added/removed modules, parse errors
+- merged_graph: runtime edges follow edited files
+- watch(): yields the update of an edit
+"""
+
+import os
+from collections import Counter
+from typing import TYPE_CHECKING
+
+from archcheck.application.services.incremental import IncrementalGraph
+from archcheck.application.services.merger import merge
+from archcheck.application.services.parser import parse_directory
+from archcheck.domain.events import Location
+from archcheck.domain.graphs import CallEdge, CallGraph
+from archcheck.domain.merged_graph import EdgeNature
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+    from archcheck.domain.merged_graph import MergedCallGraph
+    from archcheck.domain.static_graph import StaticCallGraph
+
+_SERVICE = """
+from repo import load
+
+def handle():
+    load()
+"""
+
+_REPO = """
+def load():
+    pass
+"""
+
+_UTIL = """
+def helper():
+    pass
+"""
+
+
+def _write(root: Path, files: dict[str, str]) -> None:
+    for name, text in files.items():
+        (root / name).write_text(text)
+
+
+def _edges(graph: StaticCallGraph) -> Counter[tuple[str, str]]:
+    return Counter((e.caller_fqn, e.callee_fqn) for e in graph.edges)
+
+
+def _unresolved(graph: StaticCallGraph) -> Counter[tuple[str, str, str]]:
+    return Counter((u.caller_fqn, u.callee_name, u.reason) for u in graph.unresolved)
+
+
+def _assert_matches_fresh(graph: IncrementalGraph, root: Path) -> None:
+    """Incremental state equals a full parse of the current tree."""
+    codebase, fresh = parse_directory(root)
+    assert dict(graph.codebase.modules) == dict(codebase.modules)
+    assert _edges(graph.static_graph) == _edges(fresh)
+    assert _unresolved(graph.static_graph) == _unresolved(fresh)
+
+
+def _merged(graph: MergedCallGraph | None) -> Counter[tuple[str, str, EdgeNature]]:
+    assert graph is not None
+    return Counter((e.caller_fqn, e.callee_fqn, e.nature) for e in graph.edges)
+
+
+class TestIncrementalGraphInitial:
+    """Tests for the initial parse."""
+
+    def test_matches_parse_directory(self, tmp_path: Path) -> None:
+        """Initial graph is exactly parse_directory()'s."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO, "util.py": _UTIL})
+
+        graph = IncrementalGraph(tmp_path)
+        _codebase, fresh = parse_directory(tmp_path)
+
+        assert graph.static_graph == fresh
+        assert graph.merged_graph is None
+
+
+class TestIncrementalGraphUpdate:
+    """Tests for IncrementalGraph.update()."""
+
+    def test_body_edit_resolves_one_module(self, tmp_path: Path) -> None:
+        """Editing a body leaves importers alone."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO, "util.py": _UTIL})
+        graph = IncrementalGraph(tmp_path)
+
+        (tmp_path / "repo.py").write_text("def load():\n    print()\n")
+        update = graph.update([tmp_path / "repo.py"])
+
+        assert update.changed == ("repo",)
+        assert update.resolved == ("repo",)
+        _assert_matches_fresh(graph, tmp_path)
+
+    def test_interface_change_resolves_importers(self, tmp_path: Path) -> None:
+        """Renaming a function re-resolves the modules that use it."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO, "util.py": _UTIL})
+        graph = IncrementalGraph(tmp_path)
+        assert ("service.handle", "repo.load") in _edges(graph.static_graph)
+
+        (tmp_path / "repo.py").write_text("def fetch():\n    pass\n")
+        update = graph.update([tmp_path / "repo.py"])
+
+        assert set(update.resolved) == {"repo", "service"}
+        assert ("service.handle", "repo.load") not in _edges(graph.static_graph)
+        _assert_matches_fresh(graph, tmp_path)
+
+    def test_base_class_change_resolves_subclass_module(self, tmp_path: Path) -> None:
+        """Giving a grandparent class the method re-resolves inherited calls."""
+        _write(
+            tmp_path,
+            {
+                "base.py": "class Root:\n    pass\n\nclass Base(Root):\n    pass\n",
+                "child.py": (
+                    "from base import Base\n\n"
+                    "class Child(Base):\n    def run(self):\n        self.save()\n"
+                ),
+                "util.py": _UTIL,
+            },
+        )
+        graph = IncrementalGraph(tmp_path)
+        assert ("child.Child.run", "self.save", "method not found") in _unresolved(
+            graph.static_graph,
+        )
+
+        (tmp_path / "base.py").write_text(
+            "class Root:\n    def save(self):\n        pass\n\nclass Base(Root):\n    pass\n",
+        )
+        update = graph.update([tmp_path / "base.py"])
+
+        assert set(update.resolved) == {"base", "child"}
+        assert ("child.Child.run", "base.Root.save") in _edges(graph.static_graph)
+        _assert_matches_fresh(graph, tmp_path)
+
+    def test_added_module_resolves_missing_lookup(self, tmp_path: Path) -> None:
+        """A module that looked up a missing name is re-resolved when it appears."""
+        _write(tmp_path, {"service.py": _SERVICE, "util.py": _UTIL})
+        graph = IncrementalGraph(tmp_path)
+        assert ("service.handle", "load", "external") in _unresolved(graph.static_graph)
+
+        (tmp_path / "repo.py").write_text(_REPO)
+        update = graph.update([tmp_path / "repo.py"])
+
+        assert "service" in update.resolved
+        assert "util" not in update.resolved
+        assert ("service.handle", "repo.load") in _edges(graph.static_graph)
+        _assert_matches_fresh(graph, tmp_path)
+
+    def test_removed_module(self, tmp_path: Path) -> None:
+        """Deleting a file drops its module and re-resolves its importers."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        graph = IncrementalGraph(tmp_path)
+
+        (tmp_path / "repo.py").unlink()
+        update = graph.update([tmp_path / "repo.py"])
+
+        assert update.removed == ("repo",)
+        assert update.resolved == ("service",)
+        assert "repo" not in graph.codebase.modules
+        _assert_matches_fresh(graph, tmp_path)
+
+    def test_parse_error_keeps_last_good_module(self, tmp_path: Path) -> None:
+        """A file mid-edit is reported; its previous module stays."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        graph = IncrementalGraph(tmp_path)
+        before = graph.static_graph
+
+        (tmp_path / "repo.py").write_text("def load(")
+        update = graph.update([tmp_path / "repo.py"])
+
+        assert len(update.errors) == 1
+        assert update.errors[0].path == str(tmp_path / "repo.py")
+        assert update.changed == ()
+        assert graph.static_graph == before
+
+    def test_ignores_untracked_paths(self, tmp_path: Path) -> None:
+        """Non-.py files and excluded directories are not modules."""
+        _write(tmp_path, {"service.py": _SERVICE})
+        (tmp_path / "build").mkdir()
+        (tmp_path / "build" / "gen.py").write_text(_UTIL)
+        (tmp_path / "notes.txt").write_text("")
+        graph = IncrementalGraph(tmp_path)
+
+        update = graph.update([tmp_path / "build" / "gen.py", tmp_path / "notes.txt"])
+
+        assert update.changed == ()
+        assert update.resolved == ()
+
+    def test_edit_sequence_matches_fresh(self, tmp_path: Path) -> None:
+        """Several edits in a row keep the graph equal to a full parse."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO, "util.py": _UTIL})
+        graph = IncrementalGraph(tmp_path)
+
+        edits = [
+            ("util.py", "from service import handle\n\ndef helper():\n    handle()\n"),
+            ("repo.py", "class Repo:\n    def load(self):\n        self.save()\n"),
+            ("service.py", "import util\n\ndef handle():\n    util.helper()\n"),
+            ("repo.py", _REPO),
+        ]
+        for name, text in edits:
+            (tmp_path / name).write_text(text)
+            graph.update([tmp_path / name])
+            _assert_matches_fresh(graph, tmp_path)
+
+
+class TestIncrementalGraphMerged:
+    """Tests for merged_graph with a runtime CallGraph."""
+
+    @staticmethod
+    def _runtime(root: Path) -> CallGraph:
+        edge = CallEdge(
+            caller=Location(file=str(root / "service.py"), line=4, func="handle"),
+            callee=Location(file=str(root / "repo.py"), line=2, func="load"),
+            count=1,
+        )
+        return CallGraph(edges=frozenset({edge}), unmatched=())
+
+    def test_initial_matches_merge(self, tmp_path: Path) -> None:
+        """Initial merged graph has merge()'s edges."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        runtime = self._runtime(tmp_path)
+
+        graph = IncrementalGraph(tmp_path, runtime=runtime)
+        codebase, static = parse_directory(tmp_path)
+
+        merged = _merged(graph.merged_graph)
+        assert merged == _merged(merge(static, runtime, codebase))
+        assert merged[("service.handle", "repo.load", EdgeNature.BOTH)] == 1
+
+    def test_callee_moved_unresolves_runtime_edge(self, tmp_path: Path) -> None:
+        """Moving the callee's def line makes the runtime edge unmatched."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        runtime = self._runtime(tmp_path)
+        graph = IncrementalGraph(tmp_path, runtime=runtime)
+
+        (tmp_path / "repo.py").write_text("\n\n" + _REPO)
+        graph.update([tmp_path / "repo.py"])
+        codebase, static = parse_directory(tmp_path)
+
+        merged = _merged(graph.merged_graph)
+        assert merged == _merged(merge(static, runtime, codebase))
+        assert merged[("service.handle", "repo.load", EdgeNature.STATIC_ONLY)] == 1
+
+    def test_removed_caller(self, tmp_path: Path) -> None:
+        """Deleting the caller's file drops its merged edges."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        runtime = self._runtime(tmp_path)
+        graph = IncrementalGraph(tmp_path, runtime=runtime)
+
+        (tmp_path / "service.py").unlink()
+        graph.update([tmp_path / "service.py"])
+
+        assert _merged(graph.merged_graph) == Counter()
+
+
+class TestIncrementalGraphWatch:
+    """Tests for IncrementalGraph.watch()."""
+
+    def test_yields_edit(self, tmp_path: Path) -> None:
+        """An edit after construction comes out of the next poll."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        graph = IncrementalGraph(tmp_path)
+
+        (tmp_path / "repo.py").write_text("def load():\n    print()\n")
+        os.utime(tmp_path / "repo.py", ns=(0, 0))
+        update = next(graph.watch(interval_s=0.01))
+
+        assert update.changed == ("repo",)
+
+    def test_yields_deletion(self, tmp_path: Path) -> None:
+        """A deleted file is reported as removed."""
+        _write(tmp_path, {"service.py": _SERVICE, "repo.py": _REPO})
+        graph = IncrementalGraph(tmp_path)
+
+        (tmp_path / "repo.py").unlink()
+        update = next(graph.watch(interval_s=0.01))
+
+        assert update.removed == ("repo",)
@@ -3,11 +3,14 @@
 Tests:
 - parse_file: single file parsing
 - parse_directory: directory parsing
+- parse_directory workers: process pool gives the in-process result
+- parse_directory cache_dir: unchanged files loaded from ParseCache
 - build_static_graph: graph construction
-- _compute_module_name: module name calculation
+- compute_module_name: module name calculation
 - Error handling: ParseError on syntax errors
 """
 
+import shutil
 from typing import TYPE_CHECKING
 
 import pytest
@@ -195,6 +198,103 @@ def callee():
         assert any(e.callee_fqn == "main.callee" for e in graph.edges)
 
 
+def _write_package(root: Path, files: int) -> None:
+    (root / "pkg").mkdir()
+    (root / "pkg" / "__init__.py").write_text('"""Package."""')
+    for i in range(files):
+        (root / "pkg" / f"mod{i}.py").write_text(f"import os\n\ndef f{i}():\n    os.getcwd()\n")
+
+
+class TestParseDirectoryWorkers:
+    """Tests for parse_directory(workers=...)."""
+
+    def test_pool_matches_in_process(self, tmp_path: Path) -> None:
+        """Worker processes produce the same codebase, in the same order."""
+        _write_package(tmp_path, 20)
+
+        serial, serial_graph = parse_directory(tmp_path, workers=1)
+        pooled, pooled_graph = parse_directory(tmp_path, workers=3)
+
+        assert list(pooled.modules) == list(serial.modules)
+        assert dict(pooled.modules) == dict(serial.modules)
+        assert pooled_graph == serial_graph
+
+    def test_parse_error_from_worker(self, tmp_path: Path) -> None:
+        """ParseError raised in a worker reaches the caller with its path."""
+        _write_package(tmp_path, 4)
+        broken = tmp_path / "pkg" / "broken.py"
+        broken.write_text("def broken(")
+
+        with pytest.raises(ParseError) as exc_info:
+            parse_directory(tmp_path, workers=2)
+
+        assert exc_info.value.path == str(broken)
+
+    def test_zero_workers_raises(self, tmp_path: Path) -> None:
+        """workers must be >= 1."""
+        with pytest.raises(ValueError, match="workers"):
+            parse_directory(tmp_path, workers=0)
+
+
+class TestParseDirectoryCache:
+    """Tests for parse_directory(cache_dir=...)."""
+
+    def test_cached_run_matches_fresh(self, tmp_path: Path) -> None:
+        """Second run loads every module from the cache, same result."""
+        src = tmp_path / "src"
+        src.mkdir()
+        _write_package(src, 5)
+        cache_dir = tmp_path / "cache"
+
+        fresh, _ = parse_directory(src, cache_dir=cache_dir)
+        cached, _ = parse_directory(src, cache_dir=cache_dir)
+
+        assert len(list(cache_dir.rglob("*.pickle"))) == 6
+        assert dict(cached.modules) == dict(fresh.modules)
+
+    def test_changed_file_reparsed(self, tmp_path: Path) -> None:
+        """A changed file gets a new entry, not the stale Module."""
+        src = tmp_path / "src"
+        src.mkdir()
+        (src / "main.py").write_text("def old(): pass")
+        cache_dir = tmp_path / "cache"
+
+        parse_directory(src, cache_dir=cache_dir)
+        (src / "main.py").write_text("def new(): pass")
+        codebase, _ = parse_directory(src, cache_dir=cache_dir)
+
+        assert [f.name for f in codebase.modules["main"].functions] == ["new"]
+
+    def test_moved_checkout_reuses_entries(self, tmp_path: Path) -> None:
+        """Entries do not depend on the absolute path; Module.path follows the file."""
+        first = tmp_path / "first"
+        first.mkdir()
+        _write_package(first, 2)
+        cache_dir = tmp_path / "cache"
+        parse_directory(first, cache_dir=cache_dir)
+        entries = sorted(cache_dir.rglob("*.pickle"))
+
+        second = tmp_path / "second"
+        shutil.copytree(first, second)
+        codebase, _ = parse_directory(second, cache_dir=cache_dir)
+
+        assert sorted(cache_dir.rglob("*.pickle")) == entries
+        assert codebase.modules["pkg.mod0"].path == second / "pkg" / "mod0.py"
+
+    def test_pool_uses_cache(self, tmp_path: Path) -> None:
+        """Workers read and write the same cache."""
+        src = tmp_path / "src"
+        src.mkdir()
+        _write_package(src, 8)
+        cache_dir = tmp_path / "cache"
+
+        fresh, _ = parse_directory(src, workers=2, cache_dir=cache_dir)
+        cached, _ = parse_directory(src, workers=2, cache_dir=cache_dir)
+
+        assert len(list(cache_dir.rglob("*.pickle"))) == 9
+        assert dict(cached.modules) == dict(fresh.modules)
+
+
 class TestBuildStaticGraph:
     """Tests for build_static_graph()."""
 
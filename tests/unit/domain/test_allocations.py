@@ -0,0 +1,106 @@
+"""Tests for domain/allocations.py.
+
+Tests:
+- AllocationSite invariants (allocated >= 1, freed <= allocated, lifetime count)
+- AllocationSite.live
+- AllocationSnapshot.growth()
+"""
+
+import pytest
+
+from archcheck.domain.allocations import AllocationSite, AllocationSnapshot
+from archcheck.domain.events import CreationInfo, Location
+from archcheck.domain.exceptions import (
+    FreedExceedsAllocatedError,
+    HistogramCountMismatchError,
+    InvalidCountError,
+)
+from archcheck.domain.profile import LatencyBucket, LatencyHistogram
+
+
+def _creation(func: str, type_name: str = "list") -> CreationInfo:
+    location = Location(file="app.py", line=10, func=func)
+    return CreationInfo(location=location, type_name=type_name, traceback=(location,))
+
+
+def _lifetime(count: int) -> LatencyHistogram:
+    return LatencyHistogram(
+        count=count,
+        total_ns=1000 * count,
+        min_ns=1000,
+        max_ns=1000,
+        buckets=(LatencyBucket(lower_ns=512, upper_ns=1024, count=count),),
+    )
+
+
+def _site(func: str, allocated: int, freed: int) -> AllocationSite:
+    return AllocationSite(
+        site=_creation(func),
+        allocated=allocated,
+        freed=freed,
+        lifetime=_lifetime(freed) if freed else None,
+    )
+
+
+class TestAllocationSite:
+    """Tests for AllocationSite."""
+
+    def test_live_is_allocated_minus_freed(self) -> None:
+        """live counts objects not destroyed yet."""
+        assert _site("work", allocated=5, freed=2).live == 3
+
+    def test_zero_allocated_raises(self) -> None:
+        """A site exists only once something was allocated there."""
+        with pytest.raises(InvalidCountError):
+            _site("work", allocated=0, freed=0)
+
+    def test_freed_above_allocated_raises(self) -> None:
+        """freed > allocated raises FreedExceedsAllocatedError."""
+        with pytest.raises(FreedExceedsAllocatedError) as exc_info:
+            _site("work", allocated=2, freed=3)
+        assert exc_info.value.allocated == 2
+        assert exc_info.value.freed == 3
+
+    def test_lifetime_must_count_freed(self) -> None:
+        """Lifetime histogram of another count raises HistogramCountMismatchError."""
+        with pytest.raises(HistogramCountMismatchError):
+            AllocationSite(site=_creation("work"), allocated=3, freed=2, lifetime=_lifetime(1))
+        with pytest.raises(HistogramCountMismatchError):
+            AllocationSite(site=_creation("work"), allocated=3, freed=1, lifetime=None)
+
+
+class TestAllocationSnapshot:
+    """Tests for AllocationSnapshot.growth()."""
+
+    def test_growth_reports_increases_only(self) -> None:
+        """Grown and new sites are reported, largest increase first."""
+        earlier = AllocationSnapshot(
+            sites=(_site("steady", 4, 0), _site("leaky", 2, 0), _site("shrinking", 5, 0)),
+            live_objects=11,
+        )
+        later = AllocationSnapshot(
+            sites=(
+                _site("steady", 6, 2),
+                _site("leaky", 9, 1),
+                _site("shrinking", 5, 4),
+                _site("new", 3, 0),
+            ),
+            live_objects=16,
+        )
+
+        growth = later.growth(earlier)
+
+        assert [(site.site.location.func, delta) for site, delta in growth] == [
+            ("leaky", 6),
+            ("new", 3),
+        ]
+
+    def test_same_stack_other_type_is_another_site(self) -> None:
+        """Sites are matched by creation stack AND type."""
+        earlier = AllocationSnapshot(sites=(_site("work", 3, 0),), live_objects=3)
+        dict_site = AllocationSite(
+            site=_creation("work", "dict"), allocated=1, freed=0, lifetime=None
+        )
+        later = AllocationSnapshot(sites=(_site("work", 3, 0), dict_site), live_objects=4)
+
+        assert later.growth(earlier) == ((dict_site, 1),)
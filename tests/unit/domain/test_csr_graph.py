@@ -0,0 +1,131 @@
+"""Tests for domain/csr_graph.py.
+
+Tests:
+- from_edges() interning and deduplication
+- Successors/predecessors ascending, degrees
+- Strongly connected components and cycles
+- Shape validation (FAIL-FIRST)
+"""
+
+import pytest
+
+from archcheck.domain.csr_graph import CsrGraph
+
+
+class TestCsrGraphBuild:
+    """Tests for from_edges()."""
+
+    def test_ids_follow_first_appearance(self) -> None:
+        """Node ids are assigned in first-appearance order."""
+        graph = CsrGraph.from_edges([("b", "a"), ("c", "a")])
+
+        assert graph.names == ("b", "a", "c")
+        assert graph.ids == {"b": 0, "a": 1, "c": 2}
+        assert len(graph) == 3
+
+    def test_duplicates_collapse(self) -> None:
+        """Repeated edges are stored once."""
+        graph = CsrGraph.from_edges([("a", "b"), ("a", "b"), ("b", "a")])
+
+        assert graph.edge_count == 2
+        assert list(graph.successors(0)) == [1]
+
+    def test_empty(self) -> None:
+        """No edges, no nodes."""
+        graph = CsrGraph.from_edges([])
+
+        assert len(graph) == 0
+        assert graph.edge_count == 0
+        assert graph.strongly_connected_components() == ()
+
+
+class TestCsrGraphAdjacency:
+    """Tests for neighbour and degree queries."""
+
+    def test_both_directions_ascending(self) -> None:
+        """Successors and predecessors are sorted by id."""
+        graph = CsrGraph.from_edges([("a", "d"), ("a", "c"), ("a", "b"), ("c", "b")])
+        a, b, c, d = (graph.ids[name] for name in "abcd")
+
+        assert list(graph.successors(a)) == sorted([b, c, d])
+        assert list(graph.predecessors(b)) == sorted([a, c])
+        assert list(graph.successors(d)) == []
+
+    def test_degrees(self) -> None:
+        """fan_out/fan_in count distinct neighbours."""
+        graph = CsrGraph.from_edges([("a", "b"), ("a", "c"), ("c", "b")])
+
+        assert graph.fan_out(graph.ids["a"]) == 2
+        assert graph.fan_in(graph.ids["b"]) == 2
+        assert graph.fan_in(graph.ids["a"]) == 0
+
+
+class TestCsrGraphComponents:
+    """Tests for SCC and cycle detection."""
+
+    def test_components_reverse_topological(self) -> None:
+        """Each node in one component; callees' components come first."""
+        graph = CsrGraph.from_edges([("a", "b"), ("b", "c"), ("c", "b"), ("c", "d")])
+        ids = graph.ids
+
+        components = graph.strongly_connected_components()
+
+        assert components == (
+            (ids["d"],),
+            tuple(sorted((ids["b"], ids["c"]))),
+            (ids["a"],),
+        )
+
+    def test_cycles_include_self_loops(self) -> None:
+        """Single nodes count only with a self-loop."""
+        graph = CsrGraph.from_edges([("a", "a"), ("a", "b"), ("c", "d"), ("d", "c")])
+        ids = graph.ids
+
+        assert set(graph.cycles()) == {(ids["a"],), (ids["c"], ids["d"])}
+
+    def test_deep_chain_no_recursion_limit(self) -> None:
+        """Iterative traversal handles chains deeper than the recursion limit."""
+        n = 5000
+        graph = CsrGraph.from_edges([(f"f{i}", f"f{i + 1}") for i in range(n)] + [(f"f{n}", "f0")])
+
+        assert graph.cycles() == (tuple(range(n + 1)),)
+
+
+class TestCsrGraphValidation:
+    """Tests for __post_init__ checks."""
+
+    def test_offsets_length(self) -> None:
+        """Offsets must have one entry per node plus one."""
+        with pytest.raises(ValueError, match="out_offsets must have 2 entries"):
+            CsrGraph(
+                names=("a",), out_offsets=[0], out_targets=[], in_offsets=[0, 0], in_sources=[]
+            )
+
+    def test_offsets_ascending(self) -> None:
+        """Offsets must not decrease."""
+        with pytest.raises(ValueError, match="in_offsets must be ascending"):
+            CsrGraph(
+                names=("a", "b"),
+                out_offsets=[0, 1, 1],
+                out_targets=[1],
+                in_offsets=[0, 2, 1],
+                in_sources=[0],
+            )
+
+    def test_target_out_of_range(self) -> None:
+        """Adjacency ids must name nodes."""
+        with pytest.raises(ValueError, match="out adjacency refers"):
+            CsrGraph(
+                names=("a",), out_offsets=[0, 1], out_targets=[5], in_offsets=[0, 0], in_sources=[]
+            )
+
+    def test_unique_names(self) -> None:
+        """Names are interned once."""
+        with pytest.raises(ValueError, match="unique"):
+            CsrGraph(
+                names=("a", "a"),
+                out_offsets=[0, 0, 0],
+                out_targets=[],
+                in_offsets=[0, 0, 0],
+                in_sources=[],
+            )
@@ -0,0 +1,199 @@
+"""Tests for domain/diff.py.
+
+Tests:
+- merge_join() full outer join, FAIL-FIRST on unsorted or duplicate keys
+- diff_edges() new/removed/changed edges, ranking, limit
+- diff_sites() growth from snapshots, object flows and mappings
+- diff_latency() mean and percentile shifts
+- Keys match equal content across runs
+"""
+
+import pytest
+
+from archcheck.domain.allocations import AllocationSite, AllocationSnapshot
+from archcheck.domain.diff import (
+    EdgeDelta,
+    TraceDiff,
+    diff_edges,
+    diff_latency,
+    diff_sites,
+    location_key,
+    merge_join,
+)
+from archcheck.domain.events import Location
+from archcheck.domain.exceptions import MissingDiffSideError, UnsortedKeysError
+from archcheck.domain.graphs import CallEdge, CallGraph, ObjectFlow, ObjectLifecycle
+from archcheck.domain.profile import FunctionProfile, LatencyBucket, LatencyHistogram, Profile
+from tests.factories import make_create_event, make_creation_info, make_destroy_event
+
+
+def _loc(func: str) -> Location:
+    # Fresh strings: keys must match by content, not identity
+    return Location(file="".join(["app", ".py"]), line=len(func), func="".join([func]))
+
+
+def _graph(**counts: int) -> CallGraph:
+    """Edges main → <name> with the given counts."""
+    edges = frozenset(
+        CallEdge(caller=_loc("main"), callee=_loc(name), count=count)
+        for name, count in counts.items()
+    )
+    return CallGraph(edges=edges, unmatched=())
+
+
+def _histogram(ns: int, count: int = 1) -> LatencyHistogram:
+    bucket = LatencyBucket(lower_ns=ns, upper_ns=ns + 1, count=count)
+    return LatencyHistogram(
+        count=count, total_ns=ns * count, min_ns=ns, max_ns=ns, buckets=(bucket,)
+    )
+
+
+def _profile(**means: int) -> Profile:
+    functions = tuple(
+        FunctionProfile(function=_loc(name), inclusive=_histogram(ns), exclusive=_histogram(ns))
+        for name, ns in means.items()
+    )
+    return Profile(functions=functions, clock="monotonic")
+
+
+class TestMergeJoin:
+    """Tests for merge_join()."""
+
+    def test_full_outer_join_in_key_order(self) -> None:
+        """Every key once, None for the missing side."""
+        joined = list(merge_join([(1, "a"), (3, "c")], [(2, "B"), (3, "C"), (4, "D")]))
+
+        assert joined == [
+            (1, "a", None),
+            (2, None, "B"),
+            (3, "c", "C"),
+            (4, None, "D"),
+        ]
+
+    def test_empty_inputs(self) -> None:
+        """Either side may be empty."""
+        assert list(merge_join([], [(1, "x")])) == [(1, None, "x")]
+        assert list(merge_join([(1, "x")], [])) == [(1, "x", None)]
+        assert list(merge_join([], [])) == []
+
+    def test_streams_lazily(self) -> None:
+        """Inputs are consumed as the join advances (generators accepted)."""
+        consumed: list[int] = []
+
+        def stream() -> object:
+            for key in range(1_000_000):
+                consumed.append(key)
+                yield key, key
+
+        joined = merge_join(stream(), iter([(0, 0)]))  # type: ignore[arg-type]
+
+        assert next(joined) == (0, 0, 0)
+        assert len(consumed) <= 2
+
+    def test_unsorted_raises(self) -> None:
+        """A descending key is a FAIL-FIRST error naming the side."""
+        with pytest.raises(UnsortedKeysError, match="after keys") as exc_info:
+            list(merge_join([(1, "a")], [(2, "b"), (1, "c")]))
+
+        assert exc_info.value.key == 1
+
+    def test_duplicate_raises(self) -> None:
+        """Duplicate keys are rejected too."""
+        with pytest.raises(UnsortedKeysError, match="before keys"):
+            list(merge_join([(1, "a"), (1, "b")], []))
+
+
+class TestDiffEdges:
+    """Tests for diff_edges()."""
+
+    def test_new_removed_changed(self) -> None:
+        """Unchanged edges are dropped; the rest split by kind."""
+        before = _graph(same=5, gone=2, more=3)
+        after = _graph(same=5, more=10, fresh=1)
+
+        diff = TraceDiff(edges=diff_edges(before, after))
+
+        assert [delta.edge.callee.func for delta in diff.new_edges] == ["fresh"]
+        assert [delta.edge.callee.func for delta in diff.removed_edges] == ["gone"]
+        assert [(d.edge.callee.func, d.count_delta) for d in diff.changed_edges] == [("more", 7)]
+
+    def test_ranked_by_absolute_change(self) -> None:
+        """Largest |count_delta| first, drops and rises alike."""
+        deltas = diff_edges(_graph(a=100, b=1), _graph(a=10, b=50, c=5))
+
+        assert [delta.count_delta for delta in deltas] == [-90, 49, 5]
+
+    def test_limit_keeps_top(self) -> None:
+        """limit keeps the largest changes only."""
+        deltas = diff_edges(_graph(), _graph(a=1, b=2, c=3), limit=2)
+
+        assert [delta.after.count for delta in deltas if delta.after] == [3, 2]
+
+    def test_edge_delta_needs_a_side(self) -> None:
+        """EdgeDelta without either edge is invalid."""
+        with pytest.raises(MissingDiffSideError):
+            EdgeDelta(before=None, after=None)
+
+
+class TestDiffSites:
+    """Tests for diff_sites()."""
+
+    def test_snapshots(self) -> None:
+        """Growth of live objects per site, shrinking sites omitted."""
+
+        def snapshot(**live: int) -> AllocationSnapshot:
+            sites = tuple(
+                AllocationSite(
+                    site=make_creation_info(func=func), allocated=n, freed=0, lifetime=None
+                )
+                for func, n in live.items()
+            )
+            return AllocationSnapshot(sites=sites, live_objects=sum(live.values()))
+
+        growth = diff_sites(snapshot(a=5, b=5), snapshot(a=2, b=9, c=4))
+
+        ranked = [(delta.site.location.func, delta.growth) for delta in growth]
+        assert ranked == [("b", 4), ("c", 4)]
+        assert growth[0].before == 5
+        assert growth[1].before == 0
+
+    def test_object_flow(self) -> None:
+        """ObjectFlow sites are (creation location, type); destroyed objects do not count."""
+        alive = make_create_event(obj_id=1)
+        freed = make_create_event(obj_id=2)
+        flow = ObjectFlow(
+            objects={
+                1: ObjectLifecycle(1, "TestClass", alive, None, ()),
+                2: ObjectLifecycle(2, "TestClass", freed, make_destroy_event(obj_id=2), ()),
+            },
+            orphan_destroys=(),
+        )
+
+        (delta,) = diff_sites({}, flow)
+
+        assert delta.site == make_creation_info()
+        assert (delta.before, delta.after) == (0, 1)
+
+
+class TestDiffLatency:
+    """Tests for diff_latency()."""
+
+    def test_shifts_of_common_functions(self) -> None:
+        """Only functions in both profiles; slowest regression first."""
+        shifts = diff_latency(_profile(a=100, b=100, old=5), _profile(a=90, b=400, new=7))
+
+        assert [shift.function.func for shift in shifts] == ["b", "a"]
+        assert shifts[0].mean_shift_ns == 300
+        assert shifts[1].percentile_shift_ns(50) == -10
+
+
+class TestKeys:
+    """Tests for key construction."""
+
+    def test_equal_locations_share_interned_key(self) -> None:
+        """Equal content gives the same key strings (identity)."""
+        first, second = location_key(_loc("f")), location_key(_loc("f"))
+
+        assert first == second
+        assert first[0] is second[0]
+        assert first[2] is second[2]
@@ -0,0 +1,267 @@
+"""Tests for EventColumns (columnar stop() result).
+
+Tests:
+- Row accessors and materialization to domain events
+- Creation stacks shared through the stack table, flyweights
+- select() keeps args and field errors aligned
+- Invariants validated in __post_init__ (FAIL-FIRST)
+"""
+
+from array import array
+
+import pytest
+
+from archcheck.domain.events import (
+    COLUMN_FORMATS,
+    ArgInfo,
+    CallEvent,
+    DestroyEvent,
+    EventColumns,
+    EventType,
+    FieldError,
+    Location,
+    ReturnEvent,
+)
+from tests.factories import (
+    make_call_event,
+    make_create_event,
+    make_creation_info,
+    make_destroy_event,
+    make_location,
+    make_output_error,
+    make_return_event,
+)
+from tests.factories import make_event_columns as make_columns
+
+ERROR = FieldError(field="file", exc_type="UnicodeDecodeError", exc_msg="bad")
+
+EVENTS = (
+    make_call_event(
+        file="a.py",
+        line=1,
+        func="f",
+        caller_file="main.py",
+        caller_line=9,
+        caller_func="main",
+        args=(
+            ArgInfo(name="x", obj_id=10, type_name="int"),
+            ArgInfo(name="y", obj_id=20, type_name=None),
+        ),
+        errors=(ERROR,),
+    ),
+    make_create_event(file="a.py", line=2, func="f", obj_id=30, type_name="Foo"),
+    make_call_event(
+        file="b.py", line=3, func="g", args=(ArgInfo(name="z", obj_id=30, type_name="Foo"),)
+    ),
+    make_return_event(file="b.py", line=3, func="g", return_id=None, return_type=None),
+    make_return_event(file="a.py", line=1, func="f", return_id=30, return_type="Foo"),
+    make_destroy_event(file=None, line=0, func=None, obj_id=30, type_name="Foo"),
+)
+
+
+def _empty_column(name: str) -> memoryview:
+    return memoryview(array(COLUMN_FORMATS[name]))
+
+
+class TestEventColumnsAccess:
+    """Tests for row accessors."""
+
+    def test_len_and_event_type(self) -> None:
+        """One row per event, kinds in order."""
+        columns = make_columns(events=EVENTS)
+
+        assert len(columns) == len(EVENTS)
+        assert [columns.event_type(i) for i in range(len(columns))] == [
+            EventType.CALL,
+            EventType.CREATE,
+            EventType.CALL,
+            EventType.RETURN,
+            EventType.RETURN,
+            EventType.DESTROY,
+        ]
+
+    def test_location_and_caller(self) -> None:
+        """Locations resolve string indices; missing caller is None."""
+        columns = make_columns(events=EVENTS)
+
+        assert columns.location(0) == Location(file="a.py", line=1, func="f")
+        assert columns.caller(0) == Location(file="main.py", line=9, func="main")
+        assert columns.location(5) == Location(file=None, line=0, func=None)
+        assert columns.strings[0] is None
+
+    def test_strings_deduplicated(self) -> None:
+        """Repeated file names share one string index."""
+        columns = make_columns(events=EVENTS)
+
+        assert columns.file[0] == columns.file[1] == columns.file[4]
+        assert len(set(columns.strings)) == len(columns.strings)
+
+    def test_arg_offsets(self) -> None:
+        """Args of row i start at arg_offsets[i]."""
+        columns = make_columns(events=EVENTS)
+
+        assert list(columns.arg_count) == [2, 0, 1, 0, 0, 0]
+        assert columns.arg_offsets[2] == 2
+        assert columns.arg_id[columns.arg_offsets[2]] == 30
+
+    def test_to_result_roundtrip(self) -> None:
+        """Materialized events equal the originals."""
+        columns = make_columns(events=EVENTS, output_errors=(make_output_error(),))
+
+        result = columns.to_result()
+
+        assert result.events == EVENTS
+        assert result.output_errors == columns.output_errors
+
+    def test_return_without_value(self) -> None:
+        """obj_id 0 on RETURN materializes as no return value."""
+        event = make_columns(events=EVENTS).event(3)
+
+        assert isinstance(event, ReturnEvent)
+        assert event.return_id is None
+        assert event.return_type is None
+
+
+class TestEventColumnsCreation:
+    """Tests for DESTROY creation context (stack table)."""
+
+    BOTTOM = make_location(file="main.py", line=1, func="main")
+
+    def _destroy(self, obj_id: int, line: int) -> DestroyEvent:
+        top = make_location(file="a.py", line=line, func="f")
+        creation = make_creation_info(
+            file="a.py", line=line, func="f", traceback=(top, self.BOTTOM)
+        )
+        return make_destroy_event(obj_id=obj_id, creation=creation)
+
+    def test_creation_roundtrip(self) -> None:
+        """Creation location, type and traceback survive the columns."""
+        event = self._destroy(1, 5)
+
+        assert make_columns(events=(event,)).event(0) == event
+
+    def test_shared_frames_stored_once(self) -> None:
+        """Tracebacks with a common bottom share its stack entry."""
+        columns = make_columns(events=(self._destroy(1, 5), self._destroy(2, 6)))
+
+        first, second = columns.creation
+        assert len(columns.stack_parent) == 2 + 3
+        assert columns.stack_parent[first] == columns.stack_parent[second]
+
+    def test_flyweights(self) -> None:
+        """Equal creation contexts and locations are one object."""
+        columns = make_columns(events=(self._destroy(1, 5), self._destroy(1, 5)))
+
+        first, second = columns.event(0), columns.event(1)
+        assert isinstance(first, DestroyEvent)
+        assert isinstance(second, DestroyEvent)
+        assert first.creation is second.creation
+        assert first.location is second.location
+
+    def test_empty_stack_and_none(self) -> None:
+        """Empty traceback → no location; no creation context → None."""
+        empty = make_destroy_event(obj_id=1, creation=make_creation_info(traceback=()))
+        columns = make_columns(events=(empty, make_destroy_event(obj_id=2)))
+
+        assert list(columns.creation) == [1, 0]
+        info = columns.creation_info(0)
+        assert info is not None
+        assert info.traceback == ()
+        assert info.location == Location(file=None, line=0, func=None)
+        assert columns.creation_info(1) is None
+
+
+class TestEventColumnsSelect:
+    """Tests for select()."""
+
+    def test_select_keeps_args(self) -> None:
+        """Selected CALL rows keep their own args."""
+        columns = make_columns(events=EVENTS)
+
+        selected = columns.select([2, 4])
+
+        assert len(selected) == 2
+        call = selected.event(0)
+        assert isinstance(call, CallEvent)
+        assert call.args == EVENTS[2].args
+        assert list(selected.arg_offsets) == [0, 1, 1]
+
+    def test_select_remaps_errors(self) -> None:
+        """Field errors follow their row to its new index."""
+        columns = make_columns(events=(EVENTS[1], EVENTS[0]))
+
+        assert columns.errors == ((1, (ERROR,)),)
+        assert columns.select([1]).errors == ((0, (ERROR,)),)
+        assert columns.select([0]).errors == ()
+
+    def test_select_keeps_creation(self) -> None:
+        """Stack table kept whole: selected DESTROY rows keep their creation."""
+        event = make_destroy_event(
+            obj_id=1, creation=make_creation_info(traceback=(make_location(),))
+        )
+        columns = make_columns(events=(EVENTS[0], event))
+
+        assert columns.select([1]).event(0) == columns.event(1)
+
+    def test_select_nothing(self) -> None:
+        """Empty selection is a valid empty EventColumns."""
+        selected = make_columns(events=EVENTS).select([])
+
+        assert len(selected) == 0
+        assert selected.to_result().events == ()
+
+
+class TestEventColumnsFailFirst:
+    """Tests for invariants (FAIL-FIRST)."""
+
+    def test_row_column_length_mismatch_raises(self) -> None:
+        """All row columns must have the same length."""
+        columns = {name: _empty_column(name) for name in COLUMN_FORMATS}
+        columns["line"] = memoryview(array("i", [1]))
+
+        with pytest.raises(ValueError, match="column line"):
+            EventColumns(**columns, strings=(None,), errors=(), output_errors=())
+
+    def test_arg_columns_must_cover_arg_count(self) -> None:
+        """sum(arg_count) args required."""
+        columns = {
+            name: memoryview(array(COLUMN_FORMATS[name], [0])) for name in COLUMN_FORMATS
+        }
+        columns["arg_count"] = memoryview(array("H", [2]))
+
+        with pytest.raises(ValueError, match="column arg_id"):
+            EventColumns(**columns, strings=(None,), errors=(), output_errors=())
+
+    def test_stack_column_length_mismatch_raises(self) -> None:
+        """All stack columns must have the same length."""
+        columns = {name: _empty_column(name) for name in COLUMN_FORMATS}
+        columns["stack_line"] = memoryview(array("i", [0]))
+
+        with pytest.raises(ValueError, match="column stack_line"):
+            EventColumns(**columns, strings=(None,), errors=(), output_errors=())
+
+    def test_creation_outside_stack_table_raises(self) -> None:
+        """Every creation entry must exist in the stack table."""
+        columns = make_columns(events=(make_destroy_event(),))
+        raw = {name: getattr(columns, name) for name in COLUMN_FORMATS}
+        raw["creation"] = memoryview(array("I", [len(columns.stack_parent)]))
+
+        with pytest.raises(ValueError, match="column creation"):
+            EventColumns(**raw, strings=columns.strings, errors=(), output_errors=())
+
+    def test_strings_must_start_with_none(self) -> None:
+        """Index 0 is reserved for None."""
+        columns = {name: _empty_column(name) for name in COLUMN_FORMATS}
+
+        with pytest.raises(ValueError, match="strings"):
+            EventColumns(**columns, strings=("x",), errors=(), output_errors=())
+
+    def test_create_without_type_raises(self) -> None:
+        """CREATE row must carry a type name."""
+        columns = make_columns(events=(make_create_event(),))
+        raw = {name: getattr(columns, name) for name in COLUMN_FORMATS}
+        raw["type_name"] = memoryview(array("I", [0]))
+        broken = EventColumns(**raw, strings=columns.strings, errors=(), output_errors=())
+
+        with pytest.raises(ValueError, match="without type name"):
+            broken.event(0)
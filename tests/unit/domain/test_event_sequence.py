@@ -0,0 +1,171 @@
+"""Tests for EventSequence (lazy events over EventColumns).
+
+Tests:
+- Sequence protocol: len, index, slice, iteration
+- Events built on access only
+- of_type() filters by kind column
+- Equality with tuples, isinstance and match on materialized events
+"""
+
+from contextlib import AbstractContextManager
+from unittest.mock import MagicMock, patch
+
+from archcheck.domain.events import (
+    CallEvent,
+    CreateEvent,
+    DestroyEvent,
+    EventColumns,
+    EventSequence,
+    EventType,
+    ReturnEvent,
+    TrackingResult,
+)
+from tests.factories import (
+    make_call_event,
+    make_create_event,
+    make_destroy_event,
+    make_return_event,
+)
+from tests.factories import make_event_columns as make_columns
+
+EVENTS = (
+    make_call_event(file="a.py", line=1, func="f"),
+    make_create_event(obj_id=30, type_name="Foo"),
+    make_return_event(file="a.py", line=1, func="f", return_id=30, return_type="Foo"),
+    make_destroy_event(obj_id=30, type_name="Foo"),
+)
+
+
+def _count_events() -> AbstractContextManager[MagicMock]:
+    """Record every EventColumns.event() call (events still built)."""
+    return patch.object(EventColumns, "event", autospec=True, side_effect=EventColumns.event)
+
+
+class TestEventSequenceProtocol:
+    """Tests for the Sequence protocol."""
+
+    def test_len_index_iter(self) -> None:
+        """Same events as the tuple they encode, in order."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        assert len(events) == len(EVENTS)
+        assert events[0] == EVENTS[0]
+        assert events[-1] == EVENTS[-1]
+        assert list(events) == list(EVENTS)
+
+    def test_slice_is_lazy_view(self) -> None:
+        """Slicing gives another EventSequence over the same columns."""
+        columns = make_columns(events=EVENTS)
+        events = EventSequence(columns)
+
+        sliced = events[1:3]
+
+        assert isinstance(sliced, EventSequence)
+        assert sliced.columns is columns
+        assert tuple(sliced) == EVENTS[1:3]
+        assert sliced[::-1] == EVENTS[1:3][::-1]
+
+    def test_equality_with_tuple(self) -> None:
+        """Compares equal to a tuple of equal events, both ways."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        assert events == EVENTS
+        assert EVENTS == events
+        assert events != EVENTS[:-1]
+        assert hash(events) == hash(EVENTS)
+
+    def test_tracking_results_compare_equal(self) -> None:
+        """TrackingResult with lazy events equals the tuple-based one."""
+        lazy = make_columns(events=EVENTS).to_result()
+
+        assert isinstance(lazy.events, EventSequence)
+        assert lazy == TrackingResult(events=EVENTS, output_errors=())
+
+
+class TestEventSequenceLaziness:
+    """Tests for on-demand materialization."""
+
+    def test_len_and_slice_build_nothing(self) -> None:
+        """len(), slicing and of_type() read only row indices."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        with _count_events() as event:
+            assert len(events[1:]) == 3
+            assert len(events.of_type(EventType.CALL)) == 1
+
+        event.assert_not_called()
+
+    def test_index_builds_one(self) -> None:
+        """Indexing builds exactly that row."""
+        columns = make_columns(events=EVENTS)
+
+        with _count_events() as event:
+            _ = EventSequence(columns)[2]
+
+        event.assert_called_once_with(columns, 2)
+
+    def test_repr_builds_nothing(self) -> None:
+        """repr shows the size only."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        with _count_events() as event:
+            assert repr(events) == "EventSequence(4 events)"
+
+        event.assert_not_called()
+
+
+class TestEventSequenceOfType:
+    """Tests for of_type()."""
+
+    def test_of_type_keeps_order(self) -> None:
+        """Only events of the given types, in row order."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        lifecycle = events.of_type(EventType.CREATE, EventType.DESTROY)
+
+        assert tuple(lifecycle) == (EVENTS[1], EVENTS[3])
+        assert list(lifecycle.rows) == [1, 3]
+
+    def test_of_type_on_slice(self) -> None:
+        """of_type() on a view filters within the view."""
+        events = EventSequence(make_columns(events=EVENTS))[2:]
+
+        assert tuple(events.of_type(EventType.CREATE)) == ()
+        assert tuple(events.of_type(EventType.RETURN)) == (EVENTS[2],)
+
+    def test_to_columns(self) -> None:
+        """Full view returns its columns; a partial view selects its rows."""
+        columns = make_columns(events=EVENTS)
+        events = EventSequence(columns)
+
+        assert events.to_columns() is columns
+        assert events.of_type(EventType.CALL).to_columns().to_result().events == EVENTS[:1]
+
+
+class TestEventSequenceEvents:
+    """Materialized events are the ordinary domain dataclasses."""
+
+    def test_isinstance_and_match(self) -> None:
+        """isinstance and structural match see the concrete event types."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        assert isinstance(events[0], CallEvent)
+        kinds = []
+        for event in events:
+            match event:
+                case CallEvent():
+                    kinds.append(EventType.CALL)
+                case ReturnEvent(return_id=30):
+                    kinds.append(EventType.RETURN)
+                case CreateEvent(type_name="Foo"):
+                    kinds.append(EventType.CREATE)
+                case DestroyEvent():
+                    kinds.append(EventType.DESTROY)
+
+        assert kinds == [EventType.CALL, EventType.CREATE, EventType.RETURN, EventType.DESTROY]
+
+    def test_locations_shared(self) -> None:
+        """Equal locations of different rows are one object."""
+        events = EventSequence(make_columns(events=EVENTS))
+
+        assert events[0].location is events[2].location
@@ -1,7 +1,7 @@
 """Tests for domain/graphs.py.
 
 Tests:
-- CallEdge invariants (count >= 1)
+- CallEdge invariants (count >= 1, total_ns >= 0)
 - CallEdge immutability
 - CallEdge equality based on caller/callee
 - CallGraph immutability and structure
@@ -65,6 +65,22 @@ class TestCallEdge:
         with pytest.raises(ValueError, match="count must be >= 1"):
             CallEdge(caller=caller, callee=callee, count=-1)
 
+    def test_total_ns_defaults_to_none(self) -> None:
+        """CallEdge without timing has total_ns None (not measured)."""
+        caller = Location(file="a.py", line=10, func="foo")
+        callee = Location(file="b.py", line=20, func="bar")
+
+        assert CallEdge(caller=caller, callee=callee, count=1).total_ns is None
+        assert CallEdge(caller=caller, callee=callee, count=3, total_ns=0).total_ns == 0
+
+    def test_total_ns_negative_raises(self) -> None:
+        """CallEdge with negative total_ns raises ValueError (FAIL-FIRST)."""
+        caller = Location(file="a.py", line=10, func="foo")
+        callee = Location(file="b.py", line=20, func="bar")
+
+        with pytest.raises(ValueError, match="total_ns must be >= 0"):
+            CallEdge(caller=caller, callee=callee, count=1, total_ns=-1)
+
     def test_frozen_immutable(self) -> None:
         """CallEdge is frozen (immutable)."""
         caller = Location(file="a.py", line=10, func="foo")
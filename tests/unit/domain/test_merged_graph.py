@@ -4,6 +4,7 @@ Tests:
 - EdgeNature enum exhaustive
 - MergedCallEdge invariant (static OR runtime present)
 - MergedCallGraph indexes computed
+- MergedCallGraph FQN views over the CSR core (fan-in/out, cycles)
 """
 
 import pytest
@@ -286,3 +287,60 @@ class TestMergedCallGraph:
 
         with pytest.raises(AttributeError):
             graph.edges = ()  # type: ignore[misc]
+
+
+def _runtime_edge(caller: str, callee: str) -> MergedCallEdge:
+    """RUNTIME_ONLY edge caller → callee."""
+    runtime = CallEdge(
+        caller=Location(file="test.py", line=1, func=caller),
+        callee=Location(file="test.py", line=2, func=callee),
+        count=1,
+    )
+    return MergedCallEdge(
+        caller_fqn=caller,
+        callee_fqn=callee,
+        static=None,
+        runtime=runtime,
+        nature=EdgeNature.RUNTIME_ONLY,
+    )
+
+
+class TestMergedCallGraphCsr:
+    """Tests for the FQN API on top of the CSR core."""
+
+    def test_views_match_edges(self) -> None:
+        """by_caller/by_callee hold only nodes with neighbours in that direction."""
+        graph = MergedCallGraph(edges=(_runtime_edge("a", "b"), _runtime_edge("a", "c")))
+
+        assert graph.by_caller == {"a": frozenset({"b", "c"})}
+        assert graph.by_callee == {"b": frozenset({"a"}), "c": frozenset({"a"})}
+        assert "b" not in graph.by_caller
+        assert graph.by_caller.get("b") is None
+        assert len(graph.by_callee) == 2
+        with pytest.raises(KeyError):
+            _ = graph.by_caller["missing"]
+
+    def test_fan_in_fan_out(self) -> None:
+        """Degrees count distinct neighbours; unknown FQNs have degree 0."""
+        graph = MergedCallGraph(
+            edges=(_runtime_edge("a", "b"), _runtime_edge("a", "b"), _runtime_edge("c", "b"))
+        )
+
+        assert graph.fan_out("a") == 1
+        assert graph.fan_in("b") == 2
+        assert graph.fan_in("missing") == 0
+        assert graph.graph.edge_count == 2
+
+    def test_cycles(self) -> None:
+        """Mutual and self recursion are cycles; a chain is not."""
+        graph = MergedCallGraph(
+            edges=(
+                _runtime_edge("a", "b"),
+                _runtime_edge("b", "a"),
+                _runtime_edge("b", "c"),
+                _runtime_edge("d", "d"),
+            )
+        )
+
+        assert set(graph.cycles()) == {frozenset({"a", "b"}), frozenset({"d"})}
+        assert MergedCallGraph.empty().cycles() == ()
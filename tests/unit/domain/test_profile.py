@@ -0,0 +1,141 @@
+"""Tests for domain/profile.py.
+
+Tests:
+- LatencyBucket invariants (0 <= lower < upper, count >= 1)
+- LatencyHistogram invariants (count >= 1, bucket sum, min <= max)
+- LatencyHistogram percentile and mean
+- FunctionProfile inclusive/exclusive count match
+"""
+
+import pytest
+
+from archcheck.domain.events import Location
+from archcheck.domain.exceptions import (
+    HistogramCountMismatchError,
+    InvalidBucketError,
+    InvalidCountError,
+    InvalidDurationError,
+    InvalidPercentileError,
+)
+from archcheck.domain.profile import (
+    FunctionProfile,
+    LatencyBucket,
+    LatencyHistogram,
+    Profile,
+)
+
+
+def _histogram(*buckets: tuple[int, int, int], min_ns: int, max_ns: int) -> LatencyHistogram:
+    """Histogram from (lower, upper, count) triples; total is a plausible midpoint sum."""
+    entries = tuple(LatencyBucket(lower_ns=lo, upper_ns=hi, count=n) for lo, hi, n in buckets)
+    return LatencyHistogram(
+        count=sum(b.count for b in entries),
+        total_ns=sum(b.lower_ns * b.count for b in entries),
+        min_ns=min_ns,
+        max_ns=max_ns,
+        buckets=entries,
+    )
+
+
+class TestLatencyBucket:
+    """Tests for LatencyBucket."""
+
+    def test_valid_bucket(self) -> None:
+        """Bucket with lower < upper and count >= 1."""
+        bucket = LatencyBucket(lower_ns=8, upper_ns=9, count=3)
+        assert bucket.count == 3
+
+    @pytest.mark.parametrize(("lower", "upper"), [(5, 5), (9, 8), (-1, 4)])
+    def test_invalid_bounds_raise(self, lower: int, upper: int) -> None:
+        """Empty, reversed or negative bounds raise InvalidBucketError."""
+        with pytest.raises(InvalidBucketError) as exc_info:
+            LatencyBucket(lower_ns=lower, upper_ns=upper, count=1)
+        assert exc_info.value.lower_ns == lower
+        assert exc_info.value.upper_ns == upper
+
+    def test_zero_count_raises(self) -> None:
+        """Empty buckets are never reported."""
+        with pytest.raises(InvalidCountError):
+            LatencyBucket(lower_ns=0, upper_ns=1, count=0)
+
+
+class TestLatencyHistogram:
+    """Tests for LatencyHistogram."""
+
+    def test_bucket_sum_must_match_count(self) -> None:
+        """Buckets summing to another count raise HistogramCountMismatchError."""
+        with pytest.raises(HistogramCountMismatchError) as exc_info:
+            LatencyHistogram(
+                count=3,
+                total_ns=30,
+                min_ns=10,
+                max_ns=10,
+                buckets=(LatencyBucket(lower_ns=10, upper_ns=11, count=2),),
+            )
+        assert exc_info.value.expected == 3
+        assert exc_info.value.actual == 2
+
+    def test_zero_count_raises(self) -> None:
+        """A histogram holds at least one call."""
+        with pytest.raises(InvalidCountError):
+            LatencyHistogram(count=0, total_ns=0, min_ns=0, max_ns=0, buckets=())
+
+    def test_min_above_max_raises(self) -> None:
+        """min_ns > max_ns raises InvalidDurationError."""
+        with pytest.raises(InvalidDurationError):
+            _histogram((10, 11, 1), min_ns=20, max_ns=10)
+
+    def test_mean_is_exact(self) -> None:
+        """mean_ns = total_ns / count."""
+        hist = LatencyHistogram(
+            count=4,
+            total_ns=10,
+            min_ns=1,
+            max_ns=4,
+            buckets=tuple(LatencyBucket(lower_ns=v, upper_ns=v + 1, count=1) for v in (1, 2, 3, 4)),
+        )
+        assert hist.mean_ns == 2.5
+
+    def test_percentiles(self) -> None:
+        """Percentile reports the upper edge of the bucket holding the rank."""
+        hist = _histogram((100, 104, 90), (1000, 1064, 9), (8000, 8512, 1), min_ns=100, max_ns=8200)
+
+        assert hist.percentile(0) == 100
+        assert hist.percentile(50) == 103
+        assert hist.percentile(90) == 103
+        assert hist.percentile(95) == 1063
+        assert hist.percentile(99.5) == 8200  # Clamped to max_ns
+        assert hist.percentile(100) == 8200
+
+    @pytest.mark.parametrize("q", [-1, 100.5])
+    def test_invalid_percentile_raises(self, q: float) -> None:
+        """q outside [0, 100] raises InvalidPercentileError."""
+        hist = _histogram((10, 11, 1), min_ns=10, max_ns=10)
+        with pytest.raises(InvalidPercentileError):
+            hist.percentile(q)
+
+
+class TestFunctionProfile:
+    """Tests for FunctionProfile and Profile."""
+
+    def test_matching_counts(self) -> None:
+        """Inclusive and exclusive histograms of the same calls."""
+        inclusive = _histogram((100, 104, 2), min_ns=100, max_ns=103)
+        exclusive = _histogram((10, 11, 2), min_ns=10, max_ns=10)
+        fn = FunctionProfile(
+            function=Location(file="a.py", line=1, func="work"),
+            inclusive=inclusive,
+            exclusive=exclusive,
+        )
+        profile = Profile(functions=(fn,), clock="monotonic")
+
+        assert profile.functions[0].exclusive.count == 2
+
+    def test_mismatched_counts_raise(self) -> None:
+        """Histograms of different call counts raise HistogramCountMismatchError."""
+        with pytest.raises(HistogramCountMismatchError):
+            FunctionProfile(
+                function=Location(file="a.py", line=1, func="work"),
+                inclusive=_histogram((100, 104, 2), min_ns=100, max_ns=103),
+                exclusive=_histogram((10, 11, 1), min_ns=10, max_ns=10),
+            )
@@ -0,0 +1,101 @@
+"""Tests for domain/stats.py.
+
+Tests:
+- DropCounts.total
+- TrackerStats derived values (recorded, memory_bytes, creation_map_load, hook_ns)
+- TrackerStats.to_prometheus()
+"""
+
+from archcheck.domain.events import EventType
+from archcheck.domain.stats import DropCounts, TrackerStats
+
+
+def _stats(*, creation_map_size: int = 30, creation_map_buckets: int = 64) -> TrackerStats:
+    return TrackerStats(
+        events={
+            EventType.CALL: 10,
+            EventType.RETURN: 9,
+            EventType.CREATE: 4,
+            EventType.DESTROY: 1,
+        },
+        dropped=DropCounts(oom=1, stopping=2, shm=3),
+        event_bytes=1000,
+        creation_map_bytes=200,
+        string_bytes=30,
+        stack_bytes=4,
+        creation_map_size=creation_map_size,
+        creation_map_buckets=creation_map_buckets,
+        strings=5,
+        stacks=6,
+        sites=0,
+        threads=2,
+        barrier_refused=7,
+        barrier_stops=1,
+        barrier_stop_wait_ns=500,
+        hook_samples=3,
+        hook_sampled_ns=150,
+        hook_sample_every=64,
+    )
+
+
+class TestDropCounts:
+    """Tests for DropCounts."""
+
+    def test_total_sums_reasons(self) -> None:
+        """total counts every reason."""
+        assert DropCounts(oom=1, stopping=2, shm=3).total == 6
+
+
+class TestTrackerStats:
+    """Tests for TrackerStats derived values."""
+
+    def test_recorded_sums_types(self) -> None:
+        """recorded counts every event type."""
+        assert _stats().recorded == 24
+
+    def test_memory_bytes_sums_tables(self) -> None:
+        """memory_bytes covers events, creation map, strings and stacks."""
+        assert _stats().memory_bytes == 1234
+
+    def test_creation_map_load(self) -> None:
+        """Load factor is entries per bucket."""
+        assert _stats(creation_map_size=32, creation_map_buckets=64).creation_map_load == 0.5
+
+    def test_creation_map_load_without_buckets(self) -> None:
+        """Empty map (no buckets) has load 0.0, not a division error."""
+        assert _stats(creation_map_size=0, creation_map_buckets=0).creation_map_load == 0.0
+
+    def test_hook_ns_extrapolates_sample(self) -> None:
+        """hook_ns scales sampled time by the sampling rate."""
+        assert _stats().hook_ns == 150 * 64
+
+
+class TestTrackerStatsPrometheus:
+    """Tests for TrackerStats.to_prometheus()."""
+
+    def test_labelled_counters(self) -> None:
+        """Events and drops are labelled counters."""
+        text = _stats().to_prometheus()
+
+        assert "# TYPE archcheck_tracker_events_total counter" in text
+        assert 'archcheck_tracker_events_total{type="CALL"} 10' in text
+        assert 'archcheck_tracker_dropped_total{reason="stopping"} 2' in text
+
+    def test_memory_gauges(self) -> None:
+        """Table sizes are gauges labelled by table."""
+        text = _stats().to_prometheus()
+
+        assert "# TYPE archcheck_tracker_memory_bytes gauge" in text
+        assert 'archcheck_tracker_memory_bytes{table="strings"} 30' in text
+
+    def test_prefix(self) -> None:
+        """Every metric name starts with the prefix."""
+        text = _stats().to_prometheus(prefix="app")
+        samples = [line for line in text.splitlines() if not line.startswith("#")]
+
+        assert samples
+        assert all(line.startswith("app_") for line in samples)
+
+    def test_ends_with_newline(self) -> None:
+        """Exposition format ends with a newline."""
+        assert _stats().to_prometheus().endswith("\n")
@@ -0,0 +1,80 @@
+"""Tests for domain/tasks.py.
+
+Tests:
+- TaskStats invariants (non-negative counts, at least one charge, own_ns >= 0)
+- TaskStats.net_allocated
+- TaskProfile.task(), slowest(), top_allocators()
+"""
+
+import pytest
+
+from archcheck.domain.exceptions import InvalidCountError, InvalidDurationError
+from archcheck.domain.tasks import NO_TASK, TaskProfile, TaskStats
+
+
+def _stats(task: int, own_ns: int = 100, allocated: int = 0, freed: int = 0) -> TaskStats:
+    return TaskStats(task=task, calls=1, own_ns=own_ns, allocated=allocated, freed=freed)
+
+
+def _profile(*tasks: TaskStats) -> TaskProfile:
+    return TaskProfile(tasks=tuple(sorted(tasks, key=lambda s: s.own_ns, reverse=True)))
+
+
+class TestTaskStats:
+    """Tests for TaskStats."""
+
+    def test_net_allocated(self) -> None:
+        """net_allocated may go negative: a task can free objects made elsewhere."""
+        assert _stats(1, allocated=5, freed=2).net_allocated == 3
+        assert _stats(1, allocated=0, freed=4).net_allocated == -4
+
+    def test_objects_only_is_valid(self) -> None:
+        """A task charged only objects (e.g. freed by GC) has no calls."""
+        stats = TaskStats(task=1, calls=0, own_ns=0, allocated=0, freed=1)
+
+        assert stats.calls == 0
+
+    def test_empty_raises(self) -> None:
+        """A row exists only once something was charged."""
+        with pytest.raises(InvalidCountError):
+            TaskStats(task=1, calls=0, own_ns=0, allocated=0, freed=0)
+
+    def test_negative_count_raises(self) -> None:
+        """Negative counters raise InvalidCountError with the value."""
+        with pytest.raises(InvalidCountError) as exc_info:
+            TaskStats(task=1, calls=1, own_ns=0, allocated=-1, freed=0)
+
+        assert exc_info.value.count == -1
+
+    def test_negative_time_raises(self) -> None:
+        """Negative own_ns raises InvalidDurationError."""
+        with pytest.raises(InvalidDurationError):
+            _stats(1, own_ns=-5)
+
+
+class TestTaskProfile:
+    """Tests for TaskProfile."""
+
+    def test_task_lookup(self) -> None:
+        """task() finds a task by id, None if never charged."""
+        profile = _profile(_stats(7), _stats(NO_TASK))
+
+        assert profile.task(7) == _stats(7)
+        assert profile.task(8) is None
+
+    def test_slowest_excludes_no_task(self) -> None:
+        """slowest() keeps the order of tasks, without work outside tasks."""
+        profile = _profile(_stats(NO_TASK, own_ns=900), _stats(1, own_ns=50), _stats(2, own_ns=70))
+
+        assert [s.task for s in profile.slowest(5)] == [2, 1]
+        assert [s.task for s in profile.slowest(1)] == [2]
+
+    def test_top_allocators(self) -> None:
+        """top_allocators() ranks by objects created, NO_TASK excluded."""
+        profile = _profile(
+            _stats(NO_TASK, allocated=1000),
+            _stats(1, own_ns=500, allocated=3),
+            _stats(2, own_ns=10, allocated=40),
+        )
+
+        assert [s.task for s in profile.top_allocators(2)] == [2, 1]
@@ -5,7 +5,8 @@ Tests:
 - Import resolution (absolute, relative)
 - Name resolution (direct, constructor)
 - Method resolution (self.method)
-- Super resolution (super().method)
+- Super resolution (super().method, along the MRO)
+- SymbolIndex (lookups, base class fallback, MRO, add/remove)
 - Attribute resolution (module.func)
 - Unresolved tracking (builtin, external, dynamic, undefined)
 """
@@ -21,7 +22,11 @@ from archcheck.domain.codebase import (
 )
 from archcheck.domain.events import Location
 from archcheck.domain.static_graph import CallType
-from archcheck.infrastructure.analyzers.call_resolver import resolve_calls
+from archcheck.infrastructure.analyzers.call_resolver import (
+    SymbolIndex,
+    resolve_calls,
+    resolve_module_calls,
+)
 
 
 def _make_location(line: int = 1) -> Location:
@@ -305,6 +310,26 @@ class TestMethodResolution:
         assert len(unresolved) == 1
         assert unresolved[0].reason == "self outside class"
 
+    def test_self_method_inherited(self) -> None:
+        """self.method() defined only in a base class → METHOD edge to it."""
+        base_method = _make_function("helper", "app.main", class_name="Base")
+        base_cls = _make_class("Base", "app.main", methods=(base_method,))
+        child_method = _make_function(
+            "run",
+            "app.main",
+            class_name="Child",
+            body_calls=("self.helper",),
+        )
+        child_cls = _make_class("Child", "app.main", methods=(child_method,), bases=("Base",))
+        module = _make_module("app.main", classes=(base_cls, child_cls))
+        codebase = Codebase(root_path=Path(), root_package="app", modules={"app.main": module})
+
+        edges, _unresolved = resolve_calls(module, codebase)
+
+        assert [(e.callee_fqn, e.call_type) for e in edges] == [
+            ("app.main.Base.helper", CallType.METHOD),
+        ]
+
 
 class TestSuperResolution:
     """Tests for super().method() resolution."""
@@ -366,6 +391,88 @@ class TestSuperResolution:
         assert len(unresolved) == 1
         assert unresolved[0].reason == "parent method not found"
 
+    def test_super_skips_parent_to_grandparent(self) -> None:
+        """Super().method() not defined in the parent resolves up the MRO."""
+        grand_method = _make_function("process", "app.main", class_name="Root")
+        grand_cls = _make_class("Root", "app.main", methods=(grand_method,))
+        parent_cls = _make_class("Base", "app.main", bases=("Root",))
+        child_method = _make_function(
+            "process",
+            "app.main",
+            class_name="Child",
+            body_calls=("super().process",),
+        )
+        child_cls = _make_class("Child", "app.main", methods=(child_method,), bases=("Base",))
+        module = _make_module("app.main", classes=(grand_cls, parent_cls, child_cls))
+        codebase = Codebase(root_path=Path(), root_package="app", modules={"app.main": module})
+
+        edges, _unresolved = resolve_calls(module, codebase)
+
+        assert [(e.callee_fqn, e.call_type) for e in edges] == [
+            ("app.main.Root.process", CallType.SUPER),
+        ]
+
+    def test_super_follows_c3_order(self) -> None:
+        """Diamond: Child(Left, Right), both from Root → Right before Root."""
+        root_cls = _make_class(
+            "Root",
+            "app.main",
+            methods=(_make_function("run", "app.main", class_name="Root"),),
+        )
+        left_cls = _make_class("Left", "app.main", bases=("Root",))
+        right_cls = _make_class(
+            "Right",
+            "app.main",
+            methods=(_make_function("run", "app.main", class_name="Right"),),
+            bases=("Root",),
+        )
+        child_method = _make_function(
+            "run",
+            "app.main",
+            class_name="Child",
+            body_calls=("super().run",),
+        )
+        child_cls = _make_class(
+            "Child",
+            "app.main",
+            methods=(child_method,),
+            bases=("Left", "Right"),
+        )
+        module = _make_module("app.main", classes=(root_cls, left_cls, right_cls, child_cls))
+        codebase = Codebase(root_path=Path(), root_package="app", modules={"app.main": module})
+
+        edges, _unresolved = resolve_calls(module, codebase)
+
+        assert [e.callee_fqn for e in edges] == ["app.main.Right.run"]
+
+    def test_super_base_imported_from_other_module(self) -> None:
+        """Base class imported from another module resolves via that module."""
+        base_method = _make_function("save", "app.base", class_name="Model")
+        base_module = _make_module(
+            "app.base",
+            classes=(_make_class("Model", "app.base", methods=(base_method,)),),
+        )
+        child_method = _make_function(
+            "save",
+            "app.user",
+            class_name="User",
+            body_calls=("super().save",),
+        )
+        module = _make_module(
+            "app.user",
+            imports=(Import("app.base", "Model", None, is_relative=False, level=0),),
+            classes=(_make_class("User", "app.user", methods=(child_method,), bases=("Model",)),),
+        )
+        codebase = Codebase(
+            root_path=Path(),
+            root_package="app",
+            modules={"app.base": base_module, "app.user": module},
+        )
+
+        edges, _unresolved = resolve_calls(module, codebase)
+
+        assert [e.callee_fqn for e in edges] == ["app.base.Model.save"]
+
 
 class TestAttributeResolution:
     """Tests for module.func() resolution."""
@@ -500,3 +607,85 @@ class TestUnresolvedReasons:
         assert len(unresolved) == 1
         assert unresolved[0].callee_name == "get"
         assert unresolved[0].reason == "external"
+
+
+class TestSymbolIndex:
+    """Tests for SymbolIndex."""
+
+    def test_lookups(self) -> None:
+        """Functions and classes by FQN, modules by name."""
+        module = _make_module(
+            "app.main",
+            functions=(_make_function("foo", "app.main"),),
+            classes=(_make_class("Foo", "app.main"),),
+        )
+        index = SymbolIndex((module,))
+
+        assert index.module("app.main") is module
+        assert index.function("app.main.foo") is module.functions[0]
+        assert index.get_class("app.main.Foo") is module.classes[0]
+        assert index.function("app.main.Foo") is None
+        assert index.get_class("app.other.Foo") is None
+
+    def test_first_class_named_in_module_order(self) -> None:
+        """Short-name fallback picks the first module that defines the class."""
+        first = _make_module("app.b", classes=(_make_class("Base", "app.b"),))
+        second = _make_module("app.a", classes=(_make_class("Base", "app.a"),))
+        index = SymbolIndex((first, second))
+
+        assert index.first_class_named("Base") == "app.b.Base"
+        assert index.first_class_named("Missing") is None
+
+    def test_mro_cycle_terminates(self) -> None:
+        """Cyclic bases end the MRO instead of recursing."""
+        module = _make_module(
+            "app.main",
+            classes=(
+                _make_class("A", "app.main", bases=("B",)),
+                _make_class("B", "app.main", bases=("A",)),
+            ),
+        )
+        index = SymbolIndex((module,))
+
+        assert [cls.name for cls in index.mro("app.main.A")] == ["B"]
+
+    def test_add_and_remove_update_lookups(self) -> None:
+        """Replacing a module keeps its place; removing drops its definitions."""
+        old = _make_module("app.a", classes=(_make_class("Base", "app.a"),))
+        other = _make_module("app.b", classes=(_make_class("Base", "app.b"),))
+        index = SymbolIndex((old, other))
+        base_method = _make_function("run", "app.a", class_name="Base")
+        new = _make_module(
+            "app.a",
+            classes=(_make_class("Base", "app.a", methods=(base_method,)),),
+        )
+
+        index.add(new)
+        assert index.get_class("app.a.Base") is new.classes[0]
+        assert index.first_class_named("Base") == "app.a.Base"
+
+        index.remove("app.a")
+        assert index.module("app.a") is None
+        assert index.get_class("app.a.Base") is None
+        assert index.first_class_named("Base") == "app.b.Base"
+
+    def test_resolve_module_calls_matches_resolve_calls(self) -> None:
+        """One shared index gives the same result as a per-call index."""
+        helper = _make_function("helper", "app.util")
+        util = _make_module("app.util", functions=(helper,))
+        caller = _make_function("main", "app.main", body_calls=("util.helper", "print"))
+        main = _make_module(
+            "app.main",
+            imports=(Import("app.util", None, "util", is_relative=False, level=0),),
+            functions=(caller,),
+        )
+        codebase = Codebase(
+            root_path=Path(),
+            root_package="app",
+            modules={"app.util": util, "app.main": main},
+        )
+
+        assert resolve_module_calls(main, SymbolIndex.of(codebase)) == resolve_calls(
+            main,
+            codebase,
+        )
@@ -0,0 +1,100 @@
+"""Tests for on-disk parse cache.
+
+Tests:
+- ParseCache.key(): depends on fingerprint, module name and source
+- ParseCache.load()/store(): round trip, miss, path rewrite, bad entry
+"""
+
+from __future__ import annotations
+
+import pickle
+from pathlib import Path
+
+import pytest
+
+from archcheck.domain.codebase import Module
+from archcheck.domain.exceptions import ConversionError
+from archcheck.infrastructure.parse_cache import ParseCache
+
+
+def _module(path: Path) -> Module:
+    return Module(
+        name="app.main",
+        path=path,
+        imports=(),
+        classes=(),
+        functions=(),
+        docstring="Main.",
+    )
+
+
+class TestParseCacheKey:
+    """Tests for ParseCache.key()."""
+
+    def test_same_input_same_key(self, tmp_path: Path) -> None:
+        """Key is deterministic."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        assert cache.key("app.main", b"pass") == cache.key("app.main", b"pass")
+
+    def test_source_changes_key(self, tmp_path: Path) -> None:
+        """Different source, different entry."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        assert cache.key("app.main", b"pass") != cache.key("app.main", b"pass\n")
+
+    def test_module_name_changes_key(self, tmp_path: Path) -> None:
+        """Same source under another module name is another entry."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        assert cache.key("app.main", b"pass") != cache.key("app.other", b"pass")
+
+    def test_fingerprint_changes_key(self, tmp_path: Path) -> None:
+        """Entries of another archcheck/Python version are not reused."""
+        old = ParseCache(directory=tmp_path, fingerprint="v1")
+        new = ParseCache(directory=tmp_path, fingerprint="v2")
+        assert old.key("app.main", b"pass") != new.key("app.main", b"pass")
+
+    def test_parts_not_ambiguous(self, tmp_path: Path) -> None:
+        """Moving bytes between module name and source changes the key."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        assert cache.key("ab", b"c") != cache.key("a", b"bc")
+
+
+class TestParseCacheEntries:
+    """Tests for ParseCache.load() and store()."""
+
+    def test_miss_returns_none(self, tmp_path: Path) -> None:
+        """Unknown key is a miss."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        assert cache.load(cache.key("app.main", b"pass"), tmp_path / "main.py") is None
+
+    def test_round_trip(self, tmp_path: Path) -> None:
+        """Stored Module loads back equal."""
+        cache = ParseCache(directory=tmp_path / "cache", fingerprint="v1")
+        path = tmp_path / "app" / "main.py"
+        key = cache.key("app.main", b"pass")
+
+        cache.store(key, _module(path))
+
+        assert cache.load(key, path) == _module(path)
+        assert not list((tmp_path / "cache").rglob("*.tmp"))
+
+    def test_load_sets_current_path(self, tmp_path: Path) -> None:
+        """Entry written for one checkout loads with the caller's path."""
+        cache = ParseCache(directory=tmp_path / "cache", fingerprint="v1")
+        key = cache.key("app.main", b"pass")
+        cache.store(key, _module(tmp_path / "old" / "main.py"))
+
+        loaded = cache.load(key, tmp_path / "new" / "main.py")
+
+        assert loaded is not None
+        assert loaded.path == tmp_path / "new" / "main.py"
+
+    def test_foreign_entry_raises(self, tmp_path: Path) -> None:
+        """Entry holding something else than a Module fails loudly."""
+        cache = ParseCache(directory=tmp_path, fingerprint="v1")
+        key = cache.key("app.main", b"pass")
+        entry = tmp_path / key[:2] / f"{key}.pickle"
+        entry.parent.mkdir()
+        entry.write_bytes(pickle.dumps({"not": "a module"}))
+
+        with pytest.raises(ConversionError):
+            cache.load(key, tmp_path / "main.py")
@@ -0,0 +1,268 @@
+"""Tests for binary trace file reader.
+
+Files are built with struct in the layout of c/tracking/tracefile.h,
+so the reader is tested without the C extension.
+"""
+
+from __future__ import annotations
+
+import struct
+from typing import TYPE_CHECKING
+
+import pytest
+
+from archcheck.domain.events import CallEvent, CreateEvent, DestroyEvent, ReturnEvent
+from archcheck.domain.exceptions import TraceFormatError
+from archcheck.infrastructure.tracefile import (
+    TraceReader,
+    child_trace_paths,
+    merge_traces,
+    read_trace,
+)
+
+if TYPE_CHECKING:
+    from pathlib import Path
+
+_HEADER = struct.Struct("<8sIII12x")
+_RECORD = struct.Struct("<BBHiQQIIIiII")
+_FOOTER = struct.Struct("<QQQQQ8s")
+
+CALL, RETURN, CREATE, DESTROY = 0, 1, 2, 3
+ARG, CREATION, FRAME, ERROR = 16, 17, 18, 19
+HAS_CALLER, HAS_VALUE = 1, 2
+
+
+def _record(
+    kind: int,
+    *,
+    flags: int = 0,
+    extra: int = 0,
+    line: int = 0,
+    seq: int = 0,
+    obj_id: int = 0,
+    file: int = 0,
+    func: int = 0,
+    type_id: int = 0,
+    caller: tuple[int, int, int] = (0, 0, 0),
+) -> bytes:
+    """Pack one record. caller = (line, file, func)."""
+    return _RECORD.pack(kind, flags, extra, line, seq, obj_id, file, func, type_id, *caller)
+
+
+def _write_trace(
+    path: Path,
+    records: list[bytes],
+    strings: list[str],
+    *,
+    event_count: int,
+    version: int = 1,
+    footer_magic: bytes = b"ARCHEND\0",
+) -> None:
+    """Write header, records, strings (ids 1..n), padding and footer."""
+    header = _HEADER.pack(b"ARCHTRC\0", version, _RECORD.size, 0x01020304)
+    body = b"".join(records)
+    section = b"".join(struct.pack("<I", len(s.encode())) + s.encode() for s in strings)
+    section += b"\0" * (-len(section) % 8)
+    strings_offset = _HEADER.size + len(body)
+    footer = _FOOTER.pack(
+        _HEADER.size, len(records), event_count, strings_offset, len(strings), footer_magic
+    )
+    path.write_bytes(header + body + section + footer)
+
+
+# String ids used below
+APP, HANDLER, MAIN, REQ, DICT, WIDGET = 1, 2, 3, 4, 5, 6
+STRINGS = ["app.py", "handler", "main", "req", "dict", "Widget"]
+
+
+class TestTraceReader:
+    """Tests for decoding valid trace files."""
+
+    def test_empty_trace(self, tmp_path: Path) -> None:
+        """Trace without events has len 0 and yields nothing."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [], [], event_count=0)
+
+        with TraceReader(path) as trace:
+            assert len(trace) == 0
+            assert list(trace) == []
+
+    def test_call_with_args_errors_and_caller(self, tmp_path: Path) -> None:
+        """CALL aux records become args and errors."""
+        path = tmp_path / "t.bin"
+        records = [
+            _record(
+                CALL,
+                flags=HAS_CALLER,
+                extra=2,
+                line=10,
+                file=APP,
+                func=HANDLER,
+                caller=(3, APP, MAIN),
+            ),
+            _record(ARG, obj_id=0x10, func=REQ, type_id=DICT),
+            _record(ERROR, file=REQ, func=HANDLER, type_id=DICT),
+        ]
+        _write_trace(path, records, STRINGS, event_count=1)
+
+        (event,) = read_trace(path)
+
+        assert isinstance(event, CallEvent)
+        assert event.location.file == "app.py"
+        assert event.location.line == 10
+        assert event.caller is not None
+        assert event.caller.func == "main"
+        assert event.args[0].name == "req"
+        assert event.args[0].obj_id == 0x10
+        assert event.args[0].type_name == "dict"
+        assert event.errors[0].field == "req"
+        assert event.errors[0].exc_type == "dict"
+        assert event.errors[0].exc_msg == "handler"
+
+    def test_return_with_and_without_value(self, tmp_path: Path) -> None:
+        """RETURN value fields only with HAS_VALUE flag."""
+        path = tmp_path / "t.bin"
+        records = [
+            _record(RETURN, flags=HAS_VALUE, obj_id=0x20, type_id=WIDGET, file=APP, func=HANDLER),
+            _record(RETURN, file=APP, func=HANDLER),
+        ]
+        _write_trace(path, records, STRINGS, event_count=2)
+
+        with_value, without_value = read_trace(path)
+
+        assert isinstance(with_value, ReturnEvent)
+        assert with_value.return_id == 0x20
+        assert with_value.return_type == "Widget"
+        assert isinstance(without_value, ReturnEvent)
+        assert without_value.return_id is None
+        assert without_value.return_type is None
+
+    def test_create_and_destroy_with_creation(self, tmp_path: Path) -> None:
+        """DESTROY CREATION + FRAME aux records become CreationInfo."""
+        path = tmp_path / "t.bin"
+        records = [
+            _record(CREATE, obj_id=0x30, type_id=WIDGET, line=11, file=APP, func=HANDLER),
+            _record(DESTROY, extra=3, obj_id=0x30, type_id=WIDGET),
+            _record(CREATION, extra=2, line=11, file=APP, func=HANDLER, type_id=WIDGET),
+            _record(FRAME, line=11, file=APP, func=HANDLER),
+            _record(FRAME, line=3, file=APP, func=MAIN),
+        ]
+        _write_trace(path, records, STRINGS, event_count=2)
+
+        create, destroy = read_trace(path)
+
+        assert isinstance(create, CreateEvent)
+        assert create.type_name == "Widget"
+        assert isinstance(destroy, DestroyEvent)
+        assert destroy.location.file is None
+        assert destroy.creation is not None
+        assert destroy.creation.location == create.location
+        assert [f.func for f in destroy.creation.traceback] == ["handler", "main"]
+
+    def test_repeated_locations_shared(self, tmp_path: Path) -> None:
+        """Identical locations decode to the same Location object."""
+        path = tmp_path / "t.bin"
+        record = _record(RETURN, line=5, file=APP, func=HANDLER)
+        _write_trace(path, [record, record], STRINGS, event_count=2)
+
+        first, second = read_trace(path)
+
+        assert first.location is second.location
+
+    def test_iteration_repeatable(self, tmp_path: Path) -> None:
+        """Each iteration decodes all events again."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [_record(RETURN, file=APP)], STRINGS, event_count=1)
+
+        with TraceReader(path) as trace:
+            assert list(trace) == list(trace)
+
+
+class TestMergeTraces:
+    """Tests for child_trace_paths() and merge_traces()."""
+
+    def test_child_trace_paths(self, tmp_path: Path) -> None:
+        """Only <path>.<pid>[.<pid>...] files, parent excluded, sorted."""
+        for name in ("t.bin", "t.bin.12", "t.bin.12.34", "t.bin.7", "t.bin.tmp", "t.bin.1x"):
+            (tmp_path / name).write_bytes(b"")
+
+        paths = child_trace_paths(tmp_path / "t.bin")
+
+        assert paths == tuple(str(tmp_path / n) for n in ("t.bin.12", "t.bin.12.34", "t.bin.7"))
+
+    def test_merge_keeps_file_order(self, tmp_path: Path) -> None:
+        """Events of each file in turn, no output errors."""
+        first, second = tmp_path / "a.bin", tmp_path / "b.bin"
+        _write_trace(first, [_record(RETURN, file=APP, func=HANDLER)], STRINGS, event_count=1)
+        _write_trace(
+            second,
+            [_record(RETURN, file=APP, func=MAIN), _record(RETURN, file=APP, func=REQ)],
+            STRINGS,
+            event_count=2,
+        )
+
+        result = merge_traces([first, second])
+
+        assert [e.location.func for e in result.events] == ["handler", "main", "req"]
+        assert result.output_errors == ()
+
+    def test_incomplete_worker_trace_raises(self, tmp_path: Path) -> None:
+        """A worker that never called stop() left no footer."""
+        good, bad = tmp_path / "a.bin", tmp_path / "b.bin"
+        _write_trace(good, [], [], event_count=0)
+        bad.write_bytes(_HEADER.pack(b"ARCHTRC\0", 1, _RECORD.size, 0x01020304) + b"\0" * 64)
+
+        with pytest.raises(TraceFormatError):
+            merge_traces([good, bad])
+
+
+class TestTraceReaderFailFirst:
+    """Tests for FAIL-FIRST on malformed files."""
+
+    def test_too_small(self, tmp_path: Path) -> None:
+        """File shorter than header + footer."""
+        path = tmp_path / "t.bin"
+        path.write_bytes(b"ARCHTRC\0")
+
+        with pytest.raises(TraceFormatError, match="too small"):
+            TraceReader(path)
+
+    def test_incomplete_trace_no_footer(self, tmp_path: Path) -> None:
+        """Writer never closed: footer magic missing."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [], [], event_count=0, footer_magic=b"\0" * 8)
+
+        with pytest.raises(TraceFormatError, match="footer"):
+            TraceReader(path)
+
+    def test_unsupported_version(self, tmp_path: Path) -> None:
+        """Future format versions are rejected."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [], [], event_count=0, version=99)
+
+        with pytest.raises(TraceFormatError, match="version"):
+            TraceReader(path)
+
+    def test_unknown_record_kind(self, tmp_path: Path) -> None:
+        """Unknown primary kind raises on iteration."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [_record(42)], [], event_count=1)
+
+        with pytest.raises(TraceFormatError, match="kind"):
+            list(read_trace(path))
+
+    def test_truncated_aux_records(self, tmp_path: Path) -> None:
+        """CALL promising more aux records than present."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [_record(CALL, extra=1)], [], event_count=1)
+
+        with pytest.raises(TraceFormatError, match="truncated"):
+            list(read_trace(path))
+
+    def test_string_id_out_of_range(self, tmp_path: Path) -> None:
+        """Reference to a string that is not in the section."""
+        path = tmp_path / "t.bin"
+        _write_trace(path, [_record(RETURN, file=7)], [], event_count=1)
+
+        with pytest.raises(TraceFormatError, match="string id"):
+            list(read_trace(path))